@@ -0,0 +1,60 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declares futex wrappers used by the threading primitives
+
+#include <atomic>
+
+// Use the compiler-defined macro rather than PLATFORM_LINUX/PLATFORM_ANDROID so that the
+// value is the same in every translation unit: inline functions of SpinLock depend on it.
+#if defined(__linux__)
+#    define DILIGENT_FUTEX_SUPPORTED 1
+#else
+#    define DILIGENT_FUTEX_SUPPORTED 0
+#endif
+
+namespace Threading
+{
+
+#if DILIGENT_FUTEX_SUPPORTED
+
+/// Blocks the calling thread while the value of Word is equal to Expected.
+/// The comparison and blocking are performed atomically by the kernel.
+/// The function may return spuriously, so the caller must re-check the condition.
+void FutexWait(std::atomic<int>& Word, int Expected) noexcept;
+
+/// Wakes up at most one thread blocked in FutexWait() on Word.
+void FutexWakeOne(std::atomic<int>& Word) noexcept;
+
+/// Wakes up all threads blocked in FutexWait() on Word.
+void FutexWakeAll(std::atomic<int>& Word) noexcept;
+
+#endif
+
+} // namespace Threading
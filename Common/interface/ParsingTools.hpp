@@ -38,6 +38,8 @@
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/FlagEnum.h"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../Platforms/interface/PlatformMisc.hpp"
+#include "../../Platforms/interface/Intrinsics.hpp"
 #include "StringTools.h"
 
 namespace Diligent
@@ -271,6 +273,157 @@ IteratorType SkipDelimitersAndComments(const IteratorType& Start,
 }
 
 
+namespace Detail
+{
+
+inline bool IsAnyOf(Char /*Symbol*/) noexcept
+{
+    return false;
+}
+
+template <typename... RestCharsType>
+bool IsAnyOf(Char Symbol, Char First, RestCharsType... Rest) noexcept
+{
+    return Symbol == First || IsAnyOf(Symbol, Rest...);
+}
+
+#if DILIGENT_SSE2_ENABLED
+inline __m128i CmpEqAnyOf(__m128i /*Block*/) noexcept
+{
+    return _mm_setzero_si128();
+}
+
+template <typename... RestCharsType>
+__m128i CmpEqAnyOf(__m128i Block, Char First, RestCharsType... Rest) noexcept
+{
+    return _mm_or_si128(_mm_cmpeq_epi8(Block, _mm_set1_epi8(First)), CmpEqAnyOf(Block, Rest...));
+}
+#endif
+
+} // namespace Detail
+
+
+/// Finds the first occurrence of any of the given characters.
+
+/// \param[in] Start - starting position.
+/// \param[in] End   - end of the input string.
+/// \param[in] Chars - characters to look for.
+///
+/// \return     position of the first character that matches any of Chars,
+///             or End if there is no such character.
+///
+/// \remarks    When SSE2 is available, the function tests 16 characters at a time.
+///             Unlike the iterator-based functions above, it does not stop at the
+///             null character unless '\0' is one of Chars.
+template <typename... CharsType>
+const Char* FindFirstOf(const Char* Start, const Char* End, CharsType... Chars) noexcept
+{
+    static_assert(sizeof...(Chars) > 0, "At least one character is expected");
+
+    auto Pos = Start;
+#if DILIGENT_SSE2_ENABLED
+    while (End - Pos >= 16)
+    {
+        const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos));
+        const Uint32  Mask  = static_cast<Uint32>(_mm_movemask_epi8(Detail::CmpEqAnyOf(Block, static_cast<Char>(Chars)...)));
+        if (Mask != 0)
+            return Pos + PlatformMisc::GetLSB(Mask);
+        Pos += 16;
+    }
+#endif
+    while (Pos != End && !Detail::IsAnyOf(*Pos, static_cast<Char>(Chars)...))
+        ++Pos;
+    return Pos;
+}
+
+
+/// Finds the end of the line starting from the given position.
+
+/// \param[in] Start - starting position.
+/// \param[in] End   - end of the input string.
+///
+/// \return     position of the first new line or null character, or End.
+///             This is the same position that SkipLine(Start, End, false) returns.
+inline const Char* FindLineEnd(const Char* Start, const Char* End) noexcept
+{
+    return FindFirstOf(Start, End, '\n', '\r', '\0');
+}
+
+
+/// Finds the start of the next comment starting from the given position.
+
+/// \param[in] Start - starting position.
+/// \param[in] End   - end of the input string.
+///
+/// \return     position of the first '/' that starts a single-line or
+///             a multi-line comment, or End if there are no comments.
+inline const Char* FindCommentStart(const Char* Start, const Char* End) noexcept
+{
+    auto Pos = Start;
+    while ((Pos = FindFirstOf(Pos, End, '/')) != End)
+    {
+        if (Pos + 1 != End && (Pos[1] == '/' || Pos[1] == '*'))
+            return Pos;
+        ++Pos;
+    }
+    return End;
+}
+
+
+/// Finds the next '#' character that is not part of a comment.
+
+/// \param[in] Start - starting position. Must not be inside a comment.
+/// \param[in] End   - end of the input string.
+///
+/// \return     position of the first '#' outside of comments, or End.
+///
+/// \remarks    The function skips comments the same way as SkipDelimitersAndComments
+///             does, but looks for the '#' and '/' characters 16 at a time when SSE2
+///             is available instead of testing every character.
+///
+///             If a multi-line comment is not closed, the function throws an exception
+///             of type std::pair<const Char*, const char*>, where first is the position
+///             of the comment start, and second is the error description.
+inline const Char* FindNextHash(const Char* Start, const Char* End) noexcept(false)
+{
+    auto Pos = Start;
+    while ((Pos = FindFirstOf(Pos, End, '#', '/')) != End)
+    {
+        if (*Pos == '#')
+            return Pos;
+
+        const auto* CommentStart = Pos++;
+        if (Pos == End)
+            break;
+
+        if (*Pos == '/')
+        {
+            // Single-line comment
+            Pos = FindLineEnd(Pos + 1, End);
+        }
+        else if (*Pos == '*')
+        {
+            // Multi-line comment
+            ++Pos;
+            while (true)
+            {
+                Pos = FindFirstOf(Pos, End, '*', '\0');
+                if (Pos == End || *Pos == '\0')
+                    throw std::pair<const Char*, const char*>{CommentStart, "Unable to find the end of the multiline comment."};
+
+                ++Pos;
+                if (Pos != End && *Pos == '/')
+                {
+                    ++Pos;
+                    break;
+                }
+            }
+        }
+    }
+    return End;
+}
+
+
 /// Skips one identifier starting from the given position.
 
 /// \param[in] Start - starting position.
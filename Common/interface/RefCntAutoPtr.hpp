@@ -313,7 +313,7 @@ public:
     {
         if (m_pObject)
         {
-            m_pRefCounters = ClassPtrCast<RefCountersImpl>(m_pObject->GetReferenceCounters());
+            m_pRefCounters = m_pObject->GetReferenceCounters();
             m_pRefCounters->AddWeakRef();
         }
     }
@@ -340,7 +340,7 @@ public:
     }
 
     explicit RefCntWeakPtr(RefCntAutoPtr<T>& AutoPtr) noexcept :
-        m_pRefCounters{AutoPtr ? ClassPtrCast<RefCountersImpl>(AutoPtr->GetReferenceCounters()) : nullptr},
+        m_pRefCounters{AutoPtr ? AutoPtr->GetReferenceCounters() : nullptr},
         m_pObject{static_cast<T*>(AutoPtr)}
     {
         if (m_pRefCounters)
@@ -382,7 +382,7 @@ public:
     {
         Release();
         m_pObject      = static_cast<T*>(AutoPtr);
-        m_pRefCounters = m_pObject ? ClassPtrCast<RefCountersImpl>(m_pObject->GetReferenceCounters()) : nullptr;
+        m_pRefCounters = m_pObject ? m_pObject->GetReferenceCounters() : nullptr;
         if (m_pRefCounters)
             m_pRefCounters->AddWeakRef();
         return *this;
@@ -442,7 +442,9 @@ public:
     bool operator!=(const RefCntWeakPtr& Ptr) const noexcept { return m_pRefCounters != Ptr.m_pRefCounters; }
 
 protected:
-    RefCountersImpl* m_pRefCounters = nullptr;
+    // The counters type depends on the threading mode of the object,
+    // which is not known for interface types.
+    IReferenceCounters* m_pRefCounters = nullptr;
     // We need to store raw pointer to object itself,
     // because if the object is owned by another object,
     // m_pRefCounters->QueryObject(&pObj) will return
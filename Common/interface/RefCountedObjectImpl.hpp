@@ -32,6 +32,7 @@
 
 #include <stdlib.h>
 #include <atomic>
+#include <type_traits>
 
 #include "../../Primitives/interface/Object.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
@@ -42,7 +43,24 @@
 namespace Diligent
 {
 
-// This class controls the lifetime of a refcounted object
+/// Reference counters threading mode
+enum class RefCountersThreading : Uint8
+{
+    /// Reference counters may be accessed from any thread at any time.
+    /// All counter updates use atomic read-modify-write operations.
+    MultiThreaded,
+
+    /// All references to the object (strong and weak) are owned and
+    /// manipulated by one thread at a time. Counters are updated with
+    /// plain loads and stores, and the internal lock is not used.
+    /// Handing the object over to another thread requires external synchronization.
+    ThreadConfined
+};
+
+// This class controls the lifetime of a refcounted object.
+// The threading mode is a template parameter, so the default multi-threaded
+// counters do not branch on it.
+template <RefCountersThreading ThreadingMode = RefCountersThreading::MultiThreaded>
 class RefCountersImpl final : public IReferenceCounters
 {
 public:
@@ -50,7 +68,7 @@ public:
     {
         VERIFY(m_ObjectState.load() == ObjectState::Alive, "Attempting to increment strong reference counter for a destroyed or not initialized object!");
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
-        return m_NumStrongReferences.fetch_add(+1) + 1;
+        return IncrementCounter(m_NumStrongReferences, +1);
     }
 
     template <class TPreObjectDestroy>
@@ -60,7 +78,7 @@ public:
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
 
         // Decrement strong reference counter without acquiring the lock.
-        const auto RefCount = m_NumStrongReferences.fetch_add(-1) - 1;
+        const auto RefCount = IncrementCounter(m_NumStrongReferences, -1);
         VERIFY(RefCount >= 0, "Inconsistent call to ReleaseStrongRef()");
         if (RefCount == 0)
         {
@@ -78,19 +96,19 @@ public:
 
     inline virtual ReferenceCounterValueType AddWeakRef() override final
     {
-        return m_NumWeakReferences.fetch_add(+1) + 1;
+        return IncrementCounter(m_NumWeakReferences, +1);
     }
 
     inline virtual ReferenceCounterValueType ReleaseWeakRef() override final
     {
         // The method must be serialized!
-        std::unique_lock<Threading::SpinLock> Guard{m_Lock};
+        auto Guard = Lock();
 
         // It is essentially important to check the number of weak references
         // while holding the lock. Otherwise reference counters object
         // may be destroyed twice if ReleaseStrongRef() is executed by other
         // thread.
-        const auto NumWeakReferences = m_NumWeakReferences.fetch_add(-1) - 1;
+        const auto NumWeakReferences = IncrementCounter(m_NumWeakReferences, -1);
         VERIFY(NumWeakReferences >= 0, "Inconsistent call to ReleaseWeakRef()");
 
         // There are two special case when we must not destroy the ref counters object even
@@ -148,7 +166,7 @@ public:
             // We can safely unlock it and destroy.
             // If we do not unlock it, this->m_LockFlag will expire,
             // which will cause Lock.~LockHelper() to crash.
-            Guard.unlock();
+            Unlock(Guard);
             SelfDestroy();
         }
         return NumWeakReferences;
@@ -175,9 +193,9 @@ public:
         //    Destroy the object               |                                   | -Return reference to the soon
         //                                     |                                   |  to expire object
         //
-        Threading::SpinLockGuard Guard{m_Lock};
+        auto Guard = Lock();
 
-        const auto StrongRefCnt = m_NumStrongReferences.fetch_add(+1) + 1;
+        const auto StrongRefCnt = IncrementCounter(m_NumStrongReferences, +1);
 
         // Checking if m_ObjectState == ObjectState::Alive only is not reliable:
         //
@@ -202,7 +220,7 @@ public:
             auto* pWrapper = reinterpret_cast<ObjectWrapperBase*>(m_ObjectWrapperBuffer);
             pWrapper->QueryInterface(IID_Unknown, ppObject);
         }
-        m_NumStrongReferences.fetch_add(-1);
+        IncrementCounter(m_NumStrongReferences, -1);
     }
 
     inline virtual ReferenceCounterValueType GetNumStrongRefs() const override final
@@ -215,6 +233,11 @@ public:
         return m_NumWeakReferences.load();
     }
 
+    static constexpr RefCountersThreading GetThreading()
+    {
+        return ThreadingMode;
+    }
+
 private:
     template <typename AllocatorType, typename ObjectType>
     friend class MakeNewRCObj;
@@ -223,6 +246,59 @@ private:
     {
     }
 
+    using IsThreadConfined = std::integral_constant<bool, ThreadingMode == RefCountersThreading::ThreadConfined>;
+
+    // Adds Delta to the counter and returns the new value.
+    static inline ReferenceCounterValueType IncrementCounter(std::atomic<ReferenceCounterValueType>& Counter, ReferenceCounterValueType Delta)
+    {
+        return IncrementCounter(Counter, Delta, IsThreadConfined{});
+    }
+
+    static inline ReferenceCounterValueType IncrementCounter(std::atomic<ReferenceCounterValueType>& Counter, ReferenceCounterValueType Delta, std::false_type)
+    {
+        return Counter.fetch_add(Delta) + Delta;
+    }
+
+    static inline ReferenceCounterValueType IncrementCounter(std::atomic<ReferenceCounterValueType>& Counter, ReferenceCounterValueType Delta, std::true_type)
+    {
+        // Plain load and store compile to regular moves, no lock-prefixed instructions
+        const auto NewValue = Counter.load(std::memory_order_relaxed) + Delta;
+        Counter.store(NewValue, std::memory_order_relaxed);
+        return NewValue;
+    }
+
+    std::unique_lock<Threading::SpinLock> Lock()
+    {
+        return Lock(IsThreadConfined{});
+    }
+
+    std::unique_lock<Threading::SpinLock> Lock(std::false_type)
+    {
+        return std::unique_lock<Threading::SpinLock>{m_Lock};
+    }
+
+    // Thread-confined counters are never accessed concurrently, so the lock is not needed.
+    std::unique_lock<Threading::SpinLock> Lock(std::true_type)
+    {
+        return std::unique_lock<Threading::SpinLock>{m_Lock, std::defer_lock};
+    }
+
+    static void Unlock(std::unique_lock<Threading::SpinLock>& Guard)
+    {
+        Unlock(Guard, IsThreadConfined{});
+    }
+
+    static void Unlock(std::unique_lock<Threading::SpinLock>& Guard, std::false_type)
+    {
+        Guard.unlock();
+    }
+
+    static void Unlock(std::unique_lock<Threading::SpinLock>& Guard, std::true_type)
+    {
+        // The lock was deferred and never acquired
+        VERIFY_EXPR(!Guard.owns_lock());
+    }
+
     class ObjectWrapperBase
     {
     public:
@@ -362,7 +438,7 @@ private:
 #endif
 
         // Acquire the lock.
-        std::unique_lock<Threading::SpinLock> Guard{m_Lock};
+        auto Guard = Lock();
 
         // QueryObject() first acquires the lock, and only then increments and
         // decrements the ref counter. If it reads 1 after incrementing the counter,
@@ -436,7 +512,7 @@ private:
             // We must explicitly unlock the object now to avoid deadlocks. Also,
             // if this is deleted, this->m_LockFlag will expire, which will cause
             // Lock.~LockHelper() to crash
-            Guard.unlock();
+            Unlock(Guard);
 
             // Destroy referenced object
             pWrapper->DestroyObject();
@@ -494,15 +570,22 @@ private:
 
 
 /// Base class for all reference counting objects
-template <typename Base>
+
+/// Objects whose strong and weak references are only ever manipulated by one thread
+/// at a time may use RefCountersThreading::ThreadConfined as ThreadingMode.
+/// Objects that share reference counters with their owner (see MakeNewRCObj)
+/// must use the same threading mode as the owner.
+template <typename Base, RefCountersThreading ThreadingMode = RefCountersThreading::MultiThreaded>
 class RefCountedObject : public Base
 {
 public:
+    using RefCountersType = RefCountersImpl<ThreadingMode>;
+
     template <typename... BaseCtorArgTypes>
     RefCountedObject(IReferenceCounters* pRefCounters, BaseCtorArgTypes&&... BaseCtorArgs) noexcept :
         // clang-format off
         Base          {std::forward<BaseCtorArgTypes>(BaseCtorArgs)...},
-        m_pRefCounters{ClassPtrCast<RefCountersImpl>(pRefCounters)   }
+        m_pRefCounters{ClassPtrCast<RefCountersType>(pRefCounters)   }
     // clang-format on
     {
         // If object is allocated on stack, ref counters will be null
@@ -567,6 +650,7 @@ protected:
     template <typename AllocatorType, typename ObjectType>
     friend class MakeNewRCObj;
 
+    template <RefCountersThreading>
     friend class RefCountersImpl;
 
 
@@ -603,7 +687,7 @@ private:
     // Note that the type of the reference counters is RefCountersImpl,
     // not IReferenceCounters. This avoids virtual calls from
     // AddRef() and Release() methods
-    RefCountersImpl* const m_pRefCounters;
+    RefCountersType* const m_pRefCounters;
 };
 
 
@@ -646,7 +730,9 @@ public:
     template <typename... CtorArgTypes>
     ObjectType* operator()(CtorArgTypes&&... CtorArgs)
     {
-        RefCountersImpl*    pNewRefCounters = nullptr;
+        using RefCountersType = typename ObjectType::RefCountersType;
+
+        RefCountersType*    pNewRefCounters = nullptr;
         IReferenceCounters* pRefCounters    = nullptr;
         if (m_pOwner != nullptr)
             pRefCounters = m_pOwner->GetReferenceCounters();
@@ -654,7 +740,7 @@ public:
         {
             // Constructor of RefCountersImpl class is private and only accessible
             // by methods of MakeNewRCObj
-            pNewRefCounters = new RefCountersImpl{};
+            pNewRefCounters = new RefCountersType{};
             pRefCounters    = pNewRefCounters;
         }
         ObjectType* pObj = nullptr;
@@ -672,7 +758,7 @@ public:
             else
                 pObj = new ObjectType{pRefCounters, std::forward<CtorArgTypes>(CtorArgs)...};
             if (pNewRefCounters != nullptr)
-                pNewRefCounters->Attach<ObjectType, AllocatorType>(pObj, m_pAllocator);
+                pNewRefCounters->template Attach<ObjectType, AllocatorType>(pObj, m_pAllocator);
         }
         catch (...)
         {
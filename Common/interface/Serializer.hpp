@@ -231,6 +231,25 @@ public:
                         CountType&              Count,
                         ArrayElemSerializerType ElemSerializer);
 
+    /// Serializes an array of elements that are serialized as is.
+    ///
+    /// If the elements are trivially serializable, the array is serialized as a single block:
+    ///
+    ///  * Measure/Write
+    ///      Writes Count
+    ///      Aligns up current offset to the element alignment
+    ///      Writes Count elements
+    ///
+    ///  * Read
+    ///      Reads Count
+    ///      Aligns up current offset to the element alignment
+    ///      If the current pointer is properly aligned, sets Elements to m_Ptr (zero-copy);
+    ///      otherwise, copies the elements to the memory allocated from Allocator.
+    ///      Moves m_Ptr by Count elements
+    ///
+    /// In zero-copy mode, the elements reference the source data, in the same way
+    /// the strings do, so the data must outlive the deserialized objects.
+    /// Otherwise, elements are serialized one by one.
     template <typename ElemPtrType, typename CountType>
     bool SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                            ElemPtrType&            Elements,
@@ -296,6 +315,36 @@ private:
     template <typename T>
     bool Copy(T* pData, size_t Size);
 
+    // Makes Elements reference the data in place, if possible.
+    template <typename ElemType>
+    static bool ReferenceElements(const ElemType*& Elements, const Uint8* pData)
+    {
+        if (reinterpret_cast<size_t>(pData) % alignof(ElemType) != 0)
+            return false;
+
+        Elements = reinterpret_cast<const ElemType*>(pData);
+        return true;
+    }
+
+    // Non-const elements can't reference the source data
+    template <typename ElemType>
+    static bool ReferenceElements(ElemType*& Elements, const Uint8* pData)
+    {
+        return false;
+    }
+
+    template <typename ElemPtrType, typename CountType>
+    bool SerializeArrayRawImpl(DynamicLinearAllocator* Allocator,
+                               ElemPtrType&            Elements,
+                               CountType&              Count,
+                               std::false_type /*IsTriviallySerializable*/);
+
+    template <typename ElemPtrType, typename CountType>
+    bool SerializeArrayRawImpl(DynamicLinearAllocator* Allocator,
+                               ElemPtrType&            Elements,
+                               CountType&              Count,
+                               std::true_type /*IsTriviallySerializable*/);
+
     void AlignOffset(size_t Alignment)
     {
         const auto Size       = GetSize();
@@ -487,6 +536,17 @@ template <typename ElemPtrType, typename CountType>
 bool Serializer<Mode>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                                          ElemPtrType&            Elements,
                                          CountType&              Count)
+{
+    using ElemType = RawType<decltype(Elements[0])>;
+    return SerializeArrayRawImpl(Allocator, Elements, Count, std::integral_constant<bool, IsTriviallySerializable<ElemType>::value>{});
+}
+
+template <SerializerMode Mode>
+template <typename ElemPtrType, typename CountType>
+bool Serializer<Mode>::SerializeArrayRawImpl(DynamicLinearAllocator* Allocator,
+                                             ElemPtrType&            Elements,
+                                             CountType&              Count,
+                                             std::false_type /*IsTriviallySerializable*/)
 {
     return SerializeArray(Allocator, Elements, Count,
                           [](Serializer<Mode>& Ser, auto& Elem) //
@@ -495,6 +555,61 @@ bool Serializer<Mode>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                           });
 }
 
+template <SerializerMode Mode> // Write or Measure
+template <typename ElemPtrType, typename CountType>
+bool Serializer<Mode>::SerializeArrayRawImpl(DynamicLinearAllocator* Allocator,
+                                             ElemPtrType&            Elements,
+                                             CountType&              Count,
+                                             std::true_type /*IsTriviallySerializable*/)
+{
+    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
+    VERIFY_EXPR((Elements != nullptr) == (Count != 0));
+
+    using ElemType = RawType<decltype(Elements[0])>;
+    if (!(*this)(Count))
+        return false;
+
+    // Align the elements so that they can be referenced in place when reading
+    AlignOffset(alignof(ElemType));
+
+    const ElemType* pElements = Elements;
+    return Copy(pElements, sizeof(ElemType) * static_cast<size_t>(Count));
+}
+
+template <>
+template <typename ElemPtrType, typename CountType>
+bool Serializer<SerializerMode::Read>::SerializeArrayRawImpl(DynamicLinearAllocator* Allocator,
+                                                             ElemPtrType&            Elements,
+                                                             CountType&              Count,
+                                                             std::true_type /*IsTriviallySerializable*/)
+{
+    VERIFY_EXPR(Elements == nullptr);
+
+    using ElemType = RawType<decltype(Elements[0])>;
+    if (!(*this)(Count))
+        return false;
+
+    AlignOffset(alignof(ElemType));
+
+    const size_t Size = sizeof(ElemType) * static_cast<size_t>(Count);
+    CHECK_REMAINING_SIZE(Size, "Note enough data to read ", Count, " array elements.");
+    if (Count == 0)
+        return true;
+
+    if (!ReferenceElements(Elements, m_Ptr))
+    {
+        // The source data is not properly aligned in memory, or the destination
+        // pointer is not const-qualified.
+        VERIFY_EXPR(Allocator != nullptr);
+        auto* pDstElements = Allocator->Allocate<ElemType>(Count);
+        std::memcpy(pDstElements, m_Ptr, Size);
+        Elements = pDstElements;
+    }
+    m_Ptr += Size;
+
+    return true;
+}
+
 #undef CHECK_REMAINING_SIZE
 
 } // namespace Diligent
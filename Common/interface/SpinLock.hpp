@@ -30,10 +30,18 @@
 #include <mutex>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "Futex.hpp"
 
 namespace Threading
 {
 
+/// Issues a processor hint that the thread is busy-waiting (PAUSE on x86, YIELD on ARM).
+void PauseCPU() noexcept;
+
+/// Returns true if spin-waiting may help, i.e. the system has more than one hardware thread.
+/// On a single-core system, a spinning thread only delays the thread it is waiting for.
+bool IsSpinWaitingEffective() noexcept;
+
 /// Spin lock implementation
 class SpinLock
 {
@@ -94,4 +102,71 @@ private:
 
 using SpinLockGuard = std::lock_guard<SpinLock>;
 
+
+/// Adaptive lock that spins with exponential backoff and then parks the thread.
+
+/// Unlike SpinLock, waiting threads do not consume CPU time when the lock is held
+/// for a long time or the system is oversubscribed. On platforms that support futexes,
+/// waiting threads sleep in the kernel; otherwise they yield their time slice.
+/// The price is an atomic exchange in unlock(), where SpinLock only needs a store,
+/// so SpinLock remains preferable for very short critical sections.
+class AdaptiveLock
+{
+public:
+    AdaptiveLock() noexcept {}
+
+    // clang-format off
+    AdaptiveLock             (const AdaptiveLock&)  = delete;
+    AdaptiveLock& operator = (const AdaptiveLock&)  = delete;
+    AdaptiveLock             (      AdaptiveLock&&) = delete;
+    AdaptiveLock& operator = (      AdaptiveLock&&) = delete;
+    // clang-format on
+
+    void lock() noexcept
+    {
+        int Expected = Unlocked;
+        if (m_State.compare_exchange_strong(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
+
+        LockContended();
+    }
+
+    bool try_lock() noexcept
+    {
+        if (is_locked())
+            return false;
+
+        int Expected = Unlocked;
+        return m_State.compare_exchange_strong(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept
+    {
+        VERIFY(is_locked(), "Attempting to unlock a lock that is not locked. This is a strong indication of a flawed logic.");
+        if (m_State.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters)
+            WakeWaiter();
+    }
+
+    bool is_locked() const noexcept
+    {
+        return m_State.load(std::memory_order_relaxed) != Unlocked;
+    }
+
+private:
+    void LockContended() noexcept;
+    void WakeWaiter() noexcept;
+
+private:
+    enum : int
+    {
+        Unlocked = 0,
+        Locked,
+        // The lock is held and there may be parked threads
+        LockedWithWaiters
+    };
+    std::atomic<int> m_State{Unlocked};
+};
+
+using AdaptiveLockGuard = std::lock_guard<AdaptiveLock>;
+
 } // namespace Threading
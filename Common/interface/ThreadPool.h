@@ -223,6 +223,11 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     /// Returns the number of currently running tasks
     VIRTUAL Uint32 METHOD(GetRunningTaskCount)(THIS) CONST PURE;
 
+    /// Returns the number of worker threads.
+
+    /// \remarks   The method returns zero after StopThreads() has been called.
+    VIRTUAL Uint32 METHOD(GetThreadCount)(THIS) CONST PURE;
+
 
     /// Stops all worker threads.
 
@@ -299,6 +304,7 @@ DILIGENT_END_INTERFACE
 #    define IThreadPool_WaitForAllTasks(This)       CALL_IFACE_METHOD(ThreadPool, WaitForAllTasks, This)
 #    define IThreadPool_GetQueueSize(This)          CALL_IFACE_METHOD(ThreadPool, GetQueueSize, This)
 #    define IThreadPool_GetRunningTaskCount(This)   CALL_IFACE_METHOD(ThreadPool, GetRunningTaskCount, This)
+#    define IThreadPool_GetThreadCount(This)        CALL_IFACE_METHOD(ThreadPool, GetThreadCount, This)
 #    define IThreadPool_StopThreads(This)           CALL_IFACE_METHOD(ThreadPool, StopThreads, This)
 #    define IThreadPool_ProcessTask(This, ...)      CALL_IFACE_METHOD(ThreadPool, ProcessTask, This, __VA_ARGS__)
 
@@ -32,6 +32,8 @@
 #include <atomic>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "SpinLock.hpp"
+#include "Futex.hpp"
 
 namespace Threading
 {
@@ -52,6 +54,97 @@ public:
     Signal& operator=(Signal&&)      = delete;
     // clang-format on
 
+#if DILIGENT_FUTEX_SUPPORTED
+
+    // The signal value is used as the futex word: waiters sleep in the kernel
+    // while it is zero. State transitions (trigger, auto-reset, reset) are
+    // serialized by a spin lock that is only held for a few instructions.
+
+    void Trigger(bool NotifyAll = false, int SignalValue = 1)
+    {
+        VERIFY(SignalValue != 0, "Signal value must not be zero");
+        {
+            SpinLockGuard Guard{m_StateLock};
+            VERIFY(m_SignaledValue.load() == 0 && m_NumThreadsAwaken.load() == 0, "Not all threads have been awaken since the signal was triggered last time, or the signal has not been reset");
+            m_SignaledValue.store(SignalValue);
+        }
+
+        // Skip the system call if no thread is sleeping. Both this load and the increment
+        // in Wait() are sequentially consistent, so either the waiter sees the new value
+        // before sleeping, or this thread sees the waiter.
+        if (m_NumSleepingThreads.load() != 0)
+        {
+            if (NotifyAll)
+                FutexWakeAll(m_SignaledValue);
+            else
+                FutexWakeOne(m_SignaledValue);
+        }
+    }
+
+    // WARNING!
+    // If multiple threads are waiting for a signal in an infinite loop,
+    // autoresetting the signal does not guarantee that one thread cannot
+    // go through the loop twice. In this case, every thread must wait for its
+    // own auto-reset signal or the threads must be blocked by another signal
+
+    int Wait(bool AutoReset = false, int NumThreadsWaiting = 0)
+    {
+        while (true)
+        {
+            // Briefly spin before going to sleep: if the signal is triggered shortly,
+            // this avoids the wake-up latency of the kernel.
+            if (IsSpinWaitingEffective())
+            {
+                constexpr int MaxSpinCount = 128;
+                for (int SpinCount = 1; SpinCount <= MaxSpinCount && m_SignaledValue.load(std::memory_order_acquire) == 0; SpinCount *= 2)
+                {
+                    for (int i = 0; i < SpinCount; ++i)
+                        PauseCPU();
+                }
+            }
+
+            while (m_SignaledValue.load() == 0)
+            {
+                m_NumSleepingThreads.fetch_add(1);
+                // The kernel atomically checks that the value is still zero before sleeping
+                FutexWait(m_SignaledValue, 0);
+                m_NumSleepingThreads.fetch_add(-1);
+            }
+
+            SpinLockGuard Guard{m_StateLock};
+
+            const int SignaledValue = m_SignaledValue.load();
+            if (SignaledValue == 0)
+            {
+                // The signal has been reset after we woke up
+                continue;
+            }
+
+            const auto NumThreadsAwaken = m_NumThreadsAwaken.fetch_add(1) + 1;
+            if (AutoReset)
+            {
+                VERIFY(NumThreadsWaiting > 0, "Number of waiting threads must not be 0 when auto resetting the signal");
+                // Reset the signal while holding the lock. If Trigger() is executed by another
+                // thread, it will wait until we release the lock
+                if (NumThreadsAwaken == NumThreadsWaiting)
+                {
+                    m_SignaledValue.store(0);
+                    m_NumThreadsAwaken.store(0);
+                }
+            }
+            return SignaledValue;
+        }
+    }
+
+    void Reset()
+    {
+        SpinLockGuard Guard{m_StateLock};
+        m_SignaledValue.store(0);
+        m_NumThreadsAwaken.store(0);
+    }
+
+#else
+
     // http://en.cppreference.com/w/cpp/thread/condition_variable
     void Trigger(bool NotifyAll = false, int SignalValue = 1)
     {
@@ -123,13 +216,20 @@ public:
         m_NumThreadsAwaken.store(0);
     }
 
+#endif
+
     bool IsTriggered() const { return m_SignaledValue.load() != 0; }
 
 private:
+#if DILIGENT_FUTEX_SUPPORTED
+    SpinLock        m_StateLock;
+    std::atomic_int m_NumSleepingThreads{0};
+#else
     std::mutex              m_Mutex;
     std::condition_variable m_CondVar;
-    std::atomic_int         m_SignaledValue{0};
-    std::atomic_int         m_NumThreadsAwaken{0};
+#endif
+    std::atomic_int m_SignaledValue{0};
+    std::atomic_int m_NumThreadsAwaken{0};
 };
 
 } // namespace Threading
@@ -0,0 +1,140 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::TrackingMemoryAllocator class
+
+#include <atomic>
+
+#include "../../Primitives/interface/MemoryAllocator.h"
+
+namespace Diligent
+{
+
+/// Allocation counters that are updated by Diligent::TrackingMemoryAllocator.
+
+/// All counters are updated with relaxed atomic operations, so the same counters
+/// may be shared by multiple allocators and threads. Allocation rates can be
+/// computed from the difference of two snapshots of the cumulative counters.
+struct MemoryAllocationCounters
+{
+    /// The number of bytes currently allocated.
+    std::atomic<Int64> LiveBytes{0};
+
+    /// The maximum value LiveBytes has ever reached.
+    std::atomic<Int64> PeakBytes{0};
+
+    /// The number of allocations that have not been released yet.
+    std::atomic<Int64> LiveAllocations{0};
+
+    /// The total number of allocations made since the counters were created or reset.
+    std::atomic<Uint64> TotalAllocations{0};
+
+    /// The total number of bytes allocated since the counters were created or reset.
+    std::atomic<Uint64> TotalBytes{0};
+
+    void OnAllocate(size_t Size) noexcept
+    {
+        const Int64 NewLiveBytes = LiveBytes.fetch_add(static_cast<Int64>(Size), std::memory_order_relaxed) + static_cast<Int64>(Size);
+        LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+        TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+        TotalBytes.fetch_add(Size, std::memory_order_relaxed);
+
+        Int64 CurrPeak = PeakBytes.load(std::memory_order_relaxed);
+        while (NewLiveBytes > CurrPeak && !PeakBytes.compare_exchange_weak(CurrPeak, NewLiveBytes, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void OnFree(size_t Size) noexcept
+    {
+        LiveBytes.fetch_sub(static_cast<Int64>(Size), std::memory_order_relaxed);
+        LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// Resets the peak value to the current live byte count and clears cumulative counters.
+    void ResetCumulative() noexcept
+    {
+        PeakBytes.store(LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        TotalAllocations.store(0, std::memory_order_relaxed);
+        TotalBytes.store(0, std::memory_order_relaxed);
+    }
+};
+
+
+/// Memory allocator that forwards all requests to the parent allocator
+/// and records the allocations in the MemoryAllocationCounters object.
+
+/// Every allocation is prefixed with a small header that stores the allocation
+/// size, so the memory must always be released through the same tracking allocator.
+class TrackingMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    TrackingMemoryAllocator(IMemoryAllocator& ParentAllocator, MemoryAllocationCounters& Counters) noexcept :
+        m_pParentAllocator{&ParentAllocator},
+        m_Counters{Counters}
+    {}
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override final;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override final;
+
+    /// Sets the parent allocator.
+
+    /// \note   The parent allocator must not be changed while there are
+    ///         outstanding allocations made through this allocator.
+    void SetParentAllocator(IMemoryAllocator& ParentAllocator) noexcept
+    {
+        m_pParentAllocator = &ParentAllocator;
+    }
+
+    IMemoryAllocator& GetParentAllocator() const noexcept { return *m_pParentAllocator; }
+
+    const MemoryAllocationCounters& GetCounters() const noexcept { return m_Counters; }
+
+private:
+    // clang-format off
+    TrackingMemoryAllocator             (const TrackingMemoryAllocator&) = delete;
+    TrackingMemoryAllocator             (TrackingMemoryAllocator&&)      = delete;
+    TrackingMemoryAllocator& operator = (const TrackingMemoryAllocator&) = delete;
+    TrackingMemoryAllocator& operator = (TrackingMemoryAllocator&&)      = delete;
+    // clang-format on
+
+    IMemoryAllocator*         m_pParentAllocator;
+    MemoryAllocationCounters& m_Counters;
+};
+
+} // namespace Diligent
@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Futex.hpp"
+
+#if DILIGENT_FUTEX_SUPPORTED
+
+#    include <climits>
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+namespace Threading
+{
+
+static_assert(sizeof(std::atomic<int>) == sizeof(int), "Futex word must be a 32-bit integer");
+
+static long Futex(std::atomic<int>& Word, int Op, int Value) noexcept
+{
+    // Private futexes are never shared between processes, which lets the kernel skip the mm lookup
+    return syscall(SYS_futex, reinterpret_cast<int*>(&Word), Op | FUTEX_PRIVATE_FLAG, Value, nullptr, nullptr, 0);
+}
+
+void FutexWait(std::atomic<int>& Word, int Expected) noexcept
+{
+    // EAGAIN (value changed) and EINTR are both handled by the caller re-checking the condition
+    Futex(Word, FUTEX_WAIT, Expected);
+}
+
+void FutexWakeOne(std::atomic<int>& Word) noexcept
+{
+    Futex(Word, FUTEX_WAKE, 1);
+}
+
+void FutexWakeAll(std::atomic<int>& Word) noexcept
+{
+    Futex(Word, FUTEX_WAKE, INT_MAX);
+}
+
+} // namespace Threading
+
+#endif
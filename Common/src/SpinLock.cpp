@@ -42,21 +42,74 @@
 namespace Threading
 {
 
+void PauseCPU() noexcept
+{
+    PAUSE();
+}
+
+bool IsSpinWaitingEffective() noexcept
+{
+    static const bool IsMultiCore = std::thread::hardware_concurrency() > 1;
+    return IsMultiCore;
+}
+
 void SpinLock::Wait() noexcept
 {
     // Wait for the lock to be released without generating cache misses.
-    constexpr size_t NumAttemptsToYield = 64;
-    for (size_t Attempt = 0; Attempt < NumAttemptsToYield; ++Attempt)
+    // Back off exponentially to reduce contention on the cache line.
+    if (IsSpinWaitingEffective())
     {
-        if (!is_locked())
-            return;
+        constexpr size_t MaxSpinCount = 64;
+        for (size_t SpinCount = 1; SpinCount <= MaxSpinCount; SpinCount *= 2)
+        {
+            for (size_t i = 0; i < SpinCount; ++i)
+            {
+                // Issue X86 PAUSE or ARM YIELD instruction to reduce contention
+                // between hyper-threads.
+                PAUSE();
+            }
 
-        // Issue X86 PAUSE or ARM YIELD instruction to reduce contention
-        // between hyper-threads.
-        PAUSE();
+            if (!is_locked())
+                return;
+        }
     }
 
+    // On a single-core system, the lock owner can only make progress if we yield.
     std::this_thread::yield();
 }
 
+void AdaptiveLock::LockContended() noexcept
+{
+    if (IsSpinWaitingEffective())
+    {
+        constexpr int MaxSpinCount = 64;
+        for (int SpinCount = 1; SpinCount <= MaxSpinCount; SpinCount *= 2)
+        {
+            for (int i = 0; i < SpinCount; ++i)
+                PAUSE();
+
+            if (try_lock())
+                return;
+        }
+    }
+
+#if DILIGENT_FUTEX_SUPPORTED
+    // Park the thread. The state is set to LockedWithWaiters so that unlock() wakes
+    // us up. If the exchange returns Unlocked, the lock has been acquired; it is
+    // left in LockedWithWaiters state as other threads may still be parked.
+    while (m_State.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+        FutexWait(m_State, LockedWithWaiters);
+#else
+    while (m_State.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+        std::this_thread::yield();
+#endif
+}
+
+void AdaptiveLock::WakeWaiter() noexcept
+{
+#if DILIGENT_FUTEX_SUPPORTED
+    FutexWakeOne(m_State);
+#endif
+}
+
 } // namespace Threading
@@ -69,6 +69,7 @@ public:
                         PoolCI.OnThreadExiting(i);
                 });
         }
+        m_NumThreads.store(StaticCast<Uint32>(m_WorkerThreads.size()));
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
@@ -239,6 +240,7 @@ public:
             worker.join();
 
         m_WorkerThreads.clear();
+        m_NumThreads.store(0);
     }
 
     virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
@@ -319,6 +321,11 @@ public:
         return m_NumRunningTasks.load();
     }
 
+    virtual Uint32 DILIGENT_CALL_TYPE GetThreadCount() const override final
+    {
+        return m_NumThreads.load();
+    }
+
     ~ThreadPoolImpl()
     {
         StopThreads();
@@ -328,6 +335,8 @@ public:
 
 private:
     std::vector<std::thread> m_WorkerThreads;
+    // The number of threads is atomic as it may be queried while StopThreads() clears m_WorkerThreads
+    std::atomic<Uint32> m_NumThreads{0};
 
     struct QueuedTaskInfo
     {
@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "TrackingMemoryAllocator.hpp"
+
+#include <algorithm>
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The header is placed immediately before the user pointer.
+struct AllocationHeader
+{
+    size_t Size;
+    size_t Offset; // Offset from the start of the parent allocation to the user pointer
+};
+static constexpr size_t AllocationHeaderSize = 16;
+static_assert(sizeof(AllocationHeader) <= AllocationHeaderSize, "Header does not fit into reserved space");
+
+inline AllocationHeader& GetHeader(void* Ptr)
+{
+    return *reinterpret_cast<AllocationHeader*>(static_cast<Uint8*>(Ptr) - AllocationHeaderSize);
+}
+
+} // namespace
+
+void* TrackingMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+    void* pRawMem = m_pParentAllocator->Allocate(Size + AllocationHeaderSize, dbgDescription, dbgFileName, dbgLineNumber);
+    if (pRawMem == nullptr)
+        return nullptr;
+
+    void* Ptr = static_cast<Uint8*>(pRawMem) + AllocationHeaderSize;
+
+    GetHeader(Ptr) = {Size, AllocationHeaderSize};
+    m_Counters.OnAllocate(Size);
+
+    return Ptr;
+}
+
+void TrackingMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const AllocationHeader Header = GetHeader(Ptr);
+    VERIFY(Header.Offset == AllocationHeaderSize, "This memory was not allocated with Allocate() or is corrupted");
+    m_Counters.OnFree(Header.Size);
+    m_pParentAllocator->Free(static_cast<Uint8*>(Ptr) - Header.Offset);
+}
+
+void* TrackingMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0 && IsPowerOfTwo(Alignment));
+    // Offset must be a multiple of the alignment so that the user pointer is properly aligned
+    const size_t Offset = std::max(Alignment, AllocationHeaderSize);
+
+    void* pRawMem = m_pParentAllocator->AllocateAligned(Size + Offset, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+    if (pRawMem == nullptr)
+        return nullptr;
+
+    void* Ptr = static_cast<Uint8*>(pRawMem) + Offset;
+
+    GetHeader(Ptr) = {Size, Offset};
+    m_Counters.OnAllocate(Size);
+
+    return Ptr;
+}
+
+void TrackingMemoryAllocator::FreeAligned(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const AllocationHeader Header = GetHeader(Ptr);
+    VERIFY(Header.Offset >= AllocationHeaderSize && IsPowerOfTwo(Header.Offset), "This memory was not allocated with AllocateAligned() or is corrupted");
+    m_Counters.OnFree(Header.Size);
+    m_pParentAllocator->FreeAligned(static_cast<Uint8*>(Ptr) - Header.Offset);
+}
+
+} // namespace Diligent
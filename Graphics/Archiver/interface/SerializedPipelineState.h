@@ -66,6 +66,10 @@ DILIGENT_BEGIN_INTERFACE(ISerializedPipelineState, IPipelineState)
     ///                           returned by the GetPatchedShaderCount() for this
     ///                           device type.
     /// \return Shader create information for the requested device type and shader index.
+    ///
+    /// \remarks For Vulkan, unless the pipeline is serialized without shader reflection, the SPIRV
+    ///          byte code is followed by the serialized shader resources (see IShaderVk::GetBytecodeWithReflection).
+    ///          The byte code can be used to create a shader, but can't be passed to Vulkan directly.
     VIRTUAL ShaderCreateInfo METHOD(GetPatchedShaderCreateInfo)(
         THIS_
         ARCHIVE_DEVICE_DATA_FLAGS DeviceType,
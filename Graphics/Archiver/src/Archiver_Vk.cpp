@@ -53,7 +53,10 @@ struct CompiledShaderVk : SerializedShaderImpl::CompiledShader
 
     virtual SerializedData Serialize(ShaderCreateInfo ShaderCI) const override final
     {
-        const auto& SPIRV = ShaderVk.GetSPIRV();
+        // Store the resources with the byte code so that they don't need to be reflected when the shader is unpacked
+        std::vector<uint32_t> SPIRV = ShaderVk.GetSPIRV();
+        if (const auto& pResources = ShaderVk.GetShaderResources())
+            pResources->AppendToBytecode(SPIRV, ShaderVk.GetEntryPoint());
 
         ShaderCI.Source       = nullptr;
         ShaderCI.FilePath     = nullptr;
@@ -118,6 +121,8 @@ struct SerializedResourceSignatureImpl::SignatureTraits<PipelineResourceSignatur
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersVk(const CreateInfoType& CreateInfo) noexcept(false)
 {
+    const bool bStripReflection = m_Data.Aux.NoShaderReflection;
+
     std::vector<ShaderStageInfoVk> ShaderStages;
     SHADER_TYPE                    ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
     constexpr bool                 WaitUntilShadersReady = true;
@@ -172,7 +177,6 @@ void SerializedPipelineStateImpl::PatchShadersVk(const CreateInfoType& CreateInf
         }
         VERIFY_EXPR(DescSetLayoutCount <= MAX_RESOURCE_SIGNATURES * 2);
 
-        const auto bStripReflection = m_Data.Aux.NoShaderReflection;
         PipelineStateVkImpl::RemapOrVerifyShaderResources(ShaderStagesVk,
                                                           Signatures.data(),
                                                           SignaturesCount,
@@ -188,8 +192,15 @@ void SerializedPipelineStateImpl::PatchShadersVk(const CreateInfoType& CreateInf
         const auto& Stage = ShaderStagesVk[j];
         for (size_t i = 0; i < Stage.Count(); ++i)
         {
-            const auto& SPIRV     = Stage.SPIRVs[i];
-            auto        ShaderCI  = ShaderStages[j].Serialized[i]->GetCreateInfo();
+            std::vector<uint32_t> SPIRV = Stage.SPIRVs[i];
+            if (!bStripReflection)
+            {
+                // Resource decoration offsets remain valid after remapping
+                if (const auto& pResources = Stage.Shaders[i]->GetShaderResources())
+                    pResources->AppendToBytecode(SPIRV, Stage.Shaders[i]->GetEntryPoint());
+            }
+
+            auto ShaderCI         = ShaderStages[j].Serialized[i]->GetCreateInfo();
             ShaderCI.Source       = nullptr;
             ShaderCI.FilePath     = nullptr;
             ShaderCI.Macros       = {};
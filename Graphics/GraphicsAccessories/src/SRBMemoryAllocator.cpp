@@ -68,7 +68,7 @@ void SRBMemoryAllocator::Initialize(Uint32              SRBAllocationGranularity
     for (Uint32 s = 0; s < TotalAllocatorCount; ++s)
     {
         auto size = s < ShaderVariableDataAllocatorCount ? ShaderVariableDataSizes[s] : ResourceCacheDataSizes[s - ShaderVariableDataAllocatorCount];
-        new (m_DataAllocators + s) FixedBlockMemoryAllocator(GetRawAllocator(), size, SRBAllocationGranularity);
+        new (m_DataAllocators + s) FixedBlockMemoryAllocator(m_RawMemAllocator, size, SRBAllocationGranularity);
     }
 }
 
@@ -249,7 +249,7 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
         return {};
     }
 
-    PRSData PRS{GetRawAllocator()};
+    PRSData PRS{GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION)};
     if (!pObjArchive->LoadResourceCommonData(PRSData::ArchiveResType, DeArchiveInfo.Name, PRS))
         return {};
 
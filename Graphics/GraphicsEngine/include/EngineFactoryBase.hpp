@@ -122,6 +122,22 @@ public:
         PlatformDebug::SetBreakOnError(BreakOnError);
     }
 
+    virtual void DILIGENT_CALL_TYPE GetMemoryStatistics(MEMORY_CATEGORY Category, MemoryCategoryStatistics& Stats) const override final
+    {
+        if (Category >= MEMORY_CATEGORY_COUNT)
+        {
+            UNEXPECTED("Invalid memory category (", Uint32{Category}, ")");
+            Stats = {};
+            return;
+        }
+        GetMemoryCategoryStatistics(Category, Stats);
+    }
+
+    virtual void DILIGENT_CALL_TYPE ResetMemoryStatistics() const override final
+    {
+        ResetMemoryCategoryStatistics();
+    }
+
 protected:
     template <typename DearchiverImplType>
     void CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
@@ -31,11 +31,15 @@
 /// Implementation of the Diligent::BufferBase template class
 
 #include "MemoryAllocator.h"
+#include "GraphicsTypes.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
 /// Sets raw memory allocator. This function must be called before any memory allocation/deallocation function
 /// is called.
+///
+/// \note  The category allocators (see GetRawAllocator(MEMORY_CATEGORY)) keep their original parent
+///        allocator if any category has live allocations when the allocator is changed.
 void SetRawAllocator(IMemoryAllocator* pRawAllocator);
 
 /// Returns raw memory allocator
@@ -43,6 +47,26 @@ IMemoryAllocator& GetRawAllocator();
 
 IMemoryAllocator& GetStringAllocator();
 
+/// Returns the allocator that attributes all allocations to the given memory category.
+
+/// The allocator forwards requests to the raw memory allocator and updates the
+/// category statistics. Memory must be released through the same allocator.
+IMemoryAllocator& GetRawAllocator(MEMORY_CATEGORY Category);
+
+struct MemoryAllocationCounters;
+
+/// Returns the allocation counters of the given memory category.
+
+/// The counters may be used with a Diligent::TrackingMemoryAllocator that
+/// wraps an allocator other than the global raw allocator.
+MemoryAllocationCounters& GetMemoryCategoryCounters(MEMORY_CATEGORY Category);
+
+/// Returns the statistics of the given memory category.
+void GetMemoryCategoryStatistics(MEMORY_CATEGORY Category, MemoryCategoryStatistics& Stats);
+
+/// Resets peak values and cumulative counters of all memory categories.
+void ResetMemoryCategoryStatistics();
+
 #define ALLOCATE_RAW(Allocator, Desc, Size)    (Allocator).Allocate(Size, Desc, __FILE__, __LINE__)
 #define ALLOCATE(Allocator, Desc, Type, Count) reinterpret_cast<Type*>(ALLOCATE_RAW(Allocator, Desc, sizeof(Type) * (Count)))
 #define FREE(Allocator, Ptr)                   Allocator.Free(Ptr)
@@ -371,7 +371,7 @@ public:
                                   bool                                 bIsDeviceInternal = false) :
         TDeviceObjectBase{pRefCounters, pDevice, Desc, bIsDeviceInternal},
         m_ShaderStages{ShaderStages},
-        m_SRBMemAllocator{GetRawAllocator()}
+        m_SRBMemAllocator{GetRawAllocator(MEMORY_CATEGORY_SRB_CACHES)}
     {
         // Don't read from m_Desc until it was allocated and copied in CopyPipelineResourceSignatureDesc()
         this->m_Desc.Resources             = nullptr;
@@ -419,7 +419,7 @@ public:
         m_StaticResShaderStages{InternalData.StaticResShaderStages},
         m_PipelineType         {InternalData.PipelineType},
         m_StaticResStageIndex  {InternalData.StaticResStageIndex},
-        m_SRBMemAllocator      {GetRawAllocator()}
+        m_SRBMemAllocator      {GetRawAllocator(MEMORY_CATEGORY_SRB_CACHES)}
     // clang-format on
     {
         // Don't read from m_Desc until it was allocated and copied in CopyPipelineResourceSignatureDesc()
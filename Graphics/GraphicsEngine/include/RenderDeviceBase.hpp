@@ -47,6 +47,7 @@
 #include "SwapChain.h"
 #include "GraphicsAccessories.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "TrackingMemoryAllocator.hpp"
 #include "EngineMemory.h"
 #include "STDAllocator.hpp"
 #include "IndexWrapper.hpp"
@@ -143,25 +144,26 @@ public:
         m_wpImmediateContexts ((std::max)(1u, EngineCI.NumImmediateContexts), RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
         m_wpDeferredContexts  (EngineCI.NumDeferredContexts, RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
         m_RawMemAllocator     {RawMemAllocator},
-        m_TexObjAllocator     {RawMemAllocator, sizeof(TextureImplType),                   16},
-        m_TexViewObjAllocator {RawMemAllocator, sizeof(TextureViewImplType),               32},
-        m_BufObjAllocator     {RawMemAllocator, sizeof(BufferImplType),                    16},
-        m_BuffViewObjAllocator{RawMemAllocator, sizeof(BufferViewImplType),                32},
-        m_ShaderObjAllocator  {RawMemAllocator, sizeof(ShaderImplType),                    16},
-        m_SamplerObjAllocator {RawMemAllocator, sizeof(SamplerImplType),                   32},
-        m_PSOAllocator        {RawMemAllocator, sizeof(PipelineStateImplType),             16},
-        m_SRBAllocator        {RawMemAllocator, sizeof(ShaderResourceBindingImplType),     64},
-        m_ResMappingAllocator {RawMemAllocator, sizeof(ResourceMappingImpl),                8},
-        m_FenceAllocator      {RawMemAllocator, sizeof(FenceImplType),                     16},
-        m_QueryAllocator      {RawMemAllocator, sizeof(QueryImplType),                     16},
-        m_RenderPassAllocator {RawMemAllocator, sizeof(RenderPassImplType),                16},
-        m_FramebufferAllocator{RawMemAllocator, sizeof(FramebufferImplType),               16},
-        m_BLASAllocator       {RawMemAllocator, sizeof(BottomLevelASImplType),              8},
-        m_TLASAllocator       {RawMemAllocator, sizeof(TopLevelASImplType),                 8},
-        m_SBTAllocator        {RawMemAllocator, sizeof(ShaderBindingTableImplType),         8},
-        m_PipeResSignAllocator{RawMemAllocator, sizeof(PipelineResourceSignatureImplType), 16},
-        m_MemObjAllocator     {RawMemAllocator, sizeof(DeviceMemoryImplType),              16},
-        m_PSOCacheAllocator   {RawMemAllocator, sizeof(PipelineStateCacheImplType),         4}
+        m_ObjPoolMemAllocator {RawMemAllocator, GetMemoryCategoryCounters(MEMORY_CATEGORY_OBJECT_POOLS)},
+        m_TexObjAllocator     {m_ObjPoolMemAllocator, sizeof(TextureImplType),                   16},
+        m_TexViewObjAllocator {m_ObjPoolMemAllocator, sizeof(TextureViewImplType),               32},
+        m_BufObjAllocator     {m_ObjPoolMemAllocator, sizeof(BufferImplType),                    16},
+        m_BuffViewObjAllocator{m_ObjPoolMemAllocator, sizeof(BufferViewImplType),                32},
+        m_ShaderObjAllocator  {m_ObjPoolMemAllocator, sizeof(ShaderImplType),                    16},
+        m_SamplerObjAllocator {m_ObjPoolMemAllocator, sizeof(SamplerImplType),                   32},
+        m_PSOAllocator        {m_ObjPoolMemAllocator, sizeof(PipelineStateImplType),             16},
+        m_SRBAllocator        {m_ObjPoolMemAllocator, sizeof(ShaderResourceBindingImplType),     64},
+        m_ResMappingAllocator {m_ObjPoolMemAllocator, sizeof(ResourceMappingImpl),                8},
+        m_FenceAllocator      {m_ObjPoolMemAllocator, sizeof(FenceImplType),                     16},
+        m_QueryAllocator      {m_ObjPoolMemAllocator, sizeof(QueryImplType),                     16},
+        m_RenderPassAllocator {m_ObjPoolMemAllocator, sizeof(RenderPassImplType),                16},
+        m_FramebufferAllocator{m_ObjPoolMemAllocator, sizeof(FramebufferImplType),               16},
+        m_BLASAllocator       {m_ObjPoolMemAllocator, sizeof(BottomLevelASImplType),              8},
+        m_TLASAllocator       {m_ObjPoolMemAllocator, sizeof(TopLevelASImplType),                 8},
+        m_SBTAllocator        {m_ObjPoolMemAllocator, sizeof(ShaderBindingTableImplType),         8},
+        m_PipeResSignAllocator{m_ObjPoolMemAllocator, sizeof(PipelineResourceSignatureImplType), 16},
+        m_MemObjAllocator     {m_ObjPoolMemAllocator, sizeof(DeviceMemoryImplType),              16},
+        m_PSOCacheAllocator   {m_ObjPoolMemAllocator, sizeof(PipelineStateCacheImplType),         4}
     // clang-format on
     {
         // Initialize texture format info
@@ -701,6 +703,7 @@ protected:
     std::vector<RefCntWeakPtr<DeviceContextImplType>, STDAllocatorRawMem<RefCntWeakPtr<DeviceContextImplType>>> m_wpDeferredContexts;
 
     IMemoryAllocator&         m_RawMemAllocator;      ///< Raw memory allocator
+    TrackingMemoryAllocator   m_ObjPoolMemAllocator;  ///< Allocator for object pool pages that tracks MEMORY_CATEGORY_OBJECT_POOLS
     FixedBlockMemoryAllocator m_TexObjAllocator;      ///< Allocator for texture objects
     FixedBlockMemoryAllocator m_TexViewObjAllocator;  ///< Allocator for texture view objects
     FixedBlockMemoryAllocator m_BufObjAllocator;      ///< Allocator for buffer objects
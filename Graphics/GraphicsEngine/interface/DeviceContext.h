@@ -2339,6 +2339,41 @@ struct DeviceContextCommandCounters
 };
 typedef struct DeviceContextCommandCounters DeviceContextCommandCounters;
 
+/// Device context resource binding counters.
+
+/// \remarks The counters are currently only collected by the OpenGL backend, where the context
+///          tracks the textures, samplers, images, uniform and storage buffers bound to every slot
+///          and skips redundant bindings.
+struct DeviceContextBindingCounters
+{
+    /// The number of bindings that were skipped because the same resource was already bound to the slot.
+    Uint32 Filtered DEFAULT_INITIALIZER(0);
+
+    /// The number of bindings that changed the resource bound to the slot.
+    Uint32 Changed DEFAULT_INITIALIZER(0);
+
+    /// The number of native API calls issued to change the bindings.
+
+    /// When multi-bind is supported, a contiguous range of changed bindings
+    /// is set with a single call, so this number may be less than Changed.
+    Uint32 ApiCalls DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextBindingCounters DeviceContextBindingCounters;
+
+/// Device context command buffer counters.
+
+/// \remarks The counters are currently only collected by the Vulkan backend, where every context
+///          recycles the command buffers that the GPU has finished executing.
+struct DeviceContextCommandBufferCounters
+{
+    /// The number of new command buffers that were allocated by the context.
+    Uint32 Allocated DEFAULT_INITIALIZER(0);
+
+    /// The number of recycled command buffers that were reused by the context.
+    Uint32 Reused DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextCommandBufferCounters DeviceContextCommandBufferCounters;
+
 /// Device context statistics.
 struct DeviceContextStats
 {
@@ -2348,6 +2383,12 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// Resource binding counters, see Diligent::DeviceContextBindingCounters.
+    DeviceContextBindingCounters BindingCounters DEFAULT_INITIALIZER({});
+
+    /// Command buffer counters, see Diligent::DeviceContextCommandBufferCounters.
+    DeviceContextCommandBufferCounters CommandBufferCounters DEFAULT_INITIALIZER({});
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
@@ -138,6 +138,22 @@ DILIGENT_BEGIN_INTERFACE(IEngineFactory, IObject)
     VIRTUAL void METHOD(SetBreakOnError)(THIS_
                                          bool BreakOnError) CONST PURE;
 
+    /// Returns memory statistics of the given memory category.
+
+    /// \param [in]  Category - Memory category, see Diligent::MEMORY_CATEGORY.
+    /// \param [out] Stats    - Memory category statistics, see Diligent::MemoryCategoryStatistics.
+    ///
+    /// \remarks   The statistics are global and accumulate allocations made by all devices
+    ///            and engine objects since the application start.
+    VIRTUAL void METHOD(GetMemoryStatistics)(THIS_
+                                             MEMORY_CATEGORY                Category,
+                                             MemoryCategoryStatistics REF   Stats) CONST PURE;
+
+    /// Resets peak values and cumulative counters of all memory categories.
+
+    /// \remarks   Peak values are set to the current number of live bytes.
+    VIRTUAL void METHOD(ResetMemoryStatistics)(THIS) CONST PURE;
+
 #if PLATFORM_ANDROID
     /// On Android platform, it is necessary to initialize the file system before
     /// CreateDefaultShaderSourceStreamFactory() method can be called.
@@ -171,6 +187,8 @@ DILIGENT_END_INTERFACE
 #    define IEngineFactory_CreateDearchiver(This, ...)                       CALL_IFACE_METHOD(EngineFactory, CreateDearchiver,                       This, __VA_ARGS__)
 #    define IEngineFactory_SetMessageCallback(This, ...)                     CALL_IFACE_METHOD(EngineFactory, SetMessageCallback,                     This, __VA_ARGS__)
 #    define IEngineFactory_SetBreakOnError(This, ...)                        CALL_IFACE_METHOD(EngineFactory, SetBreakOnError,                        This, __VA_ARGS__)
+#    define IEngineFactory_GetMemoryStatistics(This, ...)                    CALL_IFACE_METHOD(EngineFactory, GetMemoryStatistics,                    This, __VA_ARGS__)
+#    define IEngineFactory_ResetMemoryStatistics(This)                       CALL_IFACE_METHOD(EngineFactory, ResetMemoryStatistics,                  This)
 // clang-format on
 
 #endif
@@ -3423,6 +3423,57 @@ struct OpenXRAttribs
 typedef struct OpenXRAttribs OpenXRAttribs;
 
 
+/// Engine memory allocation category.
+
+/// Allocations made by the engine subsystems listed below are attributed to the
+/// corresponding category and can be queried with IEngineFactory::GetMemoryStatistics().
+DILIGENT_TYPED_ENUM(MEMORY_CATEGORY, Uint8)
+{
+    /// Fixed-block pools that hold device objects (textures, buffers, pipeline states, etc.)
+    MEMORY_CATEGORY_OBJECT_POOLS = 0,
+
+    /// Shader resource caches and shader variable managers of resource signatures
+    /// and shader resource binding objects.
+    MEMORY_CATEGORY_SRB_CACHES,
+
+    /// Device object archive data and temporary memory used to unpack archived objects.
+    MEMORY_CATEGORY_SERIALIZATION,
+
+    /// Shader reflection data, shader source stream factories and shader converters.
+    MEMORY_CATEGORY_SHADER_TOOLS,
+
+    /// CPU-side staging memory used to upload resource data.
+    MEMORY_CATEGORY_UPLOAD_STAGING,
+
+    /// Helper value that stores the total number of memory categories.
+    MEMORY_CATEGORY_COUNT
+};
+
+
+/// Memory statistics of a single memory category, see Diligent::MEMORY_CATEGORY.
+
+/// Total counters are cumulative. Allocation rates can be computed as the difference
+/// between two snapshots divided by the elapsed time.
+struct MemoryCategoryStatistics
+{
+    /// The number of bytes currently allocated.
+    Int64  LiveBytes        DEFAULT_INITIALIZER(0);
+
+    /// The maximum number of bytes that has ever been allocated at the same time.
+    Int64  PeakBytes        DEFAULT_INITIALIZER(0);
+
+    /// The number of allocations that have not been released yet.
+    Int64  LiveAllocations  DEFAULT_INITIALIZER(0);
+
+    /// The total number of allocations.
+    Uint64 TotalAllocations DEFAULT_INITIALIZER(0);
+
+    /// The total number of bytes allocated.
+    Uint64 TotalBytes       DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryCategoryStatistics MemoryCategoryStatistics;
+
+
 /// Engine creation information
 struct EngineCreateInfo
 {
@@ -3459,7 +3510,8 @@ struct EngineCreateInfo
     /// The number of deferred contexts to create when initializing the engine. If non-zero number
     /// is given, pointers to the contexts are written to ppContexts array by the engine factory
     /// functions (IEngineFactoryD3D11::CreateDeviceAndContextsD3D11,
-    /// IEngineFactoryD3D12::CreateDeviceAndContextsD3D12, and IEngineFactoryVk::CreateDeviceAndContextsVk)
+    /// IEngineFactoryD3D12::CreateDeviceAndContextsD3D12, IEngineFactoryVk::CreateDeviceAndContextsVk,
+    /// IEngineFactoryOpenGL::CreateDeviceAndSwapChainGL, and IEngineFactoryOpenGL::AttachToActiveGLContext)
     /// starting at position max(1, NumImmediateContexts).
     ///
     /// \remarks  Additional deferred contexts may be created later by calling IRenderDevice::CreateDeferredContext().
@@ -3628,6 +3680,25 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// * On Linux this affects the `DRI_PRIME` environment variable that is used by Mesa drivers that support PRIME.
     ADAPTER_TYPE PreferredAdapterType DEFAULT_INITIALIZER(ADAPTER_TYPE_UNKNOWN);
 
+    /// Size of the dynamic heap (the persistently mapped ring buffer that is used
+    /// to suballocate memory for dynamic uniform buffers). Zero disables the heap.
+    ///
+    /// \remarks    The heap requires GL_ARB_buffer_storage (core in OpenGL 4.4) and is ignored
+    ///             if the extension is not supported. When the heap is enabled, each time a
+    ///             USAGE_DYNAMIC uniform buffer is mapped with MAP_FLAG_DISCARD, the engine
+    ///             allocates a new chunk of the heap instead of orphaning the buffer storage.
+    ///             The memory is recycled when the GPU is done with the commands that were
+    ///             submitted before the frame was finished, so a buffer must be mapped again
+    ///             before it is used in the next frame. If the heap is exhausted, the engine
+    ///             waits for the GPU to release the memory of the previous frames; if the
+    ///             allocations of the current frame alone do not fit into the heap, the engine
+    ///             falls back to orphaning.
+    ///             Like in other backends, buffers allocated from the heap are rebound by every
+    ///             draw or dispatch command unless DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT flag
+    ///             is specified. When the device is destroyed, the engine prints heap usage
+    ///             statistics to the log that should be used to guide setting this variable.
+    Uint32 DynamicHeapSize DEFAULT_INITIALIZER(0);
+
 #if PLATFORM_WEB
     /// WebGL context attributes.
     WebGLContextAttribs WebGLAttribs;
@@ -3948,17 +4019,33 @@ struct DeviceFeaturesVk
     ///             If the extension is not supported, the texture is initialized on the device.
     DEVICE_FEATURE_STATE HostImageCopy DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates whether the device supports VK_EXT_descriptor_buffer extension.
+    ///
+    /// \remarks    When the extension is enabled, descriptor sets are stored in the dynamic heap
+    ///             buffer instead of being allocated from descriptor pools.
+    ///             If the extension is not supported, descriptor pools are used.
+    DEVICE_FEATURE_STATE DescriptorBuffer DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_EXT_graphics_pipeline_library extension.
+    ///
+    /// \remarks    When the extension is enabled, graphics pipelines are linked from cached
+    ///             vertex input, pre-rasterization, fragment shader and fragment output libraries.
+    ///             If the extension is not supported, monolithic pipelines are created.
+    DEVICE_FEATURE_STATE GraphicsPipelineLibrary DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeaturesVk() noexcept {}
 
 #define ENUMERATE_VK_DEVICE_FEATURES(Handler) \
     Handler(DynamicRendering) \
-    Handler(HostImageCopy)
+    Handler(HostImageCopy)    \
+    Handler(DescriptorBuffer) \
+    Handler(GraphicsPipelineLibrary)
 
     explicit constexpr DeviceFeaturesVk(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 2, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 4, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_VK_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -4164,6 +4251,34 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// features when compiling shaders from HLSL.
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Whether to submit command buffers to Vulkan queues from a dedicated thread.
+
+    /// When enabled, the immediate contexts hand the prepared submissions to the thread
+    /// and do not block on vkQueueSubmit.
+    /// The thread requires timeline semaphores and is only used when the
+    /// NativeFence feature is enabled.
+    ///
+    /// \remarks   IDeviceContext::LockCommandQueue() waits until the thread has passed all
+    ///             pending command buffers to the queue. While the command queue is locked,
+    ///             the application may use the VkQueue returned by ICommandQueueVk::GetVkQueue()
+    ///             directly, and all submissions are performed by the calling thread.
+    ///             The queue must not be accessed directly when it is not locked.
+    Bool EnableSubmissionThread DEFAULT_INITIALIZER(False);
+
+    /// Whether to defragment device-local memory.
+
+    /// When enabled, the immediate context relocates immutable vertex, index and indirect
+    /// argument buffers out of sparsely used memory pages in FinishFrame(), copying at most
+    /// a quarter of DeviceLocalMemoryPageSize every frame, so that the emptied pages can be released.
+    ///
+    /// \remarks   The VkBuffer handle returned by IBufferVk::GetVkBuffer() for such buffers
+    ///             may change in every call of FinishFrame(). The application must not cache
+    ///             the handle and must not record commands that use the buffers in other
+    ///             threads while the frame is being finished.
+    ///             Defragmentation is only performed when the device has a single immediate
+    ///             context, and is otherwise ignored.
+    Bool EnableMemoryDefragmentation DEFAULT_INITIALIZER(False);
+
 #if DILIGENT_CPP_INTERFACE
     EngineVkCreateInfo() noexcept :
         EngineVkCreateInfo{EngineCreateInfo{}}
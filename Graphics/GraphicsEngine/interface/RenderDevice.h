@@ -341,7 +341,11 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     /// \param [out] ppContext - Address of the memory location where a pointer to the
     ///                          deferred context interface will be written.
     /// 
-    /// \remarks    Deferred contexts are not supported in OpenGL and WebGPU backends.
+    /// \remarks    Deferred contexts are not supported in WebGPU backend.
+    ///             In OpenGL backend, deferred contexts record commands into a CPU command stream
+    ///             that is replayed by the immediate context in IDeviceContext::ExecuteCommandLists().
+    ///             Similar to other objects, deferred contexts must be created in the thread
+    ///             where the GL context is current, but may then be used from any thread.
     VIRTUAL void METHOD(CreateDeferredContext)(THIS_
                                                IDeviceContext** ppContext) PURE;
 
@@ -416,7 +416,7 @@ bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
     if (!ShaderIdxData)
         return false;
 
-    DynamicLinearAllocator Allocator{GetRawAllocator()};
+    DynamicLinearAllocator Allocator{GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION)};
 
     DeviceObjectArchive::ShaderIndexArray ShaderIndices;
     {
@@ -611,7 +611,7 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     if (pArchiveData == nullptr)
         return;
 
-    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+    PSOData<CreateInfoType> PSO{GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION)};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
         return;
 
@@ -844,7 +844,7 @@ void DearchiverBase::UnpackRenderPass(const RenderPassUnpackInfo& UnpackInfo, IR
     const auto& pObjArchive = pArchiveData->pObjArchive;
     VERIFY_EXPR(pObjArchive);
 
-    RPData RP{GetRawAllocator()};
+    RPData RP{GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION)};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(RPData::ArchiveResType, UnpackInfo.Name, RP))
         return;
 
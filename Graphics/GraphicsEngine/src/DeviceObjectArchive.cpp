@@ -533,7 +533,7 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
 {
-    auto& Allocator = GetRawAllocator();
+    auto& Allocator = GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION);
     for (auto& dst_res_it : m_NamedResources)
     {
         auto& DstData = dst_res_it.second.DeviceSpecific[static_cast<size_t>(Dev)];
@@ -564,7 +564,7 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
 
     static_assert(static_cast<size_t>(ResourceType::Count) == 8, "Did you add a new resource type? You may need to handle it here.");
 
-    auto&                  Allocator = GetRawAllocator();
+    auto&                  Allocator = GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION);
     DynamicLinearAllocator DynAllocator{Allocator, 512};
 
     // Copy shaders
@@ -31,13 +31,88 @@
 
 #include "EngineMemory.h"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "TrackingMemoryAllocator.hpp"
 #include "DebugUtilities.hpp"
 
+#include <array>
+#include <memory>
+#include <mutex>
+
 namespace Diligent
 {
 
 static IMemoryAllocator* g_pRawAllocator;
 
+namespace
+{
+
+class CategoryAllocators
+{
+public:
+    static CategoryAllocators& Get()
+    {
+        static CategoryAllocators Allocators;
+        return Allocators;
+    }
+
+    TrackingMemoryAllocator& GetAllocator(MEMORY_CATEGORY Category)
+    {
+        VERIFY(Category < MEMORY_CATEGORY_COUNT, "Invalid memory category");
+        return *m_Allocators[Category];
+    }
+
+    MemoryAllocationCounters& GetCounters(MEMORY_CATEGORY Category)
+    {
+        VERIFY(Category < MEMORY_CATEGORY_COUNT, "Invalid memory category");
+        return m_Counters[Category];
+    }
+
+    void SetParentAllocator(IMemoryAllocator& ParentAllocator)
+    {
+        std::lock_guard<std::mutex> Lock{m_ParentMtx};
+
+        bool ParentChanged = false;
+        for (size_t i = 0; i < m_Allocators.size(); ++i)
+        {
+            if (&m_Allocators[i]->GetParentAllocator() == &ParentAllocator)
+                continue;
+
+            ParentChanged = true;
+            // Memory allocated through a category allocator must be released through the same parent
+            // allocator, so the parent can't be replaced while any category has live allocations
+            // (e.g. the default shader source stream factory created before the render device).
+            if (m_Counters[i].LiveAllocations.load(std::memory_order_relaxed) != 0)
+            {
+                DEV_ERROR("Unable to replace the parent allocator of memory category ", i,
+                          " while it has live allocations. All categories keep using the original allocator.");
+                return;
+            }
+        }
+
+        if (!ParentChanged)
+            return;
+
+        for (auto& pAllocator : m_Allocators)
+            pAllocator->SetParentAllocator(ParentAllocator);
+    }
+
+private:
+    CategoryAllocators()
+    {
+        IMemoryAllocator& ParentAllocator = g_pRawAllocator != nullptr ? *g_pRawAllocator : DefaultRawMemoryAllocator::GetAllocator();
+        for (size_t i = 0; i < m_Allocators.size(); ++i)
+            m_Allocators[i] = std::make_unique<TrackingMemoryAllocator>(ParentAllocator, m_Counters[i]);
+    }
+
+    std::array<MemoryAllocationCounters, MEMORY_CATEGORY_COUNT>                 m_Counters;
+    std::array<std::unique_ptr<TrackingMemoryAllocator>, MEMORY_CATEGORY_COUNT> m_Allocators;
+
+    // Serializes parent allocator changes made by engine factories
+    std::mutex m_ParentMtx;
+};
+
+} // namespace
+
 void SetRawAllocator(IMemoryAllocator* pRawAllocator)
 {
     if (pRawAllocator == nullptr)
@@ -51,6 +126,7 @@ void SetRawAllocator(IMemoryAllocator* pRawAllocator)
                   "This may result in undefined behavior.");
 
     g_pRawAllocator = pRawAllocator;
+    CategoryAllocators::Get().SetParentAllocator(*pRawAllocator);
 }
 
 IMemoryAllocator& GetRawAllocator()
@@ -63,6 +139,33 @@ IMemoryAllocator& GetStringAllocator()
     return GetRawAllocator();
 }
 
+IMemoryAllocator& GetRawAllocator(MEMORY_CATEGORY Category)
+{
+    return CategoryAllocators::Get().GetAllocator(Category);
+}
+
+MemoryAllocationCounters& GetMemoryCategoryCounters(MEMORY_CATEGORY Category)
+{
+    return CategoryAllocators::Get().GetCounters(Category);
+}
+
+void GetMemoryCategoryStatistics(MEMORY_CATEGORY Category, MemoryCategoryStatistics& Stats)
+{
+    const MemoryAllocationCounters& Counters = GetMemoryCategoryCounters(Category);
+
+    Stats.LiveBytes        = Counters.LiveBytes.load(std::memory_order_relaxed);
+    Stats.PeakBytes        = Counters.PeakBytes.load(std::memory_order_relaxed);
+    Stats.LiveAllocations  = Counters.LiveAllocations.load(std::memory_order_relaxed);
+    Stats.TotalAllocations = Counters.TotalAllocations.load(std::memory_order_relaxed);
+    Stats.TotalBytes       = Counters.TotalBytes.load(std::memory_order_relaxed);
+}
+
+void ResetMemoryCategoryStatistics()
+{
+    for (Uint32 i = 0; i < MEMORY_CATEGORY_COUNT; ++i)
+        GetMemoryCategoryCounters(static_cast<MEMORY_CATEGORY>(i)).ResetCumulative();
+}
+
 } // namespace Diligent
 #if 0
 
@@ -73,7 +73,7 @@ Texture3D_D3D11::Texture3D_D3D11(IReferenceCounters*        pRefCounters,
     };
     // clang-format on
 
-    std::vector<D3D11_SUBRESOURCE_DATA, STDAllocatorRawMem<D3D11_SUBRESOURCE_DATA>> D3D11InitData(STD_ALLOCATOR_RAW_MEM(D3D11_SUBRESOURCE_DATA, GetRawAllocator(), "Allocator for vector<D3D11_SUBRESOURCE_DATA>"));
+    std::vector<D3D11_SUBRESOURCE_DATA, STDAllocatorRawMem<D3D11_SUBRESOURCE_DATA>> D3D11InitData(STD_ALLOCATOR_RAW_MEM(D3D11_SUBRESOURCE_DATA, GetRawAllocator(MEMORY_CATEGORY_UPLOAD_STAGING), "Allocator for vector<D3D11_SUBRESOURCE_DATA>"));
     PrepareD3D11InitData(pInitData, Tex3DDesc.MipLevels, D3D11InitData);
 
     auto* pd3d11Device = pRenderDeviceD3D11->GetD3D11Device();
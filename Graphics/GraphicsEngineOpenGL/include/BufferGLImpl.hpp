@@ -76,6 +76,43 @@ public:
 
     const GLObjectWrappers::GLBufferObj& GetGLHandle() const { return m_GlBuffer; }
 
+    /// Whether the buffer is suballocated from the dynamic heap when it is mapped for writing.
+    bool UsesDynamicHeap() const { return m_UseDynamicHeap; }
+
+    /// Returns the GL buffer object that holds the current buffer data.
+    /// For a buffer suballocated from the dynamic heap, this is the heap buffer.
+    const GLObjectWrappers::GLBufferObj& GetDataGLHandle() const
+    {
+        return m_pDynamicHeapBuffer != nullptr ? *m_pDynamicHeapBuffer : m_GlBuffer;
+    }
+
+    /// Returns the offset of the current buffer data in the buffer object returned by GetDataGLHandle().
+    GLintptr GetDataOffset() const
+    {
+        return m_pDynamicHeapBuffer != nullptr ? StaticCast<GLintptr>(m_DynamicHeapOffset) : 0;
+    }
+
+    /// Whether the current buffer data are suballocated from the dynamic heap.
+    bool HasDynamicAllocation() const { return m_pDynamicHeapBuffer != nullptr; }
+
+    /// Sets the dynamic heap allocation that holds the buffer data.
+    /// Null heap buffer indicates that the data are stored in the buffer's own storage.
+    /// HeapFrame is the dynamic heap frame in which the allocation was made.
+    void SetDynamicAllocation(const GLObjectWrappers::GLBufferObj* pHeapBuffer, Uint64 Offset, Uint64 HeapFrame)
+    {
+        VERIFY_EXPR(m_UseDynamicHeap || pHeapBuffer == nullptr);
+        m_pDynamicHeapBuffer = pHeapBuffer;
+        m_DynamicHeapOffset  = Offset;
+#ifdef DILIGENT_DEVELOPMENT
+        m_DvpDynamicHeapFrame = HeapFrame;
+#endif
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    /// Verifies that the dynamic heap allocation of the buffer, if any, has been made in the current heap frame.
+    void DvpVerifyDynamicAllocation(Uint64 CurrentHeapFrame) const;
+#endif
+
     /// Implementation of IBufferGL::GetGLBufferHandle().
     virtual GLuint DILIGENT_CALL_TYPE GetGLBufferHandle() const override final { return GetGLHandle(); }
 
@@ -94,6 +131,15 @@ private:
     GLObjectWrappers::GLBufferObj m_GlBuffer;
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
+    const bool                    m_UseDynamicHeap;
+
+    // The buffer's own storage is still allocated to be used as the fallback
+    // when an allocation can't be satisfied by the dynamic heap.
+    const GLObjectWrappers::GLBufferObj* m_pDynamicHeapBuffer = nullptr;
+    Uint64                               m_DynamicHeapOffset  = 0;
+#ifdef DILIGENT_DEVELOPMENT
+    Uint64 m_DvpDynamicHeapFrame = 0;
+#endif
 
 #if PLATFORM_WEB
     struct MappedData
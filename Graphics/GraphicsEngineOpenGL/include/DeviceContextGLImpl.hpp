@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "EngineGLImplTraits.hpp"
@@ -43,6 +44,9 @@
 
 #include "GLContextState.hpp"
 #include "GLObjectWrapper.hpp"
+#include "GLDynamicHeap.hpp"
+#include "GLCommandStream.hpp"
+#include "FixedBlockMemoryAllocator.hpp"
 
 namespace Diligent
 {
@@ -316,12 +320,17 @@ protected:
     GLContextState m_ContextState;
 
 private:
+    // Must be declared after the context state as it uses the state in the destructor
+    std::unique_ptr<GLDynamicHeap> m_pDynamicHeap;
+
     __forceinline void PrepareForDraw(DRAW_FLAGS Flags, bool IsIndexed, GLenum& GlTopology);
     __forceinline void PrepareForIndexedDraw(VALUE_TYPE IndexType, Uint32 FirstIndexLocation, GLenum& GLIndexType, size_t& FirstIndexByteOffset);
     __forceinline void PrepareForIndirectDraw(IBuffer* pAttribsBuffer);
     __forceinline void PrepareForIndirectDrawCount(IBuffer* pCountBuffer);
     __forceinline void PostDraw();
 
+    GLCommandStream& GetCommandStream();
+
     using TBindings = PipelineResourceSignatureGLImpl::TBindings;
     void BindProgramResources(Uint32 BindSRBMask);
 
@@ -363,6 +372,14 @@ private:
     GLObjectWrappers::GLFrameBufferObj m_DefaultFBO;
 
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
+
+    // Command stream that is being recorded by the deferred context
+    std::unique_ptr<GLCommandStream> m_pCommandStream;
+
+    // Buffers mapped by the deferred context and their data in the command stream
+    std::vector<std::pair<IBuffer*, void*>> m_DeferredMappedBuffers;
+
+    FixedBlockMemoryAllocator m_CmdListAllocator;
 };
 
 } // namespace Diligent
@@ -44,7 +44,9 @@
 #include "RenderPass.h"
 #include "Framebuffer.h"
 #include "PipelineResourceSignature.h"
+#include "PipelineStateCacheGL.h"
 #include "DeviceContextGL.h"
+#include "CommandList.h"
 #include "BaseInterfacesGL.h"
 
 namespace Diligent
@@ -64,13 +66,13 @@ class FenceGLImpl;
 class QueryGLImpl;
 class RenderPassGLImpl;
 class FramebufferGLImpl;
+class CommandListGLImpl;
 class BottomLevelASGLImpl;
 class TopLevelASGLImpl;
 class ShaderBindingTableGLImpl;
 class PipelineResourceSignatureGLImpl;
 class DeviceMemoryGLImpl;
-class PipelineStateCacheGlImpl
-{};
+class PipelineStateCacheGLImpl;
 
 class FixedBlockMemoryAllocator;
 
@@ -105,7 +107,9 @@ struct EngineGLImplTraits
     using QueryInterface                     = IQueryGL;
     using RenderPassInterface                = IRenderPass;
     using FramebufferInterface               = IFramebuffer;
+    using CommandListInterface               = ICommandList;
     using PipelineResourceSignatureInterface = IPipelineResourceSignature;
+    using PipelineStateCacheInterface        = IPipelineStateCacheGL;
 
     using RenderDeviceImplType              = RenderDeviceGLImpl;
     using DeviceContextImplType             = DeviceContextGLImpl;
@@ -121,12 +125,13 @@ struct EngineGLImplTraits
     using QueryImplType                     = QueryGLImpl;
     using RenderPassImplType                = RenderPassGLImpl;
     using FramebufferImplType               = FramebufferGLImpl;
+    using CommandListImplType               = CommandListGLImpl;
     using BottomLevelASImplType             = BottomLevelASGLImpl;
     using TopLevelASImplType                = TopLevelASGLImpl;
     using ShaderBindingTableImplType        = ShaderBindingTableGLImpl;
     using PipelineResourceSignatureImplType = PipelineResourceSignatureGLImpl;
     using DeviceMemoryImplType              = DeviceMemoryGLImpl;
-    using PipelineStateCacheImplType        = PipelineStateCacheGlImpl;
+    using PipelineStateCacheImplType        = PipelineStateCacheGLImpl;
 
     using BuffViewObjAllocatorType = FixedBlockMemoryAllocator;
     using TexViewObjAllocatorType  = FixedBlockMemoryAllocator;
@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLCommandStream class
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "MemoryAllocator.h"
+#include "Object.h"
+#include "RefCntAutoPtr.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+class DeviceContextGLImpl;
+
+/// CPU command stream recorded by a deferred context in OpenGL backend.
+
+/// Commands are trivially-destructible callables that are placed into linear memory pages
+/// together with the data they reference (viewports, clear values, buffer updates, etc.).
+/// Commands keep raw pointers to device objects, while the stream holds strong references
+/// to these objects until it is destroyed. The stream is replayed by calling
+/// the corresponding methods of the immediate context. The class is not thread-safe.
+class GLCommandStream
+{
+public:
+    explicit GLCommandStream(IMemoryAllocator& Allocator, size_t PageSize = 16 << 10);
+    ~GLCommandStream();
+
+    // clang-format off
+    GLCommandStream             (const GLCommandStream&)  = delete;
+    GLCommandStream             (      GLCommandStream&&) = delete;
+    GLCommandStream& operator = (const GLCommandStream&)  = delete;
+    GLCommandStream& operator = (      GLCommandStream&&) = delete;
+    // clang-format on
+
+    /// Appends a command to the stream.
+
+    /// \param [in] Handler - Callable with the void(DeviceContextGLImpl&) signature that
+    ///                       executes the command on the immediate context.
+    template <typename HandlerType>
+    void Record(HandlerType&& Handler)
+    {
+        using CommandType = Command<typename std::decay<HandlerType>::type>;
+        static_assert(std::is_trivially_destructible<CommandType>::value,
+                      "Commands must be trivially destructible. Use KeepAlive() to keep the objects referenced by the command alive.");
+
+        CommandType* pCmd = new (Allocate(sizeof(CommandType), alignof(CommandType))) CommandType{std::forward<HandlerType>(Handler)};
+        if (m_pLastCmd != nullptr)
+            m_pLastCmd->pNext = pCmd;
+        else
+            m_pFirstCmd = pCmd;
+        m_pLastCmd = pCmd;
+        ++m_NumCommands;
+    }
+
+    /// Keeps a strong reference to the object until the stream is destroyed.
+    void KeepAlive(IObject* pObject)
+    {
+        // Consecutive commands often reference the same object
+        if (pObject != nullptr && (m_Objects.empty() || m_Objects.back().RawPtr() != pObject))
+            m_Objects.emplace_back(pObject);
+    }
+
+    /// Allocates memory in the stream that stays valid until the stream is destroyed.
+    void* Allocate(size_t Size, size_t Alignment = sizeof(void*));
+
+    void* CopyData(const void* pData, size_t Size)
+    {
+        if (pData == nullptr || Size == 0)
+            return nullptr;
+
+        void* pDst = Allocate(Size);
+        std::memcpy(pDst, pData, Size);
+        return pDst;
+    }
+
+    template <typename T>
+    T* CopyArray(const T* pSrc, size_t Count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be copied into the stream");
+        return static_cast<T*>(CopyData(pSrc, sizeof(T) * Count));
+    }
+
+    const Char* CopyString(const Char* Str)
+    {
+        return Str != nullptr ? static_cast<const Char*>(CopyData(Str, strlen(Str) + 1)) : nullptr;
+    }
+
+    /// Executes all commands in the stream on the immediate context.
+    void Execute(DeviceContextGLImpl& Ctx) const;
+
+    Uint32 GetNumCommands() const { return m_NumCommands; }
+
+    /// Returns the total size of the memory pages allocated by the stream.
+    size_t GetMemorySize() const { return m_MemorySize; }
+
+private:
+    struct CommandHeader
+    {
+        using ExecuteFuncType = void (*)(const CommandHeader&, DeviceContextGLImpl&);
+
+        explicit CommandHeader(ExecuteFuncType _Execute) :
+            Execute{_Execute}
+        {}
+
+        const ExecuteFuncType Execute;
+        CommandHeader*        pNext = nullptr;
+    };
+
+    template <typename HandlerType>
+    struct Command final : CommandHeader
+    {
+        template <typename ArgType>
+        explicit Command(ArgType&& _Handler) :
+            CommandHeader{&ExecuteCommand},
+            Handler{std::forward<ArgType>(_Handler)}
+        {}
+
+        static void ExecuteCommand(const CommandHeader& Cmd, DeviceContextGLImpl& Ctx)
+        {
+            static_cast<const Command&>(Cmd).Handler(Ctx);
+        }
+
+        const HandlerType Handler;
+    };
+
+    IMemoryAllocator& m_Allocator;
+    const size_t      m_PageSize;
+
+    std::vector<void*> m_Pages;
+
+    Uint8* m_pCurrPtr = nullptr;
+    Uint8* m_pPageEnd = nullptr;
+
+    CommandHeader* m_pFirstCmd = nullptr;
+    CommandHeader* m_pLastCmd  = nullptr;
+
+    Uint32 m_NumCommands = 0;
+    size_t m_MemorySize  = 0;
+
+    std::vector<RefCntAutoPtr<IObject>> m_Objects;
+};
+
+} // namespace Diligent
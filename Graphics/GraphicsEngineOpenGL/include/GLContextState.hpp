@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "GraphicsTypes.h"
+#include "DeviceContext.h"
 #include "GLObjectWrapper.hpp"
 #include "UniqueIdentifier.hpp"
 #include "GLContext.hpp"
@@ -42,7 +43,7 @@ namespace Diligent
 class GLContextState
 {
 public:
-    GLContextState(class RenderDeviceGLImpl* pDeviceGL);
+    GLContextState(class RenderDeviceGLImpl* pDeviceGL, DeviceContextBindingCounters& BindingCounters);
 
     // clang-format off
 
@@ -59,6 +60,16 @@ public:
     void BindImage         (Uint32 Index, class BufferViewGLImpl* pBuffView, GLenum Access, GLenum Format);
     void BindStorageBlock  (Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
 
+    // Stage*() methods filter redundant bindings the same way as the Bind*() methods above, but
+    // when GL_ARB_multi_bind is supported, changed bindings are only committed to GL by
+    // CommitStagedBindings() that sets every contiguous range of slots with a single
+    // glBindTextures, glBindSamplers or glBindBuffersRange call.
+    void StageTexture      (Uint32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& Tex);
+    void StageSampler      (Uint32 Index,      const GLObjectWrappers::GLSamplerObj& GLSampler);
+    void StageUniformBuffer(Uint32 Index,      const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
+    void StageStorageBlock (Uint32 Index,      const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
+    void CommitStagedBindings();
+
     void EnsureMemoryBarrier(MEMORY_BARRIER RequiredBarriers, class AsyncWritableResource *pRes = nullptr);
     void SetPendingMemoryBarriers(MEMORY_BARRIER PendingBarriers);
 
@@ -121,6 +132,7 @@ public:
         GLint MaxCombinedTexUnits          = 0;
         GLint MaxDrawBuffers               = 0;
         GLint MaxUniformBufferBindings     = 0;
+        bool  IsMultiBindSupported         = false;
     };
     const ContextCaps& GetContextCaps() { return m_Caps; }
 
@@ -239,6 +251,26 @@ private:
     std::vector<BoundImageInfo>   m_BoundImages;
     std::vector<BoundBufferInfo>  m_BoundStorageBlocks;
 
+    // Bindings that have been staged, but not yet committed to GL
+    struct StagedBinding
+    {
+        GLuint     Slot   = 0;
+        GLuint     Handle = 0;
+        GLintptr   Offset = 0;
+        GLsizeiptr Size   = 0;
+    };
+    std::vector<StagedBinding> m_StagedTextures;
+    std::vector<StagedBinding> m_StagedSamplers;
+    std::vector<StagedBinding> m_StagedUniformBuffers;
+    std::vector<StagedBinding> m_StagedStorageBlocks;
+
+    // Scratch arrays for multi-bind calls
+    std::vector<GLuint>     m_MultiBindHandles;
+    std::vector<GLintptr>   m_MultiBindOffsets;
+    std::vector<GLsizeiptr> m_MultiBindSizes;
+
+    DeviceContextBindingCounters& m_BindingCounters;
+
     MEMORY_BARRIER m_PendingMemoryBarriers = MEMORY_BARRIER_NONE;
 
     class EnableStateHelper
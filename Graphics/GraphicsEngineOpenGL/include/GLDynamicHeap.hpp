@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLDynamicHeap class
+
+#include <deque>
+#include <utility>
+
+#include "GraphicsTypes.h"
+#include "GLObjectWrapper.hpp"
+#include "RingBuffer.hpp"
+
+namespace Diligent
+{
+
+class GLContextState;
+
+/// Persistently mapped ring buffer that dynamic buffers are suballocated from.
+
+/// The heap is backed by a single buffer created with glBufferStorage() and mapped
+/// once with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT, so mapping a dynamic buffer
+/// does not call into the driver. Every time a frame is finished, a fence is inserted
+/// into the command stream, and the space allocated in the frame is reclaimed
+/// once the fence is signaled. The class is not thread-safe.
+class GLDynamicHeap
+{
+public:
+    static constexpr Uint64 InvalidOffset = ~Uint64{0};
+
+    GLDynamicHeap(GLContextState& CtxState, IMemoryAllocator& Allocator, Uint64 Size) noexcept(false);
+    ~GLDynamicHeap();
+
+    // clang-format off
+    GLDynamicHeap             (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap             (      GLDynamicHeap&&) = delete;
+    GLDynamicHeap& operator = (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap& operator = (      GLDynamicHeap&&) = delete;
+    // clang-format on
+
+    /// Allocates a chunk of the heap.
+
+    /// If the heap is full, the method waits until the GPU is done with the frames that
+    /// have already been finished. Returns InvalidOffset if the allocation is larger than
+    /// the heap, or if the allocations of the current frame leave no room for it, in which
+    /// case the caller must fall back to buffer orphaning.
+    Uint64 Allocate(Uint64 Size, Uint64 Alignment);
+
+    /// Inserts a fence that marks the end of the current frame and
+    /// reclaims the space of all frames whose fences have been signaled.
+    void FinishCurrentFrame();
+
+    /// Returns the number of the current heap frame.
+
+    /// The number is incremented every time a non-empty frame is finished, after which
+    /// the space of all allocations made in the previous frames may be reused.
+    Uint64 GetCurrentFrame() const { return m_NextFenceValue; }
+
+    Uint8* GetCPUAddress() const { return m_pCPUAddress; }
+
+    const GLObjectWrappers::GLBufferObj& GetGLBuffer() const { return m_GLBuffer; }
+
+private:
+    // Releases the space of completed frames. If WaitForOldest is true, blocks until the oldest pending frame is complete.
+    void ReleaseCompletedFrames(bool WaitForOldest);
+
+    GLContextState& m_CtxState;
+
+    GLObjectWrappers::GLBufferObj m_GLBuffer;
+    Uint8*                        m_pCPUAddress = nullptr;
+
+    RingBuffer m_RingBuffer;
+
+    // Fences of the frames that may still be in use by the GPU
+    std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFrames;
+
+    Uint64 m_NextFenceValue = 1;
+    Uint64 m_CurrFrameSize  = 0;
+
+    Uint64 m_PeakUsedSize = 0;
+    Uint32 m_NumStalls    = 0;
+};
+
+} // namespace Diligent
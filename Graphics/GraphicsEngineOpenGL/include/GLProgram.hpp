@@ -32,6 +32,7 @@
 #include "GLObjectWrapper.hpp"
 #include "ShaderResourcesGL.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 
 namespace Diligent
 {
@@ -42,9 +43,13 @@ class GLContextState;
 class GLProgram
 {
 public:
-    GLProgram(ShaderGLImpl* const* ppShaders,
-              Uint32               NumShaders,
-              bool                 IsSeparableProgram) noexcept;
+    /// If the pipeline state cache is not null, the program is first loaded from the cached
+    /// binary. If the binary is not found or rejected by the driver, the program is linked
+    /// from the shaders, and its binary is added to the cache once linking is complete.
+    GLProgram(ShaderGLImpl* const*      ppShaders,
+              Uint32                    NumShaders,
+              bool                      IsSeparableProgram,
+              PipelineStateCacheGLImpl* pPSOCache = nullptr) noexcept;
     ~GLProgram();
 
     const GLObjectWrappers::GLProgramObj& GetGLHandle() const { return m_GLProg; }
@@ -85,6 +90,10 @@ private:
     LinkStatus m_LinkStatus      = LinkStatus::Undefined;
     bool       m_BindingsApplied = false;
 
+    // Pipeline state cache to store the program binary to after linking is complete
+    RefCntAutoPtr<PipelineStateCacheGLImpl> m_pPSOCache;
+    PipelineStateCacheGLImpl::ProgramKey    m_PSOCacheKey;
+
     std::shared_ptr<const ShaderResourcesGL> m_pResources;
 
 #ifdef DILIGENT_DEBUG
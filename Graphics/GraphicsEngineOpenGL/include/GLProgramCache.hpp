@@ -63,6 +63,7 @@ public:
         PipelineResourceLayoutDesc*  pResourceLayout    = nullptr;
         IPipelineResourceSignature** ppSignatures       = nullptr;
         Uint32                       NumSignatures      = 0;
+        IPipelineStateCache*         pPSOCache          = nullptr;
     };
 
     SharedGLProgramObjPtr GetProgram(const GetProgramAttribs& Attribs);
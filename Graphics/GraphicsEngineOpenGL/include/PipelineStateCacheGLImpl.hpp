@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateCacheGLImpl class
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "EngineGLImplTraits.hpp"
+#include "PipelineStateCacheBase.hpp"
+
+namespace Diligent
+{
+
+class ShaderGLImpl;
+
+/// Pipeline state cache implementation in OpenGL backend.
+
+/// The cache stores binaries of linked programs retrieved with glGetProgramBinary.
+/// Programs are keyed by the hash of the GLSL source of the attached shaders.
+/// The serialized data are only valid for the driver that produced them: the data
+/// generated by a different vendor, renderer or driver version are ignored.
+class PipelineStateCacheGLImpl final : public PipelineStateCacheBase<EngineGLImplTraits>
+{
+public:
+    using TPipelineStateCacheBase = PipelineStateCacheBase<EngineGLImplTraits>;
+
+    PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                             RenderDeviceGLImpl*                 pDeviceGL,
+                             const PipelineStateCacheCreateInfo& CreateInfo);
+    ~PipelineStateCacheGLImpl();
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_PipelineStateCacheGL, TPipelineStateCacheBase)
+
+    /// Implementation of IPipelineStateCache::GetData().
+    virtual void DILIGENT_CALL_TYPE GetData(IDataBlob** ppBlob) override final;
+
+    /// Implementation of IPipelineStateCacheGL::GetStats().
+    virtual void DILIGENT_CALL_TYPE GetStats(PipelineStateCacheStatsGL& Stats) const override final;
+
+    struct ProgramKey
+    {
+        Uint64 Hash         = 0;
+        Uint64 SourceLength = 0;
+
+        bool operator==(const ProgramKey& Rhs) const noexcept
+        {
+            return Hash == Rhs.Hash && SourceLength == Rhs.SourceLength;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const ProgramKey& Key) const noexcept
+            {
+                return static_cast<size_t>(Key.Hash);
+            }
+        };
+    };
+
+    static ProgramKey ComputeProgramKey(ShaderGLImpl* const* ppShaders,
+                                        Uint32               NumShaders,
+                                        bool                 IsSeparableProgram);
+
+    /// Loads the program binary into the program object.
+
+    /// \return     true if the program has been successfully linked from the cached binary,
+    ///             and false if the binary is not found or was rejected by the driver.
+    ///             In the latter case the binary is removed from the cache, and the
+    ///             program must be linked from the shaders.
+    bool LoadProgram(const ProgramKey& Key, GLuint GLProg);
+
+    /// Retrieves the binary of the linked program and adds it to the cache.
+    bool StoreProgram(const ProgramKey& Key, GLuint GLProg);
+
+private:
+    struct ProgramBinary
+    {
+        GLenum             Format = 0;
+        std::vector<Uint8> Data;
+    };
+
+    void Deserialize(const void* pData, size_t DataSize);
+
+    // Hash of the vendor, renderer and version strings of the driver
+    Uint64 m_DriverHash = 0;
+
+    std::atomic<Uint32> m_NumProgramsLoaded{0};
+    std::atomic<Uint32> m_NumProgramsRejected{0};
+    std::atomic<Uint32> m_NumProgramsStored{0};
+
+    std::mutex                                                                               m_ProgramsMtx;
+    std::unordered_map<ProgramKey, std::shared_ptr<const ProgramBinary>, ProgramKey::Hasher> m_Programs;
+};
+
+} // namespace Diligent
@@ -224,9 +224,15 @@ public:
     {
         bool FramebufferSRGB  = false;
         bool SemalessCubemaps = false;
+        bool ProgramBinary    = false;
+        bool BufferStorage    = false;
+        bool MultiBind        = false;
     };
     const GLDeviceCaps& GetGLCaps() const { return m_GLCaps; }
 
+    /// Returns the size of the dynamic heap, or zero if dynamic buffers are not suballocated from the heap.
+    Uint32 GetDynamicHeapSize() const { return m_DynamicHeapSize; }
+
 protected:
     friend class DeviceContextGLImpl;
     friend class TextureBaseGL;
@@ -260,6 +266,8 @@ private:
 
     GLDeviceLimits m_DeviceLimits = {};
     GLDeviceCaps   m_GLCaps       = {};
+
+    Uint32 m_DynamicHeapSize = 0;
 };
 
 } // namespace Diligent
@@ -71,12 +71,13 @@ public:
         Uint32 RangeSize     = 0;
         Uint32 DynamicOffset = 0;
 
-        // In OpenGL dynamic buffers are only those that are not bound as a whole and
-        // can use a dynamic offset, irrespective of the variable type or whether the
-        // buffer is USAGE_DYNAMIC or not.
+        // In OpenGL dynamic buffers are those that are not bound as a whole and
+        // can use a dynamic offset, irrespective of the variable type, as well as
+        // USAGE_DYNAMIC buffers suballocated from the dynamic heap that move every
+        // time they are mapped.
         bool IsDynamic() const
         {
-            return pBuffer && RangeSize < pBuffer->GetDesc().Size;
+            return pBuffer && (RangeSize < pBuffer->GetDesc().Size || pBuffer->UsesDynamicHeap());
         }
     };
 
@@ -328,6 +329,9 @@ public:
         m_bStaticResourcesInitialized = true;
     }
     bool StaticResourcesInitialized() const { return m_bStaticResourcesInitialized; }
+
+    // Verifies that all uniform buffers suballocated from the dynamic heap have been mapped in the current heap frame
+    void DvpVerifyDynamicAllocations(Uint64 CurrentHeapFrame) const;
 #endif
 
     // Binds all resources
@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::IPipelineStateCacheGL interface
+
+#include "../../GraphicsEngine/interface/PipelineStateCache.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {C39382AB-AFBA-44C4-B6EF-C04C6FBC1D1F}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_PipelineStateCacheGL =
+    {0xc39382ab, 0xafba, 0x44c4, {0xb6, 0xef, 0xc0, 0x4c, 0x6f, 0xbc, 0x1d, 0x1f}};
+
+// clang-format off
+
+/// Program binary statistics of a pipeline state cache, see IPipelineStateCacheGL::GetStats().
+struct PipelineStateCacheStatsGL
+{
+    /// The number of programs that have been created from the cached binaries.
+    Uint32 NumProgramsLoaded   DEFAULT_INITIALIZER(0);
+
+    /// The number of cached binaries that have been rejected by the driver.
+    /// The programs were linked from the shaders instead.
+    Uint32 NumProgramsRejected DEFAULT_INITIALIZER(0);
+
+    /// The number of program binaries that have been added to the cache.
+    Uint32 NumProgramsStored   DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineStateCacheStatsGL PipelineStateCacheStatsGL;
+
+// clang-format on
+
+#define DILIGENT_INTERFACE_NAME IPipelineStateCacheGL
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IPipelineStateCacheGLInclusiveMethods \
+    IPipelineStateCacheInclusiveMethods;      \
+    IPipelineStateCacheGLMethods PipelineStateCacheGL
+
+// clang-format off
+
+/// Exposes OpenGL-specific functionality of a pipeline state cache object.
+DILIGENT_BEGIN_INTERFACE(IPipelineStateCacheGL, IPipelineStateCache)
+{
+    /// Returns the program binary statistics of the cache.
+
+    /// \param [out] Stats - The statistics accumulated since the cache was created.
+    VIRTUAL void METHOD(GetStats)(THIS_
+                                  PipelineStateCacheStatsGL REF Stats) CONST PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+#    define IPipelineStateCacheGL_GetStats(This, ...) CALL_IFACE_METHOD(PipelineStateCacheGL, GetStats, This, __VA_ARGS__)
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
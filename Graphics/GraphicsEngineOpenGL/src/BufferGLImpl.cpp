@@ -69,6 +69,14 @@ static GLenum GetBufferBindTarget(const BufferDesc& Desc)
 
     return Target;
 }
+
+static bool UseDynamicHeap(const BufferDesc& Desc, const RenderDeviceGLImpl* pDeviceGL)
+{
+    // Only uniform buffers are suballocated: vertex and index buffers are referenced by VAOs that
+    // would have to be recreated, and buffer views can't be retargeted to a different buffer object.
+    return Desc.Usage == USAGE_DYNAMIC && Desc.BindFlags == BIND_UNIFORM_BUFFER && pDeviceGL->GetDynamicHeapSize() != 0;
+}
+
 BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceGLImpl*        pDeviceGL,
@@ -85,9 +93,10 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         BuffDesc,
         bIsDeviceInternal
     },
-    m_GlBuffer    {true                          }, // Create buffer immediately
-    m_BindTarget  {GetBufferBindTarget(BuffDesc) },
-    m_GLUsageHint {UsageToGLUsage(BuffDesc)}
+    m_GlBuffer      {true                              }, // Create buffer immediately
+    m_BindTarget    {GetBufferBindTarget(BuffDesc)     },
+    m_GLUsageHint   {UsageToGLUsage(BuffDesc)          },
+    m_UseDynamicHeap{UseDynamicHeap(BuffDesc, pDeviceGL)}
 // clang-format on
 {
     ValidateBufferInitData(BuffDesc, pBuffData);
@@ -199,9 +208,10 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         bIsDeviceInternal
     },
     // Attach to external buffer handle
-    m_GlBuffer    {true, GLObjectWrappers::GLBufferObjCreateReleaseHelper(GLHandle)},
-    m_BindTarget  {GetBufferBindTarget(m_Desc)},
-    m_GLUsageHint {UsageToGLUsage(BuffDesc)   }
+    m_GlBuffer      {true, GLObjectWrappers::GLBufferObjCreateReleaseHelper(GLHandle)},
+    m_BindTarget    {GetBufferBindTarget(m_Desc)},
+    m_GLUsageHint   {UsageToGLUsage(BuffDesc)   },
+    m_UseDynamicHeap{false                      }
 // clang-format on
 {
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
@@ -253,8 +263,8 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // what was bound to the target before your copy.
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, StaticCast<GLintptr>(SrcOffset), StaticCast<GLintptr>(DstOffset), StaticCast<GLsizeiptr>(Size));
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.GetDataGLHandle(), ResetVAO);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, SrcBufferGL.GetDataOffset() + StaticCast<GLintptr>(SrcOffset), StaticCast<GLintptr>(DstOffset), StaticCast<GLsizeiptr>(Size));
     DEV_CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
@@ -434,4 +444,16 @@ SparseBufferProperties BufferGLImpl::GetSparseProperties() const
     return {};
 }
 
+#ifdef DILIGENT_DEVELOPMENT
+void BufferGLImpl::DvpVerifyDynamicAllocation(Uint64 CurrentHeapFrame) const
+{
+    if (!HasDynamicAllocation())
+        return;
+
+    DEV_CHECK_ERR(m_DvpDynamicHeapFrame == CurrentHeapFrame, "Dynamic heap allocation of dynamic buffer '", m_Desc.Name, "' made in heap frame ", m_DvpDynamicHeapFrame,
+                  " is out-of-date (the current heap frame is ", CurrentHeapFrame, "). Note: the space of the dynamic heap is recycled after Flush(), FinishFrame() "
+                  "or when the heap runs out of space. A buffer must be mapped again before it is used after any of these events.");
+}
+#endif
+
 } // namespace Diligent
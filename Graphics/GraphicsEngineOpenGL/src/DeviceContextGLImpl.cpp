@@ -33,6 +33,7 @@
 #include <fstream>
 #include <string>
 #include <array>
+#include <algorithm>
 
 #include "SwapChainGL.h"
 
@@ -49,6 +50,7 @@
 #include "PipelineStateGLImpl.hpp"
 #include "FenceGLImpl.hpp"
 #include "ShaderResourceBindingGLImpl.hpp"
+#include "CommandListGLImpl.hpp"
 
 #include "GLTypeConversions.hpp"
 #include "VAOCache.hpp"
@@ -68,12 +70,20 @@ DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters*      pRefCounters,
         pDeviceGL,
         Desc
     },
-    m_ContextState{pDeviceGL},
-    m_DefaultFBO  {false    }
+    m_ContextState    {pDeviceGL, m_Stats.BindingCounters},
+    m_DefaultFBO      {false    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListGLImpl), 64}
 // clang-format on
 {
     m_BoundWritableTextures.reserve(16);
     m_BoundWritableBuffers.reserve(16);
+
+    // Deferred contexts never issue GL commands, so they do not need the dynamic heap
+    const Uint32 DynamicHeapSize = pDeviceGL->GetDynamicHeapSize();
+    if (!Desc.IsDeferred && DynamicHeapSize != 0)
+    {
+        m_pDynamicHeap = std::make_unique<GLDynamicHeap>(m_ContextState, GetRawAllocator(), DynamicHeapSize);
+    }
 }
 
 IMPLEMENT_QUERY_INTERFACE(DeviceContextGLImpl, IID_DeviceContextGL, TDeviceContextBase)
@@ -81,8 +91,16 @@ IMPLEMENT_QUERY_INTERFACE(DeviceContextGLImpl, IID_DeviceContextGL, TDeviceConte
 
 void DeviceContextGLImpl::Begin(Uint32 ImmediateContextId)
 {
-    UNEXPECTED("OpenGL does not support deferred contexts");
-    (void)(ImmediateContextId);
+    DEV_CHECK_ERR(ImmediateContextId == 0, "OpenGL supports only one immediate context");
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+    m_pCommandStream = std::make_unique<GLCommandStream>(GetRawAllocator());
+}
+
+GLCommandStream& DeviceContextGLImpl::GetCommandStream()
+{
+    VERIFY(IsDeferred(), "Only deferred contexts record commands into the command stream");
+    DEV_CHECK_ERR(m_pCommandStream, "Deferred context is not in recording state. Did you forget to call Begin()?");
+    return *m_pCommandStream;
 }
 
 void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
@@ -90,6 +108,14 @@ void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
     if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateGLImpl::IID_InternalImpl))
         return;
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pPipelineState);
+        CmdStream.Record([pPipelineState](DeviceContextGLImpl& Ctx) { Ctx.SetPipelineState(pPipelineState); });
+        return;
+    }
+
     const PipelineStateDesc& Desc = m_pPipelineState->GetDesc();
     if (Desc.PipelineType == PIPELINE_TYPE_COMPUTE)
     {
@@ -173,6 +199,17 @@ void DeviceContextGLImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
 {
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0);
 
+    if (IsDeferred())
+    {
+        // Resources are read from the SRB cache when the command list is executed
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pShaderResourceBinding);
+        CmdStream.Record([pShaderResourceBinding, StateTransitionMode](DeviceContextGLImpl& Ctx) {
+            Ctx.CommitShaderResources(pShaderResourceBinding, StateTransitionMode);
+        });
+        return;
+    }
+
     ShaderResourceBindingGLImpl* const pShaderResBindingGL = ClassPtrCast<ShaderResourceBindingGLImpl>(pShaderResourceBinding);
     const Uint32                       SRBIndex            = pShaderResBindingGL->GetBindingIndex();
 
@@ -187,6 +224,12 @@ void DeviceContextGLImpl::SetStencilRef(Uint32 StencilRef)
 {
     if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
     {
+        if (IsDeferred())
+        {
+            GetCommandStream().Record([StencilRef](DeviceContextGLImpl& Ctx) { Ctx.SetStencilRef(StencilRef); });
+            return;
+        }
+
         m_ContextState.SetStencilRef(GL_FRONT, StencilRef);
         m_ContextState.SetStencilRef(GL_BACK, StencilRef);
     }
@@ -196,6 +239,13 @@ void DeviceContextGLImpl::SetBlendFactors(const float* pBlendFactors)
 {
     if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
     {
+        if (IsDeferred())
+        {
+            const std::array<float, 4> BlendFactors{m_BlendFactors[0], m_BlendFactors[1], m_BlendFactors[2], m_BlendFactors[3]};
+            GetCommandStream().Record([BlendFactors](DeviceContextGLImpl& Ctx) { Ctx.SetBlendFactors(BlendFactors.data()); });
+            return;
+        }
+
         m_ContextState.SetBlendFactors(m_BlendFactors);
     }
 }
@@ -208,6 +258,23 @@ void DeviceContextGLImpl::SetVertexBuffers(Uint32                         StartS
                                            SET_VERTEX_BUFFERS_FLAGS       Flags)
 {
     TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        if (ppBuffers != nullptr)
+        {
+            for (Uint32 i = 0; i < NumBuffersSet; ++i)
+                CmdStream.KeepAlive(ppBuffers[i]);
+        }
+        IBuffer* const* ppBuffersCopy = CmdStream.CopyArray(ppBuffers, NumBuffersSet);
+        const Uint64*   pOffsetsCopy  = CmdStream.CopyArray(pOffsets, NumBuffersSet);
+        CmdStream.Record([=](DeviceContextGLImpl& Ctx) {
+            Ctx.SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffersCopy, pOffsetsCopy, StateTransitionMode, Flags);
+        });
+        return;
+    }
+
     m_ContextState.InvalidateVAO();
 }
 
@@ -215,6 +282,14 @@ void DeviceContextGLImpl::InvalidateState()
 {
     TDeviceContextBase::InvalidateState();
 
+    if (IsDeferred())
+    {
+        // GL context state is only used by the immediate context
+        if (m_pCommandStream)
+            m_pCommandStream->Record([](DeviceContextGLImpl& Ctx) { Ctx.InvalidateState(); });
+        return;
+    }
+
     m_ContextState.Invalidate();
     m_BindInfo.Invalidate();
     m_BoundWritableTextures.clear();
@@ -227,6 +302,17 @@ void DeviceContextGLImpl::InvalidateState()
 void DeviceContextGLImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
     TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pIndexBuffer);
+        CmdStream.Record([pIndexBuffer, ByteOffset, StateTransitionMode](DeviceContextGLImpl& Ctx) {
+            Ctx.SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+        });
+        return;
+    }
+
     m_ContextState.InvalidateVAO();
 }
 
@@ -234,6 +320,18 @@ void DeviceContextGLImpl::SetViewports(Uint32 NumViewports, const Viewport* pVie
 {
     TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
 
+    if (IsDeferred())
+    {
+        // Zero render target size is resolved by the immediate context from the render targets
+        // recorded earlier, so the original arguments are replayed.
+        GLCommandStream& CmdStream      = GetCommandStream();
+        const Viewport*  pViewportsCopy = CmdStream.CopyArray(pViewports, NumViewports);
+        CmdStream.Record([NumViewports, pViewportsCopy, RTWidth, RTHeight](DeviceContextGLImpl& Ctx) {
+            Ctx.SetViewports(NumViewports, pViewportsCopy, RTWidth, RTHeight);
+        });
+        return;
+    }
+
     VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
     if (NumViewports == 1)
     {
@@ -317,6 +415,16 @@ void DeviceContextGLImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, U
 {
     TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream  = GetCommandStream();
+        const Rect*      pRectsCopy = CmdStream.CopyArray(pRects, NumRects);
+        CmdStream.Record([NumRects, pRectsCopy, RTWidth, RTHeight](DeviceContextGLImpl& Ctx) {
+            Ctx.SetScissorRects(NumRects, pRectsCopy, RTWidth, RTHeight);
+        });
+        return;
+    }
+
     VERIFY(NumRects == m_NumScissorRects, "Unexpected number of scissor rects");
     if (NumRects == 1)
     {
@@ -427,6 +535,23 @@ void DeviceContextGLImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Att
 
     if (TDeviceContextBase::SetRenderTargets(Attribs))
     {
+        if (IsDeferred())
+        {
+            GLCommandStream& CmdStream = GetCommandStream();
+            if (Attribs.ppRenderTargets != nullptr)
+            {
+                for (Uint32 rt = 0; rt < Attribs.NumRenderTargets; ++rt)
+                    CmdStream.KeepAlive(Attribs.ppRenderTargets[rt]);
+            }
+            CmdStream.KeepAlive(Attribs.pDepthStencil);
+            CmdStream.KeepAlive(Attribs.pShadingRateMap);
+
+            SetRenderTargetsAttribs RTAttribs = Attribs;
+            RTAttribs.ppRenderTargets         = CmdStream.CopyArray(Attribs.ppRenderTargets, Attribs.NumRenderTargets);
+            CmdStream.Record([RTAttribs](DeviceContextGLImpl& Ctx) { Ctx.SetRenderTargetsExt(RTAttribs); });
+            return;
+        }
+
         if (m_NumBoundRenderTargets == 1 && m_pBoundRenderTargets[0] && m_pBoundRenderTargets[0]->GetTexture<TextureBaseGL>()->GetGLHandle() == 0)
         {
             DEV_CHECK_ERR(!m_pBoundDepthStencil || m_pBoundDepthStencil->GetTexture<TextureBaseGL>()->GetGLHandle() == 0,
@@ -646,6 +771,18 @@ void DeviceContextGLImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 {
     TDeviceContextBase::BeginRenderPass(Attribs);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(Attribs.pRenderPass);
+        CmdStream.KeepAlive(Attribs.pFramebuffer);
+
+        BeginRenderPassAttribs RPAttribs = Attribs;
+        RPAttribs.pClearValues           = CmdStream.CopyArray(Attribs.pClearValues, Attribs.ClearValueCount);
+        CmdStream.Record([RPAttribs](DeviceContextGLImpl& Ctx) { Ctx.BeginRenderPass(RPAttribs); });
+        return;
+    }
+
     m_AttachmentClearValues.resize(Attribs.ClearValueCount);
     for (Uint32 i = 0; i < Attribs.ClearValueCount; ++i)
         m_AttachmentClearValues[i] = Attribs.pClearValues[i];
@@ -659,6 +796,13 @@ void DeviceContextGLImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 
 void DeviceContextGLImpl::NextSubpass()
 {
+    if (IsDeferred())
+    {
+        TDeviceContextBase::NextSubpass();
+        GetCommandStream().Record([](DeviceContextGLImpl& Ctx) { Ctx.NextSubpass(); });
+        return;
+    }
+
     EndSubpass();
     TDeviceContextBase::NextSubpass();
     BeginSubpass();
@@ -667,6 +811,13 @@ void DeviceContextGLImpl::NextSubpass()
 
 void DeviceContextGLImpl::EndRenderPass()
 {
+    if (IsDeferred())
+    {
+        TDeviceContextBase::EndRenderPass();
+        GetCommandStream().Record([](DeviceContextGLImpl& Ctx) { Ctx.EndRenderPass(); });
+        return;
+    }
+
     EndSubpass();
     TDeviceContextBase::EndRenderPass();
     m_ContextState.InvalidateFBO();
@@ -719,6 +870,10 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask)
                           "in the cache have changed, but the SRB has not been committed before the draw/dispatch command.");
             pResourceCache->BindDynamicBuffers(GetContextState(), BaseBindings);
         }
+#ifdef DILIGENT_DEVELOPMENT
+        if (m_pDynamicHeap)
+            pResourceCache->DvpVerifyDynamicAllocations(m_pDynamicHeap->GetCurrentFrame());
+#endif
     }
     m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
 
@@ -881,6 +1036,12 @@ void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
 {
     TDeviceContextBase::Draw(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GetCommandStream().Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.Draw(Attribs); });
+        return;
+    }
+
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, false, GlTopology);
 
@@ -919,6 +1080,16 @@ void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+
+        MultiDrawAttribs MDAttribs = Attribs;
+        MDAttribs.pDrawItems       = CmdStream.CopyArray(Attribs.pDrawItems, Attribs.DrawCount);
+        CmdStream.Record([MDAttribs](DeviceContextGLImpl& Ctx) { Ctx.MultiDraw(MDAttribs); });
+        return;
+    }
+
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, false, GlTopology);
 
@@ -1013,6 +1184,12 @@ void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GetCommandStream().Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.DrawIndexed(Attribs); });
+        return;
+    }
+
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
     GLenum GLIndexType;
@@ -1067,6 +1244,16 @@ void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
 {
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+
+        MultiDrawIndexedAttribs MDAttribs = Attribs;
+        MDAttribs.pDrawItems              = CmdStream.CopyArray(Attribs.pDrawItems, Attribs.DrawCount);
+        CmdStream.Record([MDAttribs](DeviceContextGLImpl& Ctx) { Ctx.MultiDrawIndexed(MDAttribs); });
+        return;
+    }
+
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
     GLenum GLIndexType;
@@ -1179,6 +1366,15 @@ void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     TDeviceContextBase::DrawIndirect(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(Attribs.pAttribsBuffer);
+        CmdStream.KeepAlive(Attribs.pCounterBuffer);
+        CmdStream.Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.DrawIndirect(Attribs); });
+        return;
+    }
+
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
 
@@ -1253,6 +1449,15 @@ void DeviceContextGLImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
 {
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(Attribs.pAttribsBuffer);
+        CmdStream.KeepAlive(Attribs.pCounterBuffer);
+        CmdStream.Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.DrawIndexedIndirect(Attribs); });
+        return;
+    }
+
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
     GLenum GLIndexType;
@@ -1345,6 +1550,12 @@ void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GetCommandStream().Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.DispatchCompute(Attribs); });
+        return;
+    }
+
 #if GL_ARB_compute_shader
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (ShaderResourcesGL needs to bind a program to load uniforms).
@@ -1375,6 +1586,14 @@ void DeviceContextGLImpl::DispatchComputeIndirect(const DispatchComputeIndirectA
 {
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(Attribs.pAttribsBuffer);
+        CmdStream.Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.DispatchComputeIndirect(Attribs); });
+        return;
+    }
+
 #if GL_ARB_compute_shader
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (ShaderResourcesGL needs to bind a program to load uniforms).
@@ -1421,6 +1640,14 @@ void DeviceContextGLImpl::ClearDepthStencil(ITextureView*                  pView
 {
     TDeviceContextBase::ClearDepthStencil(pView);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pView);
+        CmdStream.Record([=](DeviceContextGLImpl& Ctx) { Ctx.ClearDepthStencil(pView, ClearFlags, fDepth, Stencil, StateTransitionMode); });
+        return;
+    }
+
     if (pView != m_pBoundDepthStencil)
     {
         LOG_ERROR_MESSAGE("Depth stencil buffer must be bound to the context to be cleared in OpenGL backend");
@@ -1460,6 +1687,18 @@ void DeviceContextGLImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
 {
     TDeviceContextBase::ClearRenderTarget(pView);
 
+    if (IsDeferred())
+    {
+        // Clear color is either four floats or four 32-bit integers
+        GLCommandStream& CmdStream = GetCommandStream();
+        const void*      pRGBACopy = CmdStream.CopyData(RGBA, sizeof(float) * 4);
+        CmdStream.KeepAlive(pView);
+        CmdStream.Record([pView, pRGBACopy, StateTransitionMode](DeviceContextGLImpl& Ctx) {
+            Ctx.ClearRenderTarget(pView, pRGBACopy, StateTransitionMode);
+        });
+        return;
+    }
+
     Int32 RTIndex = -1;
     for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
     {
@@ -1537,8 +1776,13 @@ void DeviceContextGLImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
 
 void DeviceContextGLImpl::Flush()
 {
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+    if (IsDeferred())
+        return;
 
+    // Dynamic heap allocations must remain valid until the end of the frame,
+    // so the heap frame is only finished by FinishFrame().
     glFlush();
 
     m_BindInfo = {};
@@ -1546,18 +1790,56 @@ void DeviceContextGLImpl::Flush()
 
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (m_pDynamicHeap)
+        m_pDynamicHeap->FinishCurrentFrame();
+
     TDeviceContextBase::EndFrame();
 }
 
 void DeviceContextGLImpl::FinishCommandList(ICommandList** ppCommandList)
 {
-    LOG_ERROR("Deferred contexts are not supported in OpenGL mode");
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred contexts can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+    DEV_CHECK_ERR(m_DeferredMappedBuffers.empty(), "All buffers mapped by the deferred context must be unmapped before finishing the command list");
+    m_DeferredMappedBuffers.clear();
+
+    if (!m_pCommandStream)
+    {
+        LOG_ERROR_MESSAGE("Deferred context is not in recording state. Did you forget to call Begin()?");
+        *ppCommandList = nullptr;
+        return;
+    }
+
+    CommandListGLImpl* pCmdListGL(NEW_RC_OBJ(m_CmdListAllocator, "CommandListGLImpl instance", CommandListGLImpl)(m_pDevice, this, std::move(m_pCommandStream)));
+    pCmdListGL->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    // Device context is now in default state. Only reset the base state: the GL context
+    // state of a deferred context is never used and must not be touched from this thread.
+    TDeviceContextBase::InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
 }
 
 void DeviceContextGLImpl::ExecuteCommandLists(Uint32               NumCommandLists,
                                               ICommandList* const* ppCommandLists)
 {
-    LOG_ERROR("Deferred contexts are not supported in OpenGL mode");
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        // Every command list is recorded starting from the default state
+        InvalidateState();
+
+        const CommandListGLImpl* pCmdListGL = ClassPtrCast<const CommandListGLImpl>(ppCommandLists[i]);
+        pCmdListGL->GetCommandStream().Execute(*this);
+    }
+
+    // Device context is now in default state
+    InvalidateState();
 }
 
 void DeviceContextGLImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
@@ -1591,6 +1873,15 @@ void DeviceContextGLImpl::WaitForIdle()
 
 void DeviceContextGLImpl::BeginQuery(IQuery* pQuery)
 {
+    if (IsDeferred())
+    {
+        // The query is bound to the immediate context when the command list is executed
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pQuery);
+        CmdStream.Record([pQuery](DeviceContextGLImpl& Ctx) { Ctx.BeginQuery(pQuery); });
+        return;
+    }
+
     TDeviceContextBase::BeginQuery(pQuery, 0);
 
     QueryGLImpl* pQueryGLImpl = ClassPtrCast<QueryGLImpl>(pQuery);
@@ -1638,6 +1929,14 @@ void DeviceContextGLImpl::BeginQuery(IQuery* pQuery)
 
 void DeviceContextGLImpl::EndQuery(IQuery* pQuery)
 {
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pQuery);
+        CmdStream.Record([pQuery](DeviceContextGLImpl& Ctx) { Ctx.EndQuery(pQuery); });
+        return;
+    }
+
     TDeviceContextBase::EndQuery(pQuery, 0);
 
     QueryGLImpl* pQueryGLImpl = ClassPtrCast<QueryGLImpl>(pQuery);
@@ -1716,6 +2015,17 @@ void DeviceContextGLImpl::UpdateBuffer(IBuffer*                       pBuffer,
 {
     TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        const void*      pDataCopy = CmdStream.CopyData(pData, StaticCast<size_t>(Size));
+        CmdStream.KeepAlive(pBuffer);
+        CmdStream.Record([pBuffer, Offset, Size, pDataCopy, StateTransitionMode](DeviceContextGLImpl& Ctx) {
+            Ctx.UpdateBuffer(pBuffer, Offset, Size, pDataCopy, StateTransitionMode);
+        });
+        return;
+    }
+
     BufferGLImpl* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
     pBufferGL->UpdateData(m_ContextState, Offset, Size, pData);
 }
@@ -1730,22 +2040,113 @@ void DeviceContextGLImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
 {
     TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pSrcBuffer);
+        CmdStream.KeepAlive(pDstBuffer);
+        CmdStream.Record([=](DeviceContextGLImpl& Ctx) {
+            Ctx.CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+        });
+        return;
+    }
+
     BufferGLImpl* pSrcBufferGL = ClassPtrCast<BufferGLImpl>(pSrcBuffer);
     BufferGLImpl* pDstBufferGL = ClassPtrCast<BufferGLImpl>(pDstBuffer);
+    DEV_CHECK_ERR(!pDstBufferGL->UsesDynamicHeap(), "Dynamic buffers suballocated from the dynamic heap cannot be copy destinations");
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_pDynamicHeap)
+        pSrcBufferGL->DvpVerifyDynamicAllocation(m_pDynamicHeap->GetCurrentFrame());
+#endif
     pDstBufferGL->CopyData(m_ContextState, *pSrcBufferGL, SrcOffset, DstOffset, Size);
 }
 
 void DeviceContextGLImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
 {
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    if (IsDeferred())
+    {
+        // The data is written to the command stream and copied to the buffer when the command list
+        // is executed, so only discarding writes can be supported.
+        if (MapType != MAP_WRITE || (MapFlags & MAP_FLAG_DISCARD) == 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to map buffer '", pBuffer->GetDesc().Name,
+                              "': deferred contexts in OpenGL backend only support MAP_WRITE with MAP_FLAG_DISCARD flag.");
+            pMappedData = nullptr;
+            return;
+        }
+
+        pMappedData = GetCommandStream().Allocate(StaticCast<size_t>(pBuffer->GetDesc().Size), 16);
+        m_DeferredMappedBuffers.emplace_back(pBuffer, pMappedData);
+        return;
+    }
+
     BufferGLImpl* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
+
+    if (pBufferGL->UsesDynamicHeap() && MapType == MAP_WRITE)
+    {
+        VERIFY_EXPR(m_pDynamicHeap);
+        if ((MapFlags & MAP_FLAG_DISCARD) != 0)
+        {
+            const Uint64 Alignment = m_pDevice->GetAdapterInfo().Buffer.ConstantBufferOffsetAlignment;
+            const Uint64 Offset    = m_pDynamicHeap->Allocate(pBufferGL->GetDesc().Size, Alignment);
+            if (Offset != GLDynamicHeap::InvalidOffset)
+                pBufferGL->SetDynamicAllocation(&m_pDynamicHeap->GetGLBuffer(), Offset, m_pDynamicHeap->GetCurrentFrame());
+            else
+                pBufferGL->SetDynamicAllocation(nullptr, 0, 0);
+        }
+
+        // MAP_FLAG_NO_OVERWRITE reuses the current allocation, if any
+        if (pBufferGL->HasDynamicAllocation())
+        {
+#ifdef DILIGENT_DEVELOPMENT
+            pBufferGL->DvpVerifyDynamicAllocation(m_pDynamicHeap->GetCurrentFrame());
+#endif
+            pMappedData = m_pDynamicHeap->GetCPUAddress() + pBufferGL->GetDataOffset();
+            return;
+        }
+        // Otherwise fall back to mapping the buffer's own storage
+    }
+
     pBufferGL->Map(m_ContextState, MapType, MapFlags, pMappedData);
 }
 
 void DeviceContextGLImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+
+    if (IsDeferred())
+    {
+        auto MappedIt = std::find_if(m_DeferredMappedBuffers.begin(), m_DeferredMappedBuffers.end(),
+                                     [pBuffer](const std::pair<IBuffer*, void*>& Mapped) { return Mapped.first == pBuffer; });
+        if (MappedIt == m_DeferredMappedBuffers.end())
+        {
+            LOG_ERROR_MESSAGE("Buffer '", pBuffer->GetDesc().Name, "' is not mapped by this deferred context");
+            return;
+        }
+
+        const void* pData = MappedIt->second;
+        m_DeferredMappedBuffers.erase(MappedIt);
+
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pBuffer);
+        CmdStream.Record([pBuffer, pData](DeviceContextGLImpl& Ctx) {
+            PVoid pMappedData = nullptr;
+            Ctx.MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+            if (pMappedData != nullptr)
+                memcpy(pMappedData, pData, StaticCast<size_t>(pBuffer->GetDesc().Size));
+            Ctx.UnmapBuffer(pBuffer, MAP_WRITE);
+        });
+        return;
+    }
+
     BufferGLImpl* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
+
+    // The dynamic heap is persistently mapped with GL_MAP_COHERENT_BIT, so there is nothing to do
+    if (pBufferGL->HasDynamicAllocation())
+        return;
+
     pBufferGL->Unmap(m_ContextState);
 }
 
@@ -1758,6 +2159,41 @@ void DeviceContextGLImpl::UpdateTexture(ITexture*                      pTexture,
                                         RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode)
 {
     TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, TextureStateTransitionMode);
+
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pTexture);
+
+        TextureSubResData SubresDataCopy = SubresData;
+        if (SubresData.pSrcBuffer != nullptr)
+        {
+            CmdStream.KeepAlive(SubresData.pSrcBuffer);
+        }
+        else
+        {
+            const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(pTexture->GetDesc().Format);
+
+            Uint32 NumCols = DstBox.Width();
+            Uint32 NumRows = DstBox.Height();
+            if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+            {
+                NumCols = AlignUp(NumCols, Uint32{FmtAttribs.BlockWidth}) / FmtAttribs.BlockWidth;
+                NumRows = AlignUp(NumRows, Uint32{FmtAttribs.BlockHeight}) / FmtAttribs.BlockHeight;
+            }
+            const Uint64 DataSize = SubresData.DepthStride * (DstBox.Depth() - 1) +
+                SubresData.Stride * (NumRows - 1) +
+                Uint64{NumCols} * FmtAttribs.GetElementSize();
+
+            SubresDataCopy.pData = CmdStream.CopyData(SubresData.pData, StaticCast<size_t>(DataSize));
+        }
+
+        CmdStream.Record([=](DeviceContextGLImpl& Ctx) {
+            Ctx.UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresDataCopy, SrcBufferStateTransitionMode, TextureStateTransitionMode);
+        });
+        return;
+    }
+
     TextureBaseGL* pTexGL = ClassPtrCast<TextureBaseGL>(pTexture);
     pTexGL->UpdateData(m_ContextState, MipLevel, Slice, DstBox, SubresData);
 }
@@ -1765,6 +2201,19 @@ void DeviceContextGLImpl::UpdateTexture(ITexture*                      pTexture,
 void DeviceContextGLImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
 {
     TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(CopyAttribs.pSrcTexture);
+        CmdStream.KeepAlive(CopyAttribs.pDstTexture);
+
+        CopyTextureAttribs Attribs = CopyAttribs;
+        Attribs.pSrcBox            = CmdStream.CopyArray(CopyAttribs.pSrcBox, 1);
+        CmdStream.Record([Attribs](DeviceContextGLImpl& Ctx) { Ctx.CopyTexture(Attribs); });
+        return;
+    }
+
     TextureBaseGL* pSrcTexGL = ClassPtrCast<TextureBaseGL>(CopyAttribs.pSrcTexture);
     TextureBaseGL* pDstTexGL = ClassPtrCast<TextureBaseGL>(CopyAttribs.pDstTexture);
 
@@ -1885,6 +2334,14 @@ void DeviceContextGLImpl::MapTextureSubresource(ITexture*                 pTextu
                                                 MappedTextureSubresource& MappedData)
 {
     TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    if (IsDeferred())
+    {
+        LOG_ERROR_MESSAGE("Textures can't be mapped by deferred contexts in OpenGL backend");
+        MappedData = MappedTextureSubresource{};
+        return;
+    }
+
     TextureBaseGL*     pTexGL  = ClassPtrCast<TextureBaseGL>(pTexture);
     const TextureDesc& TexDesc = pTexGL->GetDesc();
     if (TexDesc.Usage == USAGE_STAGING)
@@ -1908,6 +2365,9 @@ void DeviceContextGLImpl::MapTextureSubresource(ITexture*                 pTextu
 void DeviceContextGLImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
 {
     TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+    if (IsDeferred())
+        return;
+
     TextureBaseGL*     pTexGL  = ClassPtrCast<TextureBaseGL>(pTexture);
     const TextureDesc& TexDesc = pTexGL->GetDesc();
     if (TexDesc.Usage == USAGE_STAGING)
@@ -1924,6 +2384,15 @@ void DeviceContextGLImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 Mip
 void DeviceContextGLImpl::GenerateMips(ITextureView* pTexView)
 {
     TDeviceContextBase::GenerateMips(pTexView);
+
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pTexView);
+        CmdStream.Record([pTexView](DeviceContextGLImpl& Ctx) { Ctx.GenerateMips(pTexView); });
+        return;
+    }
+
     TextureViewGLImpl* pTexViewGL = ClassPtrCast<TextureViewGLImpl>(pTexView);
     GLenum             BindTarget = pTexViewGL->GetBindTarget();
     m_ContextState.BindTexture(-1, BindTarget, pTexViewGL->GetHandle());
@@ -1942,6 +2411,18 @@ void DeviceContextGLImpl::ResolveTextureSubresource(ITexture*
                                                     const ResolveTextureSubresourceAttribs& ResolveAttribs)
 {
     TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream = GetCommandStream();
+        CmdStream.KeepAlive(pSrcTexture);
+        CmdStream.KeepAlive(pDstTexture);
+        CmdStream.Record([pSrcTexture, pDstTexture, ResolveAttribs](DeviceContextGLImpl& Ctx) {
+            Ctx.ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+        });
+        return;
+    }
+
     TextureBaseGL*     pSrcTexGl  = ClassPtrCast<TextureBaseGL>(pSrcTexture);
     TextureBaseGL*     pDstTexGl  = ClassPtrCast<TextureBaseGL>(pDstTexture);
     const TextureDesc& SrcTexDesc = pSrcTexGl->GetDesc();
@@ -2075,6 +2556,15 @@ void DeviceContextGLImpl::BeginDebugGroup(const Char* Name, const float* pColor)
 {
     TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream  = GetCommandStream();
+        const Char*      NameCopy   = CmdStream.CopyString(Name);
+        const float*     pColorCopy = CmdStream.CopyArray(pColor, 4);
+        CmdStream.Record([NameCopy, pColorCopy](DeviceContextGLImpl& Ctx) { Ctx.BeginDebugGroup(NameCopy, pColorCopy); });
+        return;
+    }
+
 #if GL_KHR_debug
     if (glPushDebugGroup)
         glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, Name);
@@ -2085,6 +2575,12 @@ void DeviceContextGLImpl::EndDebugGroup()
 {
     TDeviceContextBase::EndDebugGroup(0);
 
+    if (IsDeferred())
+    {
+        GetCommandStream().Record([](DeviceContextGLImpl& Ctx) { Ctx.EndDebugGroup(); });
+        return;
+    }
+
 #if GL_KHR_debug
     if (glPopDebugGroup)
         glPopDebugGroup();
@@ -2095,6 +2591,15 @@ void DeviceContextGLImpl::InsertDebugLabel(const Char* Label, const float* pColo
 {
     TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
 
+    if (IsDeferred())
+    {
+        GLCommandStream& CmdStream  = GetCommandStream();
+        const Char*      LabelCopy  = CmdStream.CopyString(Label);
+        const float*     pColorCopy = CmdStream.CopyArray(pColor, 4);
+        CmdStream.Record([LabelCopy, pColorCopy](DeviceContextGLImpl& Ctx) { Ctx.InsertDebugLabel(LabelCopy, pColorCopy); });
+        return;
+    }
+
 #if GL_KHR_debug
     if (glDebugMessageInsert)
         glDebugMessageInsert(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, 0, GL_DEBUG_SEVERITY_MEDIUM, -1, Label);
@@ -193,7 +193,8 @@ void EngineFactoryOpenGLImpl::EnumerateAdapters(Version              MinVersion,
 /// \param [out] ppDevice           - Address of the memory location where pointer to
 ///                                   the created device will be written.
 /// \param [out] ppImmediateContext - Address of the memory location where pointers to
-///                                   the immediate context will be written.
+///                                   the immediate context will be written, followed by
+///                                   EngineCI.NumDeferredContexts deferred contexts.
 /// \param [in]  SCDesc             - Swap chain description.
 /// \param [out] ppSwapChain        - Address of the memory location where pointer to the new
 ///                                   swap chain will be written.
@@ -213,20 +214,14 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
     if (!ppDevice || !ppImmediateContext || !ppSwapChain)
         return;
 
-    if (EngineCI.NumDeferredContexts > 0)
-    {
-        LOG_ERROR_MESSAGE("OpenGL back-end does not support deferred contexts");
-        return;
-    }
-
     if (EngineCI.NumImmediateContexts > 1)
     {
         LOG_ERROR_MESSAGE("OpenGL back-end does not support multiple immediate contexts");
         return;
     }
 
-    *ppDevice           = nullptr;
-    *ppImmediateContext = nullptr;
+    *ppDevice = nullptr;
+    memset(ppImmediateContext, 0, sizeof(*ppImmediateContext) * (size_t{1} + size_t{EngineCI.NumDeferredContexts}));
     *ppSwapChain        = nullptr;
 
     try
@@ -262,6 +257,11 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
         pDeviceContextOpenGL->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppImmediateContext));
         pRenderDeviceOpenGL->SetImmediateContext(0, pDeviceContextOpenGL);
 
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            pRenderDeviceOpenGL->CreateDeferredContext(ppImmediateContext + 1 + DeferredCtx);
+        }
+
         TSwapChain* pSwapChainGL = NEW_RC_OBJ(RawMemAllocator, "SwapChainGLImpl instance", TSwapChain)(EngineCI, SCDesc, pRenderDeviceOpenGL, pDeviceContextOpenGL);
         pSwapChainGL->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
 
@@ -275,10 +275,13 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
             *ppDevice = nullptr;
         }
 
-        if (*ppImmediateContext)
+        for (Uint32 ctx = 0; ctx < 1 + EngineCI.NumDeferredContexts; ++ctx)
         {
-            (*ppImmediateContext)->Release();
-            *ppImmediateContext = nullptr;
+            if (ppImmediateContext[ctx] != nullptr)
+            {
+                ppImmediateContext[ctx]->Release();
+                ppImmediateContext[ctx] = nullptr;
+            }
         }
 
         if (*ppSwapChain)
@@ -298,7 +301,8 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
 /// \param [out] ppDevice - Address of the memory location where pointer to
 ///                         the created device will be written.
 /// \param [out] ppImmediateContext - Address of the memory location where pointers to
-///                                   the immediate context will be written.
+///                                   the immediate context will be written, followed by
+///                                   EngineCI.NumDeferredContexts deferred contexts.
 void EngineFactoryOpenGLImpl::AttachToActiveGLContext(const EngineGLCreateInfo& EngineCI,
                                                       IRenderDevice**           ppDevice,
                                                       IDeviceContext**          ppImmediateContext)
@@ -313,20 +317,14 @@ void EngineFactoryOpenGLImpl::AttachToActiveGLContext(const EngineGLCreateInfo&
     if (!ppDevice || !ppImmediateContext)
         return;
 
-    if (EngineCI.NumDeferredContexts > 0)
-    {
-        LOG_ERROR_MESSAGE("OpenGL back-end does not support deferred contexts");
-        return;
-    }
-
     if (EngineCI.NumImmediateContexts > 1)
     {
         LOG_ERROR_MESSAGE("OpenGL back-end does not support multiple immediate contexts");
         return;
     }
 
-    *ppDevice           = nullptr;
-    *ppImmediateContext = nullptr;
+    *ppDevice = nullptr;
+    memset(ppImmediateContext, 0, sizeof(*ppImmediateContext) * (size_t{1} + size_t{EngineCI.NumDeferredContexts}));
 
     try
     {
@@ -360,6 +358,11 @@ void EngineFactoryOpenGLImpl::AttachToActiveGLContext(const EngineGLCreateInfo&
         // keep a weak reference to the context
         pDeviceContextOpenGL->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppImmediateContext));
         pRenderDeviceOpenGL->SetImmediateContext(0, pDeviceContextOpenGL);
+
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            pRenderDeviceOpenGL->CreateDeferredContext(ppImmediateContext + 1 + DeferredCtx);
+        }
     }
     catch (const std::runtime_error&)
     {
@@ -369,10 +372,13 @@ void EngineFactoryOpenGLImpl::AttachToActiveGLContext(const EngineGLCreateInfo&
             *ppDevice = nullptr;
         }
 
-        if (*ppImmediateContext)
+        for (Uint32 ctx = 0; ctx < 1 + EngineCI.NumDeferredContexts; ++ctx)
         {
-            (*ppImmediateContext)->Release();
-            *ppImmediateContext = nullptr;
+            if (ppImmediateContext[ctx] != nullptr)
+            {
+                ppImmediateContext[ctx]->Release();
+                ppImmediateContext[ctx] = nullptr;
+            }
         }
 
         LOG_ERROR("Failed to initialize OpenGL-based render device");
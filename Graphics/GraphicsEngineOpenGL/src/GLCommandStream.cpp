@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GLCommandStream.hpp"
+
+namespace Diligent
+{
+
+GLCommandStream::GLCommandStream(IMemoryAllocator& Allocator, size_t PageSize) :
+    m_Allocator{Allocator},
+    m_PageSize{PageSize}
+{
+}
+
+GLCommandStream::~GLCommandStream()
+{
+    // All commands are trivially destructible, so the pages can simply be released
+    for (void* pPage : m_Pages)
+        m_Allocator.Free(pPage);
+}
+
+void* GLCommandStream::Allocate(size_t Size, size_t Alignment)
+{
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") is not a power of two");
+    VERIFY_EXPR(Size > 0);
+
+    if (m_pCurrPtr != nullptr)
+    {
+        Uint8* Ptr = AlignUp(m_pCurrPtr, Alignment);
+        if (Ptr + Size <= m_pPageEnd)
+        {
+            m_pCurrPtr = Ptr + Size;
+            return Ptr;
+        }
+    }
+
+    const size_t AllocSize = Size + Alignment - 1;
+    if (AllocSize > m_PageSize / 2)
+    {
+        // Large blocks (e.g. buffer updates) get a dedicated page so that
+        // the remaining space of the current page is not wasted.
+        void* pPage = m_Allocator.Allocate(AllocSize, "GL command stream page", __FILE__, __LINE__);
+        m_Pages.push_back(pPage);
+        m_MemorySize += AllocSize;
+        return AlignUp(static_cast<Uint8*>(pPage), Alignment);
+    }
+
+    Uint8* pPage = static_cast<Uint8*>(m_Allocator.Allocate(m_PageSize, "GL command stream page", __FILE__, __LINE__));
+    m_Pages.push_back(pPage);
+    m_MemorySize += m_PageSize;
+
+    m_pPageEnd = pPage + m_PageSize;
+    Uint8* Ptr = AlignUp(pPage, Alignment);
+    m_pCurrPtr = Ptr + Size;
+    VERIFY_EXPR(m_pCurrPtr <= m_pPageEnd);
+    return Ptr;
+}
+
+void GLCommandStream::Execute(DeviceContextGLImpl& Ctx) const
+{
+    for (const CommandHeader* pCmd = m_pFirstCmd; pCmd != nullptr; pCmd = pCmd->pNext)
+        pCmd->Execute(*pCmd, Ctx);
+}
+
+} // namespace Diligent
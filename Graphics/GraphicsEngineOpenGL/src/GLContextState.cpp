@@ -42,12 +42,19 @@ using namespace GLObjectWrappers;
 namespace Diligent
 {
 
-GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
+GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL, DeviceContextBindingCounters& BindingCounters) :
+    m_BindingCounters{BindingCounters}
 {
     const GraphicsAdapterInfo& AdapterInfo = pDeviceGL->GetAdapterInfo();
     m_Caps.IsFillModeSelectionSupported    = AdapterInfo.Features.WireframeFill;
     m_Caps.IsProgramPipelineSupported      = AdapterInfo.Features.SeparablePrograms;
     m_Caps.IsDepthClampSupported           = AdapterInfo.Features.DepthClamp;
+#if GL_ARB_multi_bind
+    m_Caps.IsMultiBindSupported = (pDeviceGL->GetGLCaps().MultiBind &&
+                                   glBindTextures != nullptr &&
+                                   glBindSamplers != nullptr &&
+                                   glBindBuffersRange != nullptr);
+#endif
 
     {
         m_Caps.MaxCombinedTexUnits = 0;
@@ -71,6 +78,14 @@ GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
     m_BoundUniformBuffers.reserve(m_Caps.MaxUniformBufferBindings);
     m_BoundStorageBlocks.reserve(16);
 
+    if (m_Caps.IsMultiBindSupported)
+    {
+        m_StagedTextures.reserve(32);
+        m_StagedSamplers.reserve(32);
+        m_StagedUniformBuffers.reserve(16);
+        m_StagedStorageBlocks.reserve(16);
+    }
+
     Invalidate();
 
     m_CurrentGLContext = pDeviceGL->m_GLContext.GetCurrentNativeGLContext();
@@ -109,6 +124,13 @@ void GLContextState::Invalidate()
     m_BoundUniformBuffers.clear();
     m_BoundStorageBlocks.clear();
 
+    VERIFY(m_StagedTextures.empty() && m_StagedSamplers.empty() && m_StagedUniformBuffers.empty() && m_StagedStorageBlocks.empty(),
+           "Not all staged bindings have been committed. Did you forget to call CommitStagedBindings()?");
+    m_StagedTextures.clear();
+    m_StagedSamplers.clear();
+    m_StagedUniformBuffers.clear();
+    m_StagedStorageBlocks.clear();
+
     m_DSState = DepthStencilGLState();
     m_RSState = RasterizerGLState();
 
@@ -239,11 +261,18 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
         {
             glBindTexture(BoundTex.BindTarget, 0);
             DEV_CHECK_GL_ERROR("Failed to unbind texture from target ", BindTarget, " slot ", Index, ".");
+            ++m_BindingCounters.ApiCalls;
         }
         glBindTexture(BindTarget, TexObj);
         DEV_CHECK_GL_ERROR("Failed to bind texture to target ", BindTarget, " slot ", Index, ".");
 
         BoundTex = NewTex;
+        ++m_BindingCounters.Changed;
+        ++m_BindingCounters.ApiCalls;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
     }
 }
 
@@ -257,6 +286,12 @@ void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSampler
     {
         glBindSampler(Index, GLSamplerHandle);
         DEV_CHECK_GL_ERROR("Failed to bind sampler to slot ", Index);
+        ++m_BindingCounters.Changed;
+        ++m_BindingCounters.ApiCalls;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
     }
 }
 
@@ -286,6 +321,12 @@ void GLContextState::BindImage(Uint32             Index,
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, MipLevel, IsLayered, Layer, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_BindingCounters.Changed;
+        ++m_BindingCounters.ApiCalls;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
@@ -312,6 +353,12 @@ void GLContextState::BindImage(Uint32 Index, BufferViewGLImpl* pBuffView, GLenum
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, 0, GL_FALSE, 0, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_BindingCounters.Changed;
+        ++m_BindingCounters.ApiCalls;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
@@ -368,6 +415,12 @@ void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBu
         // buffer to the generic buffer binding point specified by target.
         glBindBufferRange(GL_UNIFORM_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind uniform buffer to slot ", Index);
+        ++m_BindingCounters.Changed;
+        ++m_BindingCounters.ApiCalls;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
     }
 }
 
@@ -386,12 +439,212 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
         // buffer to the generic buffer binding point specified by target.
         glBindBufferRange(GL_SHADER_STORAGE_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind shader storage block to slot ", Index);
+        ++m_BindingCounters.Changed;
+        ++m_BindingCounters.ApiCalls;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
 }
 
+void GLContextState::StageTexture(Uint32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& TexObj)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindTexture(static_cast<Int32>(Index), BindTarget, TexObj);
+        return;
+    }
+
+    VERIFY_EXPR(BindTarget != 0);
+    VERIFY(Index < static_cast<Uint32>(m_Caps.MaxCombinedTexUnits), "Texture unit is out of range");
+
+    if (Index >= m_BoundTextures.size())
+        m_BoundTextures.resize(size_t{Index} + 1);
+
+    BoundTextureInfo  NewTex{TexObj ? TexObj.GetUniqueID() : 0, BindTarget};
+    BoundTextureInfo& BoundTex = m_BoundTextures[Index];
+    if (BoundTex != NewTex)
+    {
+        // glBindTextures binds the texture to its own target, but leaves the texture bound to
+        // the previous target of the unit intact, so unbind it explicitly (see BindTexture).
+        if (BoundTex.BindTarget != 0 && BoundTex.BindTarget != BindTarget && BoundTex.TexID != 0)
+        {
+            // Commit the bindings staged so far, which may include a texture for the same unit
+            CommitStagedBindings();
+
+            SetActiveTexture(static_cast<Int32>(Index));
+            glBindTexture(BoundTex.BindTarget, 0);
+            DEV_CHECK_GL_ERROR("Failed to unbind texture from target ", BoundTex.BindTarget, " slot ", Index, ".");
+            ++m_BindingCounters.ApiCalls;
+        }
+
+        BoundTex = NewTex;
+        m_StagedTextures.emplace_back(StagedBinding{Index, static_cast<GLuint>(TexObj)});
+        ++m_BindingCounters.Changed;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
+    }
+}
+
+void GLContextState::StageSampler(Uint32 Index, const GLObjectWrappers::GLSamplerObj& GLSampler)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindSampler(Index, GLSampler);
+        return;
+    }
+
+    if (static_cast<size_t>(Index) >= m_BoundSamplers.size())
+        m_BoundSamplers.resize(size_t{Index} + 1, -1);
+
+    GLuint GLSamplerHandle = 0;
+    if (UpdateBoundObject(m_BoundSamplers[Index], GLSampler, GLSamplerHandle))
+    {
+        m_StagedSamplers.emplace_back(StagedBinding{Index, GLSamplerHandle});
+        ++m_BindingCounters.Changed;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
+    }
+}
+
+void GLContextState::StageUniformBuffer(Uint32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindUniformBuffer(static_cast<Int32>(Index), Buff, Offset, Size);
+        return;
+    }
+
+    VERIFY(Index < static_cast<Uint32>(m_Caps.MaxUniformBufferBindings), "Uniform buffer index is out of range");
+
+    BoundBufferInfo NewUBOInfo{Buff.GetUniqueID(), Offset, Size};
+    if (Index >= m_BoundUniformBuffers.size())
+        m_BoundUniformBuffers.resize(size_t{Index} + 1);
+
+    if (m_BoundUniformBuffers[Index] != NewUBOInfo)
+    {
+        m_BoundUniformBuffers[Index] = NewUBOInfo;
+        m_StagedUniformBuffers.emplace_back(StagedBinding{Index, static_cast<GLuint>(Buff), Offset, Size});
+        ++m_BindingCounters.Changed;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
+    }
+}
+
+void GLContextState::StageStorageBlock(Uint32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindStorageBlock(static_cast<Int32>(Index), Buff, Offset, Size);
+        return;
+    }
+
+    BoundBufferInfo NewSSBOInfo{Buff.GetUniqueID(), Offset, Size};
+    if (Index >= m_BoundStorageBlocks.size())
+        m_BoundStorageBlocks.resize(size_t{Index} + 1);
+
+    if (m_BoundStorageBlocks[Index] != NewSSBOInfo)
+    {
+        m_BoundStorageBlocks[Index] = NewSSBOInfo;
+        m_StagedStorageBlocks.emplace_back(StagedBinding{Index, static_cast<GLuint>(Buff), Offset, Size});
+        ++m_BindingCounters.Changed;
+    }
+    else
+    {
+        ++m_BindingCounters.Filtered;
+    }
+}
+
+// Calls the handler for every range of consecutive slots in the staged bindings and returns the number of ranges
+template <typename StagedBindingType, typename HandlerType>
+Uint32 ForEachContiguousRange(const std::vector<StagedBindingType>& Staged, HandlerType&& Handler)
+{
+    Uint32 NumRanges = 0;
+    for (size_t Start = 0; Start < Staged.size(); ++NumRanges)
+    {
+        size_t End = Start + 1;
+        while (End < Staged.size() && Staged[End].Slot == Staged[End - 1].Slot + 1)
+            ++End;
+
+        Handler(&Staged[Start], static_cast<GLsizei>(End - Start));
+        Start = End;
+    }
+    return NumRanges;
+}
+
+void GLContextState::CommitStagedBindings()
+{
+#if GL_ARB_multi_bind
+    auto SetHandles = [this](const StagedBinding* pRange, GLsizei Count) {
+        m_MultiBindHandles.resize(Count);
+        for (GLsizei i = 0; i < Count; ++i)
+            m_MultiBindHandles[i] = pRange[i].Handle;
+    };
+
+    auto SetBufferRanges = [this](const StagedBinding* pRange, GLsizei Count) {
+        m_MultiBindOffsets.resize(Count);
+        m_MultiBindSizes.resize(Count);
+        for (GLsizei i = 0; i < Count; ++i)
+        {
+            m_MultiBindOffsets[i] = pRange[i].Offset;
+            m_MultiBindSizes[i]   = pRange[i].Size;
+        }
+    };
+
+    m_BindingCounters.ApiCalls += ForEachContiguousRange(
+        m_StagedTextures,
+        [&](const StagedBinding* pRange, GLsizei Count) {
+            SetHandles(pRange, Count);
+            glBindTextures(pRange->Slot, Count, m_MultiBindHandles.data());
+            DEV_CHECK_GL_ERROR("Failed to bind ", Count, " texture(s) starting at slot ", pRange->Slot);
+        });
+
+    m_BindingCounters.ApiCalls += ForEachContiguousRange(
+        m_StagedSamplers,
+        [&](const StagedBinding* pRange, GLsizei Count) {
+            SetHandles(pRange, Count);
+            glBindSamplers(pRange->Slot, Count, m_MultiBindHandles.data());
+            DEV_CHECK_GL_ERROR("Failed to bind ", Count, " sampler(s) starting at slot ", pRange->Slot);
+        });
+
+    // Note that unlike glBindBufferRange, glBindBuffersRange does not change the generic binding point
+    m_BindingCounters.ApiCalls += ForEachContiguousRange(
+        m_StagedUniformBuffers,
+        [&](const StagedBinding* pRange, GLsizei Count) {
+            SetHandles(pRange, Count);
+            SetBufferRanges(pRange, Count);
+            glBindBuffersRange(GL_UNIFORM_BUFFER, pRange->Slot, Count, m_MultiBindHandles.data(), m_MultiBindOffsets.data(), m_MultiBindSizes.data());
+            DEV_CHECK_GL_ERROR("Failed to bind ", Count, " uniform buffer(s) starting at slot ", pRange->Slot);
+        });
+
+#    if GL_ARB_shader_storage_buffer_object
+    m_BindingCounters.ApiCalls += ForEachContiguousRange(
+        m_StagedStorageBlocks,
+        [&](const StagedBinding* pRange, GLsizei Count) {
+            SetHandles(pRange, Count);
+            SetBufferRanges(pRange, Count);
+            glBindBuffersRange(GL_SHADER_STORAGE_BUFFER, pRange->Slot, Count, m_MultiBindHandles.data(), m_MultiBindOffsets.data(), m_MultiBindSizes.data());
+            DEV_CHECK_GL_ERROR("Failed to bind ", Count, " shader storage block(s) starting at slot ", pRange->Slot);
+        });
+#    endif
+#endif
+
+    m_StagedTextures.clear();
+    m_StagedSamplers.clear();
+    m_StagedUniformBuffers.clear();
+    m_StagedStorageBlocks.clear();
+}
+
 void GLContextState::BindBuffer(GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO)
 {
     // Binding ARRAY_BUFFER or ELEMENT_ARRAY_BUFFER affects currently bound VAO
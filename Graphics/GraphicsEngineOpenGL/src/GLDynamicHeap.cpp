@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GLDynamicHeap.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
+#include "GLContextState.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+GLDynamicHeap::GLDynamicHeap(GLContextState& CtxState, IMemoryAllocator& Allocator, Uint64 Size) noexcept(false) :
+    // clang-format off
+    m_CtxState  {CtxState},
+    m_GLBuffer  {true},
+    m_RingBuffer{StaticCast<RingBuffer::OffsetType>(Size), Allocator}
+// clang-format on
+{
+#if GL_ARB_buffer_storage
+    // GL_COPY_WRITE_BUFFER is not used for anything else, so binding the buffer to it does not disturb VAO state
+    constexpr bool ResetVAO = false;
+    m_CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer, ResetVAO);
+
+    constexpr GLbitfield Flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, StaticCast<GLsizeiptr>(Size), nullptr, Flags);
+    DEV_CHECK_GL_ERROR_AND_THROW("Failed to allocate storage for the dynamic heap");
+
+    // Coherent mapping makes CPU writes visible to the GPU without explicit flushes or memory barriers
+    m_pCPUAddress = static_cast<Uint8*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, StaticCast<GLsizeiptr>(Size), Flags));
+    DEV_CHECK_GL_ERROR_AND_THROW("Failed to persistently map the dynamic heap");
+    if (m_pCPUAddress == nullptr)
+        LOG_ERROR_AND_THROW("Failed to persistently map the dynamic heap");
+
+    m_CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+
+    m_GLBuffer.SetName("Dynamic heap");
+
+    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+#else
+    LOG_ERROR_AND_THROW("Dynamic heap requires GL_ARB_buffer_storage");
+#endif
+}
+
+GLDynamicHeap::~GLDynamicHeap()
+{
+    // Wait until the GPU is done with all allocations to make the ring buffer empty
+    FinishCurrentFrame();
+    while (!m_PendingFrames.empty())
+        ReleaseCompletedFrames(/*WaitForOldest = */ true);
+
+#if GL_ARB_buffer_storage
+    if (m_pCPUAddress != nullptr)
+    {
+        constexpr bool ResetVAO = false;
+        m_CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer, ResetVAO);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        DEV_CHECK_GL_ERROR("Failed to unmap the dynamic heap");
+        m_CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+    }
+#endif
+
+    const Uint64 Size = m_RingBuffer.GetMaxSize();
+    LOG_INFO_MESSAGE("Dynamic heap usage stats:\n"
+                     "                       Total size: ",
+                     FormatMemorySize(Size, 2),
+                     ". Peak used size: ", FormatMemorySize(m_PeakUsedSize, 2, Size),
+                     ". Peak utilization: ",
+                     std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(Size, Uint64{1})) * 100.0, '%',
+                     ". Stalls: ", m_NumStalls);
+}
+
+Uint64 GLDynamicHeap::Allocate(Uint64 Size, Uint64 Alignment)
+{
+    if (Size > m_RingBuffer.GetMaxSize())
+    {
+        LOG_WARNING_MESSAGE_ONCE("Requested dynamic allocation size (", Size, ") exceeds the dynamic heap size (", m_RingBuffer.GetMaxSize(),
+                                 "). The allocation will fall back to buffer orphaning. Increase EngineGLCreateInfo::DynamicHeapSize.");
+        return InvalidOffset;
+    }
+
+    auto Offset = m_RingBuffer.Allocate(StaticCast<RingBuffer::OffsetType>(Size), StaticCast<RingBuffer::OffsetType>(Alignment));
+    if (Offset == RingBuffer::InvalidOffset && !m_PendingFrames.empty())
+    {
+        // The heap is full: wait until the GPU releases the space of the finished frames.
+        // The current frame must not be closed here as the allocations made in it may
+        // still be used by commands that have not been recorded yet.
+        while (Offset == RingBuffer::InvalidOffset && !m_PendingFrames.empty())
+        {
+            ReleaseCompletedFrames(/*WaitForOldest = */ true);
+            Offset = m_RingBuffer.Allocate(StaticCast<RingBuffer::OffsetType>(Size), StaticCast<RingBuffer::OffsetType>(Alignment));
+        }
+        ++m_NumStalls;
+        LOG_INFO_MESSAGE_ONCE("Dynamic heap is full and the context had to wait for the GPU. Consider increasing EngineGLCreateInfo::DynamicHeapSize.");
+    }
+
+    if (Offset == RingBuffer::InvalidOffset)
+    {
+        LOG_WARNING_MESSAGE_ONCE("Dynamic allocations of the current frame exceed the dynamic heap size (", m_RingBuffer.GetMaxSize(),
+                                 "). The allocations will fall back to buffer orphaning. Increase EngineGLCreateInfo::DynamicHeapSize.");
+        return InvalidOffset;
+    }
+
+    m_CurrFrameSize += Size;
+    m_PeakUsedSize = std::max(m_PeakUsedSize, Uint64{m_RingBuffer.GetUsedSize()});
+
+    return Offset;
+}
+
+void GLDynamicHeap::FinishCurrentFrame()
+{
+    if (m_CurrFrameSize != 0)
+    {
+        const Uint64 FenceValue = m_NextFenceValue++;
+        m_RingBuffer.FinishCurrentFrame(FenceValue);
+
+        GLObjectWrappers::GLSyncObj GLFence{glFenceSync(
+            GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+            0                              // Flags, must be 0
+            )};
+        DEV_CHECK_GL_ERROR("Failed to create gl fence");
+        m_PendingFrames.emplace_back(FenceValue, std::move(GLFence));
+
+        m_CurrFrameSize = 0;
+    }
+
+    ReleaseCompletedFrames(/*WaitForOldest = */ false);
+}
+
+void GLDynamicHeap::ReleaseCompletedFrames(bool WaitForOldest)
+{
+    Uint64 CompletedFenceValue = 0;
+    while (!m_PendingFrames.empty())
+    {
+        const auto& val_fence = m_PendingFrames.front();
+
+        const bool Wait = WaitForOldest && CompletedFenceValue == 0;
+
+        auto res = glClientWaitSync(val_fence.second,
+                                    Wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                    Wait ? std::numeric_limits<GLuint64>::max() : 0);
+        if (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED)
+        {
+            VERIFY(!Wait, "Failed to wait for the dynamic heap fence");
+            break;
+        }
+
+        CompletedFenceValue = val_fence.first;
+        m_PendingFrames.pop_front();
+    }
+
+    if (CompletedFenceValue != 0)
+        m_RingBuffer.ReleaseCompletedFrames(CompletedFenceValue);
+}
+
+} // namespace Diligent
@@ -33,10 +33,10 @@
 namespace Diligent
 {
 
-GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
-                     Uint32               NumShaders,
-                     bool                 IsSeparableProgram) noexcept :
-    m_AttachedShaders{ppShaders, ppShaders + NumShaders}
+GLProgram::GLProgram(ShaderGLImpl* const*      ppShaders,
+                     Uint32                    NumShaders,
+                     bool                      IsSeparableProgram,
+                     PipelineStateCacheGLImpl* pPSOCache) noexcept
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
 
@@ -47,6 +47,26 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
         DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
     }
 
+    if (pPSOCache != nullptr)
+    {
+        m_PSOCacheKey = PipelineStateCacheGLImpl::ComputeProgramKey(ppShaders, NumShaders, IsSeparableProgram);
+        if (pPSOCache->LoadProgram(m_PSOCacheKey, m_GLProg))
+        {
+            m_LinkStatus = LinkStatus::Succeeded;
+            return;
+        }
+
+        if ((pPSOCache->GetDesc().Mode & PSO_CACHE_MODE_STORE) != 0)
+        {
+            // The hint must be set before linking
+            glProgramParameteri(m_GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_BINARY_RETRIEVABLE_HINT) failed");
+            m_pPSOCache = pPSOCache;
+        }
+    }
+
+    m_AttachedShaders.assign(ppShaders, ppShaders + NumShaders);
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         auto* pCurrShader = ppShaders[i];
@@ -101,6 +121,8 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
     if (IsLinked)
     {
         m_LinkStatus = LinkStatus::Succeeded;
+        if (m_pPSOCache)
+            m_pPSOCache->StoreProgram(m_PSOCacheKey, m_GLProg);
     }
     else
     {
@@ -131,6 +153,7 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
 
     std::vector<const ShaderGLImpl*> Null{};
     m_AttachedShaders.swap(Null);
+    m_pPSOCache.Release();
 
     return m_LinkStatus;
 }
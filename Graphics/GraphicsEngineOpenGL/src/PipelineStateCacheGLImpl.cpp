@@ -0,0 +1,326 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "PipelineStateCacheGLImpl.hpp"
+#include "RenderDeviceGLImpl.hpp"
+#include "ShaderGLImpl.hpp"
+#include "DataBlobImpl.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 ProgramCacheMagic   = 0x42504C47; // GLPB
+constexpr Uint32 ProgramCacheVersion = 1;
+
+struct ProgramCacheHeader
+{
+    Uint32 Magic       = ProgramCacheMagic;
+    Uint32 Version     = ProgramCacheVersion;
+    Uint64 DriverHash  = 0;
+    Uint32 NumPrograms = 0;
+    Uint32 Padding     = 0;
+};
+
+struct ProgramBinaryHeader
+{
+    Uint64 Hash         = 0;
+    Uint64 SourceLength = 0;
+    Uint32 Format       = 0;
+    Uint32 Size         = 0;
+};
+
+constexpr Uint64 FNVOffsetBasis = 0xCBF29CE484222325ull;
+
+// 64-bit FNV-1a hash
+void HashBytes(Uint64& Hash, const void* pData, size_t Size)
+{
+    const Uint8* pBytes = static_cast<const Uint8*>(pData);
+    for (size_t i = 0; i < Size; ++i)
+    {
+        Hash ^= pBytes[i];
+        Hash *= 0x100000001B3ull;
+    }
+}
+
+Uint64 ComputeDriverHash()
+{
+    Uint64 Hash = FNVOffsetBasis;
+    for (GLenum Name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const char* Str = reinterpret_cast<const char*>(glGetString(Name));
+        if (Str != nullptr)
+            HashBytes(Hash, Str, strlen(Str) + 1);
+    }
+    return Hash;
+}
+
+} // namespace
+
+PipelineStateCacheGLImpl::PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                                                   RenderDeviceGLImpl*                 pRenderDeviceGL,
+                                                   const PipelineStateCacheCreateInfo& CreateInfo) :
+    // clang-format off
+    TPipelineStateCacheBase
+    {
+        pRefCounters,
+        pRenderDeviceGL,
+        CreateInfo,
+        false
+    },
+    m_DriverHash{ComputeDriverHash()}
+// clang-format on
+{
+    if (CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize != 0)
+        Deserialize(CreateInfo.pCacheData, CreateInfo.CacheDataSize);
+}
+
+PipelineStateCacheGLImpl::~PipelineStateCacheGLImpl()
+{
+}
+
+void PipelineStateCacheGLImpl::Deserialize(const void* pData, size_t DataSize)
+{
+    const Uint8* pSrc = static_cast<const Uint8*>(pData);
+    const Uint8* pEnd = pSrc + DataSize;
+
+    ProgramCacheHeader Header;
+    if (DataSize < sizeof(Header))
+    {
+        LOG_WARNING_MESSAGE("Pipeline state cache data is too small. The data will be ignored.");
+        return;
+    }
+    memcpy(&Header, pSrc, sizeof(Header));
+    pSrc += sizeof(Header);
+
+    if (Header.Magic != ProgramCacheMagic || Header.Version != ProgramCacheVersion)
+    {
+        LOG_WARNING_MESSAGE("Pipeline state cache data is not valid OpenGL program cache or has unsupported version. The data will be ignored.");
+        return;
+    }
+
+    if (Header.DriverHash != m_DriverHash)
+    {
+        // This is expected after a driver update
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_INFO_MESSAGE("Pipeline state cache data was generated by a different driver. The data will be ignored.");
+        return;
+    }
+
+    Uint32 NumLoaded = 0;
+    for (; NumLoaded < Header.NumPrograms; ++NumLoaded)
+    {
+        ProgramBinaryHeader BinaryHeader;
+        if (static_cast<size_t>(pEnd - pSrc) < sizeof(BinaryHeader))
+            break;
+        memcpy(&BinaryHeader, pSrc, sizeof(BinaryHeader));
+        pSrc += sizeof(BinaryHeader);
+
+        if (static_cast<size_t>(pEnd - pSrc) < BinaryHeader.Size)
+            break;
+
+        auto pBinary = std::make_shared<ProgramBinary>();
+
+        pBinary->Format = static_cast<GLenum>(BinaryHeader.Format);
+        pBinary->Data.assign(pSrc, pSrc + BinaryHeader.Size);
+        pSrc += BinaryHeader.Size;
+
+        m_Programs.emplace(ProgramKey{BinaryHeader.Hash, BinaryHeader.SourceLength}, std::move(pBinary));
+    }
+
+    if (NumLoaded != Header.NumPrograms)
+    {
+        LOG_WARNING_MESSAGE("Pipeline state cache data is corrupted: only ", NumLoaded, " out of ", Header.NumPrograms,
+                            " programs have been loaded.");
+    }
+}
+
+void PipelineStateCacheGLImpl::GetData(IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    *ppBlob = nullptr;
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+    size_t DataSize = sizeof(ProgramCacheHeader);
+    for (const auto& it : m_Programs)
+        DataSize += sizeof(ProgramBinaryHeader) + it.second->Data.size();
+
+    auto   pDataBlob = DataBlobImpl::Create(DataSize);
+    Uint8* pDst      = pDataBlob->GetDataPtr<Uint8>();
+
+    ProgramCacheHeader Header;
+    Header.DriverHash  = m_DriverHash;
+    Header.NumPrograms = static_cast<Uint32>(m_Programs.size());
+    memcpy(pDst, &Header, sizeof(Header));
+    pDst += sizeof(Header);
+
+    for (const auto& it : m_Programs)
+    {
+        const ProgramBinary& Binary = *it.second;
+
+        ProgramBinaryHeader BinaryHeader;
+        BinaryHeader.Hash         = it.first.Hash;
+        BinaryHeader.SourceLength = it.first.SourceLength;
+        BinaryHeader.Format       = static_cast<Uint32>(Binary.Format);
+        BinaryHeader.Size         = static_cast<Uint32>(Binary.Data.size());
+        memcpy(pDst, &BinaryHeader, sizeof(BinaryHeader));
+        pDst += sizeof(BinaryHeader);
+
+        memcpy(pDst, Binary.Data.data(), Binary.Data.size());
+        pDst += Binary.Data.size();
+    }
+    VERIFY_EXPR(pDst == pDataBlob->GetDataPtr<Uint8>() + DataSize);
+
+    *ppBlob = pDataBlob.Detach();
+}
+
+void PipelineStateCacheGLImpl::GetStats(PipelineStateCacheStatsGL& Stats) const
+{
+    Stats.NumProgramsLoaded   = m_NumProgramsLoaded.load();
+    Stats.NumProgramsRejected = m_NumProgramsRejected.load();
+    Stats.NumProgramsStored   = m_NumProgramsStored.load();
+}
+
+PipelineStateCacheGLImpl::ProgramKey PipelineStateCacheGLImpl::ComputeProgramKey(ShaderGLImpl* const* ppShaders,
+                                                                                 Uint32               NumShaders,
+                                                                                 bool                 IsSeparableProgram)
+{
+    ProgramKey Key;
+    Key.Hash = FNVOffsetBasis;
+
+    const Uint8 Separable = IsSeparableProgram ? 1 : 0;
+    HashBytes(Key.Hash, &Separable, sizeof(Separable));
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        const SHADER_TYPE ShaderType = ppShaders[i]->GetDesc().ShaderType;
+        HashBytes(Key.Hash, &ShaderType, sizeof(ShaderType));
+
+        // GLSL source of the shader
+        const void* pSource    = nullptr;
+        Uint64      SourceSize = 0;
+        ppShaders[i]->GetBytecode(&pSource, SourceSize);
+        if (pSource != nullptr)
+            HashBytes(Key.Hash, pSource, static_cast<size_t>(SourceSize));
+        Key.SourceLength += SourceSize;
+    }
+
+    return Key;
+}
+
+bool PipelineStateCacheGLImpl::LoadProgram(const ProgramKey& Key, GLuint GLProg)
+{
+    if ((m_Desc.Mode & PSO_CACHE_MODE_LOAD) == 0)
+        return false;
+
+    std::shared_ptr<const ProgramBinary> pBinary;
+    {
+        std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+        auto it = m_Programs.find(Key);
+        if (it == m_Programs.end())
+            return false;
+
+        pBinary = it->second;
+    }
+
+    glProgramBinary(GLProg, pBinary->Format, pBinary->Data.data(), static_cast<GLsizei>(pBinary->Data.size()));
+    // GL_INVALID_ENUM is generated if the binary format is not supported by the driver
+    bool Succeeded = glGetError() == GL_NO_ERROR;
+    if (Succeeded)
+    {
+        // The driver may reject the binary, e.g. after an update, in which case
+        // the link status is false.
+        GLint IsLinked = GL_FALSE;
+        glGetProgramiv(GLProg, GL_LINK_STATUS, &IsLinked);
+        DEV_CHECK_GL_ERROR("glGetProgramiv(GL_LINK_STATUS) failed");
+        Succeeded = IsLinked != GL_FALSE;
+    }
+
+    if (Succeeded)
+    {
+        m_NumProgramsLoaded.fetch_add(1);
+    }
+    else
+    {
+        m_NumProgramsRejected.fetch_add(1);
+
+        {
+            std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+            auto it = m_Programs.find(Key);
+            if (it != m_Programs.end() && it->second == pBinary)
+                m_Programs.erase(it);
+        }
+
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_INFO_MESSAGE("Program binary was rejected by the driver. The program will be linked from the shaders.");
+    }
+
+    return Succeeded;
+}
+
+bool PipelineStateCacheGLImpl::StoreProgram(const ProgramKey& Key, GLuint GLProg)
+{
+    if ((m_Desc.Mode & PSO_CACHE_MODE_STORE) == 0)
+        return false;
+
+    GLint BinaryLength = 0;
+    glGetProgramiv(GLProg, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+    DEV_CHECK_GL_ERROR("glGetProgramiv(GL_PROGRAM_BINARY_LENGTH) failed");
+    if (BinaryLength <= 0)
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_INFO_MESSAGE("The driver did not provide the program binary");
+        return false;
+    }
+
+    auto pBinary = std::make_shared<ProgramBinary>();
+    pBinary->Data.resize(static_cast<size_t>(BinaryLength));
+
+    GLsizei Length = 0;
+    glGetProgramBinary(GLProg, BinaryLength, &Length, &pBinary->Format, pBinary->Data.data());
+    if (glGetError() != GL_NO_ERROR || Length <= 0)
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_ERROR_MESSAGE("Failed to get the program binary");
+        return false;
+    }
+    pBinary->Data.resize(static_cast<size_t>(Length));
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+        m_Programs[Key] = std::move(pBinary);
+    }
+    m_NumProgramsStored.fetch_add(1);
+
+    return true;
+}
+
+} // namespace Diligent
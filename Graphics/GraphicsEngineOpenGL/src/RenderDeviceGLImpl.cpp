@@ -29,6 +29,8 @@
 
 #include "RenderDeviceGLImpl.hpp"
 
+#include "SwapChainGL.h"
+
 #include "BufferGLImpl.hpp"
 #include "ShaderGLImpl.hpp"
 #include "Texture1D_GL.hpp"
@@ -47,6 +49,7 @@
 #include "RenderPassGLImpl.hpp"
 #include "FramebufferGLImpl.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 
 #include "GLTypeConversions.hpp"
 #include "VAOCache.hpp"
@@ -179,8 +182,6 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 {
     VerifyEngineGLCreateInfo(EngineCI);
 
-    VERIFY(EngineCI.NumDeferredContexts == 0, "EngineCI.NumDeferredContexts > 0 should've been caught by CreateDeviceAndSwapChainGL() or AttachToActiveGLContext()");
-
     GLint NumExtensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &NumExtensions);
     CHECK_GL_ERROR("Failed to get the number of extensions");
@@ -342,6 +343,16 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
     m_DeviceInfo.MaxShaderVersion.HLSL = {5, 0};
 #endif
 
+    if (EngineCI.DynamicHeapSize != 0)
+    {
+#if GL_ARB_buffer_storage
+        if (m_GLCaps.BufferStorage)
+            m_DynamicHeapSize = EngineCI.DynamicHeapSize;
+        else
+#endif
+            LOG_INFO_MESSAGE("Dynamic heap requires GL_ARB_buffer_storage that is not supported by this device. Dynamic buffers will use buffer orphaning.");
+    }
+
 #if GL_KHR_parallel_shader_compile
     if (m_DeviceInfo.Features.AsyncShaderCompilation)
     {
@@ -646,13 +657,18 @@ void RenderDeviceGLImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Create
 void RenderDeviceGLImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                   IPipelineStateCache**               ppPSOCache)
 {
-    *ppPSOCache = nullptr;
+    if (m_GLCaps.ProgramBinary)
+        CreatePipelineStateCacheImpl(ppPSOCache, CreateInfo);
+    else
+    {
+        LOG_INFO_MESSAGE("Pipeline state cache is not supported: the driver does not support program binaries");
+        *ppPSOCache = nullptr;
+    }
 }
 
 void RenderDeviceGLImpl::CreateDeferredContext(IDeviceContext** ppContext)
 {
-    LOG_ERROR_MESSAGE("Deferred contexts are not supported in OpenGL backend.");
-    *ppContext = nullptr;
+    CreateDeferredContextImpl(ppContext);
 }
 
 SparseTextureFormatInfo RenderDeviceGLImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
@@ -826,6 +842,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
         if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
         {
             const bool IsGL46OrAbove = GLVersion >= Version{4, 6};
+            const bool IsGL44OrAbove = GLVersion >= Version{4, 4};
             const bool IsGL43OrAbove = GLVersion >= Version{4, 3};
             const bool IsGL42OrAbove = GLVersion >= Version{4, 2};
             const bool IsGL41OrAbove = GLVersion >= Version{4, 1};
@@ -894,6 +911,8 @@ void RenderDeviceGLImpl::InitAdapterInfo()
 
             m_GLCaps.FramebufferSRGB  = IsGL40OrAbove || CheckExtension("GL_ARB_framebuffer_sRGB");
             m_GLCaps.SemalessCubemaps = IsGL40OrAbove || CheckExtension("GL_ARB_seamless_cube_map");
+            m_GLCaps.BufferStorage    = IsGL44OrAbove || CheckExtension("GL_ARB_buffer_storage");
+            m_GLCaps.MultiBind        = IsGL44OrAbove || CheckExtension("GL_ARB_multi_bind");
         }
         else
         {
@@ -976,6 +995,17 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             m_GLCaps.SemalessCubemaps = false;
         }
 
+#if !PLATFORM_WEB
+        // Program binaries are core since GL4.1 and GLES3.0, but drivers are not required to support any format
+        if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GLES || GLVersion >= Version{4, 1} || CheckExtension("GL_ARB_get_program_binary"))
+        {
+            GLint NumBinaryFormats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumBinaryFormats);
+            CHECK_GL_ERROR("glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS)");
+            m_GLCaps.ProgramBinary = NumBinaryFormats > 0;
+        }
+#endif
+
 #ifdef GL_KHR_shader_subgroup
         if (CheckExtension("GL_KHR_shader_subgroup"))
         {
@@ -136,7 +136,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                            // will reflect data written by shaders prior to the barrier
             GLState);
 
-        GLState.BindUniformBuffer(binding, UB.pBuffer->GetGLHandle(), static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset), UB.RangeSize);
+        GLState.StageUniformBuffer(binding, UB.pBuffer->GetDataGLHandle(), UB.pBuffer->GetDataOffset() + static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset), UB.RangeSize);
     }
 
     for (Uint32 s = 0, binding = BaseBindings[BINDING_RANGE_TEXTURE]; s < GetTextureCount(); ++s, ++binding)
@@ -151,7 +151,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
             auto* pTexViewGL = Tex.pView.RawPtr<TextureViewGLImpl>();
             auto* pTextureGL = Tex.pTexture;
             VERIFY_EXPR(pTextureGL == pTexViewGL->GetTexture());
-            GLState.BindTexture(binding, pTexViewGL->GetBindTarget(), pTexViewGL->GetHandle());
+            GLState.StageTexture(binding, pTexViewGL->GetBindTarget(), pTexViewGL->GetHandle());
 
             pTextureGL->TextureMemoryBarrier(
                 MEMORY_BARRIER_TEXTURE_FETCH, // Texture fetches from shaders, including fetches from buffer object
@@ -161,11 +161,11 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
 
             if (Tex.pSampler)
             {
-                GLState.BindSampler(binding, Tex.pSampler->GetHandle());
+                GLState.StageSampler(binding, Tex.pSampler->GetHandle());
             }
             else
             {
-                GLState.BindSampler(binding, GLObjectWrappers::GLSamplerObj{false});
+                GLState.StageSampler(binding, GLObjectWrappers::GLSamplerObj{false});
             }
         }
         else if (Tex.pBuffer != nullptr)
@@ -174,8 +174,8 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
             auto* pBufferGL  = Tex.pBuffer;
             VERIFY_EXPR(pBufferGL == pBufViewGL->GetBuffer());
 
-            GLState.BindTexture(binding, GL_TEXTURE_BUFFER, pBufViewGL->GetTexBufferHandle());
-            GLState.BindSampler(binding, GLObjectWrappers::GLSamplerObj{false}); // Use default texture sampling parameters
+            GLState.StageTexture(binding, GL_TEXTURE_BUFFER, pBufViewGL->GetTexBufferHandle());
+            GLState.StageSampler(binding, GLObjectWrappers::GLSamplerObj{false}); // Use default texture sampling parameters
 
             pBufferGL->BufferMemoryBarrier(
                 MEMORY_BARRIER_TEXEL_BUFFER, // Texture fetches from shaders, including fetches from buffer object
@@ -185,6 +185,10 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
         }
     }
 
+    // Images are bound individually as glBindImageTextures can't specify the level, layer and format.
+    // Commit the staged textures before that as the debug checks below use the active texture unit.
+    GLState.CommitStagedBindings();
+
 #if GL_ARB_shader_image_load_store
     for (Uint32 img = 0, binding = BaseBindings[BINDING_RANGE_IMAGE]; img < GetImageCount(); ++img, ++binding)
     {
@@ -278,7 +282,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
     {
         const auto& SSBO = GetConstSSBO(ssbo);
         if (!SSBO.pBufferView)
-            return;
+            continue;
 
         auto* const pBufferViewGL = SSBO.pBufferView.ConstPtr();
         const auto& ViewDesc      = pBufferViewGL->GetDesc();
@@ -290,15 +294,17 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                            // will reflect writes prior to the barrier
             GLState);
 
-        GLState.BindStorageBlock(binding,
-                                 pBufferGL->GetGLHandle(),
-                                 StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
-                                 StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
+        GLState.StageStorageBlock(binding,
+                                  pBufferGL->GetGLHandle(),
+                                  StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
+                                  StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
 
         if (ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS)
             WritableBuffers.push_back(pBufferGL);
     }
 #endif
+
+    GLState.CommitStagedBindings();
 }
 
 void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLState,
@@ -311,9 +317,9 @@ void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLSt
         const auto  UBOIdx = PlatformMisc::GetLSB(UBOBit);
         const auto& UB     = GetConstUB(UBOIdx);
         VERIFY_EXPR(UB.IsDynamic());
-        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(),
-                                  static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset),
-                                  UB.RangeSize);
+        GLState.StageUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetDataGLHandle(),
+                                   UB.pBuffer->GetDataOffset() + static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset),
+                                   UB.RangeSize);
     }
 
 
@@ -329,12 +335,26 @@ void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLSt
         const auto* pBufferGL     = pBufferViewGL->GetBuffer<const BufferGLImpl>();
         const auto& ViewDesc      = pBufferViewGL->GetDesc();
 
-        GLState.BindStorageBlock(BaseSSBOBinding + SSBOIdx,
-                                 pBufferGL->GetGLHandle(),
-                                 StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
-                                 StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
+        GLState.StageStorageBlock(BaseSSBOBinding + SSBOIdx,
+                                  pBufferGL->GetGLHandle(),
+                                  StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
+                                  StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
+    }
+
+    GLState.CommitStagedBindings();
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void ShaderResourceCacheGL::DvpVerifyDynamicAllocations(Uint64 CurrentHeapFrame) const
+{
+    for (Uint32 ub = 0; ub < GetUBCount(); ++ub)
+    {
+        const auto& UB = GetConstUB(ub);
+        if (UB.pBuffer)
+            UB.pBuffer->DvpVerifyDynamicAllocation(CurrentHeapFrame);
     }
 }
+#endif
 
 #ifdef DILIGENT_DEBUG
 void ShaderResourceCacheGL::DbgVerifyDynamicBufferMasks() const
@@ -136,7 +136,7 @@ void ShaderResourcesGL::AllocateResources(std::vector<UniformBufferInfo>& Unifor
 
     TotalMemorySize += AlignedStringPoolDataSize * sizeof(Char);
 
-    auto& MemAllocator = GetRawAllocator();
+    auto& MemAllocator = GetRawAllocator(MEMORY_CATEGORY_SHADER_TOOLS);
     void* RawMemory    = ALLOCATE_RAW(MemAllocator, "Memory buffer for ShaderResourcesGL", TotalMemorySize);
 
     // clang-format off
@@ -205,7 +205,7 @@ ShaderResourcesGL::~ShaderResourcesGL()
     void* RawMemory = m_UniformBuffers;
     if (RawMemory != nullptr)
     {
-        auto& MemAllocator = GetRawAllocator();
+        auto& MemAllocator = GetRawAllocator(MEMORY_CATEGORY_SHADER_TOOLS);
         MemAllocator.Free(RawMemory);
     }
 }
@@ -844,7 +844,7 @@ void ShaderResourcesGL::LoadUniforms(const LoadUniformsAttribs& Attribs)
             }
         }
 
-        m_UBReflectionBuffer = ShaderCodeBufferDescX::PackArray(UBReflections.cbegin(), UBReflections.cend(), GetRawAllocator());
+        m_UBReflectionBuffer = ShaderCodeBufferDescX::PackArray(UBReflections.cbegin(), UBReflections.cend(), GetRawAllocator(MEMORY_CATEGORY_SHADER_TOOLS));
     }
 }
 
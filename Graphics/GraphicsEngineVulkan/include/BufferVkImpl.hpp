@@ -108,11 +108,20 @@ private:
 
     VulkanUtilities::BufferViewWrapper CreateView(struct BufferViewDesc& ViewDesc);
 
+    // Relocates the buffer memory when the device memory is defragmented
+    class MemoryMover;
+
     Uint32       m_DynamicOffsetAlignment    = 0;
     VkDeviceSize m_BufferMemoryAlignedOffset = 0;
 
     VulkanUtilities::BufferWrapper          m_VulkanBuffer;
     VulkanUtilities::VulkanMemoryAllocation m_MemoryAllocation;
+
+    // Device address of the buffer if it was created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT
+    VkDeviceAddress m_VkDeviceAddress = 0;
+
+    // Only immutable buffers that are not referenced by views, descriptors or device addresses are movable
+    std::shared_ptr<MemoryMover> m_pMemoryMover;
 };
 
 } // namespace Diligent
@@ -33,6 +33,8 @@
 #include <mutex>
 #include <deque>
 #include <atomic>
+#include <thread>
+#include <condition_variable>
 
 #include "EngineVkImplTraits.hpp"
 #include "ObjectBase.hpp"
@@ -54,7 +56,8 @@ private:
                 Uint32                                    NumContexts,
                 VulkanUtilities::VulkanSyncObjectManager& SyncObjectMngr,
                 VkDevice                                  LogicalDevice,
-                Uint64                                    dbgValue);
+                VkSemaphore                               TimelineSemaphore,
+                Uint64                                    Value);
 
     void GetSemaphores(std::vector<VkSemaphore>& Semaphores);
 
@@ -73,12 +76,15 @@ public:
         return std::move(m_Semaphores[CommandQueueId]);
     }
 
-    // vkGetFenceStatus and vkWaitForFences with same fence can be used in multiple threads.
-    // Other functions requires external synchronization.
-    VkFence GetFence() const
-    {
-        return m_Fence;
-    }
+    // Returns true if the commands submitted with this sync point have been completed.
+    // When the queue tracks completion with a timeline semaphore, its counter is compared with the sync point value,
+    // otherwise the status of the binary fence is checked.
+    // vkGetFenceStatus and vkGetSemaphoreCounterValue can be used in multiple threads.
+    bool IsCompleted(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice) const;
+
+    // Waits until the commands submitted with this sync point are completed.
+    // vkWaitForFences and vkWaitSemaphores with the same object can be used in multiple threads.
+    VkResult Wait(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, uint64_t Timeout) const;
 
     SoftwareQueueIndex GetCommandQueueId() const
     {
@@ -87,9 +93,11 @@ public:
 
 private:
     const SoftwareQueueIndex                 m_CommandQueueId;
-    const Uint8                              m_NumSemaphores; // same as NumContexts
-    VulkanUtilities::VulkanRecycledFence     m_Fence;
-    VulkanUtilities::VulkanRecycledSemaphore m_Semaphores[1]; // [m_NumSemaphores]
+    const Uint8                              m_NumSemaphores;     // same as NumContexts
+    const Uint64                             m_Value;             // Fence value of the submission
+    const VkSemaphore                        m_TimelineSemaphore; // Queue timeline semaphore, may be null
+    VulkanUtilities::VulkanRecycledFence     m_Fence;             // Only used when m_TimelineSemaphore is null
+    VulkanUtilities::VulkanRecycledSemaphore m_Semaphores[1];     // [m_NumSemaphores]
 };
 
 
@@ -104,7 +112,8 @@ public:
                        SoftwareQueueIndex                                    CommandQueueId,
                        Uint32                                                NumCommandQueues,
                        Uint32                                                vkQueueIndex,
-                       const ImmediateContextCreateInfo&                     CreateInfo);
+                       const ImmediateContextCreateInfo&                     CreateInfo,
+                       bool                                                  EnableSubmissionThread = false);
     ~CommandQueueVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_CommandQueueVk, TBase)
@@ -142,8 +151,16 @@ public:
     /// Implementation of ICommandQueueVk::EnqueueSignal().
     virtual void DILIGENT_CALL_TYPE EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value) override final;
 
+    // Returns true if the completion of the submitted commands is tracked with the queue timeline semaphore.
+    // In this case the queue does not need the fence set by SetFence().
+    bool HasTimelineSemaphore() const
+    {
+        return m_TimelineSemaphore != VK_NULL_HANDLE;
+    }
+
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence)
     {
+        VERIFY(!HasTimelineSemaphore(), "The queue tracks completion with the timeline semaphore and does not use the fence");
         VERIFY_EXPR(pFence->GetDesc().Type == FENCE_TYPE_CPU_WAIT_ONLY);
         VERIFY_EXPR(!pFence->IsTimelineSemaphore());
         m_pFence = std::move(pFence);
@@ -155,11 +172,34 @@ public:
         return m_LastSyncPoint;
     }
 
+    // Blocks until all submissions queued to the submission thread have been passed to vkQueueSubmit.
+    // Returns the error of the first vkQueueSubmit call made by the thread that failed since the error
+    // was last reported, or VK_SUCCESS. Does nothing if the submission thread is not used.
+    VkResult WaitForPendingSubmissions();
+
+    // Locks the queue for direct access by the application (see IDeviceContext::LockCommandQueue()):
+    // waits until the submission thread has passed all pending submissions to vkQueueSubmit and locks
+    // m_QueueMutex until UnlockDirectAccess() is called. While the queue is locked, the submissions made
+    // through this interface are passed to vkQueueSubmit directly rather than by the submission thread.
+    void LockDirectAccess();
+    void UnlockDirectAccess();
+
 private:
-    SyncPointVkPtr CreateSyncPoint(Uint64 dbgValue);
+    SyncPointVkPtr CreateSyncPoint(Uint64 Value);
 
     void InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore, Uint64 Value);
 
+    // Submits the batches in m_TempSubmitInfos followed by a batch that signals the timeline semaphore with FenceValue.
+    // m_QueueMutex must be locked.
+    VkResult SubmitWithTimelineSignal(Uint64 FenceValue);
+
+    // Copies the submit info to a pending submission that is processed by the submission thread.
+    // Returns false if the submit info can't be copied because its pNext chain contains structures
+    // other than VkTimelineSemaphoreSubmitInfo.
+    bool EnqueueSubmission(const VkSubmitInfo& SubmitInfo, Uint64& FenceValue);
+
+    void SubmissionThreadProc();
+
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> m_LogicalDevice;
 
     const VkQueue            m_VkQueue;
@@ -168,6 +208,12 @@ private:
     const bool               m_SupportedTimelineSemaphore;
     const Uint8              m_NumCommandQueues;
 
+    // Timeline semaphore that is signaled with the fence value of every submission.
+    // All command buffers with fence value less than or equal to the semaphore value
+    // are guaranteed to be finished by the GPU.
+    // Null if timeline semaphores are not supported, in which case m_pFence is used.
+    VulkanUtilities::SemaphoreWrapper m_TimelineSemaphore;
+
     // Fence is signaled right after a command buffer has been
     // submitted to the command queue for execution.
     // All command buffers with fence value less than or equal to the signaled value
@@ -178,11 +224,59 @@ private:
     std::atomic<Uint64> m_NextFenceValue{1};
 
     // Protects access to the m_VkQueue internal data.
-    std::mutex m_QueueMutex;
+    // The mutex is recursive because it is held by LockDirectAccess() while the application
+    // may call the methods of this interface that lock it again.
+    std::recursive_mutex m_QueueMutex;
 
     // Array used to merge semaphores from SubmitInfo and from SyncPointVk
     std::vector<VkSemaphore> m_TempSignalSemaphores;
 
+    // Batches passed to vkQueueSubmit by SubmitWithTimelineSignal(), protected by m_QueueMutex
+    std::vector<VkSubmitInfo>                  m_TempSubmitInfos;
+    std::vector<VkTimelineSemaphoreSubmitInfo> m_TempTimelineInfos;
+
+    // Signal semaphore values for BindSparse(), protected by m_QueueMutex
+    std::vector<Uint64> m_TempSignalValues;
+
+    // Copy of VkSubmitInfo that owns all arrays it references
+    struct PendingSubmission
+    {
+        std::vector<VkSemaphore>          WaitSemaphores;
+        std::vector<VkPipelineStageFlags> WaitDstStageMask;
+        std::vector<VkCommandBuffer>      CommandBuffers;
+        std::vector<VkSemaphore>          SignalSemaphores;
+        std::vector<Uint64>               WaitSemaphoreValues;
+        std::vector<Uint64>               SignalSemaphoreValues;
+        bool                              HasTimelineValues = false;
+        Uint64                            FenceValue        = 0;
+    };
+
+    // Submission thread that calls vkQueueSubmit, so that the immediate context does not block on it.
+    // Only used when the timeline semaphore is available: the thread may submit the batches later than the
+    // context continues execution, and timeline semaphore values can be waited on before they are signaled.
+    std::thread m_SubmissionThread;
+
+    // Protects m_PendingSubmissions, m_FreeSubmissions, m_IsSubmitting, m_StopSubmissionThread, m_DirectAccess and m_SubmissionError
+    std::mutex m_PendingSubmissionsMtx;
+    // Notified when a submission is enqueued or the thread needs to stop
+    std::condition_variable m_SubmissionEnqueuedCV;
+    // Notified when the thread has passed the batches to vkQueueSubmit
+    std::condition_variable m_SubmissionsProcessedCV;
+
+    std::vector<PendingSubmission> m_PendingSubmissions;
+    // Processed submissions whose arrays keep their capacity
+    std::vector<PendingSubmission> m_FreeSubmissions;
+
+    bool m_IsSubmitting         = false;
+    bool m_StopSubmissionThread = false;
+
+    // Whether the queue is locked by LockDirectAccess(), in which case no submissions are passed to the thread
+    bool m_DirectAccess = false;
+
+    // The error of the first failed vkQueueSubmit call made by the submission thread.
+    // It is reported and reset by the next call that drains the pending submissions or enqueues a new one.
+    VkResult m_SubmissionError = VK_SUCCESS;
+
     // Protects access to the m_LastSyncPoint
     Threading::SpinLock m_LastSyncPointLock;
 
@@ -456,11 +456,19 @@ private:
         m_State.NumCommands = m_State.NumCommands != 0 ? m_State.NumCommands : 1;
         if (m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
         {
-            VkCommandBuffer vkCmdBuff = m_CmdPool->GetCommandBuffer();
+            bool            IsReused  = false;
+            VkCommandBuffer vkCmdBuff = m_CmdPool->GetCommandBuffer("", &IsReused);
+            if (IsReused)
+                ++m_Stats.CommandBufferCounters.Reused;
+            else
+                ++m_Stats.CommandBufferCounters.Allocated;
             m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
         }
     }
 
+    // Returns the command buffers to the pool once the GPU has finished executing them.
+    // The buffers are recycled as one batch with a single release queue entry.
+    void        DisposeVkCmdBuffers(SoftwareQueueIndex CmdQueue, const VkCommandBuffer* pVkCmdBuffs, size_t NumCmdBuffs, Uint64 FenceValue);
     inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
     inline void DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
@@ -538,6 +546,14 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // Offsets of the descriptor set data in the dynamic heap buffer.
+            // Only used when descriptor buffers are enabled.
+            std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> DescrBufferOffsets = {};
+
+            // Indicates if descriptor set data must be written to the dynamic heap by
+            // the next CommitDescriptorBuffers() call.
+            bool DescrBufferDataStale = true;
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -555,6 +571,7 @@ private:
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    void               CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -565,6 +582,9 @@ private:
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
+    /// Indicates if shader resources are bound through descriptor buffers rather than descriptor sets
+    bool m_UseDescriptorBuffer = false;
+
     /// Temporary array used by CommitDescriptorSets
     std::array<VkDescriptorSet, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorSets = {};
 
@@ -594,6 +614,9 @@ private:
     std::vector<uint64_t> m_WaitSemaphoreValues;
     std::vector<uint64_t> m_SignalSemaphoreValues;
 
+    // Command buffers of deferred contexts executed by Flush(), grouped by context before they are disposed
+    std::vector<std::pair<DeviceContextVkImpl*, VkCommandBuffer>> m_DeferredCtxCmdBuffs;
+
     // List of fences to signal/wait next time the command context is flushed
     std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>> m_SignalFences;
     std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>> m_WaitFences;
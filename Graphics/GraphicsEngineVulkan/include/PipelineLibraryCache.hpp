@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCache class
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include "GraphicsTypes.h"
+#include "RenderPass.h"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+class PipelineResourceSignatureVkImpl;
+
+/// Caches graphics pipeline libraries (VK_EXT_graphics_pipeline_library) so that
+/// pipelines that share vertex input, pre-rasterization, fragment shader or fragment output
+/// state reuse the corresponding library instead of compiling it again.
+class PipelineLibraryCache
+{
+public:
+    PipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept;
+
+    // clang-format off
+    PipelineLibraryCache             (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache             (PipelineLibraryCache&&)      = delete;
+    PipelineLibraryCache& operator = (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache& operator = (PipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    ~PipelineLibraryCache();
+
+    enum LIBRARY_PART : Uint32
+    {
+        LIBRARY_PART_VERTEX_INPUT = 0,
+        LIBRARY_PART_PRE_RASTERIZATION,
+        LIBRARY_PART_FRAGMENT_SHADER,
+        LIBRARY_PART_FRAGMENT_OUTPUT,
+        LIBRARY_PART_COUNT
+    };
+    using LibraryArray = std::array<VkPipeline, LIBRARY_PART_COUNT>;
+
+    // Attributes of the pipeline that are not contained in VkGraphicsPipelineCreateInfo.
+    // Vulkan handles may be reused after the objects are destroyed, so the libraries
+    // are matched by the identity of the signatures and the render pass rather than by the handles.
+    // The objects cannot be destroyed while the library is in the cache since every pipeline that
+    // uses the library keeps them alive.
+    struct LibraryAttribs
+    {
+        const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures   = nullptr;
+        Uint32                                                SignatureCount = 0;
+        IRenderPass*                                          pRenderPass    = nullptr;
+
+        // SPIR-V byte code of each stage in VkGraphicsPipelineCreateInfo::pStages
+        const std::vector<uint32_t>* const* ppStageSPIRVs = nullptr;
+    };
+
+    // Gets the libraries for all parts of the complete graphics pipeline described by PipelineCI.
+    // The libraries that are not found in the cache are created and added to the cache.
+    // Every library obtained by this method is referenced until it is released by ReleaseLibraries.
+    // If the method throws, the libraries obtained before the failure are written to Libraries
+    // (the remaining elements are null) and must also be released.
+    void GetLibraries(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                      const LibraryAttribs&               Attribs,
+                      VkPipelineCache                     vkPSOCache,
+                      const char*                         PipelineName,
+                      LibraryArray&                       Libraries) noexcept(false);
+
+    // Releases the references to the libraries obtained by GetLibraries.
+    // The libraries that are no longer referenced are removed from the cache.
+    void ReleaseLibraries(const LibraryArray& Libraries);
+
+    // Links the libraries into an executable pipeline.
+    // When Optimize is true, the pipeline is created with link-time optimization, which
+    // is considerably slower than the fast link, but produces the same code as a monolithic pipeline.
+    VulkanUtilities::PipelineWrapper LinkPipeline(const LibraryArray&   Libraries,
+                                                  VkPipelineLayout      vkLayout,
+                                                  VkPipelineCreateFlags Flags,
+                                                  bool                  Optimize,
+                                                  VkPipelineCache       vkPSOCache,
+                                                  const char*           PipelineName) const noexcept(false);
+
+    void Destroy();
+
+private:
+    // Data contain the size and the hash of the SPIR-V byte code rather than the byte code itself,
+    // so the byte code is also referenced by the key and is compared when the rest of the key matches.
+    struct LibraryKey
+    {
+        LIBRARY_PART       Part = LIBRARY_PART_COUNT;
+        std::vector<Uint8> Data;
+
+        // SPIR-V byte code of the shader stages of the library
+        std::vector<const std::vector<uint32_t>*> SPIRVs;
+
+        LibraryKey() = default;
+
+        // clang-format off
+        LibraryKey             (const LibraryKey&) = delete;
+        LibraryKey             (LibraryKey&&)      = default;
+        LibraryKey& operator = (const LibraryKey&) = delete;
+        LibraryKey& operator = (LibraryKey&&)      = default;
+        // clang-format on
+
+        bool operator==(const LibraryKey& rhs) const noexcept;
+
+        size_t GetHash() const noexcept;
+
+        // Copies the byte code referenced by SPIRVs into the key, so that the key
+        // does not reference the shaders of the pipeline after it is added to the cache.
+        void CopySPIRVs();
+
+        struct Hasher
+        {
+            size_t operator()(const LibraryKey& Key) const noexcept
+            {
+                return Key.GetHash();
+            }
+        };
+
+    private:
+        std::vector<std::vector<uint32_t>> m_SPIRVCopies;
+
+        mutable size_t Hash = 0;
+    };
+
+    struct LibraryEntry
+    {
+        VulkanUtilities::PipelineWrapper Library;
+
+        // The number of pipelines that use the library
+        Uint32 RefCount = 0;
+    };
+
+    class KeyBuilder;
+
+    VkPipeline GetLibrary(KeyBuilder&&                        Builder,
+                          const VkGraphicsPipelineCreateInfo& LibraryCI,
+                          VkPipelineCache                     vkPSOCache,
+                          const char*                         PipelineName) noexcept(false);
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    std::mutex                                                       m_Mutex;
+    std::unordered_map<LibraryKey, LibraryEntry, LibraryKey::Hasher> m_Cache;
+
+    // Keys of the libraries in m_Cache, used to find the entry when the library is released.
+    // Pointers to the elements of the unordered map remain valid when the map is rehashed.
+    std::unordered_map<VkPipeline, const LibraryKey*> m_LibraryKeys;
+};
+
+} // namespace Diligent
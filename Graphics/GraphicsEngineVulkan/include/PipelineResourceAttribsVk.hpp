@@ -199,5 +199,26 @@ inline VkDescriptorType DescriptorTypeToVkDescriptorType(DescriptorType Type)
     }
 }
 
+/// Returns the Vulkan descriptor type used in descriptor buffers.
+
+/// Dynamic descriptors are not allowed in descriptor set layouts created with
+/// VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT flag. Dynamic buffers are
+/// instead written as regular buffer descriptors with the dynamic offset applied to the address.
+inline VkDescriptorType DescriptorTypeToVkDescriptorBufferType(DescriptorType Type)
+{
+    switch (Type)
+    {
+        case DescriptorType::UniformBufferDynamic:
+            return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+        default:
+            return DescriptorTypeToVkDescriptorType(Type);
+    }
+}
+
 
 } // namespace Diligent
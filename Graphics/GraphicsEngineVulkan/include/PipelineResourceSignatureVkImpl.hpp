@@ -123,6 +123,9 @@ public:
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Returns true if descriptor sets of this signature are stored in descriptor buffers
+    bool UsesDescriptorBuffer() const { return m_UseDescriptorBuffer; }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -177,6 +180,15 @@ private:
     void Destruct();
 
     void CreateSetLayouts(bool IsSerialized);
+    void CreateDynamicSetUpdateTemplate();
+    void InitDescriptorBufferLayouts();
+
+    bool HasDynamicSetUpdateTemplate() const { return m_VkDynamicSetUpdateTemplate != VK_NULL_HANDLE; }
+
+    const ShaderResourceCacheVk::DescriptorBufferSetLayout* GetDescriptorBufferLayouts() const
+    {
+        return m_UseDescriptorBuffer ? m_DescriptorBufferLayouts.data() : nullptr;
+    }
 
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
@@ -184,15 +196,25 @@ private:
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update template that writes all resources of the dynamic descriptor set
+    // from the descriptor data stored in the SRB resource cache.
+    VulkanUtilities::DescriptorUpdateTemplateWrapper m_VkDynamicSetUpdateTemplate;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // Descriptor buffer layouts indexed by the set index in the layout.
+    // Only initialized when descriptor buffers are used.
+    std::array<ShaderResourceCacheVk::DescriptorBufferSetLayout, MAX_DESCRIPTOR_SETS> m_DescriptorBufferLayouts;
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
     // The total number storage buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicStorageBufferCount = 0;
+
+    bool m_UseDescriptorBuffer = false;
 };
 
 template <> Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE>() const;
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -43,6 +44,8 @@
 #include "PipelineLayoutVk.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
+#include "PipelineLibraryCache.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -69,7 +72,13 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+    /// When the pipeline is linked from pipeline libraries, returns the optimized pipeline
+    /// once it is ready, and the fast-linked pipeline otherwise.
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        const VkPipeline vkOptimizedPipeline = m_vkOptimizedPipeline.load(std::memory_order_acquire);
+        return vkOptimizedPipeline != VK_NULL_HANDLE ? vkOptimizedPipeline : static_cast<VkPipeline>(m_Pipeline);
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
@@ -133,6 +142,11 @@ private:
     void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
     void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo);
 
+    void InitializeLibraryPipeline(PipelineLibraryCache&               LibraryCache,
+                                   const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                   const TShaderStages&                ShaderStages,
+                                   IPipelineStateCache*                pPSOCache) noexcept(false);
+
     // TPipelineStateBase::Construct needs access to InitializePipeline
     friend TPipelineStateBase;
 
@@ -141,6 +155,15 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Pipeline linked from the pipeline libraries with link-time optimization.
+    // It is created in the background and replaces the fast-linked m_Pipeline when ready.
+    VulkanUtilities::PipelineWrapper m_OptimizedPipeline;
+    std::atomic<VkPipeline>          m_vkOptimizedPipeline{VK_NULL_HANDLE};
+    RefCntAutoPtr<IAsyncTask>        m_OptimizedLinkTask;
+
+    // Pipeline libraries referenced by this pipeline. They are released when the pipeline is destroyed.
+    PipelineLibraryCache::LibraryArray m_PipelineLibraries{};
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
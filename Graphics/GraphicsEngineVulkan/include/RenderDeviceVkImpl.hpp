@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
+#include <deque>
 #include <unordered_map>
 #include <vector>
 
@@ -51,6 +53,7 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PipelineLibraryCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -207,6 +210,12 @@ public:
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
+    // Hide the base class methods: in addition to locking the software queue, they drain the submission
+    // thread and lock the Vulkan queue so that the application may access the VkQueue directly
+    // (see EngineVkCreateInfo::EnableSubmissionThread).
+    ICommandQueueVk* LockCommandQueue(SoftwareQueueIndex QueueInd);
+    void             UnlockCommandQueue(SoftwareQueueIndex QueueInd);
+
     // pImmediateCtx parameter is only used to make sure the command buffer is submitted from the immediate context
     // The method returns fence value associated with the submitted command buffer
     Uint64 ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueId, const VkSubmitInfo& SubmitInfo, std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences);
@@ -215,7 +224,17 @@ public:
                                   VulkanUtilities::CommandPoolWrapper&  CmdPool,
                                   VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
                                   const Char*                           DebugPoolName = nullptr);
-    void ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
+    // Returns the fence value associated with the submitted command buffer
+    Uint64 ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
+
+    // Completes the defragmentation moves whose copies have finished on the GPU and relocates up to
+    // MaxBytesToMove bytes of movable allocations out of sparsely used memory pages
+    // (see VulkanMemoryManager::GetDefragmentationMoves). The copies are executed on the given queue.
+    void DefragmentMemory(SoftwareQueueIndex CommandQueueId, VkDeviceSize MaxBytesToMove);
+
+    // Memory defragmentation is only performed when enabled by EngineVkCreateInfo::EnableMemoryDefragmentation
+    // and the device has a single immediate context.
+    bool IsMemoryDefragmentationEnabled() const { return m_MemoryDefragmentationEnabled; }
 
     /// Implementation of IRenderDevice::ReleaseStaleResources() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final;
@@ -228,6 +247,9 @@ public:
     /// Implementation of IRenderDeviceVk::GetDeviceFeaturesVk().
     virtual void DILIGENT_CALL_TYPE GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const override final;
 
+    /// Implementation of IRenderDeviceVk::GetDeviceMemoryStats().
+    virtual void DILIGENT_CALL_TYPE GetDeviceMemoryStats(DeviceMemoryStatsVk& Stats) override final;
+
     DescriptorSetAllocation AllocateDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "")
     {
         return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
@@ -239,8 +261,9 @@ public:
     const VulkanUtilities::VulkanPhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
     const VulkanUtilities::VulkanLogicalDevice&  GetLogicalDevice() const { return *m_LogicalVkDevice; }
 
-    FramebufferCache* GetFramebufferCache() { return m_FramebufferCache.get(); }
-    RenderPassCache*  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
+    FramebufferCache*     GetFramebufferCache() { return m_FramebufferCache.get(); }
+    RenderPassCache*      GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
+    PipelineLibraryCache* GetPipelineLibraryCache() { return m_PipelineLibraryCache.get(); }
 
     VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
@@ -295,6 +318,10 @@ private:
                              Uint64&                                                     SubmittedFenceValue,
                              std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pFences);
 
+    // Completes the defragmentation moves whose copies have been recorded into the command buffers
+    // associated with fence values not greater than CompletedFenceValue.
+    void CompleteDefragmentationMoves(Uint64 CompletedFenceValue);
+
 private:
     const Properties m_Properties;
 
@@ -302,8 +329,9 @@ private:
     std::unique_ptr<VulkanUtilities::VulkanPhysicalDevice> m_PhysicalDevice;
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice>  m_LogicalVkDevice;
 
-    std::unique_ptr<FramebufferCache> m_FramebufferCache;
-    std::unique_ptr<RenderPassCache>  m_ImplicitRenderPassCache;
+    std::unique_ptr<FramebufferCache>     m_FramebufferCache;
+    std::unique_ptr<RenderPassCache>      m_ImplicitRenderPassCache;
+    std::unique_ptr<PipelineLibraryCache> m_PipelineLibraryCache;
 
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
@@ -318,6 +346,19 @@ private:
 
     VulkanUtilities::VulkanMemoryManager m_MemoryMgr;
 
+    const bool m_MemoryDefragmentationEnabled;
+
+    struct PendingDefragmentationMove
+    {
+        // Fence value associated with the command buffer that copies the data
+        Uint64 FenceValue = 0;
+
+        VulkanUtilities::VulkanMemoryManager::DefragmentationMove Move;
+    };
+    // The moves are submitted to a single queue, so they are ordered by the fence value.
+    std::mutex                             m_DefragmentationMovesMtx;
+    std::deque<PendingDefragmentationMove> m_PendingDefragmentationMoves;
+
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
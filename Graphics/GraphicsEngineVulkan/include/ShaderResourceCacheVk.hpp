@@ -52,6 +52,23 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// When descriptor update templates are used, the cache additionally keeps the Vulkan descriptor
+// data (image info, buffer info, etc.) of the last descriptor set (the dynamic set of an SRB)
+// right after the resources:
+//
+//  |  DescriptorSet[0]  |  ...  |  DescriptorSet[Ns-1]  |  Res[0]  |  ...  |  Res[m-1]  |  Data[0]  |  ...  |  Data[m-1]  |
+//
+// The data is updated every time a resource is set and is passed directly to vkUpdateDescriptorSetWithTemplate.
+//
+// When descriptor buffers (VK_EXT_descriptor_buffer) are used, SRB caches do not allocate Vulkan descriptor
+// sets. Instead, the cache keeps the descriptor data of every set in the layout defined by the signature
+// at the end of the memory block:
+//
+//  |  DescriptorSet[0]  |  ...  |  DescriptorSet[Ns-1]  |  Res[0]  |  ...  |  Res[m-1]  |  SetData[0]  |  ...  |  SetData[Ns-1]  |
+//
+// The set data is copied to the dynamic heap when resources are committed, and descriptors of dynamic
+// buffers are written at this time using the current buffer addresses.
 
 #include <vector>
 #include <memory>
@@ -68,13 +85,14 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
     explicit ShaderResourceCacheVk(ResourceCacheContentType ContentType) noexcept :
         m_TotalResources{0},
-        m_ContentType{static_cast<Uint32>(ContentType)}
+        m_ContentType{static_cast<Uint32>(ContentType)},
+        m_HasDescriptorData{0}
     {
         VERIFY_EXPR(GetContentType() == ContentType);
     }
@@ -88,9 +106,38 @@ public:
 
     ~ShaderResourceCacheVk();
 
-    static size_t GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes);
+    // Layout of the descriptor set data in a descriptor buffer
+    struct DescriptorBufferSetLayout
+    {
+        struct Slot
+        {
+            Uint32    Offset           = 0;              // Offset of the descriptor from the start of the set data
+            Uint32    Size             = 0;              // Descriptor size
+            VkSampler ImmutableSampler = VK_NULL_HANDLE; // Immutable sampler of a combined image sampler
+        };
+
+        // Descriptor slots indexed by the resource cache offset
+        std::vector<Slot> Slots;
+
+        // Initial set data that contains descriptors of immutable samplers.
+        // The size is aligned by the descriptor buffer offset alignment.
+        std::vector<Uint8> InitData;
+
+        Uint32 GetSize() const { return static_cast<Uint32>(InitData.size()); }
+    };
 
-    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes);
+    // If HasDescriptorData is true, the cache also stores the descriptor data of the last set.
+    // If pDescrBufferLayouts is not null, the cache stores the descriptor buffer data of every set.
+    static size_t GetRequiredMemorySize(Uint32                           NumSets,
+                                        const Uint32*                    SetSizes,
+                                        bool                             HasDescriptorData   = false,
+                                        const DescriptorBufferSetLayout* pDescrBufferLayouts = nullptr);
+
+    void InitializeSets(IMemoryAllocator&                MemAllocator,
+                        Uint32                           NumSets,
+                        const Uint32*                    SetSizes,
+                        bool                             HasDescriptorData   = false,
+                        const DescriptorBufferSetLayout* pDescrBufferLayouts = nullptr);
     void InitializeResources(Uint32 Set, Uint32 Offset, Uint32 ArraySize, DescriptorType Type, bool HasImmutableSampler);
 
     // sizeof(Resource) == 32 (x64, msvc, Release)
@@ -140,6 +187,16 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
+    // Descriptor data in the layout expected by a descriptor update template entry
+    // sizeof(DescriptorData) == 24 (x64)
+    union DescriptorData
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               TexelBufferView;
+        VkAccelerationStructureKHR AccelStruct;
+    };
+
     // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
     class DescriptorSet
     {
@@ -164,6 +221,9 @@ public:
 
         Uint32 GetSize() const { return m_NumResources; }
 
+        // Returns true if any resource in the set, except for separate immutable samplers, is null
+        bool HasNullDescriptors() const { return m_NumNullDescriptors > 0; }
+
         VkDescriptorSet GetVkDescriptorSet() const
         {
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
@@ -172,6 +232,7 @@ public:
     private:
         // clang-format off
 /* 0 */ const Uint32            m_NumResources = 0;
+/* 4 */ Uint32                  m_NumNullDescriptors = 0;
 /* 8 */ Resource* const         m_pResources   = nullptr;
 /*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
 /*48 */ // End of structure
@@ -249,6 +310,24 @@ public:
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
 
+    bool UsesDescriptorBuffer() const { return m_pDescriptorBufferLayouts != nullptr; }
+
+    Uint32 GetDescriptorBufferSetSize(Uint32 SetIndex) const
+    {
+        VERIFY_EXPR(m_pDescriptorBufferLayouts != nullptr && SetIndex < m_NumSets);
+        return m_pDescriptorBufferLayouts[SetIndex].GetSize();
+    }
+
+    // Writes the descriptor buffer data of the set to pDst. Descriptors of dynamic buffers
+    // are written using the current dynamic offsets of the context.
+    void WriteDescriptorBufferSet(DeviceContextVkImpl* pCtx, Uint32 SetIndex, void* pDst) const;
+
+    // Returns the descriptor data of the last set, or null if the cache does not store it
+    const DescriptorData* GetDescriptorData() const
+    {
+        return m_HasDescriptorData ? reinterpret_cast<const DescriptorData*>(GetFirstResourcePtr() + m_TotalResources) : nullptr;
+    }
+
     ResourceCacheContentType GetContentType() const { return static_cast<ResourceCacheContentType>(m_ContentType); }
 
 #ifdef DILIGENT_DEBUG
@@ -280,18 +359,36 @@ private:
         return reinterpret_cast<DescriptorSet*>(m_pMemory.get())[Index];
     }
 
+    DescriptorData* GetDescriptorData()
+    {
+        VERIFY_EXPR(m_HasDescriptorData);
+        return reinterpret_cast<DescriptorData*>(GetFirstResourcePtr() + m_TotalResources);
+    }
+
+    const Uint8* GetDescriptorBufferSetData(Uint32 SetIndex) const;
+    Uint8*       GetDescriptorBufferSetData(Uint32 SetIndex)
+    {
+        return const_cast<Uint8*>(const_cast<const ShaderResourceCacheVk*>(this)->GetDescriptorBufferSetData(SetIndex));
+    }
+
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    // Descriptor buffer layouts of every set owned by the signature, or null if descriptor buffers are not used
+    const DescriptorBufferSetLayout* m_pDescriptorBufferLayouts = nullptr;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
     // regardless of the variable type. Note this variable is not equal to dynamic offsets count, which is constant.
     Uint16 m_NumDynamicBuffers = 0;
-    Uint32 m_TotalResources : 31;
+    Uint32 m_TotalResources : 30;
 
     // Indicates what types of resources are stored in the cache
     const Uint32 m_ContentType : 1;
 
+    // Indicates that the descriptor data of the last set is stored after the resources
+    Uint32 m_HasDescriptorData : 1;
+
 #ifdef DILIGENT_DEBUG
     // Debug array that stores flags indicating if resources in the cache have been initialized
     std::vector<std::vector<bool>> m_DbgInitializedResources;
@@ -90,6 +90,9 @@ public:
         return !IsCompiling() ? m_SPIRV : NullSPIRV;
     }
 
+    /// Implementation of IShaderVk::GetBytecodeWithReflection().
+    virtual void DILIGENT_CALL_TYPE GetBytecodeWithReflection(IDataBlob** ppBytecode) const override final;
+
     const std::shared_ptr<const SPIRVShaderResources>& GetShaderResources() const
     {
         DEV_CHECK_ERR(!IsCompiling(), "Shader resources are not available until the shader is compiled. Use GetStatus() to check the shader status.");
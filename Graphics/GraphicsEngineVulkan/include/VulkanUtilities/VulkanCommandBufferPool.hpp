@@ -27,10 +27,10 @@
 
 #pragma once
 
-#include <deque>
+#include <vector>
 #include <memory>
-#include <mutex>
 #include <atomic>
+#include <mutex>
 #include "VulkanHeaders.h"
 #include "VulkanLogicalDevice.hpp"
 #include "VulkanObjectWrappers.hpp"
@@ -38,6 +38,12 @@
 namespace VulkanUtilities
 {
 
+// The pool is owned by a single device context: command buffers are only requested by the thread
+// that records commands in this context, so the list of free command buffers is not synchronized.
+// Command buffers that the GPU has finished with are returned by release queues, potentially from
+// other threads, through a lock-free list of recycled batches that the owner thread picks up when
+// it runs out of free command buffers. Batches are reused, so that recycling command buffers does not
+// allocate memory in the steady state.
 class VulkanCommandBufferPool
 {
 public:
@@ -54,23 +60,55 @@ public:
 
     ~VulkanCommandBufferPool();
 
-    VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
-    // The GPU must have finished with the command buffer being returned to the pool
+    // Must only be called by the thread that owns the pool.
+    // If pIsReused is not null, it is set to true if a recycled command buffer was returned,
+    // and to false if a new command buffer was allocated.
+    VkCommandBuffer GetCommandBuffer(const char* DebugName = "", bool* pIsReused = nullptr);
+
+    // A batch of command buffers that are returned to the pool together
+    struct RecycledBatch
+    {
+        std::vector<VkCommandBuffer> CmdBuffers;
+        RecycledBatch*               pNext = nullptr;
+    };
+
+    // Returns an empty batch. May be called from any thread.
+    // The batch must be returned to the pool by RecycleCommandBuffers().
+    RecycledBatch* AllocateRecycledBatch();
+
+    // The GPU must have finished with the command buffer(s) being returned to the pool.
+    // These methods may be called from any thread.
     void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer);
+    void RecycleCommandBuffers(RecycledBatch* pBatch);
 
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_SupportedAccessMask; }
 
 private:
+    static void PushBatches(std::atomic<RecycledBatch*>& Head, RecycledBatch* pFirst, RecycledBatch* pLast);
+
+    // Moves all recycled command buffers to the free list. Returns the number of command buffers moved.
+    size_t CollectRecycledBuffers();
+
     // Shared point to logical device must be defined before the command pool
     std::shared_ptr<const VulkanLogicalDevice> m_LogicalDevice;
 
     CommandPoolWrapper m_CmdPool;
 
-    std::mutex                  m_Mutex;
-    std::deque<VkCommandBuffer> m_CmdBuffers;
-    const VkPipelineStageFlags  m_SupportedStagesMask;
-    const VkAccessFlags         m_SupportedAccessMask;
+    // Command buffers that can be reused. Only accessed by the owner thread.
+    std::vector<VkCommandBuffer> m_FreeCmdBuffers;
+
+    // Lock-free list of batches returned by the release queues
+    std::atomic<RecycledBatch*> m_RecycledBatches{nullptr};
+
+    // Empty batches that can be reused. The owner thread pushes the batches without a lock, while the threads
+    // that pop the batches are serialized by the mutex. A batch can thus not be popped and pushed back while
+    // another thread is popping it, which rules out the ABA problem.
+    std::mutex                  m_FreeBatchesMtx;
+    std::atomic<RecycledBatch*> m_FreeBatches{nullptr};
+
+    const VkPipelineStageFlags m_SupportedStagesMask;
+    const VkAccessFlags        m_SupportedAccessMask;
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<int32_t> m_BuffCounter{0};
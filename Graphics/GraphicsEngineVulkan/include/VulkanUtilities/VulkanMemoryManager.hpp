@@ -28,7 +28,10 @@
 #pragma once
 
 #include <mutex>
+#include <shared_mutex>
 #include <array>
+#include <vector>
+#include <memory>
 #include <unordered_map>
 #include <atomic>
 #include <string>
@@ -101,35 +104,66 @@ struct VulkanMemoryAllocation
     VkDeviceSize      Size            = 0;       // Reserved size of this allocation
 };
 
+// Allocations are segregated into separate pages by their size to reduce fragmentation:
+// small allocations do not split the free space in pages that host medium-sized allocations,
+// and large allocations are given dedicated pages that are released as soon as they are freed.
+enum VULKAN_MEMORY_SIZE_CLASS : uint8_t
+{
+    // Allocations not larger than 1/64 of the page size, served from pages that are 1/4 of the page size.
+    VULKAN_MEMORY_SIZE_CLASS_SMALL = 0,
+
+    // Allocations not larger than 1/2 of the page size, served from regular pages.
+    VULKAN_MEMORY_SIZE_CLASS_MEDIUM,
+
+    // Larger allocations, each served from its own page of the exact size.
+    VULKAN_MEMORY_SIZE_CLASS_DEDICATED,
+
+    VULKAN_MEMORY_SIZE_CLASS_COUNT
+};
+
+// Interface of an object that owns a memory allocation which may be relocated by the memory manager
+// to defragment memory (see VulkanMemoryManager::SetAllocationMover).
+class IMemoryAllocationMover
+{
+public:
+    // Records the commands that copy the contents of the current allocation to NewAllocation.
+    // Returns false if the allocation can't be moved at this time (e.g. when its contents may
+    // still be modified), in which case the move is canceled and the new allocation is released.
+    virtual bool RecordCopy(VkCommandBuffer vkCmdBuffer, const VulkanMemoryAllocation& NewAllocation) = 0;
+
+    // Called when the copy recorded by RecordCopy() has been completed by the GPU.
+    // The mover must replace its allocation with NewAllocation and may register the new allocation
+    // as movable again.
+    virtual void CompleteMove(VulkanMemoryAllocation&& NewAllocation) = 0;
+
+protected:
+    ~IMemoryAllocationMover() {}
+};
+
 class VulkanMemoryPage
 {
 public:
-    VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                     VkDeviceSize          PageSize,
-                     uint32_t              MemoryTypeIndex,
-                     bool                  IsHostVisible,
-                     VkMemoryAllocateFlags AllocateFlags);
+    VulkanMemoryPage(VulkanMemoryManager&     ParentMemoryMgr,
+                     VkDeviceSize             PageSize,
+                     uint32_t                 MemoryTypeIndex,
+                     bool                     IsHostVisible,
+                     VkMemoryAllocateFlags    AllocateFlags,
+                     VULKAN_MEMORY_SIZE_CLASS SizeClass);
     ~VulkanMemoryPage();
 
+    // Pages are referenced by the allocations and must never be moved
     // clang-format off
-    VulkanMemoryPage(VulkanMemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
-    {
-        rhs.m_CPUMemory = nullptr;
-    }
-
     VulkanMemoryPage            (const VulkanMemoryPage&) = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&)       = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)  = delete;
+    VulkanMemoryPage            (VulkanMemoryPage&&)      = delete;
+    VulkanMemoryPage& operator= (const VulkanMemoryPage&) = delete;
+    VulkanMemoryPage& operator= (VulkanMemoryPage&&)      = delete;
 
     bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
     VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
     VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
 
+    VULKAN_MEMORY_SIZE_CLASS GetSizeClass() const { return m_SizeClass; }
     // clang-format on
 
     VulkanMemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
@@ -137,19 +171,71 @@ public:
     VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
     void*          GetCPUMemory() const { return m_CPUMemory; }
 
+    struct UsageInfo
+    {
+        VkDeviceSize UsedSize         = 0;
+        VkDeviceSize FreeSize         = 0;
+        VkDeviceSize MaxFreeBlockSize = 0;
+        size_t       NumFreeBlocks    = 0;
+    };
+    // Unlike GetUsedSize() etc., the method is safe to call while other threads allocate from the page.
+    UsageInfo GetUsageInfo();
+
 private:
     using AllocationsMgrOffsetType = Diligent::VariableSizeAllocationsManager::OffsetType;
 
     friend struct VulkanMemoryAllocation;
+    friend class VulkanMemoryManager;
 
     // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
     void Free(VulkanMemoryAllocation&& Allocation);
 
+    struct MovableAllocation
+    {
+        VkDeviceSize                          UnalignedOffset = 0;
+        VkDeviceSize                          Size            = 0;
+        VkDeviceSize                          Alignment       = 0;
+        std::weak_ptr<IMemoryAllocationMover> wpMover;
+    };
+    void SetAllocationMover(const VulkanMemoryAllocation& Allocation, VkDeviceSize Size, VkDeviceSize Alignment, std::weak_ptr<IMemoryAllocationMover> wpMover);
+    void GetMovableAllocations(std::vector<MovableAllocation>& Allocations);
+    bool RemoveAllocationMover(VkDeviceSize UnalignedOffset, const IMemoryAllocationMover* pMover);
+
     VulkanMemoryManager&                     m_ParentMemoryMgr;
+    const VULKAN_MEMORY_SIZE_CLASS           m_SizeClass;
     std::mutex                               m_Mutex;
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
     void*                                    m_CPUMemory = nullptr;
+
+    // Allocations that may be relocated by the defragmentation, keyed by the unaligned offset
+    std::unordered_map<VkDeviceSize, MovableAllocation> m_MovableAllocations;
+};
+
+struct VulkanMemoryManagerStats
+{
+    struct SizeClassStats
+    {
+        uint32_t     PageCount     = 0;
+        VkDeviceSize AllocatedSize = 0;
+        VkDeviceSize UsedSize      = 0;
+        VkDeviceSize FreeSize      = 0;
+
+        // The size of the largest free block in any page
+        VkDeviceSize MaxFreeBlockSize = 0;
+        size_t       NumFreeBlocks    = 0;
+
+        // The fraction of the free memory that is not part of the largest free block of its page,
+        // 0 when the free space in every page is contiguous.
+        float Fragmentation = 0;
+
+        uint64_t NumAllocations = 0;
+
+        // Allocation latency, in nanoseconds. Only measured in development builds.
+        uint64_t TotalAllocationTime = 0;
+        uint64_t MaxAllocationTime   = 0;
+    };
+    std::array<SizeClassStats, VULKAN_MEMORY_SIZE_CLASS_COUNT> SizeClasses;
 };
 
 class VulkanMemoryManager
@@ -168,6 +254,7 @@ public:
         m_LogicalDevice         {LogicalDevice         },
         m_PhysicalDevice        {PhysicalDevice        },
         m_Allocator             {Allocator             },
+        m_PagesGeneration       {GeneratePagesGeneration()},
         m_DeviceLocalPageSize   {DeviceLocalPageSize   },
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
@@ -183,7 +270,8 @@ public:
         m_LogicalDevice   {rhs.m_LogicalDevice     },
         m_PhysicalDevice  {rhs.m_PhysicalDevice    },
         m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
+        m_Pools           {std::move(rhs.m_Pools)  },
+        m_PagesGeneration {GeneratePagesGeneration()},
 
         m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
@@ -191,13 +279,23 @@ public:
         m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
 
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
-        m_PeakUsedSize      {rhs.m_PeakUsedSize     },
+        //m_PeakUsedSize      {rhs.m_PeakUsedSize},
         m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
         m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
             m_CurrUsedSize[i].store(rhs.m_CurrUsedSize[i].load());
+        for (size_t i = 0; i < m_PeakUsedSize.size(); ++i)
+            m_PeakUsedSize[i].store(rhs.m_PeakUsedSize[i].load());
+        for (size_t i = 0; i < m_AllocationStats.size(); ++i)
+        {
+            m_AllocationStats[i].NumAllocations.store(rhs.m_AllocationStats[i].NumAllocations.load());
+            m_AllocationStats[i].TotalTime.store(rhs.m_AllocationStats[i].TotalTime.load());
+            m_AllocationStats[i].MaxTime.store(rhs.m_AllocationStats[i].MaxTime.load());
+        }
+        m_NumMovableAllocations.store(rhs.m_NumMovableAllocations.load());
+        m_HasEmptyDedicatedPages.store(rhs.m_HasEmptyDedicatedPages.load());
     }
 
     ~VulkanMemoryManager();
@@ -212,6 +310,29 @@ public:
     VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
     void                   ShrinkMemory();
 
+    VulkanMemoryManagerStats GetStats();
+
+    // Registers the allocation as movable by the defragmentation. Size and Alignment are the
+    // requirements the allocation was made with. The registration is removed when the allocation
+    // is released or selected for a move.
+    void SetAllocationMover(const VulkanMemoryAllocation& Allocation, VkDeviceSize Size, VkDeviceSize Alignment, std::weak_ptr<IMemoryAllocationMover> wpMover);
+
+    struct DefragmentationMove
+    {
+        std::shared_ptr<IMemoryAllocationMover> pMover;
+        VulkanMemoryAllocation                  NewAllocation;
+    };
+    // Selects movable allocations in the pages whose utilization does not exceed MaxPageUtilization
+    // and allocates new space for them in the more densely populated pages of the same pool, so that
+    // sparse pages are emptied and eventually released by ShrinkMemory().
+    // At most MaxBytesToMove bytes are selected, which allows spreading defragmentation over several frames.
+    // The caller must copy the data with IMemoryAllocationMover::RecordCopy() and call
+    // IMemoryAllocationMover::CompleteMove() once the copy has finished on the GPU.
+    std::vector<DefragmentationMove> GetDefragmentationMoves(VkDeviceSize MaxBytesToMove, float MaxPageUtilization);
+
+    VkDeviceSize GetDeviceLocalPageSize() const { return m_DeviceLocalPageSize; }
+    VkDeviceSize GetHostVisiblePageSize() const { return m_HostVisiblePageSize; }
+
 protected:
     friend class VulkanMemoryPage;
 
@@ -225,27 +346,33 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
+    // Allocation from the existing pages only requires a shared lock as every page is protected
+    // by its own mutex. Adding and removing pages requires an exclusive lock.
+    std::shared_timed_mutex m_PagesMtx;
     struct MemoryPageIndex
     {
-        const uint32_t              MemoryTypeIndex;
-        const VkMemoryAllocateFlags AllocateFlags;
-        const bool                  IsHostVisible;
+        const uint32_t                 MemoryTypeIndex;
+        const VkMemoryAllocateFlags    AllocateFlags;
+        const bool                     IsHostVisible;
+        const VULKAN_MEMORY_SIZE_CLASS SizeClass;
 
         // clang-format off
-        MemoryPageIndex(uint32_t              _MemoryTypeIndex,
-                        bool                  _IsHostVisible,
-                        VkMemoryAllocateFlags _AllocateFlags) :
+        MemoryPageIndex(uint32_t                 _MemoryTypeIndex,
+                        bool                     _IsHostVisible,
+                        VkMemoryAllocateFlags    _AllocateFlags,
+                        VULKAN_MEMORY_SIZE_CLASS _SizeClass) :
             MemoryTypeIndex{_MemoryTypeIndex},
             AllocateFlags  {_AllocateFlags},
-            IsHostVisible  {_IsHostVisible}
+            IsHostVisible  {_IsHostVisible},
+            SizeClass      {_SizeClass}
         {}
 
         bool operator == (const MemoryPageIndex& rhs)const
         {
             return MemoryTypeIndex == rhs.MemoryTypeIndex &&
                    AllocateFlags   == rhs.AllocateFlags   &&
-                   IsHostVisible   == rhs.IsHostVisible;
+                   IsHostVisible   == rhs.IsHostVisible   &&
+                   SizeClass       == rhs.SizeClass;
         }
         // clang-format on
 
@@ -253,24 +380,52 @@ protected:
         {
             size_t operator()(const MemoryPageIndex& PageIndex) const
             {
-                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible);
+                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible, PageIndex.SizeClass);
             }
         };
     };
-    std::unordered_multimap<MemoryPageIndex, VulkanMemoryPage, MemoryPageIndex::Hasher> m_Pages;
+    struct PagePool
+    {
+        // Pages are allocated individually so that their addresses do not change
+        // when the pool grows.
+        std::vector<std::unique_ptr<VulkanMemoryPage>> Pages;
+    };
+    // Pools are never removed, so the pointers to them remain valid for the lifetime of the manager.
+    std::unordered_map<MemoryPageIndex, PagePool, MemoryPageIndex::Hasher> m_Pools;
+
+    // Every thread remembers the last page it successfully allocated from in each pool.
+    // The generation is changed whenever pages are destroyed, which invalidates the cached pages.
+    static uint64_t       GeneratePagesGeneration();
+    std::atomic<uint64_t> m_PagesGeneration{0};
+
+    VulkanMemoryAllocation AllocateFromPool(PagePool& Pool, VkDeviceSize Size, VkDeviceSize Alignment);
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
 
-    void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
+    VULKAN_MEMORY_SIZE_CLASS GetSizeClass(VkDeviceSize Size, bool IsHostVisible) const;
+
+    void OnNewAllocation(VkDeviceSize Size, bool IsHostVisible);
+    void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible, bool IsEmptyDedicatedPage);
 
     // 0 == Device local, 1 == Host-visible
-    std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
-    std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
+    std::array<std::atomic<int64_t>, 2>      m_CurrUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakUsedSize      = {};
+    std::array<VkDeviceSize, 2>              m_CurrAllocatedSize = {};
+    std::array<VkDeviceSize, 2>              m_PeakAllocatedSize = {};
+
+    struct AllocationStats
+    {
+        std::atomic<uint64_t> NumAllocations{0};
+        std::atomic<uint64_t> TotalTime{0};
+        std::atomic<uint64_t> MaxTime{0};
+    };
+    std::array<AllocationStats, VULKAN_MEMORY_SIZE_CLASS_COUNT> m_AllocationStats;
+
+    std::atomic<int32_t> m_NumMovableAllocations{0};
+    std::atomic<bool>    m_HasEmptyDedicatedPages{false};
 
     // If adding new member, do not forget to update move ctor
 };
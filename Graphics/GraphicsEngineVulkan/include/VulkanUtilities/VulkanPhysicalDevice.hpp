@@ -69,14 +69,17 @@ public:
         VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
         VkPhysicalDeviceDynamicRenderingFeaturesKHR       DynamicRendering       = {};
         VkPhysicalDeviceHostImageCopyFeaturesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT       DescriptorBuffer       = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
 
 
-        bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
-        bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
-        bool SubgroupOps          = false; // Requires Vulkan 1.1
-        bool HasPortabilitySubset = false;
-        bool RenderPass2          = false;
-        bool DrawIndirectCount    = false;
+        bool Spirv14                  = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
+        bool Spirv15                  = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
+        bool SubgroupOps              = false; // Requires Vulkan 1.1
+        bool HasPortabilitySubset     = false;
+        bool RenderPass2              = false;
+        bool DrawIndirectCount        = false;
+        bool DescriptorUpdateTemplate = false; // Core in Vulkan 1.1
     };
 
     struct ExtensionProperties
@@ -96,6 +99,8 @@ public:
         VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
         VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
         VkPhysicalDeviceHostImageCopyPropertiesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT       DescriptorBuffer       = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT GraphicsPipelineLibrary = {};
 
         std::unique_ptr<VkImageLayout[]> HostImageCopyLayouts;
     };
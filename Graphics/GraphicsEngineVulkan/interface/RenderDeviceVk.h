@@ -38,6 +38,67 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+// clang-format off
+
+/// Device memory statistics of a single allocation size class, see Diligent::DeviceMemoryStatsVk.
+struct DeviceMemorySizeClassStatsVk
+{
+    /// The number of memory pages.
+    Uint32 PageCount            DEFAULT_INITIALIZER(0);
+
+    /// The total size of the memory pages, in bytes.
+    Uint64 AllocatedSize        DEFAULT_INITIALIZER(0);
+
+    /// The size of the memory used by the allocations, in bytes.
+    Uint64 UsedSize             DEFAULT_INITIALIZER(0);
+
+    /// The size of the free memory in all pages, in bytes.
+    Uint64 FreeSize             DEFAULT_INITIALIZER(0);
+
+    /// The size of the largest free block in any page, in bytes.
+    Uint64 MaxFreeBlockSize     DEFAULT_INITIALIZER(0);
+
+    /// The fraction of the free memory that is not part of the largest free block
+    /// of its page, 0 when the free space in every page is contiguous.
+    float  Fragmentation        DEFAULT_INITIALIZER(0);
+
+    /// The total number of allocations made from this size class.
+    Uint64 NumAllocations       DEFAULT_INITIALIZER(0);
+
+    /// The total and maximum allocation latency, in nanoseconds.
+    /// The latency is only measured in development builds and is zero otherwise.
+    Uint64 TotalAllocationTime  DEFAULT_INITIALIZER(0);
+    Uint64 MaxAllocationTime    DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceMemorySizeClassStatsVk DeviceMemorySizeClassStatsVk;
+
+/// Statistics of the device memory allocated for the resources, see IRenderDeviceVk::GetDeviceMemoryStats().
+
+/// Allocations are segregated into separate pages by their size: small allocations (not larger than 1/64
+/// of the page size) are served from pages that are 1/4 of the page size, medium allocations (not larger
+/// than 1/2 of the page size) are served from regular pages, and larger allocations are given dedicated
+/// pages of the exact size.
+struct DeviceMemoryStatsVk
+{
+    /// Device-local memory page size, see EngineVkCreateInfo::DeviceLocalMemoryPageSize.
+    Uint64 DeviceLocalPageSize DEFAULT_INITIALIZER(0);
+
+    /// Host-visible memory page size, see EngineVkCreateInfo::HostVisibleMemoryPageSize.
+    Uint64 HostVisiblePageSize DEFAULT_INITIALIZER(0);
+
+    /// Statistics of the small allocations.
+    DeviceMemorySizeClassStatsVk Small;
+
+    /// Statistics of the medium allocations.
+    DeviceMemorySizeClassStatsVk Medium;
+
+    /// Statistics of the allocations that have dedicated pages.
+    DeviceMemorySizeClassStatsVk Dedicated;
+};
+typedef struct DeviceMemoryStatsVk DeviceMemoryStatsVk;
+
+// clang-format on
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -161,6 +222,12 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
     /// Returns Vulkan-specific device features, see Diligent::DeviceFeaturesVk.
     VIRTUAL void METHOD(GetDeviceFeaturesVk)(THIS_
                                              DeviceFeaturesVk REF FeaturesVk) CONST PURE;
+
+    /// Returns the statistics of the device memory allocated for the resources, see Diligent::DeviceMemoryStatsVk.
+
+    /// \note  The statistics include both device-local and host-visible memory.
+    VIRTUAL void METHOD(GetDeviceMemoryStats)(THIS_
+                                              DeviceMemoryStatsVk REF Stats) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -179,6 +246,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)            CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,            This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetDeviceMemoryStats(This, ...)           CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceMemoryStats,           This, __VA_ARGS__)
 
 // clang-format on
 
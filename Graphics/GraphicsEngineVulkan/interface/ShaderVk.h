@@ -55,6 +55,22 @@ class IShaderVk : public IShader
 public:
     /// Returns SPIRV bytecode
     virtual const std::vector<uint32_t>& DILIGENT_CALL_TYPE GetSPIRV() const = 0;
+
+    /// Returns SPIRV bytecode followed by the serialized shader resources.
+
+    /// \param [out] ppBytecode - Address of the memory location where a pointer to the
+    ///                           data blob containing the byte code will be written.
+    ///                           The function calls AddRef(), so that the new object will have
+    ///                           one reference.
+    ///
+    /// \remarks   When a shader is created from this byte code, the resources are loaded from
+    ///            the serialized data instead of reflecting the SPIRV, which is considerably faster.
+    ///            The byte code can be stored in a byte code cache or a device object archive.
+    ///            Uniform buffer reflection is not serialized: if it is requested by
+    ///            ShaderCreateInfo::LoadConstantBufferReflection, the SPIRV is reflected.
+    ///
+    ///            If the shader was created without reflection, the method returns the SPIRV only.
+    virtual void DILIGENT_CALL_TYPE GetBytecodeWithReflection(IDataBlob** ppBytecode) const = 0;
 };
 
 #endif
@@ -40,6 +40,123 @@
 namespace Diligent
 {
 
+class BufferVkImpl::MemoryMover final : public VulkanUtilities::IMemoryAllocationMover, public std::enable_shared_from_this<BufferVkImpl::MemoryMover>
+{
+public:
+    MemoryMover(BufferVkImpl& Buffer, const VkBufferCreateInfo& BuffCI, VkDeviceSize MemorySize, VkDeviceSize Alignment) :
+        // clang-format off
+        m_pDevice             {Buffer.GetDevice()                      },
+        m_BuffCI              {BuffCI                                  },
+        m_MemorySize          {MemorySize                              },
+        m_Alignment           {Alignment                               },
+        m_ImmediateContextMask{Buffer.GetDesc().ImmediateContextMask   },
+        m_pBuffer             {&Buffer                                 }
+    // clang-format on
+    {
+        VERIFY(m_BuffCI.sharingMode == VK_SHARING_MODE_EXCLUSIVE, "Buffers shared between queue families are not movable");
+        m_BuffCI.pNext                 = nullptr;
+        m_BuffCI.queueFamilyIndexCount = 0;
+        m_BuffCI.pQueueFamilyIndices   = nullptr;
+    }
+
+    // Registers the current buffer memory as movable. The mover must be owned by a shared pointer.
+    void Register(const VulkanUtilities::VulkanMemoryAllocation& Allocation)
+    {
+        m_pDevice->GetGlobalMemoryManager().SetAllocationMover(Allocation, m_MemorySize, m_Alignment, std::weak_ptr<IMemoryAllocationMover>{shared_from_this()});
+    }
+
+    // Called by the buffer destructor. A move that is in progress is canceled when it completes.
+    void Detach()
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_pBuffer = nullptr;
+    }
+
+    virtual bool RecordCopy(VkCommandBuffer vkCmdBuffer, const VulkanUtilities::VulkanMemoryAllocation& NewAllocation) override final
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (m_pBuffer == nullptr)
+            return false;
+
+        VERIFY(!m_NewBuffer, "Another move of this buffer is in progress");
+        const VulkanUtilities::VulkanLogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
+
+        VulkanUtilities::BufferWrapper NewBuffer;
+        try
+        {
+            NewBuffer = LogicalDevice.CreateBuffer(m_BuffCI, m_pBuffer->GetDesc().Name);
+        }
+        catch (const std::runtime_error&)
+        {
+            return false;
+        }
+
+        // The new buffer has the same create info, so its memory requirements are the same as well
+        const VkDeviceSize AlignedOffset = AlignUp(NewAllocation.UnalignedOffset, m_Alignment);
+        VERIFY(NewAllocation.Size >= m_MemorySize + (AlignedOffset - NewAllocation.UnalignedOffset), "Size of memory allocation is too small");
+        if (LogicalDevice.BindBufferMemory(NewBuffer, NewAllocation.Page->GetVkMemory(), AlignedOffset) != VK_SUCCESS)
+            return false;
+
+        // Make the writes of all previously submitted commands, including the initial data upload, available to the copy
+        VkMemoryBarrier Barrier{};
+        Barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        Barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        Barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(vkCmdBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &Barrier, 0, nullptr, 0, nullptr);
+
+        VkBufferCopy BuffCopy{};
+        BuffCopy.srcOffset = 0;
+        BuffCopy.dstOffset = 0;
+        BuffCopy.size      = m_BuffCI.size;
+        vkCmdCopyBuffer(vkCmdBuffer, m_pBuffer->m_VulkanBuffer, NewBuffer, 1, &BuffCopy);
+
+        // Make the copied data visible to all commands submitted after the move
+        Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        Barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+        vkCmdPipelineBarrier(vkCmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &Barrier, 0, nullptr, 0, nullptr);
+
+        m_NewBuffer        = std::move(NewBuffer);
+        m_NewAlignedOffset = AlignedOffset;
+        return true;
+    }
+
+    virtual void CompleteMove(VulkanUtilities::VulkanMemoryAllocation&& NewAllocation) override final
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (m_pBuffer == nullptr)
+        {
+            // The buffer has been destroyed while the data was being copied
+            m_pDevice->SafeReleaseDeviceObject(std::move(m_NewBuffer), m_ImmediateContextMask);
+            m_pDevice->SafeReleaseDeviceObject(std::move(NewAllocation), m_ImmediateContextMask);
+            return;
+        }
+
+        // The old buffer may still be used by the commands submitted before the move has completed
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_pBuffer->m_VulkanBuffer), m_ImmediateContextMask);
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_pBuffer->m_MemoryAllocation), m_ImmediateContextMask);
+
+        m_pBuffer->m_VulkanBuffer              = std::move(m_NewBuffer);
+        m_pBuffer->m_MemoryAllocation          = std::move(NewAllocation);
+        m_pBuffer->m_BufferMemoryAlignedOffset = m_NewAlignedOffset;
+
+        Register(m_pBuffer->m_MemoryAllocation);
+    }
+
+private:
+    RenderDeviceVkImpl* const m_pDevice;
+    VkBufferCreateInfo        m_BuffCI;
+    const VkDeviceSize        m_MemorySize;
+    const VkDeviceSize        m_Alignment;
+    const Uint64              m_ImmediateContextMask;
+
+    std::mutex    m_Mtx;
+    BufferVkImpl* m_pBuffer = nullptr;
+
+    // The buffer that is bound to the new allocation while the data is being copied
+    VulkanUtilities::BufferWrapper m_NewBuffer;
+    VkDeviceSize                   m_NewAlignedOffset = 0;
+};
+
 BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceVkImpl*        pRenderDeviceVk,
@@ -180,6 +297,19 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    // When descriptor buffers are enabled, buffer descriptors are written using buffer device addresses.
+    // Note that this does not require a backing buffer for dynamic buffers as they use the dynamic heap address.
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+    {
+        constexpr VkBufferUsageFlags DescriptorUsage =
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+            VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+        if ((VkBuffCI.usage & DescriptorUsage) != 0)
+            VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -188,6 +318,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             (m_Desc.MiscFlags & MISC_BUFFER_FLAG_SPARSE_ALIASING ? VK_BUFFER_CREATE_SPARSE_ALIASED_BIT : 0);
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
+        // Unlike other buffers, sparse buffers may be queried for the device address before memory is bound
 
         SetState(RESOURCE_STATE_UNDEFINED);
     }
@@ -440,6 +571,26 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         }
 
         SetState(InitialState);
+
+        const bool IsMovable =
+            pRenderDeviceVk->IsMemoryDefragmentationEnabled() &&
+            m_Desc.Usage == USAGE_IMMUTABLE &&
+            (m_Desc.BindFlags & ~(BIND_VERTEX_BUFFER | BIND_INDEX_BUFFER | BIND_INDIRECT_DRAW_ARGS)) == 0 &&
+            (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) == 0 &&
+            VkBuffCI.sharingMode == VK_SHARING_MODE_EXCLUSIVE;
+        if (IsMovable)
+        {
+            // The buffer is registered after the initial data upload has been submitted,
+            // so that the defragmentation copy is executed after the upload.
+            m_pMemoryMover = std::make_shared<MemoryMover>(*this, VkBuffCI, MemReqs.size, RequiredAlignment);
+            m_pMemoryMover->Register(m_MemoryAllocation);
+        }
+    }
+
+    if (m_VulkanBuffer != VK_NULL_HANDLE && (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0)
+    {
+        // Memory of non-sparse buffers has been bound at this point
+        m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
     }
 
     VERIFY_EXPR(IsInKnownState());
@@ -466,6 +617,10 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
 BufferVkImpl::~BufferVkImpl()
 {
+    // Prevent the memory from being moved while the buffer is being destroyed
+    if (m_pMemoryMover)
+        m_pMemoryMover->Detach();
+
     // Vk object can only be destroyed when it is no longer used by the GPU
     if (m_VulkanBuffer != VK_NULL_HANDLE)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_VulkanBuffer), m_Desc.ImmediateContextMask);
@@ -555,9 +710,23 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
+    if (m_VkDeviceAddress != 0)
+        return m_VkDeviceAddress;
+
+    if (m_VulkanBuffer == VK_NULL_HANDLE)
+    {
+        // Dynamic buffers without a backing buffer are suballocated from the dynamic heap
+        VERIFY(m_Desc.Usage == USAGE_DYNAMIC, "Dynamic buffer expected");
+        const VkDeviceAddress HeapAddress = m_pDevice->GetDynamicMemoryManager().GetVkDeviceAddress();
+        DEV_CHECK_ERR(HeapAddress != 0, "Dynamic heap buffer device address is only available when descriptor buffers are enabled");
+        return HeapAddress;
+    }
+
     constexpr BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
 
-    if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
+    // Buffers created from existing Vulkan handles are queried on demand
+    if ((m_Desc.BindFlags & DeviceAddressFlags) != 0 ||
+        m_pDevice->GetLogicalDevice().GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
     {
 #if DILIGENT_USE_VOLK
         VkBufferDeviceAddressInfoKHR BufferInfo = {};
@@ -31,6 +31,7 @@
 #include "CommandQueueVkImpl.hpp"
 #include "RenderDeviceVkImpl.hpp"
 #include "VulkanUtilities/VulkanDebug.hpp"
+#include "VulkanErrors.hpp"
 
 namespace Diligent
 {
@@ -40,7 +41,8 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
                                        SoftwareQueueIndex                                    CommandQueueId,
                                        Uint32                                                NumCommandQueues,
                                        Uint32                                                vkQueueIndex,
-                                       const ImmediateContextCreateInfo&                     CreateInfo) :
+                                       const ImmediateContextCreateInfo&                     CreateInfo,
+                                       bool                                                  EnableSubmissionThread) :
     // clang-format off
     TBase{pRefCounters},
     m_LogicalDevice             {LogicalDevice},
@@ -61,10 +63,41 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
         VulkanUtilities::SetQueueName(m_LogicalDevice->GetVkDevice(), m_VkQueue, CreateInfo.Name);
 
     m_TempSignalSemaphores.reserve(16);
+
+    if (m_SupportedTimelineSemaphore)
+    {
+        const std::string Name = std::string{"Command queue "} + std::to_string(Uint32{m_CommandQueueId}) + " timeline semaphore";
+        // The semaphore is signaled with the fence value of every submission, so its
+        // counter is the last completed fence value.
+        m_TimelineSemaphore = m_LogicalDevice->CreateTimelineSemaphore(0, Name.c_str());
+    }
+
+    if (EnableSubmissionThread)
+    {
+        if (m_TimelineSemaphore)
+        {
+            m_SubmissionThread = std::thread{&CommandQueueVkImpl::SubmissionThreadProc, this};
+        }
+        else
+        {
+            LOG_WARNING_MESSAGE("Submission thread requires timeline semaphores and will not be used by command queue ", Uint32{m_CommandQueueId});
+        }
+    }
 }
 
 CommandQueueVkImpl::~CommandQueueVkImpl()
 {
+    if (m_SubmissionThread.joinable())
+    {
+        // The thread submits all pending batches before it exits
+        {
+            std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+            m_StopSubmissionThread = true;
+        }
+        m_SubmissionEnqueuedCV.notify_one();
+        m_SubmissionThread.join();
+    }
+
     // Fence have resources that will be added to release queue.
     // But release queue will be destroyed after command queue and it will not release new resources.
     if (m_pFence)
@@ -82,11 +115,19 @@ SyncPointVk::SyncPointVk(SoftwareQueueIndex                        CommandQueueI
                          Uint32                                    NumContexts,
                          VulkanUtilities::VulkanSyncObjectManager& SyncObjectMngr,
                          VkDevice                                  LogicalDevice,
-                         Uint64                                    dbgValue) :
-    m_CommandQueueId{CommandQueueId},
-    m_NumSemaphores{static_cast<Uint8>(NumContexts)},
-    m_Fence{SyncObjectMngr.CreateFence()}
+                         VkSemaphore                               TimelineSemaphore,
+                         Uint64                                    Value) :
+    // clang-format off
+    m_CommandQueueId   {CommandQueueId},
+    m_NumSemaphores    {static_cast<Uint8>(NumContexts)},
+    m_Value            {Value},
+    m_TimelineSemaphore{TimelineSemaphore}
+// clang-format on
 {
+    // Binary fences are only needed when the queue does not have a timeline semaphore
+    if (m_TimelineSemaphore == VK_NULL_HANDLE)
+        m_Fence = SyncObjectMngr.CreateFence();
+
     VERIFY(m_CommandQueueId == CommandQueueId, "Not enough bits to store command queue index");
     VERIFY(m_NumSemaphores == NumContexts, "Not enough bits to store command queue count");
 
@@ -104,14 +145,15 @@ SyncPointVk::SyncPointVk(SoftwareQueueIndex                        CommandQueueI
     }
 
 #ifdef DILIGENT_DEBUG
-    String Name = String{"Queue ("} + std::to_string(CommandQueueId) + ") Value (" + std::to_string(dbgValue) + ")";
-    VulkanUtilities::SetFenceName(LogicalDevice, m_Fence, Name.c_str());
+    String Name = String{"Queue ("} + std::to_string(CommandQueueId) + ") Value (" + std::to_string(Value) + ")";
+    if (m_Fence)
+        VulkanUtilities::SetFenceName(LogicalDevice, m_Fence, Name.c_str());
 
     for (Uint32 s = 0; s < m_NumSemaphores; ++s)
     {
         if (m_Semaphores[s])
         {
-            Name = String{"Queue ("} + std::to_string(CommandQueueId) + ") Value (" + std::to_string(dbgValue) + ") Ctx (" + std::to_string(s) + ")";
+            Name = String{"Queue ("} + std::to_string(CommandQueueId) + ") Value (" + std::to_string(Value) + ") Ctx (" + std::to_string(s) + ")";
             VulkanUtilities::SetSemaphoreName(LogicalDevice, m_Semaphores[s], Name.c_str());
         }
     }
@@ -125,6 +167,44 @@ SyncPointVk::~SyncPointVk()
         m_Semaphores[s].~RecycledSyncObject();
 }
 
+bool SyncPointVk::IsCompleted(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice) const
+{
+    if (m_TimelineSemaphore != VK_NULL_HANDLE)
+    {
+        uint64_t SemaphoreValue = 0;
+        VkResult err            = LogicalDevice.GetSemaphoreCounter(m_TimelineSemaphore, &SemaphoreValue);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get timeline semaphore counter");
+        return err == VK_SUCCESS && SemaphoreValue >= m_Value;
+    }
+    else
+    {
+        return LogicalDevice.GetFenceStatus(m_Fence) == VK_SUCCESS;
+    }
+}
+
+VkResult SyncPointVk::Wait(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, uint64_t Timeout) const
+{
+    if (m_TimelineSemaphore != VK_NULL_HANDLE)
+    {
+        VkSemaphoreWaitInfo WaitInfo{};
+        WaitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        WaitInfo.pNext          = nullptr;
+        WaitInfo.flags          = 0;
+        WaitInfo.semaphoreCount = 1;
+        WaitInfo.pSemaphores    = &m_TimelineSemaphore;
+        WaitInfo.pValues        = &m_Value;
+        return LogicalDevice.WaitSemaphores(WaitInfo, Timeout);
+    }
+    else
+    {
+        VkFence  Fence  = m_Fence;
+        VkResult status = LogicalDevice.GetFenceStatus(Fence);
+        if (status == VK_NOT_READY)
+            status = LogicalDevice.WaitForFences(1, &Fence, VK_TRUE, Timeout);
+        return status;
+    }
+}
+
 __forceinline void SyncPointVk::GetSemaphores(std::vector<VkSemaphore>& Semaphores)
 {
     for (Uint32 s = 0; s < m_NumSemaphores; ++s)
@@ -134,7 +214,7 @@ __forceinline void SyncPointVk::GetSemaphores(std::vector<VkSemaphore>& Semaphor
     }
 }
 
-__forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 dbgValue)
+__forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 Value)
 {
     auto* pAllocator = &m_SyncPointAllocator;
     void* ptr        = pAllocator->Allocate(SyncPointVk::SizeOf(m_NumCommandQueues), "SyncPointVk", __FILE__, __LINE__);
@@ -144,12 +224,25 @@ __forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 dbgValue
         pAllocator->Free(ptr);
     };
 
-    return {new (ptr) SyncPointVk{m_CommandQueueId, m_NumCommandQueues, *m_SyncObjectManager, m_LogicalDevice->GetVkDevice(), dbgValue}, std::move(Deleter)};
+    return {new (ptr) SyncPointVk{m_CommandQueueId, m_NumCommandQueues, *m_SyncObjectManager, m_LogicalDevice->GetVkDevice(), m_TimelineSemaphore, Value}, std::move(Deleter)};
 }
 
 Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
 {
-    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    if (m_SubmissionThread.joinable())
+    {
+        Uint64 FenceValue = 0;
+        if (EnqueueSubmission(InSubmitInfo, FenceValue))
+            return FenceValue;
+
+        // The submit info can't be copied or the queue is locked for direct access,
+        // so it is submitted directly after all pending submissions
+        VkResult err = WaitForPendingSubmissions();
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue: ", VulkanUtilities::VkResultToString(err));
+        (void)err;
+    }
+
+    std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
 
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
@@ -186,12 +279,25 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
         1 :
         0;
 
-    auto err = vkQueueSubmit(m_VkQueue, SubmitCount, &SubmitInfo, NewSyncPoint->GetFence());
+    VkResult err = VK_SUCCESS;
+    if (HasTimelineSemaphore())
+    {
+        if (SubmitCount != 0)
+            m_TempSubmitInfos.push_back(SubmitInfo);
+        err = SubmitWithTimelineSignal(FenceValue);
+    }
+    else
+    {
+        err = vkQueueSubmit(m_VkQueue, SubmitCount, &SubmitInfo, NewSyncPoint->m_Fence);
+    }
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
     (void)err;
 
-    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
-    m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+    if (!HasTimelineSemaphore())
+    {
+        VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+        m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+    }
 
     // Update the last sync point
     {
@@ -202,6 +308,237 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
     return FenceValue;
 }
 
+VkResult CommandQueueVkImpl::SubmitWithTimelineSignal(Uint64 FenceValue)
+{
+    VERIFY_EXPR(HasTimelineSemaphore());
+
+    // Signal operations defined by vkQueueSubmit include all commands that occur earlier in submission order,
+    // so the batch that only signals the timeline semaphore completes after all previously submitted batches.
+    VkTimelineSemaphoreSubmitInfo TimelineSemaphoreSubmitInfo{};
+    TimelineSemaphoreSubmitInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    TimelineSemaphoreSubmitInfo.pNext                     = nullptr;
+    TimelineSemaphoreSubmitInfo.waitSemaphoreValueCount   = 0;
+    TimelineSemaphoreSubmitInfo.pWaitSemaphoreValues      = nullptr;
+    TimelineSemaphoreSubmitInfo.signalSemaphoreValueCount = 1;
+    TimelineSemaphoreSubmitInfo.pSignalSemaphoreValues    = &FenceValue;
+
+    VkSubmitInfo SignalInfo{};
+    SignalInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    SignalInfo.pNext                = &TimelineSemaphoreSubmitInfo;
+    SignalInfo.signalSemaphoreCount = 1;
+    SignalInfo.pSignalSemaphores    = &m_TimelineSemaphore;
+    m_TempSubmitInfos.push_back(SignalInfo);
+
+    VkResult err = vkQueueSubmit(m_VkQueue, static_cast<uint32_t>(m_TempSubmitInfos.size()), m_TempSubmitInfos.data(), VK_NULL_HANDLE);
+
+    m_TempSubmitInfos.clear();
+    m_TempTimelineInfos.clear();
+
+    return err;
+}
+
+bool CommandQueueVkImpl::EnqueueSubmission(const VkSubmitInfo& SubmitInfo, Uint64& FenceValue)
+{
+    VERIFY_EXPR(HasTimelineSemaphore());
+
+    const VkTimelineSemaphoreSubmitInfo* pTimelineInfo = nullptr;
+    for (const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(SubmitInfo.pNext); pStruct != nullptr; pStruct = pStruct->pNext)
+    {
+        if (pStruct->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+            return false;
+        pTimelineInfo = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(pStruct);
+    }
+
+    PendingSubmission Submission;
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+        if (!m_FreeSubmissions.empty())
+        {
+            Submission = std::move(m_FreeSubmissions.back());
+            m_FreeSubmissions.pop_back();
+        }
+    }
+
+    // Copy the arrays outside of the lock so that the submission thread is not blocked
+    // clang-format off
+    Submission.WaitSemaphores  .assign(SubmitInfo.pWaitSemaphores,   SubmitInfo.pWaitSemaphores   + SubmitInfo.waitSemaphoreCount);
+    Submission.WaitDstStageMask.assign(SubmitInfo.pWaitDstStageMask, SubmitInfo.pWaitDstStageMask + SubmitInfo.waitSemaphoreCount);
+    Submission.CommandBuffers  .assign(SubmitInfo.pCommandBuffers,   SubmitInfo.pCommandBuffers   + SubmitInfo.commandBufferCount);
+    Submission.SignalSemaphores.assign(SubmitInfo.pSignalSemaphores, SubmitInfo.pSignalSemaphores + SubmitInfo.signalSemaphoreCount);
+    // clang-format on
+
+    Submission.HasTimelineValues = pTimelineInfo != nullptr;
+    if (pTimelineInfo != nullptr)
+    {
+        Submission.WaitSemaphoreValues.assign(pTimelineInfo->pWaitSemaphoreValues, pTimelineInfo->pWaitSemaphoreValues + pTimelineInfo->waitSemaphoreValueCount);
+        Submission.SignalSemaphoreValues.assign(pTimelineInfo->pSignalSemaphoreValues, pTimelineInfo->pSignalSemaphoreValues + pTimelineInfo->signalSemaphoreValueCount);
+    }
+    else
+    {
+        Submission.WaitSemaphoreValues.clear();
+        Submission.SignalSemaphoreValues.clear();
+    }
+
+    VkResult SubmissionError = VK_SUCCESS;
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+
+        if (m_DirectAccess)
+        {
+            // The application accesses the Vulkan queue directly, so the batch must not be
+            // submitted by the thread concurrently with it.
+            m_FreeSubmissions.emplace_back(std::move(Submission));
+            return false;
+        }
+
+        // The value is assigned under the same lock that orders the pending submissions,
+        // so the submission thread signals the timeline semaphore with increasing values.
+        FenceValue            = m_NextFenceValue.fetch_add(1);
+        Submission.FenceValue = FenceValue;
+        m_PendingSubmissions.emplace_back(std::move(Submission));
+
+        std::swap(SubmissionError, m_SubmissionError);
+    }
+    m_SubmissionEnqueuedCV.notify_one();
+
+    // Report the failure of a previous submission to the caller the same way as a direct submission does
+    DEV_CHECK_ERR(SubmissionError == VK_SUCCESS, "Failed to submit command buffer to the command queue: ", VulkanUtilities::VkResultToString(SubmissionError));
+    (void)SubmissionError;
+
+    // The sync point only references the timeline semaphore value, so it may be created before the batch is submitted.
+    // With timeline semaphores there is one sync point semaphore slot, which is never used.
+    VERIFY_EXPR(m_NumCommandQueues == 1);
+    SyncPointVkPtr NewSyncPoint = CreateSyncPoint(FenceValue);
+
+    // Update the last sync point
+    {
+        Threading::SpinLockGuard SyncPointGuard{m_LastSyncPointLock};
+        m_LastSyncPoint = std::move(NewSyncPoint);
+    }
+
+    return true;
+}
+
+void CommandQueueVkImpl::SubmissionThreadProc()
+{
+    std::vector<PendingSubmission> Submissions;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock{m_PendingSubmissionsMtx};
+
+            // Recycle the submissions processed in the previous iteration
+            for (PendingSubmission& Submission : Submissions)
+                m_FreeSubmissions.emplace_back(std::move(Submission));
+            Submissions.clear();
+
+            if (m_IsSubmitting)
+            {
+                m_IsSubmitting = false;
+                m_SubmissionsProcessedCV.notify_all();
+            }
+
+            m_SubmissionEnqueuedCV.wait(Lock, [this]() { return m_StopSubmissionThread || !m_PendingSubmissions.empty(); });
+            if (m_PendingSubmissions.empty())
+                break; // Stop was requested and all submissions have been processed
+
+            // Take all pending submissions to pass them to a single vkQueueSubmit call
+            std::swap(Submissions, m_PendingSubmissions);
+            m_IsSubmitting = true;
+        }
+
+        std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
+
+        // m_TempSubmitInfos references the elements of m_TempTimelineInfos, so the array must not be reallocated
+        m_TempTimelineInfos.reserve(Submissions.size());
+        for (const PendingSubmission& Submission : Submissions)
+        {
+            VkSubmitInfo SubmitInfo{};
+            SubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            SubmitInfo.waitSemaphoreCount   = static_cast<uint32_t>(Submission.WaitSemaphores.size());
+            SubmitInfo.pWaitSemaphores      = Submission.WaitSemaphores.data();
+            SubmitInfo.pWaitDstStageMask    = Submission.WaitDstStageMask.data();
+            SubmitInfo.commandBufferCount   = static_cast<uint32_t>(Submission.CommandBuffers.size());
+            SubmitInfo.pCommandBuffers      = Submission.CommandBuffers.data();
+            SubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(Submission.SignalSemaphores.size());
+            SubmitInfo.pSignalSemaphores    = Submission.SignalSemaphores.data();
+
+            // Empty submission only needs the fence value to be signaled
+            if (SubmitInfo.waitSemaphoreCount == 0 &&
+                SubmitInfo.commandBufferCount == 0 &&
+                SubmitInfo.signalSemaphoreCount == 0)
+                continue;
+
+            if (Submission.HasTimelineValues)
+            {
+                m_TempTimelineInfos.emplace_back();
+                VkTimelineSemaphoreSubmitInfo& TimelineInfo = m_TempTimelineInfos.back();
+
+                TimelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+                TimelineInfo.pNext                     = nullptr;
+                TimelineInfo.waitSemaphoreValueCount   = static_cast<uint32_t>(Submission.WaitSemaphoreValues.size());
+                TimelineInfo.pWaitSemaphoreValues      = Submission.WaitSemaphoreValues.data();
+                TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(Submission.SignalSemaphoreValues.size());
+                TimelineInfo.pSignalSemaphoreValues    = Submission.SignalSemaphoreValues.data();
+
+                SubmitInfo.pNext = &TimelineInfo;
+            }
+
+            m_TempSubmitInfos.push_back(SubmitInfo);
+        }
+
+        // Fence values of the pending submissions are increasing, so signaling the last one completes all of them
+        VkResult err = SubmitWithTimelineSignal(Submissions.back().FenceValue);
+        if (err != VK_SUCCESS)
+        {
+            CHECK_VK_ERROR(err, "Failed to submit command buffers to command queue ", Uint32{m_CommandQueueId}, " from the submission thread");
+
+            // The caller that enqueued the submissions has already returned, so the error is recorded
+            // and reported by the next call that drains the pending submissions or enqueues a new one.
+            std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+            if (m_SubmissionError == VK_SUCCESS)
+                m_SubmissionError = err;
+        }
+    }
+}
+
+VkResult CommandQueueVkImpl::WaitForPendingSubmissions()
+{
+    if (!m_SubmissionThread.joinable())
+        return VK_SUCCESS;
+
+    std::unique_lock<std::mutex> Lock{m_PendingSubmissionsMtx};
+    m_SubmissionsProcessedCV.wait(Lock, [this]() { return m_PendingSubmissions.empty() && !m_IsSubmitting; });
+
+    VkResult SubmissionError = VK_SUCCESS;
+    std::swap(SubmissionError, m_SubmissionError);
+    return SubmissionError;
+}
+
+void CommandQueueVkImpl::LockDirectAccess()
+{
+    if (m_SubmissionThread.joinable())
+    {
+        std::unique_lock<std::mutex> Lock{m_PendingSubmissionsMtx};
+        m_SubmissionsProcessedCV.wait(Lock, [this]() { return m_PendingSubmissions.empty() && !m_IsSubmitting; });
+        // The submissions made until the queue is unlocked are not passed to the thread
+        m_DirectAccess = true;
+    }
+
+    m_QueueMutex.lock();
+}
+
+void CommandQueueVkImpl::UnlockDirectAccess()
+{
+    m_QueueMutex.unlock();
+
+    if (m_SubmissionThread.joinable())
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+        m_DirectAccess = false;
+    }
+}
+
 Uint64 CommandQueueVkImpl::SubmitCmdBuffer(VkCommandBuffer cmdBuffer)
 {
     VkSubmitInfo SubmitInfo{};
@@ -223,21 +560,46 @@ Uint64 CommandQueueVkImpl::SubmitCmdBuffer(VkCommandBuffer cmdBuffer)
 
 Uint64 CommandQueueVkImpl::WaitForIdle()
 {
-    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    VkResult SubmissionError = WaitForPendingSubmissions();
+    DEV_CHECK_ERR(SubmissionError == VK_SUCCESS, "Failed to submit command buffer to the command queue: ", VulkanUtilities::VkResultToString(SubmissionError));
+    (void)SubmissionError;
+
+    std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
 
     // Update last completed fence value to unlock all waiting events.
     const auto FenceValue = m_NextFenceValue.fetch_add(1);
 
-    vkQueueWaitIdle(m_VkQueue);
-    // For some reason after idling the queue not all fences are signaled
-    m_pFence->Wait(UINT64_MAX);
-    m_pFence->Reset(FenceValue);
+    if (HasTimelineSemaphore())
+    {
+        // The semaphore reaches the value once all previously submitted commands are completed
+        VkResult err = SubmitWithTimelineSignal(FenceValue);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit timeline semaphore signal command to the command queue");
+        (void)err;
+
+        vkQueueWaitIdle(m_VkQueue);
+    }
+    else
+    {
+        vkQueueWaitIdle(m_VkQueue);
+        // For some reason after idling the queue not all fences are signaled
+        m_pFence->Wait(UINT64_MAX);
+        m_pFence->Reset(FenceValue);
+    }
 
     return FenceValue;
 }
 
 Uint64 CommandQueueVkImpl::GetCompletedFenceValue()
 {
+    if (HasTimelineSemaphore())
+    {
+        uint64_t SemaphoreValue = 0;
+        VkResult err            = m_LogicalDevice->GetSemaphoreCounter(m_TimelineSemaphore, &SemaphoreValue);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get timeline semaphore counter");
+        (void)err;
+        return SemaphoreValue;
+    }
+
     return m_pFence->GetCompletedValue();
 }
 
@@ -245,7 +607,12 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 {
     DEV_CHECK_ERR(vkFence != VK_NULL_HANDLE, "vkFence must not be null");
 
-    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    // The fence must be signaled after the commands that were passed to the submission thread
+    VkResult SubmissionError = WaitForPendingSubmissions();
+    DEV_CHECK_ERR(SubmissionError == VK_SUCCESS, "Failed to submit command buffer to the command queue: ", VulkanUtilities::VkResultToString(SubmissionError));
+    (void)SubmissionError;
+
+    std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
 
     auto err = vkQueueSubmit(m_VkQueue, 0, nullptr, vkFence);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit fence signal command to the command queue");
@@ -254,7 +621,11 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 
 void CommandQueueVkImpl::EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value)
 {
-    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    VkResult SubmissionError = WaitForPendingSubmissions();
+    DEV_CHECK_ERR(SubmissionError == VK_SUCCESS, "Failed to submit command buffer to the command queue: ", VulkanUtilities::VkResultToString(SubmissionError));
+    (void)SubmissionError;
+
+    std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
     InternalSignalSemaphore(vkTimelineSemaphore, Value);
 }
 
@@ -286,13 +657,25 @@ void CommandQueueVkImpl::InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore
 
 VkResult CommandQueueVkImpl::Present(const VkPresentInfoKHR& PresentInfo)
 {
-    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    // Binary semaphores that the presentation waits for must be signaled by the batches submitted before it
+    VkResult SubmissionError = WaitForPendingSubmissions();
+    if (SubmissionError != VK_SUCCESS)
+    {
+        // The semaphores may never be signaled, so the presentation must not wait for them
+        return SubmissionError;
+    }
+
+    std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
     return vkQueuePresentKHR(m_VkQueue, &PresentInfo);
 }
 
 Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
 {
-    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    VkResult SubmissionError = WaitForPendingSubmissions();
+    DEV_CHECK_ERR(SubmissionError == VK_SUCCESS, "Failed to submit command buffer to the command queue: ", VulkanUtilities::VkResultToString(SubmissionError));
+    (void)SubmissionError;
+
+    std::lock_guard<std::recursive_mutex> QueueGuard{m_QueueMutex};
 
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
@@ -309,6 +692,7 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
         if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
         {
             VERIFY(m_TempSignalSemaphores.empty(), "Can not append semaphores when timeline semaphores are used");
+            VERIFY(!HasTimelineSemaphore() || pStruct == InBindInfo.pNext, "VkTimelineSemaphoreSubmitInfo must be the first structure in the pNext chain");
             break;
         }
         pStruct = pStruct->pNext;
@@ -322,12 +706,50 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
     BindInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
     BindInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
 
-    auto err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, NewSyncPoint->GetFence());
+    VkResult err = VK_SUCCESS;
+    if (HasTimelineSemaphore())
+    {
+        // Unlike vkQueueSubmit, semaphore signal operations of vkQueueBindSparse only include the binding
+        // operations of the same batch, so the timeline semaphore is signaled by the batch itself.
+        const VkTimelineSemaphoreSubmitInfo* pInTimelineInfo = nullptr;
+        if (InBindInfo.pNext != nullptr && static_cast<const VkBaseInStructure*>(InBindInfo.pNext)->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+            pInTimelineInfo = static_cast<const VkTimelineSemaphoreSubmitInfo*>(InBindInfo.pNext);
+
+        m_TempSignalValues.clear();
+        for (uint32_t s = 0; s < InBindInfo.signalSemaphoreCount; ++s)
+        {
+            // Values are ignored for binary semaphores
+            m_TempSignalValues.push_back(pInTimelineInfo != nullptr && s < pInTimelineInfo->signalSemaphoreValueCount ? pInTimelineInfo->pSignalSemaphoreValues[s] : 0);
+        }
+        m_TempSignalSemaphores.push_back(m_TimelineSemaphore);
+        m_TempSignalValues.push_back(FenceValue);
+
+        VkTimelineSemaphoreSubmitInfo TimelineSemaphoreSubmitInfo{};
+        TimelineSemaphoreSubmitInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        TimelineSemaphoreSubmitInfo.pNext                     = pInTimelineInfo != nullptr ? pInTimelineInfo->pNext : InBindInfo.pNext;
+        TimelineSemaphoreSubmitInfo.waitSemaphoreValueCount   = pInTimelineInfo != nullptr ? pInTimelineInfo->waitSemaphoreValueCount : 0;
+        TimelineSemaphoreSubmitInfo.pWaitSemaphoreValues      = pInTimelineInfo != nullptr ? pInTimelineInfo->pWaitSemaphoreValues : nullptr;
+        TimelineSemaphoreSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(m_TempSignalValues.size());
+        TimelineSemaphoreSubmitInfo.pSignalSemaphoreValues    = m_TempSignalValues.data();
+
+        BindInfo.pNext                = &TimelineSemaphoreSubmitInfo;
+        BindInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
+        BindInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
+
+        err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, VK_NULL_HANDLE);
+    }
+    else
+    {
+        err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, NewSyncPoint->m_Fence);
+    }
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit sparse bind commands to the command queue");
     (void)err;
 
-    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
-    m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+    if (!HasTimelineSemaphore())
+    {
+        VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+        m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+    }
 
     // Update the last sync point
     {
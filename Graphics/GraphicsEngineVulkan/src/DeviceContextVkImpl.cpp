@@ -31,6 +31,8 @@
 
 #include <sstream>
 #include <vector>
+#include <algorithm>
+#include <functional>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "PipelineStateVkImpl.hpp"
@@ -122,6 +124,8 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     m_DynamicBufferOffsets.reserve(64);
     m_MappedBuffers.reserve(32);
 
+    m_UseDescriptorBuffer = pDeviceVkImpl->GetLogicalDevice().GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE;
+
     CreateASCompactedSizeQueryPool();
 }
 
@@ -212,20 +216,21 @@ void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
     m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
 }
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+void DeviceContextVkImpl::DisposeVkCmdBuffers(SoftwareQueueIndex CmdQueue, const VkCommandBuffer* pVkCmdBuffs, size_t NumCmdBuffs, Uint64 FenceValue)
 {
-    VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-    VERIFY_EXPR(m_CmdPool != nullptr);
+    VERIFY_EXPR(pVkCmdBuffs != nullptr && NumCmdBuffs > 0);
     class CmdBufferRecycler
     {
     public:
+        using RecycledBatch = VulkanUtilities::VulkanCommandBufferPool::RecycledBatch;
+
         // clang-format off
-        CmdBufferRecycler(VkCommandBuffer                           _vkCmdBuff,
-                         VulkanUtilities::VulkanCommandBufferPool& _Pool) noexcept :
-            vkCmdBuff {_vkCmdBuff},
-            Pool      {&_Pool    }
+        CmdBufferRecycler(RecycledBatch*                            _pBatch,
+                          VulkanUtilities::VulkanCommandBufferPool& _Pool) noexcept :
+            pBatch{_pBatch},
+            Pool  {&_Pool }
         {
-            VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
+            VERIFY_EXPR(pBatch != nullptr && !pBatch->CmdBuffers.empty());
         }
 
         CmdBufferRecycler             (const CmdBufferRecycler&)  = delete;
@@ -233,11 +238,11 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
         CmdBufferRecycler& operator = (      CmdBufferRecycler&&) = delete;
 
         CmdBufferRecycler(CmdBufferRecycler&& rhs) noexcept :
-            vkCmdBuff {rhs.vkCmdBuff},
-            Pool      {rhs.Pool     }
+            pBatch{rhs.pBatch},
+            Pool  {rhs.Pool  }
         {
-            rhs.vkCmdBuff = VK_NULL_HANDLE;
-            rhs.Pool      = nullptr;
+            rhs.pBatch = nullptr;
+            rhs.Pool   = nullptr;
         }
         // clang-format on
 
@@ -245,19 +250,37 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
         {
             if (Pool != nullptr)
             {
-                Pool->RecycleCommandBuffer(std::move(vkCmdBuff));
+                Pool->RecycleCommandBuffers(pBatch);
             }
         }
 
     private:
-        VkCommandBuffer                           vkCmdBuff = VK_NULL_HANDLE;
-        VulkanUtilities::VulkanCommandBufferPool* Pool      = nullptr;
+        RecycledBatch*                            pBatch = nullptr;
+        VulkanUtilities::VulkanCommandBufferPool* Pool   = nullptr;
     };
 
-    // Discard command buffer directly to the release queue since we know exactly which queue it was submitted to
+    // This method may be called for a deferred context by the immediate context that executes its command lists
+    // while the deferred context is already recording commands for another queue. Select the pool by the queue
+    // family the buffers were submitted to rather than use m_CmdPool.
+    const HardwareQueueIndex QueueFamilyIndex{m_pDevice->GetCommandQueue(CmdQueue).GetQueueFamilyIndex()};
+
+    VulkanUtilities::VulkanCommandBufferPool* pPool = m_QueueFamilyCmdPools[QueueFamilyIndex].get();
+    VERIFY_EXPR(pPool != nullptr);
+
+    // Batches are reused by the pool, so this does not allocate memory in the steady state
+    CmdBufferRecycler::RecycledBatch* pBatch = pPool->AllocateRecycledBatch();
+    pBatch->CmdBuffers.assign(pVkCmdBuffs, pVkCmdBuffs + NumCmdBuffs);
+
+    // Discard command buffers directly to the release queue since we know exactly which queue they were submitted to
     // as well as the associated FenceValue.
     auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool}, FenceValue);
+    ReleaseQueue.DiscardResource(CmdBufferRecycler{pBatch, *pPool}, FenceValue);
+}
+
+void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+{
+    VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
+    DisposeVkCmdBuffers(CmdQueue, &vkCmdBuff, 1, FenceValue);
 }
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
@@ -419,6 +442,12 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_UseDescriptorBuffer)
+    {
+        CommitDescriptorBuffers(BindInfo, CommitSRBMask);
+        return;
+    }
+
     const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
@@ -481,6 +510,65 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
 
+void DeviceContextVkImpl::CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    VERIFY_EXPR(m_UseDescriptorBuffer);
+
+    const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
+    const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
+    VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
+
+    // Descriptor set data of all signatures is suballocated from the dynamic heap, so there is
+    // only one descriptor buffer. The buffer is not resizable and its address never changes.
+    const VulkanDynamicMemoryManager& DynamicMemMgr = m_pDevice->GetDynamicMemoryManager();
+    m_CommandBuffer.BindDescriptorBuffer(DynamicMemMgr.GetVkDeviceAddress(),
+                                         VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                                             VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                                             VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+
+    const Uint32 OffsetAlignment = static_cast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+
+    static constexpr std::array<uint32_t, MAX_DESCR_SET_PER_SIGNATURE> BufferIndices = {};
+
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+    for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
+    {
+        if ((CommitSRBMask & (1u << sign)) == 0)
+            continue;
+
+        const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
+        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null");
+        VERIFY(pResourceCache->UsesDescriptorBuffer(), "Resource cache at binding index ", sign, " does not use descriptor buffers");
+
+        ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[sign];
+
+        const Uint32 NumSets = pResourceCache->GetNumDescriptorSets();
+        VERIFY_EXPR(NumSets > 0 && NumSets <= MAX_DESCR_SET_PER_SIGNATURE);
+
+        // Descriptors of dynamic buffers contain buffer addresses rather than dynamic offsets,
+        // so the data must be rewritten every time the buffers may have been remapped.
+        if (SetInfo.DescrBufferDataStale || pResourceCache->HasDynamicResources())
+        {
+            for (Uint32 s = 0; s < NumSets; ++s)
+            {
+                VulkanDynamicAllocation DynAlloc = AllocateDynamicSpace(pResourceCache->GetDescriptorBufferSetSize(s), OffsetAlignment);
+                pResourceCache->WriteDescriptorBufferSet(this, s, DynAlloc.pDynamicMemMgr->GetCPUAddress() + DynAlloc.AlignedOffset);
+                SetInfo.DescrBufferOffsets[s] = DynAlloc.AlignedOffset;
+            }
+            SetInfo.DescrBufferDataStale = false;
+        }
+
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, NumSets,
+                                                   BufferIndices.data(), SetInfo.DescrBufferOffsets.data());
+
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
 #ifdef DILIGENT_DEVELOPMENT
 void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo)
 {
@@ -499,13 +587,22 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
         DEV_CHECK_ERR((BindInfo.StaleSRBMask & BindInfo.ActiveSRBMask) == 0, "CommitDescriptorSets() must be called before validation.");
 
         const ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[i];
-        const Uint32                               DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        if (m_UseDescriptorBuffer)
         {
-            DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
-                          "descriptor set with index ", s, " is not bound for resource signature '",
+            DEV_CHECK_ERR(!SetInfo.DescrBufferDataStale,
+                          "descriptor buffer data is not written for resource signature '",
                           pSign->GetDesc().Name, "', binding index ", i, ".");
         }
+        else
+        {
+            const Uint32 DSCount = pSign->GetNumDescriptorSets();
+            for (Uint32 s = 0; s < DSCount; ++s)
+            {
+                DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
+                              "descriptor set with index ", s, " is not bound for resource signature '",
+                              pSign->GetDesc().Name, "', binding index ", i, ".");
+            }
+        }
 
         DEV_CHECK_ERR(SetInfo.LastBoundBaseInd == SetInfo.BaseInd,
                       "Shader resource binding at index ", i, " has descriptor set base offset ", SetInfo.BaseInd,
@@ -567,6 +664,15 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     // are set by SetPipelineState().
     SetInfo.vkSets = {};
 
+    if (m_UseDescriptorBuffer)
+    {
+        VERIFY(pSignature->UsesDescriptorBuffer(), "Signature '", pSignature->GetDesc().Name, "' does not use descriptor buffers");
+        // Descriptor set data is written to the dynamic heap by CommitDescriptorBuffers(), so
+        // there are no descriptor sets to allocate.
+        SetInfo.DescrBufferDataStale = true;
+        return;
+    }
+
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -1424,6 +1530,13 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    if (!IsDeferred() && m_pDevice->IsMemoryDefragmentationEnabled())
+    {
+        // Defragment device memory incrementally, moving at most a quarter of a page every frame.
+        auto& MemoryMgr = m_pDevice->GetGlobalMemoryManager();
+        m_pDevice->DefragmentMemory(GetCommandQueueId(), MemoryMgr.GetDeviceLocalPageSize() / 4);
+    }
+
     EndFrame();
 }
 
@@ -1601,15 +1714,37 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         ++buff_idx;
     }
 
-    for (Uint32 i = 0; i < NumCommandLists; ++i, ++buff_idx)
+    // Command buffers of every deferred context are recycled as one batch.
+    // The buffers have been submitted, so their order does not matter anymore: sort them by context
+    // to bring the buffers of the same context together.
+    m_DeferredCtxCmdBuffs.clear();
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+        m_DeferredCtxCmdBuffs.emplace_back(DeferredCtxs[i].RawPtr<DeviceContextVkImpl>(), vkCmdBuffs[buff_idx + i]);
+    std::sort(m_DeferredCtxCmdBuffs.begin(), m_DeferredCtxCmdBuffs.end(),
+              [](const std::pair<DeviceContextVkImpl*, VkCommandBuffer>& lhs, const std::pair<DeviceContextVkImpl*, VkCommandBuffer>& rhs) {
+                  return std::less<DeviceContextVkImpl*>{}(lhs.first, rhs.first);
+              });
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+        vkCmdBuffs[buff_idx + i] = m_DeferredCtxCmdBuffs[i].second;
+
+    for (size_t i = 0; i < m_DeferredCtxCmdBuffs.size();)
     {
-        DeviceContextVkImpl* pDeferredCtxVkImpl = DeferredCtxs[i].RawPtr<DeviceContextVkImpl>();
+        DeviceContextVkImpl* pDeferredCtxVkImpl = m_DeferredCtxCmdBuffs[i].first;
+
+        size_t NumCtxCmdBuffs = 1;
+        while (i + NumCtxCmdBuffs < m_DeferredCtxCmdBuffs.size() && m_DeferredCtxCmdBuffs[i + NumCtxCmdBuffs].first == pDeferredCtxVkImpl)
+            ++NumCtxCmdBuffs;
+
         // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
         pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
-        // It is OK to dispose command buffer from another thread. We are not going to
-        // record any commands and only need to add the buffer to the queue
-        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue);
+        // It is OK to dispose command buffers from another thread. We are not going to
+        // record any commands and only need to add the buffers to the queue
+        pDeferredCtxVkImpl->DisposeVkCmdBuffers(GetCommandQueueId(), &vkCmdBuffs[buff_idx], NumCtxCmdBuffs, SubmittedFenceValue);
+
+        i += NumCtxCmdBuffs;
+        buff_idx += NumCtxCmdBuffs;
     }
+    m_DeferredCtxCmdBuffs.clear();
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
 
     m_State    = {};
@@ -99,6 +99,15 @@ DeviceMemoryVkImpl::DeviceMemoryVkImpl(IReferenceCounters*           pRefCounter
     MemAlloc.allocationSize  = m_Desc.PageSize;
     MemAlloc.memoryTypeIndex = m_MemoryTypeIndex;
 
+    // Sparse buffers use device addresses when descriptor buffers are enabled
+    VkMemoryAllocateFlagsInfo AllocFlagsInfo{};
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+    {
+        AllocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        AllocFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext       = &AllocFlagsInfo;
+    }
+
     const auto PageCount = StaticCast<size_t>(MemCI.InitialSize / m_Desc.PageSize);
     m_Pages.reserve(PageCount);
 
@@ -126,6 +135,15 @@ Bool DeviceMemoryVkImpl::Resize(Uint64 NewSize)
     MemAlloc.allocationSize  = m_Desc.PageSize;
     MemAlloc.memoryTypeIndex = m_MemoryTypeIndex;
 
+    // Sparse buffers use device addresses when descriptor buffers are enabled
+    VkMemoryAllocateFlagsInfo AllocFlagsInfo{};
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+    {
+        AllocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        AllocFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext       = &AllocFlagsInfo;
+    }
+
     m_Pages.reserve(NewPageCount);
 
     while (m_Pages.size() < NewPageCount)
@@ -1218,6 +1218,15 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 }
             }
 
+            // Descriptor update templates are not exposed as a device feature and are
+            // used internally to commit dynamic descriptor sets when available.
+            if (DeviceExtFeatures.DescriptorUpdateTemplate)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+                EnabledExtFeats.DescriptorUpdateTemplate = true;
+            }
+
             if (EnabledFeatures.NativeMultiDraw != DEVICE_FEATURE_STATE_DISABLED)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME));
@@ -1264,6 +1273,68 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostImageCopy.pNext;
             }
 
+            if (EnabledFeaturesVk.DescriptorBuffer)
+            {
+                // Descriptor sets are stored in the dynamic heap, so the whole heap must be addressable
+                // by a single descriptor buffer binding.
+                const VkPhysicalDeviceDescriptorBufferPropertiesEXT& DescrBufferProps = PhysicalDevice->GetExtProperties().DescriptorBuffer;
+                const VkDeviceSize MaxDescrBufferRange = std::min(DescrBufferProps.maxResourceDescriptorBufferRange, DescrBufferProps.maxSamplerDescriptorBufferRange);
+                if (EngineCI.DynamicHeapSize > MaxDescrBufferRange)
+                {
+                    if (EngineCI.FeaturesVk.DescriptorBuffer == DEVICE_FEATURE_STATE_ENABLED)
+                    {
+                        LOG_ERROR_AND_THROW("Descriptor buffer feature is required, but the dynamic heap size (", EngineCI.DynamicHeapSize,
+                                            ") exceeds the maximum descriptor buffer range (", MaxDescrBufferRange, ").");
+                    }
+                    LOG_WARNING_MESSAGE("Dynamic heap size (", EngineCI.DynamicHeapSize, ") exceeds the maximum descriptor buffer range (",
+                                        MaxDescrBufferRange, "). Descriptor pools will be used instead of descriptor buffers.");
+                }
+                else
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                    EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                    // disable unused features
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay      = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferImageLayoutIgnored = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors    = VK_FALSE;
+
+                    *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                    NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+
+                    // Buffer device address may have already been enabled for ray tracing
+                    if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                    {
+                        VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME));
+                        DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+
+                        EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                        // disable unused features
+                        EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddressCaptureReplay = VK_FALSE;
+                        EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddressMultiDevice   = VK_FALSE;
+
+                        *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                        NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                    }
+                }
+            }
+
+            if (EnabledFeaturesVk.GraphicsPipelineLibrary)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
@@ -1341,7 +1412,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 VERIFY_EXPR(QueueIndex != DEFAULT_QUEUE_ID);
                 VkDeviceQueueCreateInfo& QueueCI = QueueInfos[QueueIndex];
 
-                CommandQueuesVk[CtxInd] = NEW_RC_OBJ(RawMemAllocator, "CommandQueueVk instance", CommandQueueVkImpl)(LogicalDevice, SoftwareQueueIndex{CtxInd}, EngineCI.NumImmediateContexts, QueueCI.queueCount, ContextInfo);
+                CommandQueuesVk[CtxInd] = NEW_RC_OBJ(RawMemAllocator, "CommandQueueVk instance", CommandQueueVkImpl)(LogicalDevice, SoftwareQueueIndex{CtxInd}, EngineCI.NumImmediateContexts, QueueCI.queueCount, ContextInfo, EngineCI.EnableSubmissionThread);
                 CommandQueues[CtxInd]   = CommandQueuesVk[CtxInd];
                 QueueCI.queueCount += 1;
             }
@@ -1353,7 +1424,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
             DefaultContextInfo.Name    = "Graphics context";
             DefaultContextInfo.QueueId = static_cast<Uint8>(QueueInfos[0].queueFamilyIndex);
 
-            CommandQueuesVk[0] = NEW_RC_OBJ(RawMemAllocator, "CommandQueueVk instance", CommandQueueVkImpl)(LogicalDevice, SoftwareQueueIndex{0}, 1u, 1u, DefaultContextInfo);
+            CommandQueuesVk[0] = NEW_RC_OBJ(RawMemAllocator, "CommandQueueVk instance", CommandQueueVkImpl)(LogicalDevice, SoftwareQueueIndex{0}, 1u, 1u, DefaultContextInfo, EngineCI.EnableSubmissionThread);
             CommandQueues[0]   = CommandQueuesVk[0];
         }
 
@@ -1366,6 +1437,10 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
 
             for (Uint32 CtxInd = 0; CtxInd < CommandQueuesVk.size(); ++CtxInd)
             {
+                // Queues that track completion with the timeline semaphore do not need the fence
+                if (CommandQueuesVk[CtxInd]->HasTimelineSemaphore())
+                    continue;
+
                 RefCntAutoPtr<FenceVkImpl> pFenceVk{NEW_RC_OBJ(RawMemAllocator, "FenceVkImpl instance", FenceVkImpl)(pRenderDeviceVk, Desc, IsDeviceInternal)};
                 CommandQueuesVk[CtxInd]->SetFence(std::move(pFenceVk));
             }
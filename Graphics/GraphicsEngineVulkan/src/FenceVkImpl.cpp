@@ -133,8 +133,7 @@ Uint64 FenceVkImpl::InternalGetCompletedValue()
     {
         SyncPointData& Item = m_SyncPoints.front();
 
-        VkResult status = LogicalDevice.GetFenceStatus(Item.SyncPoint->GetFence());
-        if (status == VK_SUCCESS)
+        if (Item.SyncPoint->IsCompleted(LogicalDevice))
         {
             UpdateLastCompletedFenceValue(Item.Value);
             m_SyncPoints.pop_front();
@@ -218,13 +217,7 @@ void FenceVkImpl::Wait(Uint64 Value)
             if (Item.Value > Value)
                 break;
 
-            VkFence  Fence  = Item.SyncPoint->GetFence();
-            VkResult status = LogicalDevice.GetFenceStatus(Fence);
-            if (status == VK_NOT_READY)
-            {
-                status = LogicalDevice.WaitForFences(1, &Fence, VK_TRUE, UINT64_MAX);
-            }
-
+            VkResult status = Item.SyncPoint->Wait(LogicalDevice, UINT64_MAX);
             DEV_CHECK_ERR(status == VK_SUCCESS, "All pending fences must now be complete!");
             UpdateLastCompletedFenceValue(Item.Value);
 
@@ -0,0 +1,536 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineLibraryCache.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "PipelineResourceSignatureVkImpl.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+// Serializes the state that affects a pipeline library into a binary key.
+// Only scalar values and structures that consist of 32-bit members (and thus have no padding)
+// are written directly, so that the key does not depend on uninitialized bytes.
+class PipelineLibraryCache::KeyBuilder
+{
+public:
+    explicit KeyBuilder(LIBRARY_PART Part)
+    {
+        m_Key.Part = Part;
+        m_Key.Data.reserve(512);
+    }
+
+    template <typename T>
+    void Add(const T& Val)
+    {
+        static_assert(std::is_scalar<T>::value, "Only scalar values can be added to the key");
+        AddBytes(&Val, sizeof(Val));
+    }
+
+    template <typename T>
+    void AddArray(const T* pVals, Uint32 Count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value && sizeof(T) % sizeof(Uint32) == 0, "Unexpected array element type");
+        Add(Count);
+        if (Count > 0)
+            AddBytes(pVals, sizeof(T) * Count);
+    }
+
+    void AddString(const char* Str)
+    {
+        const size_t Len = Str != nullptr ? strlen(Str) : 0;
+        Add(Len);
+        AddBytes(Str, Len);
+    }
+
+    // Objects are identified by their address. The address cannot be reused while the library
+    // is in the cache since the pipelines that use the library keep the objects alive.
+    void AddObject(IObject* pObject)
+    {
+        Add(pObject);
+    }
+
+    void AddDynamicState(const VkPipelineDynamicStateCreateInfo* pDynamicState)
+    {
+        VERIFY_EXPR(pDynamicState != nullptr);
+        AddArray(pDynamicState->pDynamicStates, pDynamicState->dynamicStateCount);
+    }
+
+    void AddShaderStage(const VkPipelineShaderStageCreateInfo& Stage, const std::vector<uint32_t>& SPIRV)
+    {
+        VERIFY(Stage.pSpecializationInfo == nullptr, "Specialization constants are not expected");
+        Add(Stage.stage);
+        AddString(Stage.pName);
+        // The byte code may be hundreds of kilobytes, so only its size and hash are added to the key data.
+        // The byte code itself is only compared when the keys are otherwise equal.
+        Add(SPIRV.size());
+        Add(ComputeHashRaw(SPIRV.data(), SPIRV.size() * sizeof(uint32_t)));
+        m_Key.SPIRVs.push_back(&SPIRV);
+    }
+
+    void AddMultisampleState(const VkPipelineMultisampleStateCreateInfo& MSState)
+    {
+        Add(MSState.rasterizationSamples);
+        Add(MSState.sampleShadingEnable);
+        Add(MSState.minSampleShading);
+        Add(MSState.pSampleMask != nullptr ? MSState.pSampleMask[0] : ~0u);
+        Add(MSState.alphaToCoverageEnable);
+        Add(MSState.alphaToOneEnable);
+    }
+
+    LibraryKey& GetKey() { return m_Key; }
+
+private:
+    void AddBytes(const void* pData, size_t Size)
+    {
+        const Uint8* pBytes = static_cast<const Uint8*>(pData);
+        m_Key.Data.insert(m_Key.Data.end(), pBytes, pBytes + Size);
+    }
+
+    LibraryKey m_Key;
+};
+
+size_t PipelineLibraryCache::LibraryKey::GetHash() const noexcept
+{
+    if (Hash == 0)
+    {
+        Hash = ComputeHash(static_cast<Uint32>(Part), ComputeHashRaw(Data.data(), Data.size()));
+    }
+    return Hash;
+}
+
+bool PipelineLibraryCache::LibraryKey::operator==(const LibraryKey& rhs) const noexcept
+{
+    if (GetHash() != rhs.GetHash() || Part != rhs.Part || Data != rhs.Data)
+        return false;
+
+    // The byte code hashes in the key data match, but the hashes may collide
+    VERIFY_EXPR(SPIRVs.size() == rhs.SPIRVs.size());
+    for (size_t i = 0; i < SPIRVs.size(); ++i)
+    {
+        if (*SPIRVs[i] != *rhs.SPIRVs[i])
+            return false;
+    }
+    return true;
+}
+
+void PipelineLibraryCache::LibraryKey::CopySPIRVs()
+{
+    VERIFY_EXPR(m_SPIRVCopies.empty());
+    m_SPIRVCopies.reserve(SPIRVs.size());
+    for (const std::vector<uint32_t>*& pSPIRV : SPIRVs)
+    {
+        m_SPIRVCopies.push_back(*pSPIRV);
+        // Moving the key does not relocate the elements of m_SPIRVCopies
+        pSPIRV = &m_SPIRVCopies.back();
+    }
+}
+
+PipelineLibraryCache::PipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept :
+    m_DeviceVkImpl{DeviceVk}
+{}
+
+PipelineLibraryCache::~PipelineLibraryCache()
+{
+    VERIFY(m_Cache.empty(), "Pipeline library cache is not empty. Did you call Destroy?");
+}
+
+void PipelineLibraryCache::Destroy()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    // All pipelines must have been released at this point
+    VERIFY(m_Cache.empty(), "Pipeline library cache is not empty. This may be the result of a pipeline state leak.");
+    m_LibraryKeys.clear();
+    m_Cache.clear();
+}
+
+VkPipeline PipelineLibraryCache::GetLibrary(KeyBuilder&&                        Builder,
+                                            const VkGraphicsPipelineCreateInfo& LibraryCI,
+                                            VkPipelineCache                     vkPSOCache,
+                                            const char*                         PipelineName) noexcept(false)
+{
+    LibraryKey& Key = Builder.GetKey();
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+
+        auto it = m_Cache.find(Key);
+        if (it != m_Cache.end())
+        {
+            ++it->second.RefCount;
+            return it->second.Library;
+        }
+    }
+
+    // Do not hold the lock while the library is being compiled to let other threads use the cache.
+    static constexpr char LibraryNames[][24] = {
+        "vertex input",
+        "pre-rasterization",
+        "fragment shader",
+        "fragment output",
+    };
+    static_assert(_countof(LibraryNames) == LIBRARY_PART_COUNT, "Please update the array above");
+
+    const std::string LibraryName = std::string{PipelineName != nullptr ? PipelineName : ""} + " - " + LibraryNames[Key.Part] + " library";
+
+    LibraryEntry NewEntry;
+    NewEntry.Library  = m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(LibraryCI, vkPSOCache, LibraryName.c_str());
+    NewEntry.RefCount = 1;
+
+    Key.CopySPIRVs();
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    auto it = m_Cache.find(Key);
+    if (it != m_Cache.end())
+    {
+        // Another thread has created the same library in the meantime. The new library
+        // has never been used and is destroyed when NewEntry goes out of scope.
+        ++it->second.RefCount;
+        return it->second.Library;
+    }
+
+    it = m_Cache.emplace(std::move(Key), std::move(NewEntry)).first;
+    m_LibraryKeys.emplace(it->second.Library, &it->first);
+    return it->second.Library;
+}
+
+void PipelineLibraryCache::ReleaseLibraries(const LibraryArray& Libraries)
+{
+    std::vector<VulkanUtilities::PipelineWrapper> UnusedLibraries;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        for (VkPipeline vkLibrary : Libraries)
+        {
+            if (vkLibrary == VK_NULL_HANDLE)
+                continue;
+
+            auto key_it = m_LibraryKeys.find(vkLibrary);
+            if (key_it == m_LibraryKeys.end())
+            {
+                UNEXPECTED("Pipeline library is not found in the cache");
+                continue;
+            }
+
+            auto it = m_Cache.find(*key_it->second);
+            VERIFY_EXPR(it != m_Cache.end() && it->second.RefCount > 0);
+            if (--it->second.RefCount == 0)
+            {
+                UnusedLibraries.emplace_back(std::move(it->second.Library));
+                m_LibraryKeys.erase(key_it);
+                m_Cache.erase(it);
+            }
+        }
+    }
+
+    // Pipelines linked from the libraries may still be used by the GPU
+    for (VulkanUtilities::PipelineWrapper& Library : UnusedLibraries)
+        m_DeviceVkImpl.SafeReleaseDeviceObject(std::move(Library), ~Uint64{0});
+}
+
+void PipelineLibraryCache::GetLibraries(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                        const LibraryAttribs&               Attribs,
+                                        VkPipelineCache                     vkPSOCache,
+                                        const char*                         PipelineName,
+                                        LibraryArray&                       Libraries) noexcept(false)
+{
+    VERIFY_EXPR(PipelineCI.sType == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO);
+    VERIFY_EXPR(Attribs.ppStageSPIRVs != nullptr);
+
+    // Libraries are created with the flags of the complete pipeline (e.g. the descriptor buffer flag
+    // must be consistent across all libraries and the linked pipeline).
+    const VkPipelineCreateFlags LibraryFlags =
+        PipelineCI.flags |
+        VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+        VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+    // When dynamic rendering is used, the attachment formats are provided by VkPipelineRenderingCreateInfo,
+    // which is the only structure in the pNext chain of the pipeline create info.
+    const VkPipelineRenderingCreateInfoKHR* pRenderingCI = nullptr;
+    if (PipelineCI.renderPass == VK_NULL_HANDLE)
+    {
+        pRenderingCI = static_cast<const VkPipelineRenderingCreateInfoKHR*>(PipelineCI.pNext);
+        VERIFY_EXPR(pRenderingCI != nullptr && pRenderingCI->sType == VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR);
+    }
+    else
+    {
+        VERIFY(Attribs.pRenderPass != nullptr, "Render pass object must be provided when the pipeline uses a render pass");
+    }
+
+    const auto AddRenderPass = [&](KeyBuilder& Builder) {
+        if (pRenderingCI != nullptr)
+        {
+            Builder.Add(pRenderingCI->viewMask);
+            Builder.AddArray(pRenderingCI->pColorAttachmentFormats, pRenderingCI->colorAttachmentCount);
+            Builder.Add(pRenderingCI->depthAttachmentFormat);
+            Builder.Add(pRenderingCI->stencilAttachmentFormat);
+        }
+        else
+        {
+            Builder.AddObject(Attribs.pRenderPass);
+            Builder.Add(PipelineCI.subpass);
+        }
+    };
+
+    // Pipeline layouts of the libraries are defined by the resource signatures
+    const auto AddLayout = [&](KeyBuilder& Builder) {
+        Builder.Add(Attribs.SignatureCount);
+        for (Uint32 s = 0; s < Attribs.SignatureCount; ++s)
+            Builder.AddObject(Attribs.ppSignatures[s].RawPtr());
+    };
+
+    const auto InitLibraryCI = [&](VkGraphicsPipelineLibraryCreateInfoEXT& LibTypeCI,
+                                   VkGraphicsPipelineCreateInfo&           LibraryCI,
+                                   VkGraphicsPipelineLibraryFlagsEXT       LibraryFlag) {
+        LibTypeCI       = {};
+        LibTypeCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        LibTypeCI.pNext = nullptr;
+        LibTypeCI.flags = LibraryFlag;
+
+        LibraryCI                    = {};
+        LibraryCI.sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        LibraryCI.pNext              = &LibTypeCI;
+        LibraryCI.flags              = LibraryFlags;
+        LibraryCI.pDynamicState      = PipelineCI.pDynamicState;
+        LibraryCI.basePipelineHandle = VK_NULL_HANDLE;
+        LibraryCI.basePipelineIndex  = -1;
+    };
+
+    const auto InitLibraryRenderPass = [&](VkGraphicsPipelineLibraryCreateInfoEXT& LibTypeCI,
+                                           VkGraphicsPipelineCreateInfo&           LibraryCI,
+                                           VkPipelineRenderingCreateInfoKHR&       RenderingCI) {
+        if (pRenderingCI != nullptr)
+        {
+            RenderingCI       = *pRenderingCI;
+            RenderingCI.pNext = nullptr;
+            LibTypeCI.pNext   = &RenderingCI;
+        }
+        else
+        {
+            LibraryCI.renderPass = PipelineCI.renderPass;
+            LibraryCI.subpass    = PipelineCI.subpass;
+        }
+    };
+
+    Libraries = {};
+
+    // Vertex input interface
+    {
+        VkGraphicsPipelineLibraryCreateInfoEXT LibTypeCI;
+        VkGraphicsPipelineCreateInfo           LibraryCI;
+        InitLibraryCI(LibTypeCI, LibraryCI, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+        LibraryCI.pVertexInputState   = PipelineCI.pVertexInputState;
+        LibraryCI.pInputAssemblyState = PipelineCI.pInputAssemblyState;
+
+        KeyBuilder Builder{LIBRARY_PART_VERTEX_INPUT};
+        Builder.Add(LibraryFlags);
+        Builder.AddDynamicState(PipelineCI.pDynamicState);
+
+        const VkPipelineVertexInputStateCreateInfo& VertexInput = *PipelineCI.pVertexInputState;
+        Builder.AddArray(VertexInput.pVertexBindingDescriptions, VertexInput.vertexBindingDescriptionCount);
+        Builder.AddArray(VertexInput.pVertexAttributeDescriptions, VertexInput.vertexAttributeDescriptionCount);
+        if (const VkPipelineVertexInputDivisorStateCreateInfoEXT* pDivisorCI = static_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(VertexInput.pNext))
+        {
+            VERIFY_EXPR(pDivisorCI->sType == VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT);
+            Builder.AddArray(pDivisorCI->pVertexBindingDivisors, pDivisorCI->vertexBindingDivisorCount);
+        }
+        else
+        {
+            Builder.Add(Uint32{0});
+        }
+
+        Builder.Add(PipelineCI.pInputAssemblyState->topology);
+        Builder.Add(PipelineCI.pInputAssemblyState->primitiveRestartEnable);
+
+        Libraries[LIBRARY_PART_VERTEX_INPUT] = GetLibrary(std::move(Builder), LibraryCI, vkPSOCache, PipelineName);
+    }
+
+    std::vector<VkPipelineShaderStageCreateInfo> PreRasterStages;
+    std::vector<VkPipelineShaderStageCreateInfo> FragmentStages;
+    std::vector<const std::vector<uint32_t>*>    PreRasterSPIRVs;
+    std::vector<const std::vector<uint32_t>*>    FragmentSPIRVs;
+    for (uint32_t i = 0; i < PipelineCI.stageCount; ++i)
+    {
+        const VkPipelineShaderStageCreateInfo& Stage = PipelineCI.pStages[i];
+        if (Stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+        {
+            FragmentStages.push_back(Stage);
+            FragmentSPIRVs.push_back(Attribs.ppStageSPIRVs[i]);
+        }
+        else
+        {
+            PreRasterStages.push_back(Stage);
+            PreRasterSPIRVs.push_back(Attribs.ppStageSPIRVs[i]);
+        }
+    }
+
+    // Pre-rasterization shaders
+    {
+        VkGraphicsPipelineLibraryCreateInfoEXT LibTypeCI;
+        VkGraphicsPipelineCreateInfo           LibraryCI;
+        VkPipelineRenderingCreateInfoKHR       RenderingCI;
+        InitLibraryCI(LibTypeCI, LibraryCI, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+        InitLibraryRenderPass(LibTypeCI, LibraryCI, RenderingCI);
+        LibraryCI.stageCount          = static_cast<uint32_t>(PreRasterStages.size());
+        LibraryCI.pStages             = PreRasterStages.data();
+        LibraryCI.pViewportState      = PipelineCI.pViewportState;
+        LibraryCI.pRasterizationState = PipelineCI.pRasterizationState;
+        LibraryCI.pTessellationState  = PipelineCI.pTessellationState;
+        LibraryCI.layout              = PipelineCI.layout;
+
+        KeyBuilder Builder{LIBRARY_PART_PRE_RASTERIZATION};
+        Builder.Add(LibraryFlags);
+        Builder.AddDynamicState(PipelineCI.pDynamicState);
+        AddLayout(Builder);
+        AddRenderPass(Builder);
+
+        Builder.Add(static_cast<Uint32>(PreRasterStages.size()));
+        for (size_t i = 0; i < PreRasterStages.size(); ++i)
+            Builder.AddShaderStage(PreRasterStages[i], *PreRasterSPIRVs[i]);
+
+        const VkPipelineViewportStateCreateInfo& ViewportState = *PipelineCI.pViewportState;
+        Builder.Add(ViewportState.viewportCount);
+        Builder.Add(ViewportState.scissorCount);
+        Builder.AddArray(ViewportState.pScissors, ViewportState.pScissors != nullptr ? ViewportState.scissorCount : 0);
+
+        const VkPipelineRasterizationStateCreateInfo& RasterState = *PipelineCI.pRasterizationState;
+        VERIFY(RasterState.pNext == nullptr, "Rasterization state extensions are not expected");
+        Builder.Add(RasterState.depthClampEnable);
+        Builder.Add(RasterState.rasterizerDiscardEnable);
+        Builder.Add(RasterState.polygonMode);
+        Builder.Add(RasterState.cullMode);
+        Builder.Add(RasterState.frontFace);
+        Builder.Add(RasterState.depthBiasEnable);
+        Builder.Add(RasterState.depthBiasConstantFactor);
+        Builder.Add(RasterState.depthBiasClamp);
+        Builder.Add(RasterState.depthBiasSlopeFactor);
+        Builder.Add(RasterState.lineWidth);
+
+        Builder.Add(PipelineCI.pTessellationState != nullptr ? PipelineCI.pTessellationState->patchControlPoints : 0u);
+
+        Libraries[LIBRARY_PART_PRE_RASTERIZATION] = GetLibrary(std::move(Builder), LibraryCI, vkPSOCache, PipelineName);
+    }
+
+    // Fragment shader
+    {
+        VkGraphicsPipelineLibraryCreateInfoEXT LibTypeCI;
+        VkGraphicsPipelineCreateInfo           LibraryCI;
+        VkPipelineRenderingCreateInfoKHR       RenderingCI;
+        InitLibraryCI(LibTypeCI, LibraryCI, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+        InitLibraryRenderPass(LibTypeCI, LibraryCI, RenderingCI);
+        LibraryCI.stageCount         = static_cast<uint32_t>(FragmentStages.size());
+        LibraryCI.pStages            = FragmentStages.data();
+        LibraryCI.pDepthStencilState = PipelineCI.pDepthStencilState;
+        LibraryCI.pMultisampleState  = PipelineCI.pMultisampleState;
+        LibraryCI.layout             = PipelineCI.layout;
+
+        KeyBuilder Builder{LIBRARY_PART_FRAGMENT_SHADER};
+        Builder.Add(LibraryFlags);
+        Builder.AddDynamicState(PipelineCI.pDynamicState);
+        AddLayout(Builder);
+        AddRenderPass(Builder);
+
+        Builder.Add(static_cast<Uint32>(FragmentStages.size()));
+        for (size_t i = 0; i < FragmentStages.size(); ++i)
+            Builder.AddShaderStage(FragmentStages[i], *FragmentSPIRVs[i]);
+
+        const VkPipelineDepthStencilStateCreateInfo& DSState = *PipelineCI.pDepthStencilState;
+        Builder.Add(DSState.depthTestEnable);
+        Builder.Add(DSState.depthWriteEnable);
+        Builder.Add(DSState.depthCompareOp);
+        Builder.Add(DSState.depthBoundsTestEnable);
+        Builder.Add(DSState.stencilTestEnable);
+        Builder.AddArray(&DSState.front, 1);
+        Builder.AddArray(&DSState.back, 1);
+        Builder.Add(DSState.minDepthBounds);
+        Builder.Add(DSState.maxDepthBounds);
+
+        Builder.AddMultisampleState(*PipelineCI.pMultisampleState);
+
+        Libraries[LIBRARY_PART_FRAGMENT_SHADER] = GetLibrary(std::move(Builder), LibraryCI, vkPSOCache, PipelineName);
+    }
+
+    // Fragment output interface
+    {
+        VkGraphicsPipelineLibraryCreateInfoEXT LibTypeCI;
+        VkGraphicsPipelineCreateInfo           LibraryCI;
+        VkPipelineRenderingCreateInfoKHR       RenderingCI;
+        InitLibraryCI(LibTypeCI, LibraryCI, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+        InitLibraryRenderPass(LibTypeCI, LibraryCI, RenderingCI);
+        LibraryCI.pColorBlendState  = PipelineCI.pColorBlendState;
+        LibraryCI.pMultisampleState = PipelineCI.pMultisampleState;
+
+        KeyBuilder Builder{LIBRARY_PART_FRAGMENT_OUTPUT};
+        Builder.Add(LibraryFlags);
+        Builder.AddDynamicState(PipelineCI.pDynamicState);
+        AddRenderPass(Builder);
+
+        const VkPipelineColorBlendStateCreateInfo& BlendState = *PipelineCI.pColorBlendState;
+        Builder.Add(BlendState.logicOpEnable);
+        Builder.Add(BlendState.logicOp);
+        Builder.AddArray(BlendState.pAttachments, BlendState.attachmentCount);
+        for (float BlendConstant : BlendState.blendConstants)
+            Builder.Add(BlendConstant);
+
+        Builder.AddMultisampleState(*PipelineCI.pMultisampleState);
+
+        Libraries[LIBRARY_PART_FRAGMENT_OUTPUT] = GetLibrary(std::move(Builder), LibraryCI, vkPSOCache, PipelineName);
+    }
+}
+
+VulkanUtilities::PipelineWrapper PipelineLibraryCache::LinkPipeline(const LibraryArray&   Libraries,
+                                                                    VkPipelineLayout      vkLayout,
+                                                                    VkPipelineCreateFlags Flags,
+                                                                    bool                  Optimize,
+                                                                    VkPipelineCache       vkPSOCache,
+                                                                    const char*           PipelineName) const noexcept(false)
+{
+    VkPipelineLibraryCreateInfoKHR LibraryCI{};
+    LibraryCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibraryCI.pNext        = nullptr;
+    LibraryCI.libraryCount = static_cast<uint32_t>(Libraries.size());
+    LibraryCI.pLibraries   = Libraries.data();
+
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext = &LibraryCI;
+    PipelineCI.flags = Flags;
+    if (Optimize)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+    PipelineCI.layout             = vkLayout;
+    PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    PipelineCI.basePipelineIndex  = -1;
+
+    return m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(PipelineCI, vkPSOCache, PipelineName);
+}
+
+} // namespace Diligent
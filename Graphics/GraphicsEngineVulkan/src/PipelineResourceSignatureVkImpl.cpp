@@ -156,7 +156,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data());
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), HasDynamicSetUpdateTemplate(), GetDescriptorBufferLayouts());
             });
     }
     catch (...)
@@ -247,6 +247,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS> vkSetLayoutBindings;
 
+    // Descriptor buffers are only used by signatures that are created with the device
+    const bool UseDescriptorBuffer = HasDevice() && GetDevice()->GetLogicalDevice().GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE;
+
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
 
     std::vector<bool> ImmutableSamplerWithResource(m_Desc.NumImmutableSamplers, false);
@@ -330,7 +333,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = UseDescriptorBuffer ?
+                DescriptorTypeToVkDescriptorBufferType(pAttribs->GetDescriptorType()) :
+                DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
@@ -454,7 +459,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
+    SetLayoutCI.flags = UseDescriptorBuffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
 
     if (HasDevice())
     {
@@ -471,7 +476,169 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (UseDescriptorBuffer)
+            InitDescriptorBufferLayouts();
+        else if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC) && LogicalDevice.GetEnabledExtFeatures().DescriptorUpdateTemplate)
+            CreateDynamicSetUpdateTemplate();
+    }
+}
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferLayouts()
+{
+    const RenderDeviceVkImpl*                            pDevice       = GetDevice();
+    const VulkanUtilities::VulkanLogicalDevice&          LogicalDevice = pDevice->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props         = pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+
+    // Robust buffer descriptors may be larger than the regular ones
+    const bool RobustBufferAccess = LogicalDevice.GetEnabledFeatures().robustBufferAccess != VK_FALSE;
+
+    auto GetDescriptorSize = [&](VkDescriptorType vkType) -> size_t {
+        switch (vkType)
+        {
+            // clang-format off
+            case VK_DESCRIPTOR_TYPE_SAMPLER:                    return Props.samplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     return Props.combinedImageSamplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              return Props.sampledImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              return Props.storageImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       return RobustBufferAccess ? Props.robustUniformTexelBufferDescriptorSize : Props.uniformTexelBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       return RobustBufferAccess ? Props.robustStorageTexelBufferDescriptorSize : Props.storageTexelBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             return RobustBufferAccess ? Props.robustUniformBufferDescriptorSize : Props.uniformBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:             return RobustBufferAccess ? Props.robustStorageBufferDescriptorSize : Props.storageBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           return Props.inputAttachmentDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return Props.accelerationStructureDescriptorSize;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected descriptor type");
+                return 0;
+        }
+    };
+
+    auto WriteSamplerDescriptor = [&](VkSampler vkSampler, Uint8* pDst) {
+        VkDescriptorGetInfoEXT GetInfo{};
+        GetInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        GetInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+        GetInfo.data.pSampler = &vkSampler;
+        LogicalDevice.GetDescriptor(GetInfo, Props.samplerDescriptorSize, pDst);
+    };
+
+    // Set layouts indexed by the set index in the layout
+    std::array<VkDescriptorSetLayout, MAX_DESCRIPTOR_SETS> vkSetLayouts = {};
+    if (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+        vkSetLayouts[GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>()] = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_STATIC_MUTABLE];
+    if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC))
+        vkSetLayouts[GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>()] = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    for (Uint32 set = 0; set < GetNumDescriptorSets(); ++set)
+    {
+        ShaderResourceCacheVk::DescriptorBufferSetLayout& Layout = m_DescriptorBufferLayouts[set];
+
+        // Set data is placed in the descriptor buffer at offsets aligned by descriptorBufferOffsetAlignment
+        const VkDeviceSize SetSize = AlignUp(LogicalDevice.GetDescriptorSetLayoutSize(vkSetLayouts[set]), Props.descriptorBufferOffsetAlignment);
+        Layout.InitData.resize(StaticCast<size_t>(SetSize), Uint8{0});
+        Layout.Slots.resize(m_DescriptorSetSizes[set]);
+    }
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+    for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+    {
+        const PipelineResourceDesc&        ResDesc   = m_Desc.Resources[r];
+        const PipelineResourceAttribsType& Attr      = m_pResourceAttribs[r];
+        const DescriptorType               DescrType = Attr.GetDescriptorType();
+
+        ShaderResourceCacheVk::DescriptorBufferSetLayout& Layout = m_DescriptorBufferLayouts[Attr.DescrSet];
+
+        const VkDeviceSize BindingOffset = LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkSetLayouts[Attr.DescrSet], Attr.BindingIndex);
+        const size_t       DescrSize     = GetDescriptorSize(DescriptorTypeToVkDescriptorBufferType(DescrType));
+
+        VkSampler vkImmutableSampler = VK_NULL_HANDLE;
+        if (Attr.IsImmutableSamplerAssigned())
+        {
+            const Uint32 SrcImmutableSamplerInd = FindImmutableSamplerVk(ResDesc, DescrType, m_Desc, GetCombinedSamplerSuffix());
+            VERIFY_EXPR(SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+            if (const RefCntAutoPtr<SamplerVkImpl>& pSamplerVk = m_pImmutableSamplers[SrcImmutableSamplerInd])
+                vkImmutableSampler = pSamplerVk->GetVkSampler();
+        }
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            ShaderResourceCacheVk::DescriptorBufferSetLayout::Slot& Slot = Layout.Slots[Attr.CacheOffset(CacheType) + ArrInd];
+
+            Slot.Offset           = StaticCast<Uint32>(BindingOffset + ArrInd * DescrSize);
+            Slot.Size             = StaticCast<Uint32>(DescrSize);
+            Slot.ImmutableSampler = vkImmutableSampler;
+            VERIFY_EXPR(size_t{Slot.Offset} + Slot.Size <= Layout.InitData.size());
+
+            // Immutable separate samplers are never set in the resource cache
+            if (DescrType == DescriptorType::Sampler && vkImmutableSampler != VK_NULL_HANDLE)
+                WriteSamplerDescriptor(vkImmutableSampler, &Layout.InitData[Slot.Offset]);
+        }
+    }
+
+    // Immutable samplers that are not assigned to any resource have their own bindings (see CreateSetLayouts())
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerAttribsVk& ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+        if (ImtblSampAttribs.DescrSet == ~0u || !m_pImmutableSamplers[i])
+            continue;
+
+        ShaderResourceCacheVk::DescriptorBufferSetLayout& Layout = m_DescriptorBufferLayouts[ImtblSampAttribs.DescrSet];
+
+        const VkDeviceSize BindingOffset = LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkSetLayouts[ImtblSampAttribs.DescrSet], ImtblSampAttribs.BindingIndex);
+        VERIFY_EXPR(BindingOffset + Props.samplerDescriptorSize <= Layout.InitData.size());
+        WriteSamplerDescriptor(m_pImmutableSamplers[i]->GetVkSampler(), &Layout.InitData[StaticCast<size_t>(BindingOffset)]);
     }
+
+    m_UseDescriptorBuffer = true;
+}
+
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    VERIFY_EXPR(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC));
+    // The dynamic set is always the last set in the resource cache, which is where the cache keeps descriptor data
+    VERIFY_EXPR(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>() == GetNumDescriptorSets() - 1);
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+    Entries.reserve(DynResIdxRange.second - DynResIdxRange.first);
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr = GetResourceAttribs(ResIdx);
+        // Immutable samplers are permanently bound into the set layout
+        if (Attr.GetDescriptorType() == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        // Every array element takes one DescriptorData slot at its offset in the resource cache
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(Attr.GetDescriptorType());
+        Entry.offset          = size_t{Attr.CacheOffset(CacheType)} * sizeof(ShaderResourceCacheVk::DescriptorData);
+        Entry.stride          = sizeof(ShaderResourceCacheVk::DescriptorData);
+        Entries.push_back(Entry);
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    const char* TemplateName = "Dynamic set update template";
+#ifdef DILIGENT_DEVELOPMENT
+    std::string _TemplateName{m_Desc.Name};
+    _TemplateName.append(" - dynamic set update template");
+    TemplateName = _TemplateName.c_str();
+#endif
+    m_VkDynamicSetUpdateTemplate = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, TemplateName);
 }
 
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
@@ -481,6 +648,9 @@ PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 
 void PipelineResourceSignatureVkImpl::Destruct()
 {
+    if (m_VkDynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_VkDynamicSetUpdateTemplate), ~0ull);
+
     for (auto& Layout : m_VkDescrSetLayouts)
     {
         if (Layout)
@@ -499,7 +669,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
 #endif
 
     auto& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data());
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), HasDynamicSetUpdateTemplate(), GetDescriptorBufferLayouts());
 
     const auto TotalResources = GetTotalResourceCount();
     const auto CacheType      = ResourceCache.GetContentType();
@@ -515,6 +685,10 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    // Descriptor set data is stored in the resource cache when descriptor buffers are used
+    if (UsesDescriptorBuffer())
+        return;
+
     if (auto vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -613,6 +787,19 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    const Uint32                                DynamicSetIdx = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+    const ShaderResourceCacheVk::DescriptorSet& SetResources  = ResourceCache.GetDescriptorSet(DynamicSetIdx);
+    const VulkanUtilities::VulkanLogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    // The template writes every descriptor in the set, so it can only be used when all resources are bound.
+    // Otherwise, fall back to writing non-null descriptors only.
+    if (HasDynamicSetUpdateTemplate() && !SetResources.HasNullDescriptors())
+    {
+        VERIFY_EXPR(ResourceCache.GetDescriptorData() != nullptr);
+        LogicalDevice.UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_VkDynamicSetUpdateTemplate, ResourceCache.GetDescriptorData());
+        return;
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -640,10 +827,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     auto AccelStructIt   = DescrAccelStructArr.begin();
     auto WriteDescrSetIt = WriteDescrSetArr.begin();
 
-    const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
-    const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const VulkanUtilities::VulkanLogicalDevice& LogicalDevice  = GetDevice()->GetLogicalDevice();
-    const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
 
@@ -959,7 +1143,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data());
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), HasDynamicSetUpdateTemplate(), GetDescriptorBufferLayouts());
             });
     }
     catch (...)
@@ -31,6 +31,7 @@
 
 #include <array>
 #include <unordered_map>
+#include <functional>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -38,6 +39,7 @@
 #include "RenderPassVkImpl.hpp"
 #include "ShaderResourceBindingVkImpl.hpp"
 #include "PipelineStateCacheVkImpl.hpp"
+#include "PipelineLibraryCache.hpp"
 
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
@@ -116,6 +118,8 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -126,14 +130,15 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
-void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
-                            std::vector<VkPipelineShaderStageCreateInfo>& Stages,
-                            const PipelineLayoutVk&                       Layout,
-                            const PipelineStateDesc&                      PSODesc,
-                            const GraphicsPipelineDesc&                   GraphicsPipeline,
-                            VulkanUtilities::PipelineWrapper&             Pipeline,
-                            RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+// Initializes the graphics pipeline create info and passes it to the CreatePipeline handler,
+// which either creates a monolithic pipeline or links it from the pipeline libraries.
+void CreateGraphicsPipeline(RenderDeviceVkImpl*                                             pDeviceVk,
+                            std::vector<VkPipelineShaderStageCreateInfo>&                   Stages,
+                            const PipelineLayoutVk&                                         Layout,
+                            const PipelineStateDesc&                                        PSODesc,
+                            const GraphicsPipelineDesc&                                     GraphicsPipeline,
+                            RefCntAutoPtr<IRenderPass>&                                     pRenderPass,
+                            const std::function<void(const VkGraphicsPipelineCreateInfo&)>& CreatePipeline)
 {
     const VulkanUtilities::VulkanLogicalDevice&  LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const VulkanUtilities::VulkanPhysicalDevice& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
@@ -144,6 +149,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     VkPipelineRenderingCreateInfoKHR PipelineRenderingCI{};
     std::vector<VkFormat>            ColorAttachmentFormats;
@@ -357,7 +364,7 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    CreatePipeline(PipelineCI);
 }
 
 
@@ -378,6 +385,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -858,10 +867,84 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const PipelineStateVkImpl::TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
     const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+
+    // Mesh shading pipelines are always created as monolithic pipelines
+    PipelineLibraryCache* pLibraryCache = m_Desc.PipelineType == PIPELINE_TYPE_GRAPHICS ? m_pDevice->GetPipelineLibraryCache() : nullptr;
+
+    CreateGraphicsPipeline(
+        m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, GetRenderPassPtr(),
+        [&](const VkGraphicsPipelineCreateInfo& PipelineCI) {
+            if (pLibraryCache != nullptr)
+                InitializeLibraryPipeline(*pLibraryCache, PipelineCI, ShaderStages, CreateInfo.pPSOCache);
+            else
+                m_Pipeline = m_pDevice->GetLogicalDevice().CreateGraphicsPipeline(PipelineCI, vkSPOCache, m_Desc.Name);
+        });
+}
+
+void PipelineStateVkImpl::InitializeLibraryPipeline(PipelineLibraryCache&               LibraryCache,
+                                                    const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                    const TShaderStages&                ShaderStages,
+                                                    IPipelineStateCache*                pPSOCache) noexcept(false)
+{
+    const VkPipelineCache vkSPOCache = pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+
+    // SPIR-V byte code in the same order as the stages in PipelineCI (see InitPipelineShaderStages)
+    std::vector<const std::vector<uint32_t>*> StageSPIRVs;
+    for (const ShaderStageInfo& Stage : ShaderStages)
+    {
+        for (const std::vector<uint32_t>& SPIRV : Stage.SPIRVs)
+            StageSPIRVs.push_back(&SPIRV);
+    }
+    VERIFY_EXPR(StageSPIRVs.size() == PipelineCI.stageCount);
+
+    PipelineLibraryCache::LibraryAttribs Attribs;
+    Attribs.ppSignatures   = m_Signatures;
+    Attribs.SignatureCount = m_SignatureCount;
+    Attribs.pRenderPass    = GetRenderPassPtr();
+    Attribs.ppStageSPIRVs  = StageSPIRVs.data();
+
+    // If the method throws, Destruct() releases the libraries that have been obtained
+    LibraryCache.GetLibraries(PipelineCI, Attribs, vkSPOCache, m_Desc.Name, m_PipelineLibraries);
+    const PipelineLibraryCache::LibraryArray& Libraries = m_PipelineLibraries;
+
+    // Flags such as the descriptor buffer flag must be consistent between the libraries and the linked pipeline
+    const VkPipelineCreateFlags LinkFlags = PipelineCI.flags;
+
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+    if (pThreadPool == nullptr)
+    {
+        // There is no thread to run the optimized link in the background, so do it now
+        m_Pipeline = LibraryCache.LinkPipeline(Libraries, PipelineCI.layout, LinkFlags, /*Optimize = */ true, vkSPOCache, m_Desc.Name);
+        return;
+    }
+
+    // Fast link is cheap and makes the pipeline usable immediately
+    m_Pipeline = LibraryCache.LinkPipeline(Libraries, PipelineCI.layout, LinkFlags, /*Optimize = */ false, vkSPOCache, m_Desc.Name);
+
+    // The optimized pipeline is linked in the background with a lower priority than shader compilation tasks.
+    // The pipeline layout and the libraries stay alive until the task is complete: both are released
+    // by the destructor after the task has been removed from the queue or finished.
+    VkPipelineLayout                   vkLayout = PipelineCI.layout;
+    RefCntAutoPtr<IPipelineStateCache> pCache{pPSOCache};
+    m_OptimizedLinkTask = EnqueueAsyncWork(
+        pThreadPool,
+        [this, &LibraryCache, Libraries, vkLayout, LinkFlags, pCache](Uint32 ThreadId) {
+            const VkPipelineCache vkCache = pCache ? pCache.RawPtr<PipelineStateCacheVkImpl>()->GetVkPipelineCache() : VK_NULL_HANDLE;
+            try
+            {
+                m_OptimizedPipeline = LibraryCache.LinkPipeline(Libraries, vkLayout, LinkFlags, /*Optimize = */ true, vkCache, m_Desc.Name);
+                m_vkOptimizedPipeline.store(m_OptimizedPipeline, std::memory_order_release);
+            }
+            catch (...)
+            {
+                LOG_WARNING_MESSAGE("Failed to create optimized pipeline for PSO '", m_Desc.Name, "'. Fast-linked pipeline will be used.");
+            }
+            return ASYNC_TASK_STATUS_COMPLETE;
+        },
+        -1.f);
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
@@ -926,12 +1009,34 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion =*/true);
 
+    if (m_OptimizedLinkTask)
+    {
+        // The optimized link task also references the pipeline object.
+        // Remove it from the queue if it has not started yet, or wait until it is complete otherwise.
+        // Note that cancelling the task is not enough: a cancelled task stays in the queue until
+        // one of the threads picks it up, which may take arbitrarily long if all threads are busy.
+        IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+        if (pThreadPool == nullptr || !pThreadPool->RemoveTask(m_OptimizedLinkTask))
+        {
+            m_OptimizedLinkTask->Cancel();
+            m_OptimizedLinkTask->WaitForCompletion();
+        }
+        m_OptimizedLinkTask.Release();
+    }
+
     Destruct();
 }
 
 void PipelineStateVkImpl::Destruct()
 {
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    if (m_OptimizedPipeline)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
+    if (m_PipelineLibraries[0] != VK_NULL_HANDLE)
+    {
+        m_pDevice->GetPipelineLibraryCache()->ReleaseLibraries(m_PipelineLibraries);
+        m_PipelineLibraries = {};
+    }
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
@@ -140,6 +140,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DeviceLocalMemoryReserveSize,
         EngineCI.HostVisibleMemoryReserveSize
     },
+    m_MemoryDefragmentationEnabled{EngineCI.EnableMemoryDefragmentation && CommandQueueCount == 1},
     m_DynamicMemoryManager
     {
         GetRawAllocator(),
@@ -156,6 +157,11 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         m_ImplicitRenderPassCache = std::make_unique<RenderPassCache>(*this);
     }
 
+    if (m_LogicalVkDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE)
+    {
+        m_PipelineLibraryCache = std::make_unique<PipelineLibraryCache>(*this);
+    }
+
     static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
 
     const uint32_t vkVersion = m_PhysicalDevice->GetVkVersion();
@@ -204,6 +210,11 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
 
+    if (EngineCI.EnableMemoryDefragmentation && !m_MemoryDefragmentationEnabled)
+    {
+        LOG_WARNING_MESSAGE("Memory defragmentation is only supported with a single immediate context and will be disabled.");
+    }
+
     InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
 }
 
@@ -219,9 +230,17 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
         m_ImplicitRenderPassCache->Destroy();
     }
 
+    if (m_PipelineLibraryCache)
+    {
+        m_PipelineLibraryCache->Destroy();
+    }
+
     // Wait for the GPU to complete all its operations
     IdleGPU();
 
+    // All copies have finished now, and the new allocations must be released before the memory manager
+    CompleteDefragmentationMoves(~Uint64{0});
+
     ReleaseStaleResources(true);
 
     DEV_CHECK_ERR(m_DescriptorSetAllocator.GetAllocatedDescriptorSetCounter() == 0, "All allocated descriptor sets must have been released now.");
@@ -289,9 +308,9 @@ void RenderDeviceVkImpl::AllocateTransientCmdPool(SoftwareQueueIndex
 }
 
 
-void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex                    CommandQueueId,
-                                                           VkCommandBuffer                       vkCmdBuff,
-                                                           VulkanUtilities::CommandPoolWrapper&& CmdPool)
+Uint64 RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex                    CommandQueueId,
+                                                             VkCommandBuffer                       vkCmdBuff,
+                                                             VulkanUtilities::CommandPoolWrapper&& CmdPool)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
 
@@ -401,6 +420,53 @@ void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex
         },
         FenceValue);
     // clang-format on
+
+    return FenceValue;
+}
+
+void RenderDeviceVkImpl::DefragmentMemory(SoftwareQueueIndex CommandQueueId, VkDeviceSize MaxBytesToMove)
+{
+    VERIFY(m_MemoryDefragmentationEnabled, "Memory defragmentation is not enabled");
+
+    // Only pages that are at most half full are emptied
+    constexpr float MaxPageUtilization = 0.5f;
+
+    CompleteDefragmentationMoves(GetCompletedFenceValue(CommandQueueId));
+
+    auto Moves = m_MemoryMgr.GetDefragmentationMoves(MaxBytesToMove, MaxPageUtilization);
+    if (Moves.empty())
+        return;
+
+    VulkanUtilities::CommandPoolWrapper  CmdPool;
+    VulkanUtilities::VulkanCommandBuffer CmdBuffer;
+    AllocateTransientCmdPool(CommandQueueId, CmdPool, CmdBuffer, "Transient command pool to defragment memory");
+
+    std::vector<VulkanUtilities::VulkanMemoryManager::DefragmentationMove> RecordedMoves;
+    RecordedMoves.reserve(Moves.size());
+    for (auto& Move : Moves)
+    {
+        if (Move.pMover->RecordCopy(CmdBuffer.GetVkCmdBuffer(), Move.NewAllocation))
+            RecordedMoves.emplace_back(std::move(Move));
+    }
+    // Release the new allocations of the moves that have been canceled
+    Moves.clear();
+
+    const Uint64 FenceValue = ExecuteAndDisposeTransientCmdBuff(CommandQueueId, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
+
+    std::lock_guard<std::mutex> Lock{m_DefragmentationMovesMtx};
+    for (auto& Move : RecordedMoves)
+        m_PendingDefragmentationMoves.push_back(PendingDefragmentationMove{FenceValue, std::move(Move)});
+}
+
+void RenderDeviceVkImpl::CompleteDefragmentationMoves(Uint64 CompletedFenceValue)
+{
+    std::lock_guard<std::mutex> Lock{m_DefragmentationMovesMtx};
+    while (!m_PendingDefragmentationMoves.empty() && m_PendingDefragmentationMoves.front().FenceValue <= CompletedFenceValue)
+    {
+        VulkanUtilities::VulkanMemoryManager::DefragmentationMove& Move = m_PendingDefragmentationMoves.front().Move;
+        Move.pMover->CompleteMove(std::move(Move.NewAllocation));
+        m_PendingDefragmentationMoves.pop_front();
+    }
 }
 
 void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex                                          CommandQueueId,
@@ -449,6 +515,19 @@ void RenderDeviceVkImpl::IdleGPU()
     ReleaseStaleResources();
 }
 
+ICommandQueueVk* RenderDeviceVkImpl::LockCommandQueue(SoftwareQueueIndex QueueInd)
+{
+    ICommandQueueVk* pQueue = TRenderDeviceBase::LockCommandQueue(QueueInd);
+    ClassPtrCast<CommandQueueVkImpl>(pQueue)->LockDirectAccess();
+    return pQueue;
+}
+
+void RenderDeviceVkImpl::UnlockCommandQueue(SoftwareQueueIndex QueueInd)
+{
+    m_CommandQueues[QueueInd].CmdQueue.RawPtr<CommandQueueVkImpl>()->UnlockDirectAccess();
+    TRenderDeviceBase::UnlockCommandQueue(QueueInd);
+}
+
 void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 {
     // Submit empty command buffer to the queue. This will effectively signal the fence and
@@ -837,4 +916,32 @@ void RenderDeviceVkImpl::GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const
     FeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(m_LogicalVkDevice->GetEnabledExtFeatures());
 }
 
+void RenderDeviceVkImpl::GetDeviceMemoryStats(DeviceMemoryStatsVk& Stats)
+{
+    const VulkanUtilities::VulkanMemoryManagerStats MgrStats = m_MemoryMgr.GetStats();
+
+    auto GetSizeClassStats = [&MgrStats](VulkanUtilities::VULKAN_MEMORY_SIZE_CLASS SizeClass) {
+        const auto& SrcStats = MgrStats.SizeClasses[SizeClass];
+
+        DeviceMemorySizeClassStatsVk ClassStats;
+        ClassStats.PageCount           = SrcStats.PageCount;
+        ClassStats.AllocatedSize       = SrcStats.AllocatedSize;
+        ClassStats.UsedSize            = SrcStats.UsedSize;
+        ClassStats.FreeSize            = SrcStats.FreeSize;
+        ClassStats.MaxFreeBlockSize    = SrcStats.MaxFreeBlockSize;
+        ClassStats.Fragmentation       = SrcStats.Fragmentation;
+        ClassStats.NumAllocations      = SrcStats.NumAllocations;
+        ClassStats.TotalAllocationTime = SrcStats.TotalAllocationTime;
+        ClassStats.MaxAllocationTime   = SrcStats.MaxAllocationTime;
+        return ClassStats;
+    };
+
+    Stats                     = {};
+    Stats.DeviceLocalPageSize = m_MemoryMgr.GetDeviceLocalPageSize();
+    Stats.HostVisiblePageSize = m_MemoryMgr.GetHostVisiblePageSize();
+    Stats.Small               = GetSizeClassStats(VulkanUtilities::VULKAN_MEMORY_SIZE_CLASS_SMALL);
+    Stats.Medium              = GetSizeClassStats(VulkanUtilities::VULKAN_MEMORY_SIZE_CLASS_MEDIUM);
+    Stats.Dedicated           = GetSizeClassStats(VulkanUtilities::VULKAN_MEMORY_SIZE_CLASS_DEDICATED);
+}
+
 } // namespace Diligent
@@ -41,16 +41,37 @@
 namespace Diligent
 {
 
-size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes)
+static size_t GetDescriptorBufferDataSize(Uint32 NumSets, const ShaderResourceCacheVk::DescriptorBufferSetLayout* pDescrBufferLayouts)
+{
+    size_t DataSize = 0;
+    if (pDescrBufferLayouts != nullptr)
+    {
+        for (Uint32 t = 0; t < NumSets; ++t)
+            DataSize += pDescrBufferLayouts[t].GetSize();
+    }
+    return DataSize;
+}
+
+size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32                           NumSets,
+                                                    const Uint32*                    SetSizes,
+                                                    bool                             HasDescriptorData,
+                                                    const DescriptorBufferSetLayout* pDescrBufferLayouts)
 {
     Uint32 TotalResources = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
         TotalResources += SetSizes[t];
     size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource);
+    if (HasDescriptorData && NumSets > 0)
+        MemorySize += SetSizes[NumSets - 1] * sizeof(DescriptorData);
+    MemorySize += GetDescriptorBufferDataSize(NumSets, pDescrBufferLayouts);
     return MemorySize;
 }
 
-void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes)
+void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator&                MemAllocator,
+                                           Uint32                           NumSets,
+                                           const Uint32*                    SetSizes,
+                                           bool                             HasDescriptorData,
+                                           const DescriptorBufferSetLayout* pDescrBufferLayouts)
 {
     VERIFY(!m_pMemory, "Memory has already been allocated");
 
@@ -59,10 +80,12 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Data[0] | ... | Data[m-1] | SetData[0] | ... | SetData[Ns-1] ||
     //
     //
     //  Ns = m_NumSets
+    //  Data[] is only allocated if HasDescriptorData is true
+    //  SetData[] is only allocated if pDescrBufferLayouts is not null
 
     m_NumSets = static_cast<Uint16>(NumSets);
     VERIFY(m_NumSets == NumSets, "NumSets (", NumSets, ") exceed maximum representable value");
@@ -74,8 +97,13 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
         m_TotalResources += SetSizes[t];
     }
 
-    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource);
-    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes));
+    m_HasDescriptorData        = (HasDescriptorData && NumSets > 0) ? 1 : 0;
+    m_pDescriptorBufferLayouts = NumSets > 0 ? pDescrBufferLayouts : nullptr;
+
+    const size_t DescriptorDataSize       = m_HasDescriptorData ? SetSizes[NumSets - 1] * sizeof(DescriptorData) : 0;
+    const size_t DescriptorBufferDataSize = GetDescriptorBufferDataSize(NumSets, m_pDescriptorBufferLayouts);
+    const size_t MemorySize               = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + DescriptorDataSize + DescriptorBufferDataSize;
+    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, HasDescriptorData, pDescrBufferLayouts));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
 #endif
@@ -96,7 +124,22 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR((char*)pCurrResPtr == (char*)m_pMemory.get() + MemorySize);
+        if (m_HasDescriptorData)
+        {
+            // Null resources are represented by zero descriptor data
+            memset(pCurrResPtr, 0, DescriptorDataSize);
+        }
+        if (m_pDescriptorBufferLayouts != nullptr)
+        {
+            // Set data initially contains immutable sampler descriptors
+            for (Uint32 t = 0; t < NumSets; ++t)
+            {
+                const DescriptorBufferSetLayout& Layout = m_pDescriptorBufferLayouts[t];
+                VERIFY(Layout.Slots.size() == SetSizes[t], "The number of descriptor buffer slots is inconsistent with the set size");
+                memcpy(GetDescriptorBufferSetData(t), Layout.InitData.data(), Layout.GetSize());
+            }
+        }
+        VERIFY_EXPR((char*)pCurrResPtr + DescriptorDataSize + DescriptorBufferDataSize == (char*)m_pMemory.get() + MemorySize);
     }
 }
 
@@ -106,6 +149,9 @@ void ShaderResourceCacheVk::InitializeResources(Uint32 Set, Uint32 Offset, Uint3
     for (Uint32 res = 0; res < ArraySize; ++res)
     {
         new (&DescrSet.GetResource(Offset + res)) Resource{Type, HasImmutableSampler};
+        // Separate immutable samplers are never written to the descriptor set
+        if (!(Type == DescriptorType::Sampler && HasImmutableSampler))
+            ++DescrSet.m_NumNullDescriptors;
 #ifdef DILIGENT_DEBUG
         m_DbgInitializedResources[Set][size_t{Offset} + res] = true;
 #endif
@@ -288,6 +334,218 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 }
 
+static ShaderResourceCacheVk::DescriptorData GetResourceDescriptorData(const ShaderResourceCacheVk::Resource& Res)
+{
+    ShaderResourceCacheVk::DescriptorData Data{};
+    if (Res.IsNull())
+        return Data;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            Data.ImageInfo = Res.GetSamplerDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            Data.ImageInfo = Res.GetImageDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            Data.TexelBufferView = Res.GetBufferViewWriteInfo();
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            Data.BufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            Data.BufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            Data.ImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            Data.AccelStruct = *Res.GetAccelerationStructureWriteInfo().pAccelerationStructures;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+
+    return Data;
+}
+
+// Writes the descriptor of a non-null resource to the descriptor buffer set data
+static void GetDescriptorBufferDescriptor(const VulkanUtilities::VulkanLogicalDevice&                    LogicalDevice,
+                                          const ShaderResourceCacheVk::Resource&                        Res,
+                                          const ShaderResourceCacheVk::DescriptorBufferSetLayout::Slot& Slot,
+                                          VkDeviceSize                                                  DynamicOffset,
+                                          Uint8*                                                        pSetData)
+{
+    VERIFY_EXPR(!Res.IsNull());
+
+    VkDescriptorGetInfoEXT GetInfo{};
+    GetInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    GetInfo.pNext = nullptr;
+    GetInfo.type  = DescriptorTypeToVkDescriptorBufferType(Res.Type);
+
+    // Do not zero-initialize!
+    union
+    {
+        VkSampler                  vkSampler;
+        VkDescriptorImageInfo      vkImageInfo;
+        VkDescriptorAddressInfoEXT vkAddressInfo;
+    };
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            vkSampler             = Res.GetSamplerDescriptorWriteInfo().sampler;
+            GetInfo.data.pSampler = &vkSampler;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+            vkImageInfo = Res.GetImageDescriptorWriteInfo();
+            // Immutable samplers are not embedded into the descriptor set layout and must be provided explicitly
+            if (Res.HasImmutableSampler)
+                vkImageInfo.sampler = Slot.ImmutableSampler;
+            GetInfo.data.pCombinedImageSampler = &vkImageInfo;
+            break;
+
+        case DescriptorType::SeparateImage:
+            vkImageInfo                = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pSampledImage = &vkImageInfo;
+            break;
+
+        case DescriptorType::StorageImage:
+            vkImageInfo                = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pStorageImage = &vkImageInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            vkImageInfo                        = Res.GetInputAttachmentDescriptorWriteInfo();
+            GetInfo.data.pInputAttachmentImage = &vkImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+        {
+            const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+            const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+
+            vkAddressInfo         = {};
+            vkAddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+            vkAddressInfo.address = pBuffViewVk->GetBuffer<const BufferVkImpl>()->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+            vkAddressInfo.range   = ViewDesc.ByteWidth;
+            vkAddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+            if (Res.Type == DescriptorType::UniformTexelBuffer)
+                GetInfo.data.pUniformTexelBuffer = &vkAddressInfo;
+            else
+                GetInfo.data.pStorageTexelBuffer = &vkAddressInfo;
+            break;
+        }
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        {
+            const VkDescriptorBufferInfo vkBufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+
+            vkAddressInfo         = {};
+            vkAddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+            vkAddressInfo.address = Res.pObject.ConstPtr<BufferVkImpl>()->GetVkDeviceAddress() + vkBufferInfo.offset + DynamicOffset;
+            vkAddressInfo.range   = vkBufferInfo.range;
+            vkAddressInfo.format  = VK_FORMAT_UNDEFINED;
+
+            GetInfo.data.pUniformBuffer = &vkAddressInfo;
+            break;
+        }
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        {
+            const VkDescriptorBufferInfo vkBufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+
+            vkAddressInfo         = {};
+            vkAddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+            vkAddressInfo.address = Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>()->GetVkDeviceAddress() + vkBufferInfo.offset + DynamicOffset;
+            vkAddressInfo.range   = vkBufferInfo.range;
+            vkAddressInfo.format  = VK_FORMAT_UNDEFINED;
+
+            GetInfo.data.pStorageBuffer = &vkAddressInfo;
+            break;
+        }
+
+        case DescriptorType::AccelerationStructure:
+            GetInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected resource type");
+            return;
+    }
+
+    LogicalDevice.GetDescriptor(GetInfo, Slot.Size, pSetData + Slot.Offset);
+}
+
+const Uint8* ShaderResourceCacheVk::GetDescriptorBufferSetData(Uint32 SetIndex) const
+{
+    VERIFY_EXPR(m_pDescriptorBufferLayouts != nullptr && SetIndex < m_NumSets);
+
+    const Uint8* pSetData = reinterpret_cast<const Uint8*>(GetFirstResourcePtr() + m_TotalResources);
+    if (m_HasDescriptorData)
+        pSetData += GetDescriptorSet(m_NumSets - 1u).GetSize() * sizeof(DescriptorData);
+    for (Uint32 t = 0; t < SetIndex; ++t)
+        pSetData += m_pDescriptorBufferLayouts[t].GetSize();
+    return pSetData;
+}
+
+void ShaderResourceCacheVk::WriteDescriptorBufferSet(DeviceContextVkImpl* pCtx, Uint32 SetIndex, void* pDst) const
+{
+    const DescriptorBufferSetLayout& Layout = m_pDescriptorBufferLayouts[SetIndex];
+
+    Uint8* const pDstData = static_cast<Uint8*>(pDst);
+    memcpy(pDstData, GetDescriptorBufferSetData(SetIndex), Layout.GetSize());
+
+    // Dynamic uniform and storage buffers always go first in the set (see GetDynamicBufferOffsets()).
+    // Their addresses may change every time the buffer is mapped, so the descriptors are written here.
+    const VulkanUtilities::VulkanLogicalDevice& LogicalDevice = pCtx->GetDevice()->GetLogicalDevice();
+
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    for (Uint32 res = 0; res < DescrSet.GetSize(); ++res)
+    {
+        const Resource& Res = DescrSet.GetResource(res);
+        if (!IsDynamicDescriptorType(Res.Type))
+            break;
+
+        if (Res.IsNull())
+            continue;
+
+        const BufferVkImpl* pBufferVk = Res.Type == DescriptorType::UniformBufferDynamic ?
+            Res.pObject.ConstPtr<BufferVkImpl>() :
+            Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+        // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
+        const VkDeviceSize DynamicOffset = Res.BufferDynamicOffset + pCtx->GetDynamicBufferOffset(pBufferVk, /*VerifyAllocation = */ false);
+        GetDescriptorBufferDescriptor(LogicalDevice, Res, Layout.Slots[res], DynamicOffset, pDstData);
+    }
+}
+
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
     Uint32                                      DescrSetIndex,
@@ -297,6 +555,8 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
     Resource&      DstRes   = DescrSet.GetResource(CacheOffset);
 
+    const bool WasNull = DstRes.IsNull();
+
     if (IsDynamicBuffer(DstRes))
     {
         VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
@@ -328,6 +588,39 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
+    if (!(DstRes.Type == DescriptorType::Sampler && DstRes.HasImmutableSampler))
+    {
+        if (WasNull && !DstRes.IsNull())
+        {
+            VERIFY_EXPR(DescrSet.m_NumNullDescriptors > 0);
+            --DescrSet.m_NumNullDescriptors;
+        }
+        else if (!WasNull && DstRes.IsNull())
+        {
+            ++DescrSet.m_NumNullDescriptors;
+        }
+
+        if (m_HasDescriptorData && DescrSetIndex == m_NumSets - 1u)
+            GetDescriptorData()[CacheOffset] = GetResourceDescriptorData(DstRes);
+
+        // Descriptors of dynamic buffers are written when the set data is copied to the descriptor buffer
+        if (m_pDescriptorBufferLayouts != nullptr && !IsDynamicDescriptorType(DstRes.Type))
+        {
+            const DescriptorBufferSetLayout::Slot& Slot = m_pDescriptorBufferLayouts[DescrSetIndex].Slots[CacheOffset];
+
+            Uint8* pSetData = GetDescriptorBufferSetData(DescrSetIndex);
+            if (DstRes.pObject)
+            {
+                VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to the descriptor buffer data");
+                GetDescriptorBufferDescriptor(*pLogicalDevice, DstRes, Slot, 0, pSetData);
+            }
+            else
+            {
+                memset(pSetData + Slot.Offset, 0, Slot.Size);
+            }
+        }
+    }
+
     VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
     if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
     {
@@ -294,8 +294,12 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
         auto vkDescrSet = m_CachedSet.GetVkDescriptorSet();
         if (m_CacheType == ResourceCacheContentType::SRB)
         {
-            if (m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
-                m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
+            if (ResourceCache.UsesDescriptorBuffer())
+            {
+                VERIFY(vkDescrSet == VK_NULL_HANDLE, "Vulkan descriptor sets must not be allocated when descriptor buffers are used");
+            }
+            else if (m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
+                     m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
             {
                 VERIFY(vkDescrSet != VK_NULL_HANDLE, "Static and mutable variables must have a valid Vulkan descriptor set assigned");
             }
@@ -164,6 +164,9 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
 void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
                               const CreateInfo&       VkShaderCI)
 {
+    const void* pResourceData    = nullptr;
+    size_t      ResourceDataSize = 0;
+
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
@@ -203,8 +206,13 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     {
         DEV_CHECK_ERR(ShaderCI.ByteCodeSize != 0, "ByteCodeSize must not be 0");
         DEV_CHECK_ERR(ShaderCI.ByteCodeSize % 4 == 0, "Byte code size (", ShaderCI.ByteCodeSize, ") is not multiple of 4");
-        m_SPIRV.resize(ShaderCI.ByteCodeSize / 4);
-        memcpy(m_SPIRV.data(), ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
+
+        // The byte code may be followed by the serialized resources (see GetBytecodeWithReflection())
+        size_t SPIRVSize = 0;
+        SPIRVShaderResources::SplitBytecode(ShaderCI.ByteCode, ShaderCI.ByteCodeSize, SPIRVSize, pResourceData, ResourceDataSize);
+
+        m_SPIRV.resize(SPIRVSize / 4);
+        memcpy(m_SPIRV.data(), ShaderCI.ByteCode, SPIRVSize);
     }
     else
     {
@@ -219,23 +227,41 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     {
         if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
         {
-            IMemoryAllocator& Allocator = GetRawAllocator();
+            IMemoryAllocator& Allocator = GetRawAllocator(MEMORY_CATEGORY_SHADER_TOOLS);
 
             std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
                 ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
                 STDDeleterRawMem<void>(Allocator),
             };
-            const bool LoadShaderInputs = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
-            new (pRawMem.get()) SPIRVShaderResources // May throw
-                {
-                    Allocator,
-                    m_SPIRV,
-                    m_Desc,
-                    m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
-                    LoadShaderInputs,
-                    ShaderCI.LoadConstantBufferReflection,
-                    m_EntryPoint //
-                };
+            const bool  LoadShaderInputs      = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
+            const char* CombinedSamplerSuffix = m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr;
+            if (pResourceData != nullptr && !ShaderCI.LoadConstantBufferReflection)
+            {
+                // Serialized resources don't contain uniform buffer reflection
+                new (pRawMem.get()) SPIRVShaderResources // May throw
+                    {
+                        Allocator,
+                        pResourceData,
+                        ResourceDataSize,
+                        m_SPIRV.size(),
+                        m_Desc,
+                        CombinedSamplerSuffix,
+                        m_EntryPoint //
+                    };
+            }
+            else
+            {
+                new (pRawMem.get()) SPIRVShaderResources // May throw
+                    {
+                        Allocator,
+                        m_SPIRV,
+                        m_Desc,
+                        CombinedSamplerSuffix,
+                        LoadShaderInputs,
+                        ShaderCI.LoadConstantBufferReflection,
+                        m_EntryPoint //
+                    };
+            }
             VERIFY_EXPR(ShaderCI.ByteCode != nullptr || m_EntryPoint == ShaderCI.EntryPoint ||
                         (m_EntryPoint == "main" && (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL) != 0));
             m_pShaderResources.reset(static_cast<SPIRVShaderResources*>(pRawMem.release()), STDDeleterRawMem<SPIRVShaderResources>(Allocator));
@@ -347,4 +373,19 @@ const ShaderCodeBufferDesc* ShaderVkImpl::GetConstantBufferDesc(Uint32 Index) co
     return m_pShaderResources->GetUniformBufferDesc(Index);
 }
 
+void ShaderVkImpl::GetBytecodeWithReflection(IDataBlob** ppBytecode) const
+{
+    DEV_CHECK_ERR(ppBytecode != nullptr && *ppBytecode == nullptr, "ppBytecode must not be null and must point to null");
+    DEV_CHECK_ERR(!IsCompiling(), "Shader byte code is not available until the shader is compiled. Use GetStatus() to check the shader status.");
+    if (ppBytecode == nullptr || IsCompiling())
+        return;
+
+    std::vector<uint32_t> Bytecode{m_SPIRV};
+    if (m_pShaderResources)
+        m_pShaderResources->AppendToBytecode(Bytecode, m_EntryPoint);
+
+    RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(Bytecode.size() * sizeof(Bytecode[0]), Bytecode.data());
+    *ppBytecode                           = pDataBlob.Detach();
+}
+
 } // namespace Diligent
@@ -59,32 +59,101 @@ VulkanCommandBufferPool::~VulkanCommandBufferPool()
                   "buffers in release queues, VulkanCommandBufferPool::RecycleCommandBuffer() will crash when attempting to "
                   "return the buffer to the pool.");
 
-    for (auto CmdBuff : m_CmdBuffers)
+    CollectRecycledBuffers();
+    for (auto CmdBuff : m_FreeCmdBuffers)
         m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
     m_CmdPool.Release();
+
+    RecycledBatch* pBatch = m_FreeBatches.exchange(nullptr);
+    while (pBatch != nullptr)
+    {
+        RecycledBatch* pNext = pBatch->pNext;
+        delete pBatch;
+        pBatch = pNext;
+    }
 }
 
-VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
+void VulkanCommandBufferPool::PushBatches(std::atomic<RecycledBatch*>& Head, RecycledBatch* pFirst, RecycledBatch* pLast)
 {
-    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
+    VERIFY_EXPR(pFirst != nullptr && pLast != nullptr);
+    pLast->pNext = Head.load(std::memory_order_relaxed);
+    while (!Head.compare_exchange_weak(pLast->pNext, pFirst, std::memory_order_release, std::memory_order_relaxed))
+    {
+        // pLast->pNext has been updated with the current head, try again
+    }
+}
 
+VulkanCommandBufferPool::RecycledBatch* VulkanCommandBufferPool::AllocateRecycledBatch()
+{
     {
-        std::lock_guard<std::mutex> Lock{m_Mutex};
+        std::lock_guard<std::mutex> Lock{m_FreeBatchesMtx};
 
-        if (!m_CmdBuffers.empty())
+        RecycledBatch* pBatch = m_FreeBatches.load(std::memory_order_acquire);
+        // pBatch->pNext can't change while the batch is in the list since no other thread is popping batches
+        while (pBatch != nullptr && !m_FreeBatches.compare_exchange_weak(pBatch, pBatch->pNext, std::memory_order_acquire, std::memory_order_acquire))
         {
-            CmdBuffer = m_CmdBuffers.front();
-            auto err  = vkResetCommandBuffer(
-                CmdBuffer,
-                0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
-                  // owned by the command buffer should be returned to the parent command pool.
-            );
-            DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
-            (void)err;
-            m_CmdBuffers.pop_front();
+            // pBatch has been updated with the current head, try again
         }
+        if (pBatch != nullptr)
+        {
+            VERIFY_EXPR(pBatch->CmdBuffers.empty());
+            pBatch->pNext = nullptr;
+            return pBatch;
+        }
+    }
+
+    // New batches are only allocated until there are enough of them to cover all command buffers in flight
+    return new RecycledBatch;
+}
+
+size_t VulkanCommandBufferPool::CollectRecycledBuffers()
+{
+    // The owner thread takes the entire list at once, so there is no ABA problem
+    RecycledBatch* pFirst = m_RecycledBatches.exchange(nullptr, std::memory_order_acquire);
+    if (pFirst == nullptr)
+        return 0;
+
+    size_t         NumCollected = 0;
+    RecycledBatch* pLast        = nullptr;
+    for (RecycledBatch* pBatch = pFirst; pBatch != nullptr; pBatch = pBatch->pNext)
+    {
+        m_FreeCmdBuffers.insert(m_FreeCmdBuffers.end(), pBatch->CmdBuffers.begin(), pBatch->CmdBuffers.end());
+        NumCollected += pBatch->CmdBuffers.size();
+        // Keep the capacity of the vector to avoid allocating memory when the batch is reused
+        pBatch->CmdBuffers.clear();
+        pLast = pBatch;
     }
 
+    // Return all batches to the free list at once
+    PushBatches(m_FreeBatches, pFirst, pLast);
+
+    return NumCollected;
+}
+
+VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName, bool* pIsReused)
+{
+    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
+
+    if (m_FreeCmdBuffers.empty())
+        CollectRecycledBuffers();
+
+    if (!m_FreeCmdBuffers.empty())
+    {
+        CmdBuffer = m_FreeCmdBuffers.back();
+        m_FreeCmdBuffers.pop_back();
+
+        auto err = vkResetCommandBuffer(
+            CmdBuffer,
+            0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
+              // owned by the command buffer should be returned to the parent command pool.
+        );
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
+        (void)err;
+    }
+
+    if (pIsReused != nullptr)
+        *pIsReused = CmdBuffer != VK_NULL_HANDLE;
+
     // If no cmd buffers were ready to be reused, create a new one
     if (CmdBuffer == VK_NULL_HANDLE)
     {
@@ -120,12 +189,21 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
 
 void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
+    VERIFY_EXPR(CmdBuffer != VK_NULL_HANDLE);
+
+    RecycledBatch* pBatch = AllocateRecycledBatch();
+    pBatch->CmdBuffers.push_back(CmdBuffer);
     CmdBuffer = VK_NULL_HANDLE;
+    RecycleCommandBuffers(pBatch);
+}
+
+void VulkanCommandBufferPool::RecycleCommandBuffers(RecycledBatch* pBatch)
+{
+    VERIFY_EXPR(pBatch != nullptr && !pBatch->CmdBuffers.empty());
 #ifdef DILIGENT_DEVELOPMENT
-    --m_BuffCounter;
+    m_BuffCounter -= static_cast<int32_t>(pBatch->CmdBuffers.size());
 #endif
+    PushBatches(m_RecycledBatches, pBatch, pBatch);
 }
 
 } // namespace VulkanUtilities
@@ -441,6 +441,11 @@ void SetDescriptorPoolName(VkDevice device, VkDescriptorPool descriptorPool, con
     SetObjectName(device, (uint64_t)descriptorPool, VK_OBJECT_TYPE_DESCRIPTOR_POOL, name);
 }
 
+void SetDescriptorUpdateTemplateName(VkDevice device, VkDescriptorUpdateTemplate updateTemplate, const char* name)
+{
+    SetObjectName(device, (uint64_t)updateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE, name);
+}
+
 void SetSemaphoreName(VkDevice device, VkSemaphore semaphore, const char* name)
 {
     SetObjectName(device, (uint64_t)semaphore, VK_OBJECT_TYPE_SEMAPHORE, name);
@@ -610,6 +615,12 @@ void SetVulkanObjectName<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(VkD
     SetPipelineCacheName(device, pipeCache, name);
 }
 
+template <>
+void SetVulkanObjectName<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(VkDevice device, VkDescriptorUpdateTemplate updateTemplate, const char* name)
+{
+    SetDescriptorUpdateTemplateName(device, updateTemplate, name);
+}
+
 
 const char* VkResultToString(VkResult errorCode)
 {
@@ -27,11 +27,71 @@
 
 #include "pch.h"
 #include <sstream>
+#include <chrono>
+#include <algorithm>
 #include "VulkanUtilities/VulkanMemoryManager.hpp"
 
 namespace VulkanUtilities
 {
 
+namespace
+{
+
+// Small allocations are served from pages that are smaller than regular pages
+constexpr VkDeviceSize SmallPageSizeDivisor = 4;
+// Allocations that do not exceed PageSize / SmallAllocationSizeDivisor are considered small
+constexpr VkDeviceSize SmallAllocationSizeDivisor = 64;
+// Allocations that exceed PageSize / DedicatedAllocationSizeDivisor get dedicated pages
+constexpr VkDeviceSize DedicatedAllocationSizeDivisor = 2;
+
+const char* GetSizeClassName(VULKAN_MEMORY_SIZE_CLASS SizeClass)
+{
+    static_assert(VULKAN_MEMORY_SIZE_CLASS_COUNT == 3, "Please handle the new size class below");
+    switch (SizeClass)
+    {
+        case VULKAN_MEMORY_SIZE_CLASS_SMALL: return "small";
+        case VULKAN_MEMORY_SIZE_CLASS_MEDIUM: return "medium";
+        case VULKAN_MEMORY_SIZE_CLASS_DEDICATED: return "dedicated";
+        default:
+            UNEXPECTED("Unexpected size class");
+            return "unknown";
+    }
+}
+
+template <typename T>
+void UpdateAtomicMax(std::atomic<T>& Max, T Value)
+{
+    T CurrMax = Max.load();
+    while (CurrMax < Value && !Max.compare_exchange_weak(CurrMax, Value))
+    {
+    }
+}
+
+struct PageHint
+{
+    const void*       pPool      = nullptr;
+    uint64_t          Generation = 0;
+    VulkanMemoryPage* pPage      = nullptr;
+};
+// Per-thread cache of the pages the thread last allocated from. The cache is direct-mapped
+// by the pool address; a collision simply results in a full scan of the pool.
+thread_local std::array<PageHint, 8> t_PageHints;
+
+PageHint& GetPageHint(const void* pPool)
+{
+    return t_PageHints[Diligent::ComputeHash(pPool) % t_PageHints.size()];
+}
+
+} // namespace
+
+uint64_t VulkanMemoryManager::GeneratePagesGeneration()
+{
+    // The generation is unique across all managers, so a hint that refers to a pool
+    // of a destroyed manager can never match a pool of a new manager at the same address.
+    static std::atomic<uint64_t> NextGeneration{1};
+    return NextGeneration.fetch_add(1);
+}
+
 VulkanMemoryAllocation::~VulkanMemoryAllocation()
 {
     if (Page != nullptr)
@@ -40,13 +100,15 @@ VulkanMemoryAllocation::~VulkanMemoryAllocation()
     }
 }
 
-VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                                   VkDeviceSize          PageSize,
-                                   uint32_t              MemoryTypeIndex,
-                                   bool                  IsHostVisible,
-                                   VkMemoryAllocateFlags AllocateFlags) :
+VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&     ParentMemoryMgr,
+                                   VkDeviceSize             PageSize,
+                                   uint32_t                 MemoryTypeIndex,
+                                   bool                     IsHostVisible,
+                                   VkMemoryAllocateFlags    AllocateFlags,
+                                   VULKAN_MEMORY_SIZE_CLASS SizeClass) :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
+    m_SizeClass      {SizeClass      },
     m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
 // clang-format on
 {
@@ -94,6 +156,7 @@ VulkanMemoryPage::~VulkanMemoryPage()
     }
 
     VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
+    VERIFY(m_MovableAllocations.empty(), "Destroying a page with registered movable allocations");
 }
 
 VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
@@ -118,14 +181,76 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
 
 void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
 {
-    m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
-    VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
-    m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    // The page may be destroyed by another thread as soon as the mutex is released,
+    // so the parent manager must only be accessed through the local reference afterwards.
+    VulkanMemoryManager& ParentMemoryMgr = m_ParentMemoryMgr;
+    const bool           IsHostVisible   = m_CPUMemory != nullptr;
+
+    bool IsEmptyDedicatedPage = false;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
+        VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
+        m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+        if (!m_MovableAllocations.empty() && m_MovableAllocations.erase(Allocation.UnalignedOffset) != 0)
+            ParentMemoryMgr.m_NumMovableAllocations.fetch_add(-1);
+        IsEmptyDedicatedPage = m_SizeClass == VULKAN_MEMORY_SIZE_CLASS_DEDICATED && m_AllocationMgr.IsEmpty();
+    }
+    ParentMemoryMgr.OnFreeAllocation(Allocation.Size, IsHostVisible, IsEmptyDedicatedPage);
     Allocation = VulkanMemoryAllocation{};
 }
 
+VulkanMemoryPage::UsageInfo VulkanMemoryPage::GetUsageInfo()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    UsageInfo Info;
+    Info.UsedSize         = m_AllocationMgr.GetUsedSize();
+    Info.FreeSize         = m_AllocationMgr.GetFreeSize();
+    Info.MaxFreeBlockSize = m_AllocationMgr.GetMaxFreeBlockSize();
+    Info.NumFreeBlocks    = m_AllocationMgr.GetNumFreeBlocks();
+    return Info;
+}
+
+void VulkanMemoryPage::SetAllocationMover(const VulkanMemoryAllocation&         Allocation,
+                                          VkDeviceSize                          Size,
+                                          VkDeviceSize                          Alignment,
+                                          std::weak_ptr<IMemoryAllocationMover> wpMover)
+{
+    VERIFY_EXPR(Allocation.Page == this);
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    auto& Movable = m_MovableAllocations[Allocation.UnalignedOffset];
+    if (Movable.Size == 0)
+        m_ParentMemoryMgr.m_NumMovableAllocations.fetch_add(1);
+    Movable.UnalignedOffset = Allocation.UnalignedOffset;
+    Movable.Size            = Size;
+    Movable.Alignment       = Alignment;
+    Movable.wpMover         = std::move(wpMover);
+}
+
+void VulkanMemoryPage::GetMovableAllocations(std::vector<MovableAllocation>& Allocations)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    for (const auto& it : m_MovableAllocations)
+        Allocations.push_back(it.second);
+}
+
+bool VulkanMemoryPage::RemoveAllocationMover(VkDeviceSize UnalignedOffset, const IMemoryAllocationMover* pMover)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    auto it = m_MovableAllocations.find(UnalignedOffset);
+    // The allocation may have been released and the space reused by another movable allocation
+    if (it == m_MovableAllocations.end() || it->second.wpMover.lock().get() != pMover)
+        return false;
+
+    m_MovableAllocations.erase(it);
+    m_ParentMemoryMgr.m_NumMovableAllocations.fetch_add(-1);
+    return true;
+}
+
 VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
 {
     // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
@@ -158,8 +283,57 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements&
     return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
 }
 
+VULKAN_MEMORY_SIZE_CLASS VulkanMemoryManager::GetSizeClass(VkDeviceSize Size, bool IsHostVisible) const
+{
+    const VkDeviceSize PageSize = IsHostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+    if (Size <= PageSize / SmallAllocationSizeDivisor)
+        return VULKAN_MEMORY_SIZE_CLASS_SMALL;
+    else if (Size <= PageSize / DedicatedAllocationSizeDivisor)
+        return VULKAN_MEMORY_SIZE_CLASS_MEDIUM;
+    else
+        return VULKAN_MEMORY_SIZE_CLASS_DEDICATED;
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::AllocateFromPool(PagePool& Pool, VkDeviceSize Size, VkDeviceSize Alignment)
+{
+    // m_PagesMtx must be locked by the caller, so the generation can't change
+    const uint64_t Generation = m_PagesGeneration.load();
+
+    // Try the page this thread allocated from last time first. This way, threads that allocate
+    // concurrently tend to use different pages and do not contend for the page mutexes.
+    PageHint&         Hint      = GetPageHint(&Pool);
+    VulkanMemoryPage* pHintPage = nullptr;
+    if (Hint.pPool == &Pool && Hint.Generation == Generation)
+    {
+        pHintPage = Hint.pPage;
+
+        VulkanMemoryAllocation Allocation = pHintPage->Allocate(Size, Alignment);
+        if (Allocation.IsValid())
+            return Allocation;
+    }
+
+    for (auto& pPage : Pool.Pages)
+    {
+        if (pPage.get() == pHintPage)
+            continue;
+
+        VulkanMemoryAllocation Allocation = pPage->Allocate(Size, Alignment);
+        if (Allocation.IsValid())
+        {
+            Hint = PageHint{&Pool, Generation, pPage.get()};
+            return Allocation;
+        }
+    }
+
+    return VulkanMemoryAllocation{};
+}
+
 VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
 {
+#ifdef DILIGENT_DEVELOPMENT
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+#endif
+
     VulkanMemoryAllocation Allocation;
 
     // On integrated GPUs, there is no difference between host-visible and GPU-only
@@ -169,34 +343,48 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    const VULKAN_MEMORY_SIZE_CLASS SizeClass = GetSizeClass(Size, HostVisible);
+    MemoryPageIndex                PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass};
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    // Dedicated pages are never shared
+    if (SizeClass != VULKAN_MEMORY_SIZE_CLASS_DEDICATED)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
+        std::shared_lock<std::shared_timed_mutex> Lock{m_PagesMtx};
+
+        auto pool_it = m_Pools.find(PageIdx);
+        if (pool_it != m_Pools.end())
+            Allocation = AllocateFromPool(pool_it->second, Size, Alignment);
     }
 
     size_t stat_ind = HostVisible ? 1 : 0;
     if (Allocation.Page == nullptr)
     {
-        auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
+        VkDeviceSize PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+        if (SizeClass == VULKAN_MEMORY_SIZE_CLASS_SMALL)
+            PageSize /= SmallPageSizeDivisor;
+        else if (SizeClass == VULKAN_MEMORY_SIZE_CLASS_DEDICATED)
+            PageSize = Diligent::AlignUp(Size, Alignment);
+
+        // Allocating device memory may take a long time, so create the page without holding
+        // the lock to let other threads allocate from the existing pages meanwhile.
+        auto pNewPage = std::make_unique<VulkanMemoryPage>(*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass);
+        Allocation    = pNewPage->Allocate(Size, Alignment);
+        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+
+        std::lock_guard<std::shared_timed_mutex> Lock{m_PagesMtx};
 
         m_CurrAllocatedSize[stat_ind] += PageSize;
         m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
 
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
+        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible " : "device-local "),
+                         GetSizeClassName(SizeClass), " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
                          "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
-        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+        OnNewPageCreated(*pNewPage);
+
+        PagePool& Pool = m_Pools.emplace(PageIdx, PagePool{}).first->second;
+        if (SizeClass != VULKAN_MEMORY_SIZE_CLASS_DEDICATED)
+            GetPageHint(&Pool) = PageHint{&Pool, m_PagesGeneration.load(), pNewPage.get()};
+        Pool.Pages.emplace_back(std::move(pNewPage));
     }
 
     if (Allocation.Page != nullptr)
@@ -204,43 +392,204 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
         VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
     }
 
-    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
-    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+    OnNewAllocation(Allocation.Size, HostVisible);
+
+    AllocationStats& Stats = m_AllocationStats[SizeClass];
+    Stats.NumAllocations.fetch_add(1);
+#ifdef DILIGENT_DEVELOPMENT
+    const uint64_t AllocationTime = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - StartTime).count());
+    Stats.TotalTime.fetch_add(AllocationTime);
+    UpdateAtomicMax(Stats.MaxTime, AllocationTime);
+#endif
 
     return Allocation;
 }
 
 void VulkanMemoryManager::ShrinkMemory()
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+    std::lock_guard<std::shared_timed_mutex> Lock{m_PagesMtx};
+
+    // Empty dedicated pages are always released as they can't be reused by other allocations
+    const bool HasEmptyDedicatedPages = m_HasEmptyDedicatedPages.exchange(false);
+    if (!HasEmptyDedicatedPages && m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
         return;
 
-    auto it = m_Pages.begin();
-    while (it != m_Pages.end())
+    bool PagesDestroyed = false;
+    for (auto& pool_it : m_Pools)
     {
-        auto curr_it = it;
-        ++it;
-        auto& Page          = curr_it->second;
-        bool  IsHostVisible = Page.GetCPUMemory() != nullptr;
-        auto  ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        const bool IsHostVisible = pool_it.first.IsHostVisible;
+        const bool IsDedicated   = pool_it.first.SizeClass == VULKAN_MEMORY_SIZE_CLASS_DEDICATED;
+        const auto stat_ind      = IsHostVisible ? 1 : 0;
+        const auto ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+
+        auto& Pages = pool_it.second.Pages;
+        for (auto page_it = Pages.begin(); page_it != Pages.end();)
         {
-            auto PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            auto& Page = **page_it;
+            if (Page.IsEmpty() && (IsDedicated || m_CurrAllocatedSize[stat_ind] > ReserveSize))
+            {
+                auto PageSize = Page.GetPageSize();
+                m_CurrAllocatedSize[stat_ind] -= PageSize;
+                LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible " : "device-local "),
+                                 GetSizeClassName(pool_it.first.SizeClass), " page (", Diligent::FormatMemorySize(PageSize, 2),
+                                 "). Current allocated size: ",
+                                 Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
+                OnPageDestroy(Page);
+                page_it        = Pages.erase(page_it);
+                PagesDestroyed = true;
+            }
+            else
+            {
+                ++page_it;
+            }
         }
     }
+
+    // Invalidate the pages cached by the threads
+    if (PagesDestroyed)
+        m_PagesGeneration.store(GeneratePagesGeneration());
+}
+
+void VulkanMemoryManager::OnNewAllocation(VkDeviceSize Size, bool IsHostVisible)
+{
+    const size_t  stat_ind     = IsHostVisible ? 1 : 0;
+    const int64_t CurrUsedSize = m_CurrUsedSize[stat_ind].fetch_add(static_cast<int64_t>(Size)) + static_cast<int64_t>(Size);
+    UpdateAtomicMax(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(CurrUsedSize));
 }
 
-void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
+void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible, bool IsEmptyDedicatedPage)
 {
     m_CurrUsedSize[IsHostVisible ? 1 : 0].fetch_add(-static_cast<int64_t>(Size));
+    if (IsEmptyDedicatedPage)
+        m_HasEmptyDedicatedPages.store(true);
+}
+
+VulkanMemoryManagerStats VulkanMemoryManager::GetStats()
+{
+    VulkanMemoryManagerStats Stats;
+
+    std::array<VkDeviceSize, VULKAN_MEMORY_SIZE_CLASS_COUNT> TotalMaxFreeBlockSize = {};
+    {
+        std::shared_lock<std::shared_timed_mutex> Lock{m_PagesMtx};
+        for (const auto& pool_it : m_Pools)
+        {
+            const VULKAN_MEMORY_SIZE_CLASS SizeClass  = pool_it.first.SizeClass;
+            auto&                          ClassStats = Stats.SizeClasses[SizeClass];
+            for (const auto& pPage : pool_it.second.Pages)
+            {
+                const VulkanMemoryPage::UsageInfo Usage = pPage->GetUsageInfo();
+
+                ClassStats.PageCount += 1;
+                ClassStats.AllocatedSize += pPage->GetPageSize();
+                ClassStats.UsedSize += Usage.UsedSize;
+                ClassStats.FreeSize += Usage.FreeSize;
+                ClassStats.MaxFreeBlockSize = std::max(ClassStats.MaxFreeBlockSize, Usage.MaxFreeBlockSize);
+                ClassStats.NumFreeBlocks += Usage.NumFreeBlocks;
+                TotalMaxFreeBlockSize[SizeClass] += Usage.MaxFreeBlockSize;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < Stats.SizeClasses.size(); ++i)
+    {
+        auto& ClassStats = Stats.SizeClasses[i];
+        if (ClassStats.FreeSize > 0)
+            ClassStats.Fragmentation = 1.f - static_cast<float>(static_cast<double>(TotalMaxFreeBlockSize[i]) / static_cast<double>(ClassStats.FreeSize));
+
+        ClassStats.NumAllocations      = m_AllocationStats[i].NumAllocations.load();
+        ClassStats.TotalAllocationTime = m_AllocationStats[i].TotalTime.load();
+        ClassStats.MaxAllocationTime   = m_AllocationStats[i].MaxTime.load();
+    }
+
+    return Stats;
+}
+
+void VulkanMemoryManager::SetAllocationMover(const VulkanMemoryAllocation& Allocation, VkDeviceSize Size, VkDeviceSize Alignment, std::weak_ptr<IMemoryAllocationMover> wpMover)
+{
+    DEV_CHECK_ERR(Allocation.IsValid(), "Allocation must not be empty");
+    DEV_CHECK_ERR(Size > 0 && Size <= Allocation.Size, "Size (", Size, ") must be in the range [1, ", Allocation.Size, "]");
+
+    // Dedicated pages hold a single allocation each, so moving it would not reduce fragmentation
+    if (Allocation.Page->GetSizeClass() == VULKAN_MEMORY_SIZE_CLASS_DEDICATED)
+        return;
+
+    Allocation.Page->SetAllocationMover(Allocation, Size, Alignment, std::move(wpMover));
+}
+
+std::vector<VulkanMemoryManager::DefragmentationMove> VulkanMemoryManager::GetDefragmentationMoves(VkDeviceSize MaxBytesToMove, float MaxPageUtilization)
+{
+    std::vector<DefragmentationMove> Moves;
+    if (MaxBytesToMove == 0 || m_NumMovableAllocations.load() == 0)
+        return Moves;
+
+    std::vector<std::pair<VkDeviceSize, VulkanMemoryPage*>> SortedPages;
+    std::vector<VulkanMemoryPage::MovableAllocation>        Movables;
+
+    VkDeviceSize BytesToMove = 0;
+
+    std::shared_lock<std::shared_timed_mutex> Lock{m_PagesMtx};
+    for (auto& pool_it : m_Pools)
+    {
+        if (BytesToMove >= MaxBytesToMove)
+            break;
+
+        if (pool_it.first.SizeClass == VULKAN_MEMORY_SIZE_CLASS_DEDICATED)
+            continue;
+
+        const auto& Pages = pool_it.second.Pages;
+        if (Pages.size() < 2)
+            continue;
+
+        SortedPages.clear();
+        for (const auto& pPage : Pages)
+            SortedPages.emplace_back(pPage->GetUsageInfo().UsedSize, pPage.get());
+        std::sort(SortedPages.begin(), SortedPages.end(),
+                  [](const std::pair<VkDeviceSize, VulkanMemoryPage*>& lhs, const std::pair<VkDeviceSize, VulkanMemoryPage*>& rhs) {
+                      return lhs.first < rhs.first;
+                  });
+
+        // Move allocations out of the least used pages into the most used ones so that
+        // the former become empty and can be released.
+        for (size_t SrcIdx = 0; SrcIdx + 1 < SortedPages.size() && BytesToMove < MaxBytesToMove; ++SrcIdx)
+        {
+            VulkanMemoryPage*  pSrcPage = SortedPages[SrcIdx].second;
+            const VkDeviceSize UsedSize = SortedPages[SrcIdx].first;
+            if (static_cast<double>(UsedSize) > MaxPageUtilization * static_cast<double>(pSrcPage->GetPageSize()))
+                break;
+
+            Movables.clear();
+            pSrcPage->GetMovableAllocations(Movables);
+            for (auto& Movable : Movables)
+            {
+                if (BytesToMove + Movable.Size > MaxBytesToMove)
+                    continue;
+
+                std::shared_ptr<IMemoryAllocationMover> pMover = Movable.wpMover.lock();
+                if (!pMover)
+                {
+                    pSrcPage->RemoveAllocationMover(Movable.UnalignedOffset, nullptr);
+                    continue;
+                }
+
+                VulkanMemoryAllocation NewAllocation;
+                for (size_t DstIdx = SortedPages.size() - 1; DstIdx > SrcIdx && !NewAllocation; --DstIdx)
+                    NewAllocation = SortedPages[DstIdx].second->Allocate(Movable.Size, Movable.Alignment);
+                if (!NewAllocation)
+                    continue;
+                OnNewAllocation(NewAllocation.Size, pool_it.first.IsHostVisible);
+
+                // The allocation may have been released concurrently, in which case the new allocation is freed.
+                if (!pSrcPage->RemoveAllocationMover(Movable.UnalignedOffset, pMover.get()))
+                    continue;
+
+                BytesToMove += Movable.Size;
+                Moves.push_back(DefragmentationMove{std::move(pMover), std::move(NewAllocation)});
+            }
+        }
+    }
+
+    return Moves;
 }
 
 VulkanMemoryManager::~VulkanMemoryManager()
@@ -249,16 +598,36 @@ VulkanMemoryManager::~VulkanMemoryManager()
     auto PeakHostVisiblePages = m_PeakAllocatedSize[1] / m_HostVisiblePageSize;
     LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "' stats:\n"
                                                          "                       Peak used/allocated device-local memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[0], 2, m_PeakAllocatedSize[0]), " / ",
+                     Diligent::FormatMemorySize(m_PeakUsedSize[0].load(), 2, m_PeakAllocatedSize[0]), " / ",
                      Diligent::FormatMemorySize(m_PeakAllocatedSize[0], 2, m_PeakAllocatedSize[0]),
                      " (", PeakDeviceLocalPages, (PeakDeviceLocalPages == 1 ? " page)" : " pages)"),
                      "\n                       Peak used/allocated host-visible memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[1], 2, m_PeakAllocatedSize[1]), " / ",
+                     Diligent::FormatMemorySize(m_PeakUsedSize[1].load(), 2, m_PeakAllocatedSize[1]), " / ",
                      Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
                      " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"));
 
-    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
-        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    const VulkanMemoryManagerStats Stats = GetStats();
+    std::stringstream              ss;
+    for (uint32_t i = 0; i < VULKAN_MEMORY_SIZE_CLASS_COUNT; ++i)
+    {
+        const auto& ClassStats = Stats.SizeClasses[i];
+        if (ClassStats.NumAllocations == 0)
+            continue;
+
+        ss << "\n                       " << GetSizeClassName(static_cast<VULKAN_MEMORY_SIZE_CLASS>(i)) << " allocations: " << ClassStats.NumAllocations;
+#ifdef DILIGENT_DEVELOPMENT
+        ss << ", average/max latency: " << ClassStats.TotalAllocationTime / ClassStats.NumAllocations / 1000
+           << " / " << ClassStats.MaxAllocationTime / 1000 << " us";
+#endif
+    }
+    if (ss.tellp() > 0)
+        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "' allocation stats:", ss.str());
+
+    for (const auto& pool_it : m_Pools)
+    {
+        for (const auto& pPage : pool_it.second.Pages)
+            VERIFY(pPage->IsEmpty(), "The page contains outstanding allocations");
+    }
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
@@ -29,6 +29,9 @@
 /// \file
 /// Definition of the Diligent::ReloadableShader class
 
+#include <string>
+#include <vector>
+
 #include "Shader.h"
 #include "ShaderBase.hpp"
 
@@ -109,12 +112,23 @@ public:
                        const ShaderCreateInfo& CreateInfo,
                        IShader**               ppReloadableShader);
 
+    /// Re-creates the internal shader object.
+
+    /// \return    true if the shader was not found in the cache and had to be compiled.
     bool Reload();
 
+    /// Returns the internal shader object.
+    IShader* GetShader() const { return m_pShader; }
+
+    /// Returns the paths of the source files the shader was created from,
+    /// including all files it includes directly or indirectly.
+    const std::vector<std::string>& GetDependencies() const { return m_Dependencies; }
+
 private:
     RefCntAutoPtr<RenderStateCacheImpl> m_pStateCache;
     RefCntAutoPtr<IShader>              m_pShader;
     ShaderCreateInfoWrapper             m_CreateInfo;
+    std::vector<std::string>            m_Dependencies;
 };
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 
 #include <unordered_map>
 #include <mutex>
+#include <memory>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -38,6 +39,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "FileWatcher.hpp"
 
 namespace Diligent
 {
@@ -156,6 +158,9 @@ private:
     std::mutex                                                          m_ReloadablePipelinesMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
 
+    // Watches shader source directories to only reload the affected render states
+    std::unique_ptr<FileWatcher> m_pFileWatcher;
+
     Uint32 m_ReloadVersion = 0;
 };
 
@@ -35,6 +35,22 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct BytecodeCacheCreateInfo
 {
     enum RENDER_DEVICE_TYPE DeviceType DEFAULT_INITIALIZER(RENDER_DEVICE_TYPE_UNDEFINED);
+
+    /// Path to the file that persistently stores the cache.
+
+    /// If null, the cache is kept in memory. Otherwise, the byte code is stored
+    /// in the file, and the index of the entries is stored in the file with
+    /// the same name and the .idx extension appended. When the cache is created,
+    /// only the index is read, while the byte code is memory-mapped and copied
+    /// to a data blob when requested. New entries are appended to the file
+    /// immediately and are not kept in memory. Only one cache object may use the file at a time.
+    const Char* FilePath DEFAULT_INITIALIZER(nullptr);
+
+    /// The maximum total size of the byte code in the cache, in bytes.
+
+    /// When the size is exceeded, the least recently used entries are evicted.
+    /// Zero means no limit.
+    Uint64 MaxSize DEFAULT_INITIALIZER(0);
 };
 typedef struct BytecodeCacheCreateInfo BytecodeCacheCreateInfo;
 
@@ -53,6 +69,9 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_BytecodeCache = {0xD1F8295F, 0xF9D7,
 // clang-format off
 
 /// Byte code cache interface
+
+/// All methods of the interface are thread-safe, so that the cache may be used
+/// by multiple shader compilation threads simultaneously.
 DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 {
     /// Loads the cache data from the binary blob
@@ -80,6 +99,9 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
     ///
     /// \remarks    If the byte code for the given shader create parameters is already present
     ///             in the cache, it is replaced.
+    ///
+    ///             In Vulkan, store the byte code returned by IShaderVk::GetBytecodeWithReflection()
+    ///             so that shaders created from the cached byte code don't need to reflect SPIRV.
     VIRTUAL void METHOD(AddBytecode)(THIS_ 
                                      const ShaderCreateInfo REF ShaderCI,
                                      IDataBlob*                 pByteCode) PURE;
@@ -103,6 +125,8 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 
 
     /// Clears the cache and resets it to default state.
+
+    /// \remarks    If the cache is stored in a file, the file is cleared as well.
     VIRTUAL void METHOD(Clear)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
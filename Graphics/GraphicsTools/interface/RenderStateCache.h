@@ -76,6 +76,17 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Optional semicolon-separated list of directories to watch for shader source changes
+    /// when hot reload is enabled, e.g. "shaders;shaders/common".
+    ///
+    /// \remarks   If the directories are watched, IRenderStateCache::Reload only recompiles
+    ///             the shaders whose source file or any of the files it includes has changed
+    ///             since the previous reload, and only re-creates the pipelines that use these
+    ///             shaders. Otherwise, all shaders and pipelines are reloaded.
+    ///
+    ///             File watching is currently only supported on Linux.
+    const Char* WatchDirectories DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -85,12 +96,14 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_LOG_LEVEL     _LogLevel          = RenderStateCacheCreateInfo{}.LogLevel,
         bool                             _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                             _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        const Char*                      _WatchDirectories  = RenderStateCacheCreateInfo{}.WatchDirectories) noexcept :
         pDevice{_pDevice},
         LogLevel{_LogLevel},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        WatchDirectories{_WatchDirectories}
     {}
 #endif
 };
@@ -243,6 +256,9 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///
     /// \remars     Reloading is only enabled if the cache was created with the EnableHotReload member of
     ///             RenderStateCacheCreateInfo member set to true.
+    ///
+    ///             If RenderStateCacheCreateInfo::WatchDirectories is set, only the render states affected
+    ///             by the changed files are reloaded, and ReloadGraphicsPipeline is only called for them.
     VIRTUAL Uint32 METHOD(Reload)(THIS_
                                   ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline DEFAULT_VALUE(nullptr), 
                                   void*                              pUserData              DEFAULT_VALUE(nullptr)) PURE;
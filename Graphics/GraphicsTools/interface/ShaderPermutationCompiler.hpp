@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderPermutationCompiler class
+
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "ShaderMacroHelper.hpp"
+
+namespace Diligent
+{
+
+/// Compiles multiple variants of a shader that differ only in macro definitions.
+
+/// The compiler loads the shader files once and compiles all variants from memory. If no
+/// #include directive is inside a conditional block, all variants are compiled from the same
+/// unrolled source. Macros whose names do not appear in the source are ignored, and
+/// variants that only differ in such macros share the same shader object. The remaining
+/// variants are created with the SHADER_COMPILE_FLAG_ASYNCHRONOUS flag, so that they are
+/// compiled in parallel when the device supports the AsyncShaderCompilation feature.
+class ShaderPermutationCompiler
+{
+public:
+    /// Macro matrix dimension: the macro name and all values it may take.
+    struct MacroDimension
+    {
+        std::string              Name;
+        std::vector<std::string> Values;
+    };
+
+    struct VariantInfo
+    {
+        /// Compiled shader. Null if the compilation failed.
+        /// Variants with identical preprocessed source share the same object.
+        RefCntAutoPtr<IShader> pShader;
+
+        /// Index of the variant that was actually compiled for this one.
+        Uint32 CompiledVariant = 0;
+
+        /// Returns the shader byte code. For OpenGL, this is the full GLSL source.
+        /// The pointer remains valid while the shader object is alive.
+        const void* GetBytecode(Uint64& Size) const;
+    };
+
+    struct Statistics
+    {
+        /// The total number of variants.
+        Uint32 NumVariants = 0;
+
+        /// The number of variants that were compiled after removing duplicates.
+        Uint32 NumCompiled = 0;
+
+        /// The number of variants that failed to compile.
+        Uint32 NumFailed = 0;
+
+        /// Whether the include files were unrolled once and shared by all variants.
+        /// False if any #include directive is inside a conditional block, see HasConditionalIncludes().
+        bool SharedSource = false;
+
+        /// Time spent unrolling includes and analyzing the source, in seconds.
+        double PreprocessTime = 0;
+
+        /// Time spent compiling the variants, in seconds.
+        double CompileTime = 0;
+    };
+
+    explicit ShaderPermutationCompiler(IRenderDevice* pDevice);
+
+    /// Compiles the shader variants.
+
+    /// \param [in]  ShaderCI     - Base shader create info. Its macros are added to every variant.
+    /// \param [in]  Permutations - Per-variant macros.
+    /// \param [out] pStats       - Optional compilation statistics.
+    /// \return      Variant information, one element per permutation.
+    std::vector<VariantInfo> Compile(const ShaderCreateInfo&               ShaderCI,
+                                     const std::vector<ShaderMacroHelper>& Permutations,
+                                     Statistics*                           pStats = nullptr);
+
+    /// Expands the macro matrix into the list of all macro combinations.
+    static std::vector<ShaderMacroHelper> ExpandMacroMatrix(const std::vector<MacroDimension>& Matrix);
+
+    /// Returns the names of the macros that are referenced by the source as identifiers,
+    /// directly or through the definitions of other referenced macros.
+    /// Comments and string constants are ignored. Macros may contain several definitions
+    /// of the same name, in which case all of them are followed.
+    static std::vector<std::string> FindReferencedMacros(const char* Source, size_t SourceLength, const ShaderMacroArray& Macros);
+
+    /// Returns true if any #include directive in the source is inside an #if, #ifdef or #ifndef block.
+    /// The include guard that encloses the whole file is not taken into account.
+    /// If the source can't be parsed, the function conservatively returns true.
+    static bool HasConditionalIncludes(const char* Source, size_t SourceLength);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+};
+
+} // namespace Diligent
@@ -47,6 +47,11 @@ struct XXH128Hash
     {
         return LowPart == RHS.LowPart && HighPart == RHS.HighPart;
     }
+
+    constexpr bool operator!=(const XXH128Hash& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
 };
 
 struct XXH128State final
@@ -121,6 +126,9 @@ struct XXH128State final
         Update(Args...);
     }
 
+    /// Hashes the shader create info, including the contents of the source file and all
+    /// files it includes. Content hashes of the files read through the source stream factory
+    /// are cached, see Diligent::InvalidateShaderSourceHashCache().
     void Update(const ShaderCreateInfo& ShaderCI) noexcept;
 
     template <typename T>
@@ -170,6 +178,45 @@ private:
     XXH3_state_s* m_State = nullptr;
 };
 
+
+/// Statistics of the shader source hash cache used by XXH128State::Update(const ShaderCreateInfo&).
+struct ShaderSourceHashCacheStatistics
+{
+    /// The number of source files that were read through the source stream factories.
+    Uint64 NumFilesRead = 0;
+
+    /// The total size of the source files that were read, in bytes.
+    Uint64 BytesRead = 0;
+
+    /// The number of source file lookups that were served from the cache.
+    Uint64 NumCacheHits = 0;
+
+    /// The total size of the source files that did not have to be read again, in bytes.
+    Uint64 BytesSaved = 0;
+};
+
+/// Invalidates the content hashes of all shader source files cached by XXH128State::Update(const ShaderCreateInfo&).
+
+/// The cache identifies files by the source stream factory and the file path and assumes that
+/// the file contents do not change while the factory is alive. The application must call this
+/// function after the shader source files have been modified (e.g. before reloading the shaders).
+void InvalidateShaderSourceHashCache();
+
+/// Returns the statistics of the shader source hash cache.
+ShaderSourceHashCacheStatistics GetShaderSourceHashCacheStatistics();
+
+/// Collects the paths of all source files the shader depends on.
+
+/// \param [in]  ShaderCI     - Shader create info.
+/// \param [out] Dependencies - The shader source file (if ShaderCI.FilePath is not null) followed by
+///                              all files it includes directly or indirectly. Paths are the names
+///                              passed to the source stream factory.
+/// \return      true if all includes have been processed successfully, and false otherwise.
+///
+/// \remarks     Files are looked up in the shader source hash cache, so files that have been
+///              hashed by XXH128State::Update(const ShaderCreateInfo&) are not read again.
+bool GetShaderSourceDependencies(const ShaderCreateInfo& ShaderCI, std::vector<std::string>& Dependencies);
+
 } // namespace Diligent
 
 namespace std
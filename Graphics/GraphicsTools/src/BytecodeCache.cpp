@@ -25,6 +25,13 @@
  */
 
 #include <unordered_map>
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstring>
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
@@ -33,6 +40,9 @@
 #include "BytecodeCache.h"
 #include "XXH128Hasher.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
+#include "MappedFile.hpp"
 
 namespace Diligent
 {
@@ -72,12 +82,55 @@ public:
         }
     };
 
+    // Header of the byte code and index files of the disk-backed cache.
+    // The files are created together and share the same id.
+    struct FileHeader
+    {
+        static constexpr Uint32 DataMagic   = 0x7ADEDA7A;
+        static constexpr Uint32 IndexMagic  = 0x7ADE1DE8;
+        static constexpr Uint32 CurrVersion = 1;
+
+        Uint32 Magic      = 0;
+        Uint32 Version    = CurrVersion;
+        Uint32 DeviceType = 0;
+        Uint32 Reserved   = 0;
+        Uint64 FileId     = 0;
+    };
+    static_assert(sizeof(FileHeader) == 24, "Unexpected file header size");
+
+    // The index file is a sequence of records that are appended every time
+    // an entry is added or removed. Later records override earlier ones.
+    struct IndexRecord
+    {
+        static constexpr Uint64 RemovedEntrySize = ~Uint64{0};
+
+        Uint64 HashLow  = 0;
+        Uint64 HashHigh = 0;
+        Uint64 Offset   = 0; // Offset of the byte code in the data file
+        Uint64 Size     = 0; // Byte code size, or RemovedEntrySize
+    };
+    static_assert(sizeof(IndexRecord) == 32, "Unexpected index record size");
+
 public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
         TBase{pRefCounters},
-        m_DeviceType{CreateInfo.DeviceType}
+        m_DeviceType{CreateInfo.DeviceType},
+        m_MaxSize{CreateInfo.MaxSize}
     {
+        if (CreateInfo.FilePath != nullptr && CreateInfo.FilePath[0] != '\0')
+        {
+            if (MappedFile::IsSupported())
+            {
+                m_DataFilePath  = CreateInfo.FilePath;
+                m_IndexFilePath = m_DataFilePath + ".idx";
+                OpenFiles();
+            }
+            else
+            {
+                LOG_WARNING_MESSAGE("Memory-mapped files are not supported on this platform. Bytecode cache will be kept in memory.");
+            }
+        }
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BytecodeCache, TBase);
@@ -106,6 +159,7 @@ public:
             return false;
         }
 
+        std::lock_guard<std::mutex> Lock{m_Mtx};
         for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
         {
             BytecodeCacheElementHeader ElementHeader;
@@ -113,7 +167,7 @@ public:
 
             auto pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
             Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
-            m_HashMap.emplace(ElementHeader.Hash, pBytecode);
+            AddEntry(ElementHeader.Hash, pBytecode);
         }
 
         return true;
@@ -124,11 +178,15 @@ public:
         DEV_CHECK_ERR(ppByteCode != nullptr, "ppByteCode must not be null.");
         DEV_CHECK_ERR(*ppByteCode == nullptr, "*ppByteCode is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
         const auto Hash = ComputeHash(ShaderCI);
-        const auto Iter = m_HashMap.find(Hash);
-        if (Iter != m_HashMap.end())
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        const auto Iter = m_Entries.find(Hash);
+        if (Iter != m_Entries.end())
         {
-            auto pObject = Iter->second;
-            *ppByteCode  = pObject.Detach();
+            Entry& Item = Iter->second;
+            m_LRUList.splice(m_LRUList.begin(), m_LRUList, Item.LRUIter);
+            *ppByteCode = GetEntryData(Item).Detach();
         }
     }
 
@@ -136,15 +194,20 @@ public:
     {
         DEV_CHECK_ERR(pByteCode != nullptr, "pByteCode must not be null.");
         const auto Hash = ComputeHash(ShaderCI);
-        const auto Iter = m_HashMap.emplace(Hash, pByteCode);
-        if (!Iter.second)
-            Iter.first->second = pByteCode;
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        AddEntry(Hash, pByteCode);
     }
 
     virtual void DILIGENT_CALL_TYPE RemoveBytecode(const ShaderCreateInfo& ShaderCI) override final
     {
         const auto Hash = ComputeHash(ShaderCI);
-        m_HashMap.erase(Hash);
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        const auto Iter = m_Entries.find(Hash);
+        if (Iter != m_Entries.end())
+            RemoveEntry(Iter);
     }
 
     virtual void DILIGENT_CALL_TYPE Store(IDataBlob** ppDataBlob) override final
@@ -152,22 +215,26 @@ public:
         DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
         DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
 
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
         auto WriteData = [&](auto& Stream) //
         {
             BytecodeCacheHeader Header{};
-            Header.ElementCount = m_HashMap.size();
+            Header.ElementCount = m_Entries.size();
             Header.Serialize(Stream);
 
-            for (auto const& Pair : m_HashMap)
+            // Write the entries from the least recently used to the most recently used
+            // so that the order is preserved when the data is loaded.
+            for (auto It = m_LRUList.rbegin(); It != m_LRUList.rend(); ++It)
             {
-                const auto& pBytecode = Pair.second;
+                const Entry& Item = m_Entries.find(*It)->second;
 
                 BytecodeCacheElementHeader ElementHeader;
-                ElementHeader.Hash     = Pair.first;
-                ElementHeader.DataSize = pBytecode->GetSize();
+                ElementHeader.Hash     = *It;
+                ElementHeader.DataSize = static_cast<size_t>(Item.Size);
                 ElementHeader.Serialize(Stream);
 
-                Stream.CopyBytes(pBytecode->GetConstDataPtr(), ElementHeader.DataSize);
+                Stream.CopyBytes(GetEntryDataPtr(Item), ElementHeader.DataSize);
             }
         };
 
@@ -185,10 +252,27 @@ public:
 
     virtual void DILIGENT_CALL_TYPE Clear() override final
     {
-        m_HashMap.clear();
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        ClearEntries();
+        if (!m_DataFilePath.empty())
+            ResetFiles();
     }
 
 private:
+    struct Entry
+    {
+        // Byte code of the entry. Null if the byte code is only stored in the mapped file.
+        RefCntAutoPtr<IDataBlob> pBytecode;
+
+        // Offset of the byte code in the data file
+        Uint64 FileOffset = 0;
+        Uint64 Size       = 0;
+
+        std::list<XXH128Hash>::iterator LRUIter;
+    };
+    using EntryMapType = std::unordered_map<XXH128Hash, Entry>;
+
     XXH128Hash ComputeHash(const ShaderCreateInfo& ShaderCI) const
     {
         XXH128State Hasher;
@@ -196,10 +280,303 @@ private:
         return Hasher.Digest();
     }
 
+    const void* GetEntryDataPtr(const Entry& Item)
+    {
+        if (Item.pBytecode)
+            return Item.pBytecode->GetConstDataPtr();
+
+        if (Item.FileOffset + Item.Size > m_Mapping.GetSize())
+            RemapDataFile();
+
+        VERIFY_EXPR(Item.FileOffset + Item.Size <= m_Mapping.GetSize());
+        return static_cast<const Uint8*>(m_Mapping.GetData()) + Item.FileOffset;
+    }
+
+    RefCntAutoPtr<IDataBlob> GetEntryData(const Entry& Item)
+    {
+        if (Item.pBytecode)
+            return Item.pBytecode;
+
+        // Copy the data from the mapped file, so that the blob remains valid
+        // if the file is cleared or compacted.
+        return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(static_cast<size_t>(Item.Size), GetEntryDataPtr(Item))};
+    }
+
+    // Maps the data file again to make the byte code appended since it was mapped visible
+    void RemapDataFile()
+    {
+        // Repositioning the stream writes out the buffered data
+        if (m_DataFile)
+            m_DataFile->SetPos(0, FilePosOrigin::End);
+
+        m_Mapping.Close();
+        if (!m_Mapping.Open(m_DataFilePath.c_str()))
+            LOG_ERROR_MESSAGE("Failed to map the bytecode cache file '", m_DataFilePath, "'.");
+    }
+
+    // Inserts the entry without writing it to the file
+    Entry& InsertEntry(const XXH128Hash& Hash, Uint64 Size)
+    {
+        auto it = m_Entries.find(Hash);
+        if (it != m_Entries.end())
+        {
+            m_TotalSize -= it->second.Size;
+            m_LRUList.splice(m_LRUList.begin(), m_LRUList, it->second.LRUIter);
+            it->second.pBytecode.Release();
+        }
+        else
+        {
+            m_LRUList.push_front(Hash);
+            it                  = m_Entries.emplace(Hash, Entry{}).first;
+            it->second.LRUIter = m_LRUList.begin();
+        }
+        it->second.Size = Size;
+        m_TotalSize += Size;
+        return it->second;
+    }
+
+    void AddEntry(const XXH128Hash& Hash, IDataBlob* pBytecode)
+    {
+        const Uint64 Size = pBytecode->GetSize();
+
+        Entry& Item    = InsertEntry(Hash, Size);
+        Item.pBytecode = pBytecode;
+
+        if (!m_DataFilePath.empty())
+        {
+            if (m_DataFile && m_IndexFile &&
+                m_DataFile->Write(pBytecode->GetConstDataPtr(), static_cast<size_t>(Size)))
+            {
+                Item.FileOffset = m_DataFileSize;
+                m_DataFileSize += Size;
+                WriteIndexRecord(Hash, Item.FileOffset, Size);
+
+                // The byte code is read back from the mapped file when it is requested
+                Item.pBytecode.Release();
+            }
+            else if (m_DataFile)
+            {
+                // Offsets of the subsequent entries can't be trusted after a failed write
+                LOG_ERROR_MESSAGE("Failed to write byte code to the cache file '", m_DataFilePath, "'. New byte code will not be saved.");
+                m_DataFile.Close();
+                m_IndexFile.Close();
+            }
+        }
+
+        EvictEntries();
+    }
+
+    void RemoveEntry(EntryMapType::iterator Iter)
+    {
+        if (!m_DataFilePath.empty())
+            WriteIndexRecord(Iter->first, 0, IndexRecord::RemovedEntrySize);
+
+        m_TotalSize -= Iter->second.Size;
+        m_LRUList.erase(Iter->second.LRUIter);
+        m_Entries.erase(Iter);
+    }
+
+    // Evicts the least recently used entries until the total size fits the budget
+    void EvictEntries()
+    {
+        if (m_MaxSize == 0)
+            return;
+
+        while (m_TotalSize > m_MaxSize && !m_LRUList.empty())
+            RemoveEntry(m_Entries.find(m_LRUList.back()));
+    }
+
+    void WriteIndexRecord(const XXH128Hash& Hash, Uint64 Offset, Uint64 Size)
+    {
+        if (!m_IndexFile)
+            return;
+
+        IndexRecord Record;
+        Record.HashLow  = Hash.LowPart;
+        Record.HashHigh = Hash.HighPart;
+        Record.Offset   = Offset;
+        Record.Size     = Size;
+        if (!m_IndexFile->Write(&Record, sizeof(Record)))
+            LOG_ERROR_MESSAGE("Failed to write the bytecode cache index file '", m_IndexFilePath, "'.");
+    }
+
+    // Reads the index and maps the data file
+    bool ReadIndex()
+    {
+        if (!FileSystem::FileExists(m_IndexFilePath.c_str()) || !FileSystem::FileExists(m_DataFilePath.c_str()))
+            return false;
+
+        std::vector<Uint8> IndexData;
+        if (!FileWrapper::ReadWholeFile(m_IndexFilePath.c_str(), IndexData, /*Silent = */ true) || IndexData.size() < sizeof(FileHeader))
+            return false;
+
+        if (!m_Mapping.Open(m_DataFilePath.c_str()) || m_Mapping.GetSize() < sizeof(FileHeader))
+            return false;
+
+        FileHeader IndexHeader;
+        FileHeader DataHeader;
+        memcpy(&IndexHeader, IndexData.data(), sizeof(IndexHeader));
+        memcpy(&DataHeader, m_Mapping.GetData(), sizeof(DataHeader));
+        if (IndexHeader.Magic != FileHeader::IndexMagic ||
+            DataHeader.Magic != FileHeader::DataMagic ||
+            IndexHeader.Version != FileHeader::CurrVersion ||
+            DataHeader.Version != FileHeader::CurrVersion ||
+            IndexHeader.DeviceType != static_cast<Uint32>(m_DeviceType) ||
+            DataHeader.DeviceType != static_cast<Uint32>(m_DeviceType) ||
+            IndexHeader.FileId != DataHeader.FileId)
+        {
+            LOG_WARNING_MESSAGE("Bytecode cache file '", m_DataFilePath, "' is incompatible and will be reset.");
+            return false;
+        }
+
+        // A partially written record at the end of the index is ignored
+        const size_t NumRecords = (IndexData.size() - sizeof(FileHeader)) / sizeof(IndexRecord);
+        for (size_t i = 0; i < NumRecords; ++i)
+        {
+            IndexRecord Record;
+            memcpy(&Record, &IndexData[sizeof(FileHeader) + i * sizeof(IndexRecord)], sizeof(Record));
+
+            XXH128Hash Hash{Record.HashLow, Record.HashHigh};
+            if (Record.Size == IndexRecord::RemovedEntrySize)
+            {
+                const auto Iter = m_Entries.find(Hash);
+                if (Iter != m_Entries.end())
+                {
+                    m_TotalSize -= Iter->second.Size;
+                    m_LRUList.erase(Iter->second.LRUIter);
+                    m_Entries.erase(Iter);
+                }
+            }
+            else if (Record.Offset >= sizeof(FileHeader) &&
+                     Record.Offset <= m_Mapping.GetSize() &&
+                     Record.Size <= m_Mapping.GetSize() - Record.Offset)
+            {
+                Entry& Item     = InsertEntry(Hash, Record.Size);
+                Item.FileOffset = Record.Offset;
+            }
+        }
+        m_DataFileSize = m_Mapping.GetSize();
+
+        return true;
+    }
+
+    // Creates empty data and index files
+    void ResetFiles()
+    {
+        m_DataFile.Close();
+        m_IndexFile.Close();
+        m_Mapping.Close();
+
+        FileHeader DataHeader;
+        DataHeader.Magic      = FileHeader::DataMagic;
+        DataHeader.DeviceType = static_cast<Uint32>(m_DeviceType);
+        DataHeader.FileId     = static_cast<Uint64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+        FileHeader IndexHeader = DataHeader;
+        IndexHeader.Magic      = FileHeader::IndexMagic;
+
+        m_DataFile.Open(FileOpenAttribs{m_DataFilePath.c_str(), EFileAccessMode::Overwrite});
+        m_IndexFile.Open(FileOpenAttribs{m_IndexFilePath.c_str(), EFileAccessMode::Overwrite});
+        if (!m_DataFile || !m_IndexFile ||
+            !m_DataFile->Write(&DataHeader, sizeof(DataHeader)) ||
+            !m_IndexFile->Write(&IndexHeader, sizeof(IndexHeader)))
+        {
+            LOG_ERROR_MESSAGE("Failed to create bytecode cache file '", m_DataFilePath, "'. Byte code will not be saved.");
+            m_DataFile.Close();
+            m_IndexFile.Close();
+        }
+        m_DataFileSize = sizeof(FileHeader);
+    }
+
+    void ClearEntries()
+    {
+        m_Entries.clear();
+        m_LRUList.clear();
+        m_TotalSize = 0;
+    }
+
+    void OpenFiles()
+    {
+        if (!ReadIndex())
+        {
+            ClearEntries();
+            ResetFiles();
+            return;
+        }
+
+        const Uint64 UsedSize = sizeof(FileHeader) + m_TotalSize;
+        if (m_DataFileSize - UsedSize > UsedSize || (m_MaxSize != 0 && m_TotalSize > m_MaxSize))
+        {
+            // Most of the file is occupied by removed entries or the cache exceeds the budget
+            Compact();
+            ClearEntries();
+            if (!ReadIndex())
+            {
+                ClearEntries();
+                ResetFiles();
+                return;
+            }
+        }
+
+        m_DataFile.Open(FileOpenAttribs{m_DataFilePath.c_str(), EFileAccessMode::Append});
+        m_IndexFile.Open(FileOpenAttribs{m_IndexFilePath.c_str(), EFileAccessMode::Append});
+        if (!m_DataFile || !m_IndexFile)
+        {
+            LOG_ERROR_MESSAGE("Failed to open bytecode cache file '", m_DataFilePath, "' for writing. New byte code will not be saved.");
+            m_DataFile.Close();
+            m_IndexFile.Close();
+        }
+    }
+
+    // Rewrites the files keeping only the most recently used entries that fit the budget
+    void Compact()
+    {
+        std::vector<std::pair<XXH128Hash, RefCntAutoPtr<IDataBlob>>> LiveEntries;
+        LiveEntries.reserve(m_Entries.size());
+
+        Uint64 Size = 0;
+        for (const XXH128Hash& Hash : m_LRUList)
+        {
+            const Entry& Item = m_Entries.find(Hash)->second;
+            if (m_MaxSize != 0 && Size + Item.Size > m_MaxSize)
+                break;
+            Size += Item.Size;
+            LiveEntries.emplace_back(Hash, DataBlobImpl::Create(static_cast<size_t>(Item.Size), GetEntryDataPtr(Item)));
+        }
+
+        ClearEntries();
+        ResetFiles();
+
+        // Write the entries from the least recently used to the most recently used
+        for (auto It = LiveEntries.rbegin(); It != LiveEntries.rend(); ++It)
+            AddEntry(It->first, It->second);
+
+        // Flush the files so that they can be mapped
+        m_DataFile.Close();
+        m_IndexFile.Close();
+    }
+
 private:
-    RENDER_DEVICE_TYPE m_DeviceType;
+    const RENDER_DEVICE_TYPE m_DeviceType;
+    const Uint64             m_MaxSize;
+
+    std::mutex m_Mtx;
+
+    EntryMapType m_Entries;
+
+    // Entry hashes from the most recently used to the least recently used
+    std::list<XXH128Hash> m_LRUList;
+
+    // Total size of the byte code of all entries
+    Uint64 m_TotalSize = 0;
 
-    std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
+    // Disk-backed cache
+    std::string m_DataFilePath;
+    std::string m_IndexFilePath;
+    FileWrapper m_DataFile;
+    FileWrapper m_IndexFile;
+    MappedFile  m_Mapping;
+    Uint64      m_DataFileSize = 0;
 };
 
 void CreateBytecodeCache(const BytecodeCacheCreateInfo& CreateInfo,
@@ -26,6 +26,7 @@
 
 #include "ReloadableShader.hpp"
 #include "RenderStateCacheImpl.hpp"
+#include "XXH128Hasher.hpp"
 
 namespace Diligent
 {
@@ -45,6 +46,7 @@ ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
     {
         LOG_ERROR_AND_THROW("Internal shader object must not be null");
     }
+    GetShaderSourceDependencies(m_CreateInfo.Get(), m_Dependencies);
 }
 
 ReloadableShader::~ReloadableShader()
@@ -89,6 +91,8 @@ bool ReloadableShader::Reload()
     if (pNewShader)
     {
         m_pShader = pNewShader;
+        // Includes may have been added or removed
+        GetShaderSourceDependencies(m_CreateInfo.Get(), m_Dependencies);
     }
     else
     {
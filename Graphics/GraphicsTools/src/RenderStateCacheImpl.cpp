@@ -35,6 +35,7 @@
 #include <array>
 #include <mutex>
 #include <vector>
+#include <unordered_set>
 
 #include "Archiver.h"
 #include "Dearchiver.h"
@@ -49,6 +50,8 @@
 #include "GraphicsAccessories.hpp"
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
+#include "ThreadPool.hpp"
+#include "FileSystem.hpp"
 
 namespace Diligent
 {
@@ -228,6 +231,24 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
+
+    if (CreateInfo.EnableHotReload && CreateInfo.WatchDirectories != nullptr)
+    {
+        if (FileWatcher::IsSupported())
+        {
+            m_pFileWatcher = std::make_unique<FileWatcher>();
+            FileSystem::SplitPathList(CreateInfo.WatchDirectories, [this](const char* Path, size_t Len) {
+                m_pFileWatcher->AddDirectory(std::string{Path, Len}.c_str());
+                return true;
+            });
+            if (!m_pFileWatcher->IsWatching())
+                m_pFileWatcher.reset();
+        }
+        else
+        {
+            LOG_INFO_MESSAGE("File watching is not supported on this platform. All render states will be reloaded by IRenderStateCache::Reload().");
+        }
+    }
 }
 
 #define RENDER_STATE_CACHE_LOG(Level, ...)                         \
@@ -887,6 +908,37 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     return false;
 }
 
+// Returns true if the changed file is the shader dependency. Dependencies are paths relative
+// to the source factory search directories, while changed files are paths in the watched directories.
+static bool IsDependency(const std::string& ChangedFile, const std::string& Dependency)
+{
+    if (Dependency.empty() || ChangedFile.length() < Dependency.length())
+        return false;
+
+    const size_t Offset = ChangedFile.length() - Dependency.length();
+    for (size_t i = 0; i < Dependency.length(); ++i)
+    {
+        const char c0 = ChangedFile[Offset + i];
+        const char c1 = Dependency[i];
+        if (c0 != c1 && !(FileSystem::IsSlash(c0) && FileSystem::IsSlash(c1)))
+            return false;
+    }
+    return Offset == 0 || FileSystem::IsSlash(ChangedFile[Offset - 1]);
+}
+
+static bool DependsOnAnyFile(const std::vector<std::string>& Dependencies, const std::vector<std::string>& ChangedFiles)
+{
+    for (const std::string& Dependency : Dependencies)
+    {
+        for (const std::string& ChangedFile : ChangedFiles)
+        {
+            if (IsDependency(ChangedFile, Dependency))
+                return true;
+        }
+    }
+    return false;
+}
+
 Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
 {
     if (!m_CI.EnableHotReload)
@@ -897,7 +949,29 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
 
     Uint32 NumStatesReloaded = 0;
 
-    // Reload all shaders first
+    {
+        const ShaderSourceHashCacheStatistics Stats = GetShaderSourceHashCacheStatistics();
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "shader source hashing read ", Stats.NumFilesRead, " files (", Stats.BytesRead,
+                               " bytes); ", Stats.NumCacheHits, " reads (", Stats.BytesSaved, " bytes) were served from the hash cache.");
+    }
+
+    // When the source directories are watched, only the render states that depend on the changed files are reloaded.
+    // If some file system events have been lost, everything is reloaded.
+    std::vector<std::string> ChangedFiles;
+    const bool               IncrementalReload = m_pFileWatcher && m_pFileWatcher->PollChanges(ChangedFiles);
+    if (IncrementalReload)
+    {
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, ChangedFiles.size(), " shader source file(s) changed since the last reload.");
+        for (const std::string& File : ChangedFiles)
+            RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "    ", File);
+    }
+
+    // Shader source files may have been modified, so their cached hashes must be discarded
+    InvalidateShaderSourceHashCache();
+
+    // Collect the shaders to reload
+    std::vector<RefCntAutoPtr<ReloadableShader>> Shaders;
+    size_t                                       NumShaders = 0;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
         for (auto shader_it : m_ReloadableShaders)
@@ -907,8 +981,9 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
                 RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
                 if (pReloadableShader)
                 {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
+                    ++NumShaders;
+                    if (!IncrementalReload || DependsOnAnyFile(pReloadableShader->GetDependencies(), ChangedFiles))
+                        Shaders.emplace_back(std::move(pReloadableShader));
                 }
                 else
                 {
@@ -918,9 +993,55 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         }
     }
 
+    // Reload shaders first. Shaders are independent, so they are reloaded in parallel
+    // using the device's shader compilation thread pool, if there is one.
+    std::vector<RefCntAutoPtr<IShader>> OldShaders(Shaders.size());
+    std::vector<Uint8>                  Compiled(Shaders.size());
+    for (size_t i = 0; i < Shaders.size(); ++i)
+        OldShaders[i] = Shaders[i]->GetShader();
+
+    if (IThreadPool* pThreadPool = Shaders.size() > 1 ? m_pDevice->GetShaderCompilationThreadPool() : nullptr)
+    {
+        std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+        Tasks.reserve(Shaders.size());
+        for (size_t i = 0; i < Shaders.size(); ++i)
+        {
+            Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                                [&Shaders, &Compiled, i](Uint32 ThreadId) {
+                                                    Compiled[i] = Shaders[i]->Reload() ? 1 : 0;
+                                                    return ASYNC_TASK_STATUS_COMPLETE;
+                                                }));
+        }
+        for (IAsyncTask* pTask : Tasks)
+            pTask->WaitForCompletion();
+    }
+    else
+    {
+        for (size_t i = 0; i < Shaders.size(); ++i)
+            Compiled[i] = Shaders[i]->Reload() ? 1 : 0;
+    }
+
+    // Pipelines reference reloadable shaders, so the shaders whose internal
+    // object has been replaced identify the pipelines that must be re-created.
+    std::unordered_set<const IShader*> ChangedShaders;
+    for (size_t i = 0; i < Shaders.size(); ++i)
+    {
+        if (Compiled[i] != 0)
+            ++NumStatesReloaded;
+
+        if (Shaders[i]->GetShader() != OldShaders[i])
+        {
+            ChangedShaders.emplace(Shaders[i].RawPtr<IShader>());
+            const char* Name = Shaders[i]->GetDesc().Name;
+            RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Reloaded shader '", (Name ? Name : "<unnamed>"), "'.");
+        }
+    }
+
     // Reload pipelines.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
+    size_t NumPipelines         = 0;
+    size_t NumPipelinesReloaded = 0;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
         for (auto pso_it : m_ReloadablePipelines)
@@ -928,10 +1049,18 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
             if (auto pPSO = pso_it.second.Lock())
             {
                 RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
+                if (pReloadablePSO)
                 {
+                    ++NumPipelines;
+                    if (IncrementalReload && !pReloadablePSO->UsesAnyShader(ChangedShaders))
+                        continue;
+
                     if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
                         ++NumStatesReloaded;
+                    ++NumPipelinesReloaded;
+
+                    const char* Name = pReloadablePSO->GetDesc().Name;
+                    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reloaded pipeline '", (Name ? Name : "<unnamed>"), "'.");
                 }
                 else
                 {
@@ -941,6 +1070,9 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         }
     }
 
+    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, (IncrementalReload ? "Incremental" : "Full"), " reload: ",
+                           ChangedShaders.size(), " of ", NumShaders, " shader(s) and ", NumPipelinesReloaded, " of ", NumPipelines, " pipeline(s) updated.");
+
     ++m_ReloadVersion;
 
     return NumStatesReloaded;
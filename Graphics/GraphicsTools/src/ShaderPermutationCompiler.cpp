@@ -0,0 +1,510 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderPermutationCompiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ShaderToolsCommon.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ParsingTools.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+const void* ShaderPermutationCompiler::VariantInfo::GetBytecode(Uint64& Size) const
+{
+    Size = 0;
+    if (!pShader)
+        return nullptr;
+
+    const void* pBytecode = nullptr;
+    pShader->GetBytecode(&pBytecode, Size);
+    return pBytecode;
+}
+
+ShaderPermutationCompiler::ShaderPermutationCompiler(IRenderDevice* pDevice) :
+    m_pDevice{pDevice}
+{
+    VERIFY(m_pDevice, "Render device must not be null");
+}
+
+std::vector<ShaderMacroHelper> ShaderPermutationCompiler::ExpandMacroMatrix(const std::vector<MacroDimension>& Matrix)
+{
+    std::vector<ShaderMacroHelper> Permutations(1);
+    for (const MacroDimension& Dim : Matrix)
+    {
+        if (Dim.Values.empty())
+            continue;
+
+        std::vector<ShaderMacroHelper> Expanded;
+        Expanded.reserve(Permutations.size() * Dim.Values.size());
+        for (const ShaderMacroHelper& Macros : Permutations)
+        {
+            for (const std::string& Value : Dim.Values)
+            {
+                Expanded.emplace_back(Macros);
+                Expanded.back().Add(Dim.Name.c_str(), Value.c_str());
+            }
+        }
+        Permutations = std::move(Expanded);
+    }
+    return Permutations;
+}
+
+namespace
+{
+
+enum class MacroScanTokenType
+{
+    Undefined,
+    PreprocessorDirective,
+    Identifier,
+    NumericConstant,
+    StringConstant,
+    Assignment,
+    ComparisonOp,
+    LogicOp,
+    BitwiseOp,
+    IncDecOp,
+    MathOp,
+    Colon,
+    DoubleColon,
+    Comma,
+    Semicolon,
+    QuestionMark,
+    OpenParen,
+    ClosingParen,
+    OpenBrace,
+    ClosingBrace,
+    OpenSquareBracket,
+    ClosingSquareBracket
+};
+
+// Token that references the source string rather than copying it
+struct MacroScanToken
+{
+    using TokenType = MacroScanTokenType;
+
+    TokenType   Type         = TokenType::Undefined;
+    const char* DelimStart   = nullptr;
+    const char* DelimEnd     = nullptr;
+    const char* LiteralStart = nullptr;
+    const char* LiteralEnd   = nullptr;
+
+    void SetType(TokenType _Type)
+    {
+        Type = _Type;
+    }
+
+    TokenType GetType() const { return Type; }
+
+    bool CompareLiteral(const char* Str) const
+    {
+        return CompareLiteral(Str, Str + strlen(Str));
+    }
+
+    bool CompareLiteral(const char* Start, const char* End) const
+    {
+        return End - Start == LiteralEnd - LiteralStart && std::equal(Start, End, LiteralStart);
+    }
+
+    void ExtendLiteral(const char* /*Start*/, const char* End)
+    {
+        LiteralEnd = End;
+    }
+
+    static MacroScanToken Create(TokenType _Type, const char* _DelimStart, const char* _DelimEnd, const char* _LiteralStart, const char* _LiteralEnd)
+    {
+        return MacroScanToken{_Type, _DelimStart, _DelimEnd, _LiteralStart, _LiteralEnd};
+    }
+};
+
+// Calls the handler for every identifier in the string. Comments and string constants are skipped.
+template <typename HandlerType>
+void ForEachIdentifier(const char* Start, const char* End, HandlerType&& Handler) noexcept(false)
+{
+    const std::vector<MacroScanToken> Tokens = Parsing::Tokenize<MacroScanToken, std::vector<MacroScanToken>>(
+        Start, End, MacroScanToken::Create,
+        [](const char*, const char*) {
+            return MacroScanTokenType::Identifier;
+        });
+
+    for (size_t i = 0; i < Tokens.size(); ++i)
+    {
+        const MacroScanToken& Token = Tokens[i];
+        if (Token.Type != MacroScanTokenType::Identifier)
+            continue;
+
+        // The tokenizer splits numbers with suffixes (e.g. 1.0e5f, 0x10, 1u) into a numeric constant
+        // and an identifier that immediately follows it. The latter is not a name.
+        if (i > 0 && Tokens[i - 1].Type == MacroScanTokenType::NumericConstant && Token.DelimStart == Token.DelimEnd)
+            continue;
+
+        Handler(Token.LiteralStart, Token.LiteralEnd);
+    }
+}
+
+} // namespace
+
+std::vector<std::string> ShaderPermutationCompiler::FindReferencedMacros(const char* Source, size_t SourceLength, const ShaderMacroArray& Macros)
+{
+    struct MacroInfo
+    {
+        // All definitions of the macro
+        std::vector<const char*> Definitions;
+
+        bool IsReferenced = false;
+    };
+    std::unordered_map<std::string, MacroInfo> MacroInfos;
+    for (Uint32 i = 0; i < Macros.Count; ++i)
+    {
+        MacroInfo& Info = MacroInfos[Macros[i].Name];
+        if (Macros[i].Definition != nullptr && Macros[i].Definition[0] != '\0')
+            Info.Definitions.push_back(Macros[i].Definition);
+    }
+
+    // Referenced macros whose definitions have not been scanned yet
+    std::vector<const MacroInfo*> PendingMacros;
+
+    const auto MarkReferenced = [&](const char* NameStart, const char* NameEnd) {
+        auto it = MacroInfos.find(std::string{NameStart, NameEnd});
+        if (it != MacroInfos.end() && !it->second.IsReferenced)
+        {
+            it->second.IsReferenced = true;
+            PendingMacros.push_back(&it->second);
+        }
+    };
+
+    try
+    {
+        ForEachIdentifier(Source, Source + SourceLength, MarkReferenced);
+
+        // A macro that is only used in the definition of a referenced macro
+        // also affects the preprocessed source.
+        while (!PendingMacros.empty())
+        {
+            const MacroInfo* pInfo = PendingMacros.back();
+            PendingMacros.pop_back();
+            for (const char* Definition : pInfo->Definitions)
+                ForEachIdentifier(Definition, Definition + strlen(Definition), MarkReferenced);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        // The source can't be tokenized: conservatively treat all macros as referenced
+        for (auto& it : MacroInfos)
+            it.second.IsReferenced = true;
+    }
+
+    std::vector<std::string> Referenced;
+    for (Uint32 i = 0; i < Macros.Count; ++i)
+    {
+        auto it = MacroInfos.find(Macros[i].Name);
+        if (it != MacroInfos.end() && it->second.IsReferenced)
+        {
+            Referenced.emplace_back(Macros[i].Name);
+            // Report every name once
+            it->second.IsReferenced = false;
+        }
+    }
+    return Referenced;
+}
+
+bool ShaderPermutationCompiler::HasConditionalIncludes(const char* Source, size_t SourceLength)
+{
+    struct DirectiveInfo
+    {
+        std::string Name;
+        // The first identifier after the directive name
+        std::string Arg;
+    };
+    std::vector<DirectiveInfo> Directives;
+    try
+    {
+        const char* const End = Source + SourceLength;
+        for (const char* Pos = Source; Pos != End;)
+        {
+            const char* NameStart = nullptr;
+            const char* NameEnd   = nullptr;
+            Pos                   = Parsing::FindNextPreprocessorDirective(Pos, End, NameStart, NameEnd);
+            if (Pos == End)
+                break;
+
+            const char* ArgStart = Parsing::SkipDelimiters(NameEnd, End, " \t");
+            const char* ArgEnd   = Parsing::SkipIdentifier(ArgStart, End);
+            Directives.push_back({std::string{NameStart, NameEnd}, std::string{ArgStart, ArgEnd}});
+
+            Pos = Parsing::SkipLine(NameEnd, End, /* GoToNextLine = */ true);
+        }
+    }
+    catch (...)
+    {
+        // The source can't be parsed: conservatively assume that it has conditional includes
+        return true;
+    }
+
+    const auto IsConditionalStart = [](const std::string& Name) {
+        return Name == "if" || Name == "ifdef" || Name == "ifndef";
+    };
+
+    // The include guard (#ifndef GUARD, #define GUARD ... #endif) does not make the includes conditional,
+    // since the unrolled source contains every file only once anyway.
+    size_t First = 0;
+    size_t Last  = Directives.size();
+    if (Directives.size() >= 3 &&
+        Directives[0].Name == "ifndef" && Directives[1].Name == "define" && Directives[0].Arg == Directives[1].Arg && !Directives[0].Arg.empty() &&
+        Directives.back().Name == "endif")
+    {
+        // The guard's #endif must be the last directive
+        int  Depth     = 0;
+        bool IsGuarded = true;
+        for (size_t i = 0; i < Directives.size() && IsGuarded; ++i)
+        {
+            if (IsConditionalStart(Directives[i].Name))
+                ++Depth;
+            else if (Directives[i].Name == "endif")
+                --Depth;
+            IsGuarded = Depth > 0 || i + 1 == Directives.size();
+        }
+        if (IsGuarded)
+        {
+            First = 1;
+            Last  = Directives.size() - 1;
+        }
+    }
+
+    int Depth = 0;
+    for (size_t i = First; i < Last; ++i)
+    {
+        const std::string& Name = Directives[i].Name;
+        if (IsConditionalStart(Name))
+            ++Depth;
+        else if (Name == "endif")
+            Depth = std::max(Depth - 1, 0);
+        else if (Name == "include" && Depth > 0)
+            return true;
+    }
+
+    return false;
+}
+
+std::vector<ShaderPermutationCompiler::VariantInfo> ShaderPermutationCompiler::Compile(const ShaderCreateInfo&               ShaderCI,
+                                                                                       const std::vector<ShaderMacroHelper>& Permutations,
+                                                                                       Statistics*                           pStats)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    Statistics Stats;
+    Stats.NumVariants = static_cast<Uint32>(Permutations.size());
+
+    std::vector<VariantInfo> Variants(Permutations.size());
+
+    const auto PreprocessStart = Clock::now();
+
+    ShaderCreateInfo BaseCI = ShaderCI;
+
+    // Files are loaded once and the variants read them from memory. If no include directive is inside
+    // a conditional block, the variants are compiled from the unrolled source. Otherwise, the unrolled
+    // source may miss a file that a variant includes (the unroller pastes every file only once, at its
+    // first #include, regardless of #if blocks), and each variant resolves the includes itself.
+    std::string                                    UnrolledSource;
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pCachedSourceFactory;
+    bool                                           SourceScanned = false;
+    if (ShaderCI.ByteCode == nullptr)
+    {
+        try
+        {
+            std::vector<std::pair<std::string, std::string>> Files;
+
+            bool HasConditionalIncludes = false;
+            if (!ProcessShaderIncludes(ShaderCI,
+                                       [&](const ShaderIncludePreprocessInfo& FileInfo) {
+                                           if (!HasConditionalIncludes)
+                                               HasConditionalIncludes = ShaderPermutationCompiler::HasConditionalIncludes(FileInfo.Source, FileInfo.SourceLength);
+                                           if (!FileInfo.FilePath.empty())
+                                               Files.emplace_back(FileInfo.FilePath, std::string{FileInfo.Source, FileInfo.SourceLength});
+                                       }))
+            {
+                LOG_ERROR_AND_THROW("Failed to process includes");
+            }
+
+            if (ShaderCI.pShaderSourceStreamFactory != nullptr)
+            {
+                std::vector<MemoryShaderSourceFileInfo> FileInfos;
+                FileInfos.reserve(Files.size());
+                for (const auto& File : Files)
+                    FileInfos.emplace_back(File.first.c_str(), File.second);
+
+                // The variants are compiled asynchronously, so the factory keeps its own copy of the sources.
+                // Files that are requested by a different name are loaded through the original factory.
+                RefCntAutoPtr<IShaderSourceInputStreamFactory> pMemorySourceFactory =
+                    CreateMemoryShaderSourceFactory(MemoryShaderSourceFactoryCreateInfo{FileInfos.data(), static_cast<Uint32>(FileInfos.size()), /*CopySources = */ true});
+                pCachedSourceFactory = CreateCompoundShaderSourceFactory({pMemorySourceFactory, ShaderCI.pShaderSourceStreamFactory});
+                if (!pCachedSourceFactory)
+                    LOG_ERROR_AND_THROW("Failed to create the shader source factory");
+            }
+
+            ShaderCreateInfo CachedCI           = ShaderCI;
+            CachedCI.pShaderSourceStreamFactory = pCachedSourceFactory;
+            UnrolledSource                      = UnrollShaderIncludes(CachedCI);
+            SourceScanned                       = true;
+
+            if (!HasConditionalIncludes)
+            {
+                BaseCI.Source       = UnrolledSource.c_str();
+                BaseCI.SourceLength = UnrolledSource.length();
+                BaseCI.FilePath     = nullptr;
+                Stats.SharedSource  = true;
+            }
+            else
+            {
+                BaseCI.pShaderSourceStreamFactory = pCachedSourceFactory;
+            }
+        }
+        catch (...)
+        {
+            LOG_WARNING_MESSAGE("Failed to unroll includes of shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""),
+                                "'. Variants will be compiled from the original source without deduplication.");
+        }
+    }
+
+    // Byte code is not affected by macros, and all variants are identical
+    const bool RemoveDuplicates = SourceScanned || ShaderCI.ByteCode != nullptr;
+
+    // Find the variant macros that may affect the preprocessed source.
+    // Macros that are not referenced by the source can't change it. The unrolled source
+    // contains every file reachable through any #include, so it references all such macros.
+    std::unordered_set<std::string> ReferencedMacros;
+    if (SourceScanned)
+    {
+        // Collect every distinct definition, since a macro may reference other
+        // macros through any of its values. Common macros may reference variant macros too.
+        ShaderMacroHelper               AllMacros;
+        std::unordered_set<std::string> UniqueDefinitions;
+        const auto                      AddMacros = [&](const ShaderMacroArray& MacroArray) {
+            for (Uint32 i = 0; i < MacroArray.Count; ++i)
+            {
+                const ShaderMacro Macro{MacroArray[i].Name, MacroArray[i].Definition != nullptr ? MacroArray[i].Definition : ""};
+                if (UniqueDefinitions.insert(std::string{Macro.Name} + '=' + Macro.Definition).second)
+                    AllMacros.Add(Macro);
+            }
+        };
+        AddMacros(ShaderCI.Macros);
+        for (const ShaderMacroHelper& Macros : Permutations)
+            AddMacros(Macros);
+
+        for (std::string& Name : FindReferencedMacros(UnrolledSource.c_str(), UnrolledSource.length(), AllMacros))
+            ReferencedMacros.emplace(std::move(Name));
+    }
+
+    // Assign every variant to the first variant with the same set of referenced macros
+    std::vector<Uint32> UniqueVariants;
+    {
+        std::unordered_map<std::string, Uint32> KeyToVariant;
+        for (size_t i = 0; i < Permutations.size(); ++i)
+        {
+            if (!RemoveDuplicates)
+            {
+                Variants[i].CompiledVariant = static_cast<Uint32>(i);
+                UniqueVariants.push_back(static_cast<Uint32>(i));
+                continue;
+            }
+
+            const ShaderMacroArray MacroArray = Permutations[i];
+
+            std::vector<std::pair<std::string, std::string>> Relevant;
+            for (Uint32 m = 0; m < MacroArray.Count; ++m)
+            {
+                if (ReferencedMacros.find(MacroArray[m].Name) != ReferencedMacros.end())
+                    Relevant.emplace_back(MacroArray[m].Name, MacroArray[m].Definition != nullptr ? MacroArray[m].Definition : "");
+            }
+            std::sort(Relevant.begin(), Relevant.end());
+
+            std::string Key;
+            for (const auto& Macro : Relevant)
+            {
+                Key.append(Macro.first);
+                Key.push_back('=');
+                Key.append(Macro.second);
+                Key.push_back('\n');
+            }
+
+            auto it = KeyToVariant.emplace(std::move(Key), static_cast<Uint32>(i));
+            if (it.second)
+                UniqueVariants.push_back(static_cast<Uint32>(i));
+            Variants[i].CompiledVariant = it.first->second;
+        }
+    }
+    Stats.NumCompiled = static_cast<Uint32>(UniqueVariants.size());
+
+    const auto CompileStart = Clock::now();
+    Stats.PreprocessTime    = std::chrono::duration<double>(CompileStart - PreprocessStart).count();
+
+    // Start compiling all unique variants. With the asynchronous flag, the device
+    // compiles them in parallel on its shader compilation thread pool.
+    for (Uint32 VariantIdx : UniqueVariants)
+    {
+        ShaderMacroHelper Macros;
+        for (Uint32 m = 0; m < ShaderCI.Macros.Count; ++m)
+            Macros.Add(ShaderCI.Macros[m]);
+        Macros += Permutations[VariantIdx];
+
+        ShaderCreateInfo VariantCI = BaseCI;
+        VariantCI.Macros           = Macros;
+        VariantCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+        m_pDevice->CreateShader(VariantCI, &Variants[VariantIdx].pShader);
+    }
+
+    for (Uint32 VariantIdx : UniqueVariants)
+    {
+        RefCntAutoPtr<IShader>& pShader = Variants[VariantIdx].pShader;
+        if (pShader && pShader->GetStatus(/*WaitForCompletion = */ true) != SHADER_STATUS_READY)
+            pShader.Release();
+    }
+
+    for (VariantInfo& Variant : Variants)
+    {
+        Variant.pShader = Variants[Variant.CompiledVariant].pShader;
+        if (!Variant.pShader)
+            ++Stats.NumFailed;
+    }
+
+    Stats.CompileTime = std::chrono::duration<double>(Clock::now() - CompileStart).count();
+
+    if (pStats != nullptr)
+        *pStats = Stats;
+
+    return Variants;
+}
+
+} // namespace Diligent
@@ -26,6 +26,12 @@
 
 #include "XXH128Hasher.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "xxhash.h"
 
 #include "DebugUtilities.hpp"
@@ -35,6 +41,263 @@
 namespace Diligent
 {
 
+namespace
+{
+
+// Caches content hashes and direct includes of the shader source files so that
+// hashing a shader whose files have not changed does not read any files.
+class ShaderSourceHashCache
+{
+public:
+    struct FileInfo
+    {
+        XXH128Hash               Hash;
+        std::vector<std::string> Includes;
+        size_t                   Size       = 0;
+        Uint32                   Generation = 0;
+    };
+    using FileInfoPtr = std::shared_ptr<const FileInfo>;
+
+    static ShaderSourceHashCache& Get()
+    {
+        static ShaderSourceHashCache Cache;
+        return Cache;
+    }
+
+    // ShaderCI.FilePath must not be null, ShaderCI.Source must be null.
+    FileInfoPtr GetFileInfo(const ShaderCreateInfo& ShaderCI) noexcept(false)
+    {
+        VERIFY_EXPR(ShaderCI.FilePath != nullptr && ShaderCI.Source == nullptr);
+
+        IShaderSourceInputStreamFactory* const pFactory = ShaderCI.pShaderSourceStreamFactory;
+        // Read the generation before the file so that the entry is considered stale
+        // if the cache is invalidated while the file is being read.
+        const Uint32 Generation = m_Generation.load(std::memory_order_acquire);
+
+        if (pFactory != nullptr)
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+
+            auto factory_it = m_Factories.find(pFactory);
+            if (factory_it != m_Factories.end())
+            {
+                FactoryFiles& Files = factory_it->second;
+                // The factory is alive as it is referenced by ShaderCI. If the weak pointer is not
+                // valid, the cached files belong to a released factory that had the same address.
+                if (Files.wpFactory.IsValid())
+                {
+                    auto file_it = Files.Files.find(ShaderCI.FilePath);
+                    if (file_it != Files.Files.end() && file_it->second->Generation == Generation)
+                    {
+                        m_Stats.NumCacheHits.fetch_add(1, std::memory_order_relaxed);
+                        m_Stats.BytesSaved.fetch_add(file_it->second->Size, std::memory_order_relaxed);
+                        return file_it->second;
+                    }
+                }
+                else
+                {
+                    m_Factories.erase(factory_it);
+                }
+            }
+        }
+
+        const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+
+        auto pInfo = std::make_shared<FileInfo>();
+        if (SourceData.Source != nullptr && SourceData.SourceLength != 0)
+        {
+            const XXH128_hash_t Hash = XXH3_128bits(SourceData.Source, SourceData.SourceLength);
+
+            pInfo->Hash     = {Hash.low64, Hash.high64};
+            pInfo->Includes = FindShaderIncludes(ShaderCI, SourceData.Source, SourceData.SourceLength);
+            pInfo->Size     = SourceData.SourceLength;
+        }
+        pInfo->Generation = Generation;
+
+        m_Stats.NumFilesRead.fetch_add(1, std::memory_order_relaxed);
+        m_Stats.BytesRead.fetch_add(pInfo->Size, std::memory_order_relaxed);
+
+        if (pFactory != nullptr)
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+
+            auto factory_it = m_Factories.find(pFactory);
+            if (factory_it == m_Factories.end())
+                factory_it = m_Factories.emplace(pFactory, FactoryFiles{pFactory}).first;
+
+            factory_it->second.Files[HashMapStringKey{ShaderCI.FilePath, true}] = pInfo;
+        }
+
+        return pInfo;
+    }
+
+    void Invalidate()
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        m_Generation.fetch_add(1, std::memory_order_acq_rel);
+        m_Factories.clear();
+    }
+
+    ShaderSourceHashCacheStatistics GetStatistics() const
+    {
+        ShaderSourceHashCacheStatistics Stats;
+        Stats.NumFilesRead = m_Stats.NumFilesRead.load(std::memory_order_relaxed);
+        Stats.BytesRead    = m_Stats.BytesRead.load(std::memory_order_relaxed);
+        Stats.NumCacheHits = m_Stats.NumCacheHits.load(std::memory_order_relaxed);
+        Stats.BytesSaved   = m_Stats.BytesSaved.load(std::memory_order_relaxed);
+        return Stats;
+    }
+
+private:
+    struct FactoryFiles
+    {
+        explicit FactoryFiles(IShaderSourceInputStreamFactory* pFactory) :
+            wpFactory{pFactory}
+        {}
+
+        RefCntWeakPtr<IShaderSourceInputStreamFactory> wpFactory;
+
+        std::unordered_map<HashMapStringKey, FileInfoPtr> Files;
+    };
+
+    std::mutex m_Mtx;
+
+    std::unordered_map<const IShaderSourceInputStreamFactory*, FactoryFiles> m_Factories;
+
+    std::atomic<Uint32> m_Generation{0};
+
+    struct
+    {
+        std::atomic<Uint64> NumFilesRead{0};
+        std::atomic<Uint64> BytesRead{0};
+        std::atomic<Uint64> NumCacheHits{0};
+        std::atomic<Uint64> BytesSaved{0};
+    } m_Stats;
+};
+
+using IncludeSetType = std::unordered_set<HashMapStringKey>;
+
+// Mirrors ProcessShaderIncludes(): includes are processed in a depth-first order and every file
+// is hashed after the files it includes. Instead of the file contents, the hasher is updated with
+// the cached content hashes.
+void UpdateShaderIncludes(XXH128State&                                    Hasher,
+                          const ShaderCreateInfo&                         ShaderCI,
+                          const std::vector<std::string>&                 Includes,
+                          IncludeSetType&                                 ProcessedIncludes,
+                          std::vector<ShaderSourceHashCache::FileInfoPtr>& ProcessedFiles) noexcept(false)
+{
+    for (const std::string& Include : Includes)
+    {
+        // The string is owned by the file info that is kept alive by ProcessedFiles
+        if (!ProcessedIncludes.emplace(Include.c_str()).second)
+            continue;
+
+        ShaderCreateInfo IncludeCI{ShaderCI};
+        IncludeCI.FilePath     = Include.c_str();
+        IncludeCI.Source       = nullptr;
+        IncludeCI.SourceLength = 0;
+
+        ShaderSourceHashCache::FileInfoPtr pInfo = ShaderSourceHashCache::Get().GetFileInfo(IncludeCI);
+        UpdateShaderIncludes(Hasher, IncludeCI, pInfo->Includes, ProcessedIncludes, ProcessedFiles);
+        Hasher.Update(pInfo->Hash.LowPart, pInfo->Hash.HighPart);
+        ProcessedFiles.emplace_back(std::move(pInfo));
+    }
+}
+
+void CollectShaderIncludes(const ShaderCreateInfo&         ShaderCI,
+                           const std::vector<std::string>& Includes,
+                           IncludeSetType&                 ProcessedIncludes,
+                           std::vector<std::string>&       Dependencies) noexcept(false)
+{
+    for (const std::string& Include : Includes)
+    {
+        if (!ProcessedIncludes.emplace(Include.c_str(), true).second)
+            continue;
+
+        ShaderCreateInfo IncludeCI{ShaderCI};
+        IncludeCI.FilePath     = Include.c_str();
+        IncludeCI.Source       = nullptr;
+        IncludeCI.SourceLength = 0;
+
+        ShaderSourceHashCache::FileInfoPtr pInfo = ShaderSourceHashCache::Get().GetFileInfo(IncludeCI);
+        Dependencies.emplace_back(Include);
+        CollectShaderIncludes(IncludeCI, pInfo->Includes, ProcessedIncludes, Dependencies);
+    }
+}
+
+bool UpdateShaderSource(XXH128State& Hasher, const ShaderCreateInfo& ShaderCI) noexcept
+{
+    try
+    {
+        IncludeSetType                                  ProcessedIncludes;
+        std::vector<ShaderSourceHashCache::FileInfoPtr> ProcessedFiles;
+        if (ShaderCI.Source != nullptr)
+        {
+            const size_t                   SourceLength = ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source);
+            const std::vector<std::string> Includes     = FindShaderIncludes(ShaderCI, ShaderCI.Source, SourceLength);
+            UpdateShaderIncludes(Hasher, ShaderCI, Includes, ProcessedIncludes, ProcessedFiles);
+            Hasher.UpdateStr(ShaderCI.Source, SourceLength);
+        }
+        else
+        {
+            ShaderSourceHashCache::FileInfoPtr pInfo = ShaderSourceHashCache::Get().GetFileInfo(ShaderCI);
+            UpdateShaderIncludes(Hasher, ShaderCI, pInfo->Includes, ProcessedIncludes, ProcessedFiles);
+            Hasher.Update(pInfo->Hash.LowPart, pInfo->Hash.HighPart);
+        }
+        return true;
+    }
+    catch (const std::pair<std::string, std::string>& ErrInfo)
+    {
+        LOG_ERROR_MESSAGE("Failed to process includes in ", ErrInfo.first, ": ", ErrInfo.second);
+        return false;
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to process includes in shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""), "'.");
+        return false;
+    }
+}
+
+} // namespace
+
+void InvalidateShaderSourceHashCache()
+{
+    ShaderSourceHashCache::Get().Invalidate();
+}
+
+ShaderSourceHashCacheStatistics GetShaderSourceHashCacheStatistics()
+{
+    return ShaderSourceHashCache::Get().GetStatistics();
+}
+
+bool GetShaderSourceDependencies(const ShaderCreateInfo& ShaderCI, std::vector<std::string>& Dependencies)
+{
+    Dependencies.clear();
+    try
+    {
+        IncludeSetType ProcessedIncludes;
+        if (ShaderCI.Source != nullptr)
+        {
+            const size_t                   SourceLength = ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source);
+            const std::vector<std::string> Includes     = FindShaderIncludes(ShaderCI, ShaderCI.Source, SourceLength);
+            CollectShaderIncludes(ShaderCI, Includes, ProcessedIncludes, Dependencies);
+        }
+        else if (ShaderCI.FilePath != nullptr)
+        {
+            ShaderSourceHashCache::FileInfoPtr pInfo = ShaderSourceHashCache::Get().GetFileInfo(ShaderCI);
+            Dependencies.emplace_back(ShaderCI.FilePath);
+            ProcessedIncludes.emplace(ShaderCI.FilePath, true);
+            CollectShaderIncludes(ShaderCI, pInfo->Includes, ProcessedIncludes, Dependencies);
+        }
+        return true;
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to collect source dependencies of shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""), "'.");
+        return false;
+    }
+}
+
 XXH128State::XXH128State() :
     m_State{XXH3_createState()}
 {
@@ -79,9 +342,7 @@ void XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "ShaderCI.ByteCode must be null when either Source or FilePath is specified");
-        ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
-            UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
-        });
+        UpdateShaderSource(*this, ShaderCI);
     }
     else if (ShaderCI.ByteCode != nullptr && ShaderCI.ByteCodeSize != 0)
     {
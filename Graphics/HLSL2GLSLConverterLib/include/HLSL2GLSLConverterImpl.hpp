@@ -241,7 +241,8 @@ private:
         ///                             the input stream factory using InputFileName.
         /// \param [in] NumSymbols    - Number of symbols in the HLSLSource string
         /// \param [in] bPreserveTokens - Whether to preserve original tokens. This must be set to true if the stream
-        ///                               will be used for multiple conversions.
+        ///                               will be used for multiple conversions. Tokens of such streams are
+        ///                               never modified after construction.
         ConversionStream(IReferenceCounters*              pRefCounters,
                          const HLSL2GLSLConverterImpl&    Converter,
                          const char*                      InputFileName,
@@ -250,12 +251,31 @@ private:
                          size_t                           NumSymbols,
                          bool                             bPreserveTokens);
 
+        /// Creates a stream that owns a private copy of the tokens of the parsed stream.
+        ConversionStream(IReferenceCounters*     pRefCounters,
+                         const ConversionStream& ParsedStream);
+
+        /// Converts the shader entry point using a private copy of the tokens.
+
+        /// The stream itself is never modified, so multiple entry points and shader stages
+        /// may be converted from the same stream concurrently by different threads.
         String Convert(const Char* EntryPoint,
                        SHADER_TYPE ShaderType,
                        bool        IncludeDefintions,
                        const char* SamplerSuffix,
                        bool        UseInOutLocationQualifiers,
-                       bool        UseRowMajorMatrices);
+                       bool        UseRowMajorMatrices) const;
+
+        /// Converts the shader entry point by modifying the tokens of the stream.
+
+        /// This avoids copying the tokens, but the stream can't be used for any other conversion
+        /// afterwards. The method must not be called for streams that preserve tokens.
+        String ConvertInPlace(const Char* EntryPoint,
+                              SHADER_TYPE ShaderType,
+                              bool        IncludeDefintions,
+                              const char* SamplerSuffix,
+                              bool        UseInOutLocationQualifiers,
+                              bool        UseRowMajorMatrices);
 
         virtual void DILIGENT_CALL_TYPE Convert(const Char* EntryPoint,
                                                 SHADER_TYPE ShaderType,
@@ -459,7 +479,8 @@ private:
 
         String BuildGLSLSource();
 
-        // Tokenized source code
+        // Tokenized source code. If m_bPreserveTokens is true, the tokens are
+        // immutable and every conversion operates on its own copy.
         TokenListType m_Tokens;
 
         // List of tokens defining structs
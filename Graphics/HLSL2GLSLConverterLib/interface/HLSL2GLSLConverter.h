@@ -49,6 +49,11 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_HLSL2GLSLConversionStream =
 
 // clang-format off
 
+/// HLSL to GLSL conversion stream that holds the tokenized source code.
+
+/// The stream is immutable after it has been created: every conversion works on
+/// its own copy of the tokens. Multiple entry points and shader stages may thus be
+/// converted from the same stream concurrently by different threads.
 DILIGENT_BEGIN_INTERFACE(IHLSL2GLSLConversionStream, IObject)
 {
     VIRTUAL void METHOD(Convert)(THIS_
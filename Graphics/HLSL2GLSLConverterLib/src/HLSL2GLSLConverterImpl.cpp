@@ -4460,6 +4460,18 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
     m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
 }
 
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*     pRefCounters,
+                                                           const ConversionStream& ParsedStream) :
+    // clang-format off
+    TBase            {pRefCounters                },
+    m_Tokens         {ParsedStream.m_Tokens       },
+    m_bPreserveTokens{false                       },
+    m_Converter      {ParsedStream.m_Converter    },
+    m_InputFileName  {ParsedStream.m_InputFileName}
+// clang-format on
+{
+}
+
 
 String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
 {
@@ -4468,7 +4480,7 @@ String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
         try
         {
             ConversionStream Stream(nullptr, *this, Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols, false);
-            return Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
+            return Stream.ConvertInPlace(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
                                   Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
                                   Attribs.UseRowMajorMatrices);
         }
@@ -4513,7 +4525,7 @@ void HLSL2GLSLConverterImpl::CreateStream(const Char*                      Input
 {
     try
     {
-        auto* pStream = NEW_RC_OBJ(GetRawAllocator(), "HLSL2GLSLConverterImpl::ConversionStream object instance", ConversionStream)(*this, InputFileName, pSourceStreamFactory, HLSLSource, NumSymbols, true);
+        auto* pStream = NEW_RC_OBJ(GetRawAllocator(MEMORY_CATEGORY_SHADER_TOOLS), "HLSL2GLSLConverterImpl::ConversionStream object instance", ConversionStream)(*this, InputFileName, pSourceStreamFactory, HLSLSource, NumSymbols, true);
         pStream->QueryInterface(IID_HLSL2GLSLConversionStream, reinterpret_cast<IObject**>(ppStream));
     }
     catch (std::runtime_error&)
@@ -4547,11 +4559,25 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                          bool        IncludeDefintions,
                                                          const char* SamplerSuffix,
                                                          bool        UseInOutLocationQualifiers,
-                                                         bool        UseRowMajorMatrices)
+                                                         bool        UseRowMajorMatrices) const
+{
+    // All conversion state lives in the temporary stream, which makes the
+    // method safe to call from multiple threads.
+    ConversionStream Stream{nullptr, *this};
+    return Stream.ConvertInPlace(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers, UseRowMajorMatrices);
+}
+
+String HLSL2GLSLConverterImpl::ConversionStream::ConvertInPlace(const Char* EntryPoint,
+                                                                SHADER_TYPE ShaderType,
+                                                                bool        IncludeDefintions,
+                                                                const char* SamplerSuffix,
+                                                                bool        UseInOutLocationQualifiers,
+                                                                bool        UseRowMajorMatrices)
 {
+    VERIFY(!m_bPreserveTokens, "Tokens of the stream '", m_InputFileName, "' must be preserved and can't be converted in place");
+
     m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
     m_bUseRowMajorMatrices        = UseRowMajorMatrices;
-    TokenListType TokensCopy(m_bPreserveTokens ? m_Tokens : TokenListType());
 
     Uint32 ShaderStorageBlockBinding = 0;
     Uint32 ImageBinding              = 0;
@@ -4791,14 +4817,6 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 
     auto GLSLSource = BuildGLSLSource();
 
-    if (m_bPreserveTokens)
-    {
-        m_Tokens.swap(TokensCopy);
-        m_StructDefinitions.clear();
-        m_PreprocessorDefinitions.clear();
-        m_Objects.clear();
-    }
-
     if (IncludeDefintions)
         GLSLSource.insert(0, g_GLSLDefinitions);
 
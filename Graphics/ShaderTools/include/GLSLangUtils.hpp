@@ -50,6 +50,11 @@ enum class SpirvVersion
     Count
 };
 
+/// Initializes glslang process-wide state.
+
+/// Initialization is reference-counted: every call must be matched by a call to FinalizeGlslang.
+/// HLSLtoSPIRV and GLSLtoSPIRV may be called from multiple threads simultaneously; each call
+/// holds its own reference, so finalizing glslang does not affect compilations in flight.
 void InitializeGlslang();
 void FinalizeGlslang();
 
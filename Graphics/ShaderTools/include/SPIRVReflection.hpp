@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SPIRVReflection class
+
+#include <array>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "SPIRVShaderResources.hpp"
+
+namespace Diligent
+{
+
+/// Lightweight single-pass SPIR-V module parser that extracts the resource information
+/// required by SPIRVShaderResources without constructing a SPIRV-Cross compiler.
+
+/// The parser only reads module-level declarations (names, decorations, types, constants
+/// and global variables) and stops at the first function definition. It follows the
+/// resource classification rules of spirv_cross::Compiler::get_shader_resources().
+/// Names are not copied and point into the SPIR-V binary, which must outlive the object.
+class SPIRVReflection
+{
+public:
+    struct EntryPointInfo
+    {
+        Uint32      ExecutionModel = 0;
+        Uint32      FunctionId     = 0;
+        const char* Name           = nullptr;
+
+        // Offset and number of the interface variable ids in the SPIR-V binary
+        Uint32 InterfaceOffset = 0;
+        Uint32 NumInterfaces   = 0;
+    };
+
+    struct ResourceInfo
+    {
+        const char*                              Name = nullptr;
+        SPIRVShaderResourceAttribs::ResourceType Type = SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes;
+
+        Uint32             ArraySize   = 1;
+        RESOURCE_DIMENSION ResourceDim = RESOURCE_DIM_UNDEFINED;
+        bool               IsMS        = false;
+
+        // Offsets in SPIR-V words of the binding & descriptor set decoration operands
+        Uint32 BindingDecorationOffset       = 0;
+        Uint32 DescriptorSetDecorationOffset = 0;
+
+        Uint32 BufferStaticSize = 0;
+        Uint32 BufferStride     = 0;
+    };
+
+    struct StageInputInfo
+    {
+        const char* Name                     = nullptr;
+        const char* Semantic                 = nullptr; // HlslSemanticGOOGLE decoration, may be null
+        Uint32      LocationDecorationOffset = 0;
+    };
+
+    // Resource lists match the lists of spirv_cross::ShaderResources
+    struct Resources
+    {
+        std::vector<ResourceInfo> UniformBuffers;
+        std::vector<ResourceInfo> StorageBuffers;
+        std::vector<ResourceInfo> StorageImages;
+        std::vector<ResourceInfo> SampledImages;
+        std::vector<ResourceInfo> AtomicCounters;
+        std::vector<ResourceInfo> SeparateSamplers;
+        std::vector<ResourceInfo> SeparateImages;
+        std::vector<ResourceInfo> SubpassInputs;
+        std::vector<ResourceInfo> AccelerationStructures;
+
+        std::vector<StageInputInfo> StageInputs;
+
+        std::array<Uint32, 3> ComputeGroupSize = {};
+    };
+
+    /// Parses the module-level declarations of the SPIR-V binary.
+
+    /// \return     false if the binary is malformed or uses constructs the parser does not
+    ///             support (e.g. decoration groups). SPIRV-Cross should be used in this case.
+    bool Parse(const std::vector<uint32_t>& SPIRV);
+
+    const std::vector<EntryPointInfo>& GetEntryPoints() const { return m_EntryPoints; }
+
+    /// Whether the module was compiled from HLSL source.
+    bool IsHLSLSource() const { return m_IsHLSLSource; }
+
+    /// Whether the module declares the SPV_GOOGLE_hlsl_functionality1 extension.
+    bool UsesHLSLFunctionality1() const { return m_UsesHLSLFunctionality1; }
+
+    /// Loads the resources used by the entry point.
+
+    /// \return     false if the resources can't be reflected by the parser (e.g. arrays
+    ///             sized by specialization constants). SPIRV-Cross should be used in this case.
+    bool LoadResources(const EntryPointInfo& EntryPoint, Resources& Res);
+
+private:
+    struct IdInfo
+    {
+        // Offset of the instruction that defines the id (type, constant or variable)
+        Uint32 DefOffset = 0;
+
+        // Offsets of the decoration operands in the SPIR-V binary
+        Uint32 BindingOffset       = 0;
+        Uint32 DescriptorSetOffset = 0;
+        Uint32 LocationOffset      = 0;
+
+        Uint32 ArrayStride = 0;
+        Uint32 Flags       = 0;
+
+        const char* Name         = nullptr;
+        const char* HlslSemantic = nullptr;
+    };
+
+    struct MemberDecoration
+    {
+        Uint32 StructId;
+        Uint32 Member;
+        Uint32 Decoration;
+        Uint32 Value;
+    };
+
+    struct ExecutionModeInfo
+    {
+        Uint32 FunctionId;
+        Uint32 Mode;
+        Uint32 Offset; // Offset of the first mode operand
+    };
+
+    Uint32 GetOpCode(Uint32 Id) const;
+    Uint32 GetOperand(Uint32 Id, Uint32 Operand) const;
+    Uint32 StripArrays(Uint32 TypeId) const;
+
+    bool GetConstantValue(Uint32 ConstantId, Uint32& Value) const;
+    bool GetArraySize(Uint32 TypeId, Uint32& ArraySize) const;
+    bool GetDeclaredStructSize(Uint32 StructId, Uint32& Size) const;
+    bool GetDeclaredMemberSize(Uint32 StructId, Uint32 Member, Uint32& Size) const;
+    bool GetMemberDecoration(Uint32 StructId, Uint32 Member, Uint32 Decoration, Uint32* pValue = nullptr) const;
+    bool AllMembersHaveDecoration(Uint32 StructId, Uint32 Decoration) const;
+    bool AnyMemberHasDecoration(Uint32 StructId, Uint32 Decoration) const;
+
+    const char* GetName(Uint32 Id) const;
+    const char* GetBlockName(Uint32 VarId, Uint32 BlockTypeId, bool PreferInstanceName);
+
+    bool InitResource(Uint32 VarId, Uint32 BaseTypeId, SPIRVShaderResourceAttribs::ResourceType Type, ResourceInfo& Res) const;
+
+private:
+    const uint32_t* m_Words    = nullptr;
+    size_t          m_NumWords = 0;
+    Uint32          m_Version  = 0;
+
+    std::vector<IdInfo>            m_Ids;
+    std::vector<Uint32>            m_Variables;
+    std::vector<MemberDecoration>  m_MemberDecorations;
+    std::vector<EntryPointInfo>    m_EntryPoints;
+    std::vector<ExecutionModeInfo> m_ExecutionModes;
+
+    // Names generated for anonymous blocks
+    std::deque<std::string> m_GeneratedNames;
+
+    bool m_IsSourceKnown          = false;
+    bool m_IsHLSLSource           = false;
+    bool m_UsesHLSLFunctionality1 = false;
+};
+
+} // namespace Diligent
@@ -111,6 +111,16 @@ struct SPIRVShaderResourceAttribs
                                Uint32                                _BufferStaticSize = 0,
                                Uint32                                _BufferStride     = 0) noexcept;
 
+    SPIRVShaderResourceAttribs(const char*        _Name,
+                               ResourceType       _Type,
+                               Uint16             _ArraySize,
+                               RESOURCE_DIMENSION _ResourceDim,
+                               bool               _IsMS,
+                               uint32_t           _BindingDecorationOffset,
+                               uint32_t           _DescriptorSetDecorationOffset,
+                               Uint32             _BufferStaticSize = 0,
+                               Uint32             _BufferStride     = 0) noexcept;
+
     ShaderResourceDesc GetResourceDesc() const
     {
         return ShaderResourceDesc{Name, GetShaderResourceType(Type), ArraySize};
@@ -143,17 +153,34 @@ struct SPIRVShaderStageInputAttribs
 };
 static_assert(sizeof(SPIRVShaderStageInputAttribs) % sizeof(void*) == 0, "Size of SPIRVShaderStageInputAttribs struct must be multiple of sizeof(void*)");
 
+class SPIRVReflection;
+
 /// Diligent::SPIRVShaderResources class
 class SPIRVShaderResources
 {
 public:
+    // Resources are reflected by the lightweight SPIRVReflection parser. SPIRV-Cross is used
+    // when uniform buffer reflection is requested, when the parser does not support the
+    // byte code, or when ForceSPIRVCross is true.
     SPIRVShaderResources(IMemoryAllocator&     Allocator,
                          std::vector<uint32_t> spirv_binary,
                          const ShaderDesc&     shaderDesc,
                          const char*           CombinedSamplerSuffix,
                          bool                  LoadShaderStageInputs,
                          bool                  LoadUniformBufferReflection,
-                         std::string&          EntryPoint) noexcept(false);
+                         std::string&          EntryPoint,
+                         bool                  ForceSPIRVCross = false) noexcept(false);
+
+    // Loads the resources serialized by AppendToBytecode() without parsing the SPIRV binary.
+    // pData and DataSize are the resource data returned by SplitBytecode(). SPIRVWordCount is
+    // the size of the SPIRV binary in 32-bit words, which all decoration offsets must be within.
+    SPIRVShaderResources(IMemoryAllocator& Allocator,
+                         const void*       pData,
+                         size_t            DataSize,
+                         size_t            SPIRVWordCount,
+                         const ShaderDesc& shaderDesc,
+                         const char*       CombinedSamplerSuffix,
+                         std::string&      EntryPoint) noexcept(false);
 
     // clang-format off
     SPIRVShaderResources             (const SPIRVShaderResources&)  = delete;
@@ -336,7 +363,37 @@ public:
     // Sets the input location decorations using the HLSL semantic names.
     void MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV) const;
 
+    // Appends the serialized resources and the entry point name to the SPIRV binary.
+    // Uniform buffer reflection is not serialized.
+    //
+    //  | SPIRV | Resource data | Padding | Data size | ResourceDataVersion | ResourceDataMagic |
+    //
+    // Valid SPIRV modules end with OpFunctionEnd, so the footer can't be mistaken for SPIRV code.
+    void AppendToBytecode(std::vector<uint32_t>& Bytecode, const std::string& EntryPoint) const;
+
+    // Splits the byte code produced by AppendToBytecode() into the SPIRV binary and the resource data.
+    // If the byte code does not contain the resource data, SPIRVSize is set to BytecodeSize.
+    // If the resource data was written by a different version, SPIRVSize excludes the data,
+    // but pResourceData is set to null. Returns true if the resource data can be loaded.
+    static bool SplitBytecode(const void*  pBytecode,
+                              size_t       BytecodeSize,
+                              size_t&      SPIRVSize,
+                              const void*& pResourceData,
+                              size_t&      ResourceDataSize);
+
+    static constexpr uint32_t ResourceDataMagic   = 0x52464C44; // 'DLFR'
+    static constexpr uint32_t ResourceDataVersion = 1;
+
 private:
+    // Initializes the resources using SPIRVReflection.
+    // Returns false if the resources must be loaded with SPIRV-Cross.
+    bool InitializeFromReflection(IMemoryAllocator& Allocator,
+                                  SPIRVReflection&  Reflection,
+                                  const ShaderDesc& shaderDesc,
+                                  const char*       CombinedSamplerSuffix,
+                                  bool              LoadShaderStageInputs,
+                                  std::string&      EntryPoint) noexcept(false);
+
     void Initialize(IMemoryAllocator&       Allocator,
                     const ResourceCounters& Counters,
                     Uint32                  NumShaderStageInputs,
@@ -45,8 +45,35 @@ enum SPIRV_OPTIMIZATION_FLAGS : Uint32
 DEFINE_FLAG_ENUM_OPERATORS(SPIRV_OPTIMIZATION_FLAGS);
 
 
+/// Runs the optimization passes on the SPIR-V byte code.
+
+/// Optimizers with pre-registered passes are pooled and reused by all threads.
+/// Results are cached by the content of the source byte code, the target environment
+/// and the passes, so that identical inputs are never optimized twice.
+/// If TargetEnv is SPV_ENV_MAX, it is derived from the SPIR-V version.
+/// Returns an empty vector if the optimization failed.
 std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
                                     spv_target_env               TargetEnv,
                                     SPIRV_OPTIMIZATION_FLAGS     Passes);
 
+/// Sets the maximum size in bytes of the source and optimized byte code kept
+/// in the optimization cache. Zero disables the cache.
+void SetSPIRVOptimizationCacheSize(size_t MaxSize);
+
+struct SPIRVOptimizationStatistics
+{
+    /// The number of times the optimizer was run.
+    Uint32 NumOptimizations = 0;
+
+    /// The number of times the result was found in the cache.
+    Uint32 NumCacheHits = 0;
+
+    /// The number of optimizers created by the pool.
+    Uint32 NumOptimizersCreated = 0;
+
+    /// The current cache size in bytes.
+    size_t CacheSize = 0;
+};
+void GetSPIRVOptimizationStatistics(SPIRVOptimizationStatistics& Stats);
+
 } // namespace Diligent
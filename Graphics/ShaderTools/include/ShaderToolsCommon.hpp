@@ -30,6 +30,7 @@
 #include <functional>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "GraphicsTypes.h"
 #include "Shader.h"
@@ -137,6 +138,12 @@ struct ShaderIncludePreprocessInfo
 /// Includes are processed in a depth-first order such that original source file is processed last.
 bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept;
 
+/// Returns the paths of the files directly included by the shader source, in the order
+/// they appear in the source. ShaderCI is only used to format error messages.
+/// The function throws std::pair<std::string, std::string> (file info, error) if the
+/// source can't be parsed.
+std::vector<std::string> FindShaderIncludes(const ShaderCreateInfo& ShaderCI, const char* Source, size_t SourceLength) noexcept(false);
+
 ///  Unrolls all include files into a single file
 std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false);
 
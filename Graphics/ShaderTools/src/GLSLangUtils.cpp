@@ -31,6 +31,7 @@
 #include <unordered_map>
 #include <memory>
 #include <array>
+#include <string>
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
 #    include <MoltenGLSLToSPIRVConverter/GLSLToSPIRVConverter.h>
@@ -229,6 +230,55 @@ TBuiltInResource InitResources()
     return Resources;
 }
 
+// The resource limits are constant and are shared by all compilation threads
+const TBuiltInResource& GetBuiltInResources()
+{
+    static const TBuiltInResource Resources = InitResources();
+    return Resources;
+}
+
+// Keeps glslang process-wide state alive while a shader is being compiled.
+// glslang reference-counts InitializeProcess/FinalizeProcess calls under its global lock,
+// so a compilation running on a worker thread is not affected if the owner of the
+// initialization (e.g. the render device) calls FinalizeGlslang concurrently.
+// Symbol tables are only built when the counter goes from zero to one.
+class GlslangProcessReference
+{
+public:
+    GlslangProcessReference()
+    {
+        ::glslang::InitializeProcess();
+    }
+    ~GlslangProcessReference()
+    {
+        ::glslang::FinalizeProcess();
+    }
+
+    // clang-format off
+    GlslangProcessReference           (const GlslangProcessReference&) = delete;
+    GlslangProcessReference& operator=(const GlslangProcessReference&) = delete;
+    // clang-format on
+};
+
+// Returns the part of the HLSL preamble that does not depend on the shader.
+// The string is built once and is copied into the per-shader preamble.
+const std::string& GetHLSLPreambleBase(bool RowMajorMatrices)
+{
+    static const std::array<std::string, 2> PreambleBase = []() {
+        std::array<std::string, 2> Preambles;
+        for (size_t RowMajor = 0; RowMajor < Preambles.size(); ++RowMajor)
+        {
+            std::string& Preamble = Preambles[RowMajor];
+            if (RowMajor != 0)
+                Preamble += "#pragma pack_matrix(row_major)\n\n";
+            Preamble.append("#define GLSLANG\n\n");
+            Preamble.append(g_HLSLDefinitions);
+        }
+        return Preambles;
+    }();
+    return PreambleBase[RowMajorMatrices ? 1 : 0];
+}
+
 void LogCompilerError(const char* DebugOutputMessage,
                       const char* InfoLog,
                       const char* InfoDebugLog,
@@ -265,7 +315,7 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
 {
     Shader.setAutoMapBindings(true);
     Shader.setAutoMapLocations(true);
-    TBuiltInResource Resources = InitResources();
+    const TBuiltInResource& Resources = GetBuiltInResources();
 
     auto ParseResult = pIncluder != nullptr ?
         Shader.parse(&Resources, 100, shProfile, false, false, messages, *pIncluder) :
@@ -431,6 +481,8 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       const char*             ExtraDefinitions,
                                       IDataBlob**             ppCompilerOutput)
 {
+    GlslangProcessReference GlslangRef;
+
     EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
     ::glslang::TShader Shader{ShLang};
     EShMessages        messages  = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
@@ -451,11 +503,11 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
 
     const auto SourceData = ReadShaderSourceFile(ShaderCI);
 
+    const std::string& PreambleBase = GetHLSLPreambleBase((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0);
+
     std::string Preamble;
-    if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
-        Preamble += "#pragma pack_matrix(row_major)\n\n";
-    Preamble.append("#define GLSLANG\n\n");
-    Preamble.append(g_HLSLDefinitions);
+    Preamble.reserve(PreambleBase.size() + 1024);
+    Preamble.append(PreambleBase);
     AppendShaderTypeDefinitions(Preamble, ShaderCI.Desc.ShaderType);
 
     if (ExtraDefinitions != nullptr)
@@ -504,6 +556,8 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
 {
     VERIFY_EXPR(Attribs.ShaderSource != nullptr && Attribs.SourceCodeLen > 0);
 
+    GlslangProcessReference GlslangRef;
+
     const EShLanguage  ShLang = ShaderTypeToShLanguage(Attribs.ShaderType);
     ::glslang::TShader Shader(ShLang);
     ::EProfile         shProfile = EProfile::ENoProfile;
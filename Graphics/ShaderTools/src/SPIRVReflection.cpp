@@ -0,0 +1,744 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVReflection.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "spirv.hpp"
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+enum SPIRV_ID_FLAGS : Uint32
+{
+    SPIRV_ID_FLAG_NONE         = 0u,
+    SPIRV_ID_FLAG_BLOCK        = 1u << 0u,
+    SPIRV_ID_FLAG_BUFFER_BLOCK = 1u << 1u,
+    SPIRV_ID_FLAG_NON_WRITABLE = 1u << 2u,
+    SPIRV_ID_FLAG_BUILT_IN     = 1u << 3u,
+    SPIRV_ID_FLAG_ARRAY_STRIDE = 1u << 4u,
+};
+
+// Returns the number of words occupied by the null-terminated literal string
+// or 0 if the string is not terminated within the instruction.
+Uint32 GetLiteralStringWordCount(const uint32_t* pWords, Uint32 NumWords)
+{
+    const char* Str = reinterpret_cast<const char*>(pWords);
+    const void* End = std::memchr(Str, 0, size_t{NumWords} * sizeof(uint32_t));
+    return End != nullptr ? static_cast<Uint32>((static_cast<const char*>(End) - Str) / sizeof(uint32_t) + 1) : 0;
+}
+
+bool IsArrayType(Uint32 OpCode)
+{
+    return OpCode == spv::OpTypeArray || OpCode == spv::OpTypeRuntimeArray;
+}
+
+bool IsImageType(Uint32 OpCode)
+{
+    return OpCode == spv::OpTypeImage || OpCode == spv::OpTypeSampledImage;
+}
+
+} // namespace
+
+bool SPIRVReflection::Parse(const std::vector<uint32_t>& SPIRV)
+{
+    // Header:
+    //      0          1           2           3        4
+    // |  Magic  |  Version  |  Generator  |  Bound  |  Schema  |
+    constexpr size_t HeaderSize = 5;
+    if (SPIRV.size() < HeaderSize || SPIRV[0] != spv::MagicNumber)
+        return false;
+
+    m_Words    = SPIRV.data();
+    m_NumWords = SPIRV.size();
+    m_Version  = SPIRV[1];
+
+    const Uint32 Bound = SPIRV[3];
+    if (Bound > m_NumWords)
+        return false; // Every id must be defined by at least one instruction
+    m_Ids.resize(Bound);
+
+    auto IsValidId = [Bound](Uint32 Id) {
+        return Id != 0 && Id < Bound;
+    };
+
+    for (size_t Offset = HeaderSize; Offset < m_NumWords;)
+    {
+        //      0 (high 16 bits)   0 (low 16 bits)    1 ...
+        // |     Word Count     |      OpCode      |  Operands
+        const Uint32 WordCount = m_Words[Offset] >> 16u;
+        const Uint32 OpCode    = m_Words[Offset] & 0xFFFFu;
+        if (WordCount == 0 || Offset + WordCount > m_NumWords)
+            return false;
+
+        const uint32_t* Ops    = m_Words + Offset + 1;
+        const Uint32    NumOps = WordCount - 1;
+
+        switch (OpCode)
+        {
+            case spv::OpSource:
+                if (NumOps < 1)
+                    return false;
+                m_IsSourceKnown = Ops[0] == spv::SourceLanguageESSL || Ops[0] == spv::SourceLanguageGLSL || Ops[0] == spv::SourceLanguageHLSL;
+                m_IsHLSLSource  = Ops[0] == spv::SourceLanguageHLSL;
+                break;
+
+            case spv::OpExtension:
+                if (GetLiteralStringWordCount(Ops, NumOps) == 0)
+                    return false;
+                if (strcmp(reinterpret_cast<const char*>(Ops), "SPV_GOOGLE_hlsl_functionality1") == 0)
+                    m_UsesHLSLFunctionality1 = true;
+                break;
+
+            case spv::OpName:
+                if (NumOps < 2 || !IsValidId(Ops[0]) || GetLiteralStringWordCount(Ops + 1, NumOps - 1) == 0)
+                    return false;
+                m_Ids[Ops[0]].Name = reinterpret_cast<const char*>(Ops + 1);
+                break;
+
+            case spv::OpEntryPoint:
+            {
+                // | Execution Model | Function | Name | Interface ...
+                if (NumOps < 3)
+                    return false;
+                const Uint32 NameWordCount = GetLiteralStringWordCount(Ops + 2, NumOps - 2);
+                if (NameWordCount == 0)
+                    return false;
+
+                EntryPointInfo EntryPoint;
+                EntryPoint.ExecutionModel  = Ops[0];
+                EntryPoint.FunctionId      = Ops[1];
+                EntryPoint.Name            = reinterpret_cast<const char*>(Ops + 2);
+                EntryPoint.InterfaceOffset = static_cast<Uint32>(Offset + 3 + NameWordCount);
+                EntryPoint.NumInterfaces   = NumOps - 2 - NameWordCount;
+                m_EntryPoints.push_back(EntryPoint);
+                break;
+            }
+
+            case spv::OpExecutionMode:
+                // | Entry Point | Mode | Operands ...
+                if (NumOps < 2)
+                    return false;
+                // Like SPIRV-Cross, only literal local size is reported; LocalSizeId leaves it zero
+                if (Ops[1] == spv::ExecutionModeLocalSize)
+                {
+                    if (NumOps < 5)
+                        return false;
+                    m_ExecutionModes.push_back({Ops[0], Ops[1], static_cast<Uint32>(Offset + 3)});
+                }
+                break;
+
+            case spv::OpDecorate:
+            case spv::OpDecorateString:
+            {
+                // | Target | Decoration | Operands ...
+                if (NumOps < 2 || !IsValidId(Ops[0]))
+                    return false;
+
+                IdInfo& Info = m_Ids[Ops[0]];
+                switch (Ops[1])
+                {
+                    // clang-format off
+                    case spv::DecorationBlock:       Info.Flags |= SPIRV_ID_FLAG_BLOCK;        break;
+                    case spv::DecorationBufferBlock: Info.Flags |= SPIRV_ID_FLAG_BUFFER_BLOCK; break;
+                    case spv::DecorationNonWritable: Info.Flags |= SPIRV_ID_FLAG_NON_WRITABLE; break;
+                    case spv::DecorationBuiltIn:     Info.Flags |= SPIRV_ID_FLAG_BUILT_IN;     break;
+                    // clang-format on
+
+                    case spv::DecorationArrayStride:
+                    case spv::DecorationBinding:
+                    case spv::DecorationDescriptorSet:
+                    case spv::DecorationLocation:
+                        if (NumOps < 3)
+                            return false;
+                        if (Ops[1] == spv::DecorationArrayStride)
+                        {
+                            Info.ArrayStride = Ops[2];
+                            Info.Flags |= SPIRV_ID_FLAG_ARRAY_STRIDE;
+                        }
+                        else
+                        {
+                            Uint32& DecorationOffset = Ops[1] == spv::DecorationBinding ?
+                                Info.BindingOffset :
+                                (Ops[1] == spv::DecorationDescriptorSet ? Info.DescriptorSetOffset : Info.LocationOffset);
+                            DecorationOffset = static_cast<Uint32>(Offset + 3);
+                        }
+                        break;
+
+                    case spv::DecorationHlslSemanticGOOGLE:
+                        if (GetLiteralStringWordCount(Ops + 2, NumOps - 2) == 0)
+                            return false;
+                        Info.HlslSemantic = reinterpret_cast<const char*>(Ops + 2);
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
+            }
+
+            case spv::OpMemberDecorate:
+                // | Structure Type | Member | Decoration | Operands ...
+                if (NumOps < 3 || !IsValidId(Ops[0]))
+                    return false;
+                switch (Ops[2])
+                {
+                    case spv::DecorationOffset:
+                    case spv::DecorationMatrixStride:
+                        if (NumOps < 4)
+                            return false;
+                        m_MemberDecorations.push_back({Ops[0], Ops[1], Ops[2], Ops[3]});
+                        break;
+
+                    case spv::DecorationRowMajor:
+                    case spv::DecorationColMajor:
+                    case spv::DecorationNonWritable:
+                    case spv::DecorationBuiltIn:
+                        m_MemberDecorations.push_back({Ops[0], Ops[1], Ops[2], 0});
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
+
+            case spv::OpDecorationGroup:
+            case spv::OpGroupDecorate:
+            case spv::OpGroupMemberDecorate:
+                // Deprecated decoration groups are not supported
+                return false;
+
+            case spv::OpTypeVoid:
+            case spv::OpTypeBool:
+            case spv::OpTypeInt:
+            case spv::OpTypeFloat:
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            case spv::OpTypeImage:
+            case spv::OpTypeSampler:
+            case spv::OpTypeSampledImage:
+            case spv::OpTypeArray:
+            case spv::OpTypeRuntimeArray:
+            case spv::OpTypeStruct:
+            case spv::OpTypePointer:
+            case spv::OpTypeAccelerationStructureKHR:
+                // | Result | Operands ...
+                if (NumOps < 1 || !IsValidId(Ops[0]))
+                    return false;
+                m_Ids[Ops[0]].DefOffset = static_cast<Uint32>(Offset);
+                break;
+
+            case spv::OpConstant:
+            case spv::OpSpecConstant:
+            case spv::OpVariable:
+                // | Result Type | Result | Operands ...
+                if (NumOps < 3 || !IsValidId(Ops[1]))
+                    return false;
+                m_Ids[Ops[1]].DefOffset = static_cast<Uint32>(Offset);
+                if (OpCode == spv::OpVariable && Ops[2] != spv::StorageClassFunction)
+                    m_Variables.push_back(Ops[1]);
+                break;
+
+            case spv::OpFunction:
+                // All module-level declarations precede function definitions
+                Offset = m_NumWords;
+                continue;
+
+            default:
+                break;
+        }
+
+        Offset += WordCount;
+    }
+
+    std::sort(m_MemberDecorations.begin(), m_MemberDecorations.end(),
+              [](const MemberDecoration& lhs, const MemberDecoration& rhs) {
+                  return lhs.StructId < rhs.StructId || (lhs.StructId == rhs.StructId && lhs.Member < rhs.Member);
+              });
+
+    return true;
+}
+
+Uint32 SPIRVReflection::GetOpCode(Uint32 Id) const
+{
+    if (Id >= m_Ids.size() || m_Ids[Id].DefOffset == 0)
+        return spv::OpNop;
+    return m_Words[m_Ids[Id].DefOffset] & 0xFFFFu;
+}
+
+// Returns the operand of the instruction that defines the id; the operand
+// index is one-based so that the result id of type instructions is operand 1.
+Uint32 SPIRVReflection::GetOperand(Uint32 Id, Uint32 Operand) const
+{
+    VERIFY_EXPR(Id < m_Ids.size() && m_Ids[Id].DefOffset != 0);
+    const Uint32 DefOffset = m_Ids[Id].DefOffset;
+    const Uint32 WordCount = m_Words[DefOffset] >> 16u;
+    return Operand < WordCount ? m_Words[DefOffset + Operand] : 0;
+}
+
+Uint32 SPIRVReflection::StripArrays(Uint32 TypeId) const
+{
+    // OpTypeArray / OpTypeRuntimeArray
+    //      0          1           2           3
+    // |  OpCode  | Result | Element Type | Length |
+    while (IsArrayType(GetOpCode(TypeId)))
+        TypeId = GetOperand(TypeId, 2);
+    return TypeId;
+}
+
+bool SPIRVReflection::GetConstantValue(Uint32 ConstantId, Uint32& Value) const
+{
+    // OpConstant
+    //      0           1          2        3
+    // |  OpCode  | Result Type | Result | Value |
+    //
+    // SPIRV-Cross reports the id of a specialization constant instead of
+    // its value, so specialization constants are not handled here.
+    if (GetOpCode(ConstantId) != spv::OpConstant)
+        return false;
+    Value = GetOperand(ConstantId, 3);
+    return true;
+}
+
+// Returns the size of the innermost array dimension, which is what
+// spirv_cross::SPIRType::array[0] contains.
+bool SPIRVReflection::GetArraySize(Uint32 TypeId, Uint32& ArraySize) const
+{
+    ArraySize = 1;
+    for (Uint32 OpCode = GetOpCode(TypeId); IsArrayType(OpCode); OpCode = GetOpCode(TypeId))
+    {
+        if (OpCode == spv::OpTypeArray)
+        {
+            if (!GetConstantValue(GetOperand(TypeId, 3), ArraySize))
+                return false;
+        }
+        else
+        {
+            ArraySize = 0;
+        }
+        TypeId = GetOperand(TypeId, 2);
+    }
+    return true;
+}
+
+bool SPIRVReflection::GetMemberDecoration(Uint32 StructId, Uint32 Member, Uint32 Decoration, Uint32* pValue) const
+{
+    const MemberDecoration Key{StructId, Member, 0, 0};
+    auto                   range = std::equal_range(m_MemberDecorations.begin(), m_MemberDecorations.end(), Key,
+                                                    [](const MemberDecoration& lhs, const MemberDecoration& rhs) {
+                                    return lhs.StructId < rhs.StructId || (lhs.StructId == rhs.StructId && lhs.Member < rhs.Member);
+                                });
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->Decoration == Decoration)
+        {
+            if (pValue != nullptr)
+                *pValue = it->Value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SPIRVReflection::AllMembersHaveDecoration(Uint32 StructId, Uint32 Decoration) const
+{
+    // OpTypeStruct
+    //      0          1          2 ...
+    // |  OpCode  | Result | Member Types ...
+    const Uint32 NumMembers = (m_Words[m_Ids[StructId].DefOffset] >> 16u) - 2;
+    if (NumMembers == 0)
+        return false;
+    for (Uint32 Member = 0; Member < NumMembers; ++Member)
+    {
+        if (!GetMemberDecoration(StructId, Member, Decoration))
+            return false;
+    }
+    return true;
+}
+
+bool SPIRVReflection::AnyMemberHasDecoration(Uint32 StructId, Uint32 Decoration) const
+{
+    auto it = std::lower_bound(m_MemberDecorations.begin(), m_MemberDecorations.end(), StructId,
+                               [](const MemberDecoration& lhs, Uint32 Id) {
+                                   return lhs.StructId < Id;
+                               });
+    for (; it != m_MemberDecorations.end() && it->StructId == StructId; ++it)
+    {
+        if (it->Decoration == Decoration)
+            return true;
+    }
+    return false;
+}
+
+// Follows spirv_cross::Compiler::get_declared_struct_size()
+bool SPIRVReflection::GetDeclaredStructSize(Uint32 StructId, Uint32& Size) const
+{
+    if (GetOpCode(StructId) != spv::OpTypeStruct)
+        return false;
+
+    const Uint32 NumMembers = (m_Words[m_Ids[StructId].DefOffset] >> 16u) - 2;
+    if (NumMembers == 0)
+        return false;
+
+    // Offsets can be declared out of order, so find the last member
+    Uint32 LastMember    = 0;
+    Uint32 HighestOffset = 0;
+    for (Uint32 Member = 0; Member < NumMembers; ++Member)
+    {
+        Uint32 MemberOffset = 0;
+        if (!GetMemberDecoration(StructId, Member, spv::DecorationOffset, &MemberOffset))
+            return false;
+        if (MemberOffset > HighestOffset)
+        {
+            HighestOffset = MemberOffset;
+            LastMember    = Member;
+        }
+    }
+
+    Uint32 MemberSize = 0;
+    if (!GetDeclaredMemberSize(StructId, LastMember, MemberSize))
+        return false;
+
+    Size = HighestOffset + MemberSize;
+    return true;
+}
+
+// Follows spirv_cross::Compiler::get_declared_struct_member_size()
+bool SPIRVReflection::GetDeclaredMemberSize(Uint32 StructId, Uint32 Member, Uint32& Size) const
+{
+    const Uint32 TypeId = GetOperand(StructId, 2 + Member);
+    const Uint32 OpCode = GetOpCode(TypeId);
+    switch (OpCode)
+    {
+        case spv::OpTypeArray:
+        case spv::OpTypeRuntimeArray:
+        {
+            // Array stride is decorated on the array type
+            if ((m_Ids[TypeId].Flags & SPIRV_ID_FLAG_ARRAY_STRIDE) == 0)
+                return false;
+            Uint32 Length = 0;
+            if (OpCode == spv::OpTypeArray && !GetConstantValue(GetOperand(TypeId, 3), Length))
+                return false;
+            Size = m_Ids[TypeId].ArrayStride * Length;
+            return true;
+        }
+
+        case spv::OpTypeStruct:
+            return GetDeclaredStructSize(TypeId, Size);
+
+        case spv::OpTypePointer:
+            // OpTypePointer
+            //      0          1           2            3
+            // |  OpCode  | Result | Storage Class | Type |
+            if (GetOperand(TypeId, 2) != spv::StorageClassPhysicalStorageBuffer)
+                return false;
+            Size = 8;
+            return true;
+
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+            // |  OpCode  | Result | Width | ...
+            Size = GetOperand(TypeId, 2) / 8;
+            return true;
+
+        case spv::OpTypeVector:
+        {
+            // |  OpCode  | Result | Component Type | Component Count |
+            const Uint32 ComponentType = GetOperand(TypeId, 2);
+            if (GetOpCode(ComponentType) != spv::OpTypeInt && GetOpCode(ComponentType) != spv::OpTypeFloat)
+                return false;
+            Size = GetOperand(TypeId, 3) * (GetOperand(ComponentType, 2) / 8);
+            return true;
+        }
+
+        case spv::OpTypeMatrix:
+        {
+            // |  OpCode  | Result | Column Type | Column Count |
+            Uint32 MatrixStride = 0;
+            if (!GetMemberDecoration(StructId, Member, spv::DecorationMatrixStride, &MatrixStride))
+                return false;
+            if (GetMemberDecoration(StructId, Member, spv::DecorationRowMajor))
+                Size = MatrixStride * GetOperand(GetOperand(TypeId, 2), 3);
+            else if (GetMemberDecoration(StructId, Member, spv::DecorationColMajor))
+                Size = MatrixStride * GetOperand(TypeId, 3);
+            else
+                return false;
+            return true;
+        }
+
+        default:
+            // Opaque types
+            return false;
+    }
+}
+
+const char* SPIRVReflection::GetName(Uint32 Id) const
+{
+    const char* Name = Id < m_Ids.size() ? m_Ids[Id].Name : nullptr;
+    return Name != nullptr ? Name : "";
+}
+
+// Follows spirv_cross::Compiler::get_remapped_declared_block_name()
+const char* SPIRVReflection::GetBlockName(Uint32 VarId, Uint32 BlockTypeId, bool PreferInstanceName)
+{
+    const char* InstanceName = GetName(VarId);
+    if (PreferInstanceName)
+    {
+        if (*InstanceName != '\0')
+            return InstanceName;
+        m_GeneratedNames.emplace_back("_" + std::to_string(VarId));
+        return m_GeneratedNames.back().c_str();
+    }
+
+    const char* BlockName = GetName(BlockTypeId);
+    if (*BlockName != '\0')
+        return BlockName;
+    if (*InstanceName != '\0')
+        return InstanceName;
+
+    m_GeneratedNames.emplace_back("_" + std::to_string(BlockTypeId) + "_" + std::to_string(VarId));
+    return m_GeneratedNames.back().c_str();
+}
+
+bool SPIRVReflection::InitResource(Uint32 VarId, Uint32 BaseTypeId, SPIRVShaderResourceAttribs::ResourceType Type, ResourceInfo& Res) const
+{
+    // OpVariable
+    //      0           1          2            3
+    // |  OpCode  | Result Type | Result | Storage Class |
+    const Uint32 PointeeTypeId = GetOperand(GetOperand(VarId, 1), 3);
+    if (!GetArraySize(PointeeTypeId, Res.ArraySize))
+        return false;
+
+    Res.Type                          = Type;
+    Res.BindingDecorationOffset       = m_Ids[VarId].BindingOffset;
+    Res.DescriptorSetDecorationOffset = m_Ids[VarId].DescriptorSetOffset;
+
+    Uint32 ImageTypeId = BaseTypeId;
+    if (GetOpCode(ImageTypeId) == spv::OpTypeSampledImage)
+        ImageTypeId = GetOperand(ImageTypeId, 2);
+    if (GetOpCode(ImageTypeId) == spv::OpTypeImage)
+    {
+        // OpTypeImage
+        //      0          1          2          3      4        5      6       7           8
+        // |  OpCode  | Result | Sampled Type | Dim | Depth | Arrayed | MS | Sampled | Image Format |
+        const Uint32 Dim     = GetOperand(ImageTypeId, 3);
+        const bool   Arrayed = GetOperand(ImageTypeId, 5) != 0;
+        switch (Dim)
+        {
+            // clang-format off
+            case spv::Dim1D:     Res.ResourceDim = Arrayed ? RESOURCE_DIM_TEX_1D_ARRAY : RESOURCE_DIM_TEX_1D;     break;
+            case spv::Dim2D:     Res.ResourceDim = Arrayed ? RESOURCE_DIM_TEX_2D_ARRAY : RESOURCE_DIM_TEX_2D;     break;
+            case spv::Dim3D:     Res.ResourceDim = RESOURCE_DIM_TEX_3D;                                           break;
+            case spv::DimCube:   Res.ResourceDim = Arrayed ? RESOURCE_DIM_TEX_CUBE_ARRAY : RESOURCE_DIM_TEX_CUBE; break;
+            case spv::DimBuffer: Res.ResourceDim = RESOURCE_DIM_BUFFER;                                           break;
+            // clang-format on
+            default: Res.ResourceDim = RESOURCE_DIM_UNDEFINED;
+        }
+        Res.IsMS = GetOperand(ImageTypeId, 6) != 0;
+    }
+
+    return true;
+}
+
+// Follows spirv_cross::Compiler::get_shader_resources()
+bool SPIRVReflection::LoadResources(const EntryPointInfo& EntryPoint, Resources& Res)
+{
+    std::vector<Uint32> Interface{m_Words + EntryPoint.InterfaceOffset, m_Words + EntryPoint.InterfaceOffset + EntryPoint.NumInterfaces};
+    std::sort(Interface.begin(), Interface.end());
+
+    // In SPIR-V 1.4 and up, every global must be present in the entry point interface list
+    const bool AllGlobalsInInterface = m_Version >= 0x10400;
+
+    // UAVs from HLSL source tend to be declared in a way where the type is reused but the instance
+    // name is significant. If the source language is unknown, detect aliased storage buffer types.
+    bool SSBOInstanceNameIsSignificant = m_IsHLSLSource;
+    if (!m_IsSourceKnown)
+    {
+        std::vector<Uint32> SSBOTypes;
+        for (Uint32 VarId : m_Variables)
+        {
+            const Uint32 PtrTypeId    = GetOperand(VarId, 1);
+            const Uint32 StorageClass = GetOperand(VarId, 3);
+            const Uint32 BaseTypeId   = StripArrays(GetOperand(PtrTypeId, 3));
+            if (StorageClass == spv::StorageClassStorageBuffer ||
+                (StorageClass == spv::StorageClassUniform && (m_Ids[BaseTypeId].Flags & SPIRV_ID_FLAG_BUFFER_BLOCK) != 0))
+            {
+                if (std::find(SSBOTypes.begin(), SSBOTypes.end(), BaseTypeId) != SSBOTypes.end())
+                    SSBOInstanceNameIsSignificant = true;
+                else
+                    SSBOTypes.push_back(BaseTypeId);
+            }
+        }
+    }
+
+    for (Uint32 VarId : m_Variables)
+    {
+        const Uint32 PtrTypeId = GetOperand(VarId, 1);
+        if (GetOpCode(PtrTypeId) != spv::OpTypePointer)
+            return false;
+
+        const Uint32 StorageClass = GetOperand(PtrTypeId, 2);
+        const Uint32 BaseTypeId   = StripArrays(GetOperand(PtrTypeId, 3));
+        const Uint32 BaseOpCode   = GetOpCode(BaseTypeId);
+
+        if (AllGlobalsInInterface || StorageClass == spv::StorageClassInput || StorageClass == spv::StorageClassOutput)
+        {
+            if (!std::binary_search(Interface.begin(), Interface.end(), VarId))
+                continue;
+        }
+
+        const bool IsBuiltIn =
+            (m_Ids[VarId].Flags & SPIRV_ID_FLAG_BUILT_IN) != 0 ||
+            (BaseOpCode == spv::OpTypeStruct && AnyMemberHasDecoration(BaseTypeId, spv::DecorationBuiltIn));
+        if (IsBuiltIn)
+            continue;
+
+        Uint32 ImageDim     = ~0u;
+        Uint32 ImageSampled = 0;
+        if (IsImageType(BaseOpCode))
+        {
+            const Uint32 ImageTypeId = BaseOpCode == spv::OpTypeSampledImage ? GetOperand(BaseTypeId, 2) : BaseTypeId;
+            ImageDim                 = GetOperand(ImageTypeId, 3);
+            ImageSampled             = GetOperand(ImageTypeId, 7);
+        }
+
+        using ResourceType = SPIRVShaderResourceAttribs::ResourceType;
+
+        ResourceInfo Resource;
+        if (StorageClass == spv::StorageClassInput)
+        {
+            StageInputInfo Input;
+            Input.Name                     = (m_Ids[BaseTypeId].Flags & SPIRV_ID_FLAG_BLOCK) != 0 ? GetBlockName(VarId, BaseTypeId, false) : GetName(VarId);
+            Input.Semantic                 = m_Ids[VarId].HlslSemantic;
+            Input.LocationDecorationOffset = m_Ids[VarId].LocationOffset;
+            Res.StageInputs.push_back(Input);
+        }
+        else if (StorageClass == spv::StorageClassUniformConstant && ImageDim == spv::DimSubpassData)
+        {
+            if (!InitResource(VarId, BaseTypeId, ResourceType::InputAttachment, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.SubpassInputs.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassUniform && (m_Ids[BaseTypeId].Flags & SPIRV_ID_FLAG_BLOCK) != 0)
+        {
+            if (!InitResource(VarId, BaseTypeId, ResourceType::UniformBuffer, Resource) ||
+                !GetDeclaredStructSize(BaseTypeId, Resource.BufferStaticSize))
+                return false;
+
+            // See GetUBName() in SPIRVShaderResources.cpp
+            const char* InstanceName = GetName(VarId);
+            Resource.Name            = (m_IsHLSLSource && *InstanceName != '\0') ? InstanceName : GetBlockName(VarId, BaseTypeId, false);
+            Res.UniformBuffers.push_back(Resource);
+        }
+        else if ((StorageClass == spv::StorageClassUniform && (m_Ids[BaseTypeId].Flags & SPIRV_ID_FLAG_BUFFER_BLOCK) != 0) ||
+                 StorageClass == spv::StorageClassStorageBuffer)
+        {
+            const bool IsReadOnly =
+                (m_Ids[VarId].Flags & SPIRV_ID_FLAG_NON_WRITABLE) != 0 ||
+                AllMembersHaveDecoration(BaseTypeId, spv::DecorationNonWritable);
+            if (!InitResource(VarId, BaseTypeId, IsReadOnly ? ResourceType::ROStorageBuffer : ResourceType::RWStorageBuffer, Resource) ||
+                !GetDeclaredStructSize(BaseTypeId, Resource.BufferStaticSize))
+                return false;
+
+            // Runtime array stride
+            const Uint32 NumMembers     = (m_Words[m_Ids[BaseTypeId].DefOffset] >> 16u) - 2;
+            const Uint32 LastMemberType = GetOperand(BaseTypeId, 2 + NumMembers - 1);
+            if (GetOpCode(LastMemberType) == spv::OpTypeRuntimeArray && !IsArrayType(GetOpCode(GetOperand(LastMemberType, 2))))
+            {
+                if ((m_Ids[LastMemberType].Flags & SPIRV_ID_FLAG_ARRAY_STRIDE) == 0)
+                    return false;
+                Resource.BufferStride = m_Ids[LastMemberType].ArrayStride;
+            }
+
+            Resource.Name = GetBlockName(VarId, BaseTypeId, SSBOInstanceNameIsSignificant);
+            Res.StorageBuffers.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassUniformConstant && BaseOpCode == spv::OpTypeImage && ImageSampled == 2)
+        {
+            if (!InitResource(VarId, BaseTypeId, ImageDim == spv::DimBuffer ? ResourceType::StorageTexelBuffer : ResourceType::StorageImage, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.StorageImages.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassUniformConstant && BaseOpCode == spv::OpTypeImage && ImageSampled == 1)
+        {
+            if (!InitResource(VarId, BaseTypeId, ImageDim == spv::DimBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SeparateImage, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.SeparateImages.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassUniformConstant && BaseOpCode == spv::OpTypeSampler)
+        {
+            if (!InitResource(VarId, BaseTypeId, ResourceType::SeparateSampler, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.SeparateSamplers.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassUniformConstant && BaseOpCode == spv::OpTypeSampledImage)
+        {
+            if (!InitResource(VarId, BaseTypeId, ImageDim == spv::DimBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SampledImage, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.SampledImages.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassAtomicCounter)
+        {
+            if (!InitResource(VarId, BaseTypeId, ResourceType::AtomicCounter, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.AtomicCounters.push_back(Resource);
+        }
+        else if (StorageClass == spv::StorageClassUniformConstant && BaseOpCode == spv::OpTypeAccelerationStructureKHR)
+        {
+            if (!InitResource(VarId, BaseTypeId, ResourceType::AccelerationStructure, Resource))
+                return false;
+            Resource.Name = GetName(VarId);
+            Res.AccelerationStructures.push_back(Resource);
+        }
+    }
+
+    for (const ExecutionModeInfo& Mode : m_ExecutionModes)
+    {
+        if (Mode.FunctionId != EntryPoint.FunctionId)
+            continue;
+
+        VERIFY_EXPR(Mode.Mode == spv::ExecutionModeLocalSize);
+        for (size_t i = 0; i < Res.ComputeGroupSize.size(); ++i)
+            Res.ComputeGroupSize[i] = m_Words[Mode.Offset + i];
+    }
+
+    return true;
+}
+
+} // namespace Diligent
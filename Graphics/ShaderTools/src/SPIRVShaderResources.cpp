@@ -34,6 +34,8 @@
 #include "StringTools.hpp"
 #include "Align.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "SPIRVReflection.hpp"
+#include "Serializer.hpp"
 
 namespace Diligent
 {
@@ -125,6 +127,31 @@ SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const diligent_spirv_cros
 // clang-format on
 {}
 
+SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const char*        _Name,
+                                                       ResourceType       _Type,
+                                                       Uint16             _ArraySize,
+                                                       RESOURCE_DIMENSION _ResourceDim,
+                                                       bool               _IsMS,
+                                                       uint32_t           _BindingDecorationOffset,
+                                                       uint32_t           _DescriptorSetDecorationOffset,
+                                                       Uint32             _BufferStaticSize,
+                                                       Uint32             _BufferStride) noexcept :
+    // clang-format off
+    Name                          {_Name},
+    ArraySize                     {_ArraySize},
+    Type                          {_Type},
+    ResourceDim                   {static_cast<Uint8>(_ResourceDim)},
+    IsMS                          {_IsMS ? Uint8{1} : Uint8{0}},
+    BindingDecorationOffset       {_BindingDecorationOffset},
+    DescriptorSetDecorationOffset {_DescriptorSetDecorationOffset},
+    BufferStaticSize              {_BufferStaticSize},
+    BufferStride                  {_BufferStride}
+// clang-format on
+{
+    VERIFY(BindingDecorationOffset != 0, "Resource \'", Name, "\' has no binding decoration");
+    VERIFY(DescriptorSetDecorationOffset != 0, "Resource \'", Name, "\' has no descriptor set decoration");
+}
+
 
 SHADER_RESOURCE_TYPE SPIRVShaderResourceAttribs::GetShaderResourceType(ResourceType Type)
 {
@@ -381,9 +408,22 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
                                            const char*           CombinedSamplerSuffix,
                                            bool                  LoadShaderStageInputs,
                                            bool                  LoadUniformBufferReflection,
-                                           std::string&          EntryPoint) noexcept(false) :
+                                           std::string&          EntryPoint,
+                                           bool                  ForceSPIRVCross) noexcept(false) :
     m_ShaderType{shaderDesc.ShaderType}
 {
+    // Constructing SPIRV-Cross compiler is expensive as it builds the full IR of the module.
+    // The lightweight parser only reads the declarations, which is enough for resource reflection.
+    if (!ForceSPIRVCross && !LoadUniformBufferReflection)
+    {
+        SPIRVReflection Reflection;
+        if (Reflection.Parse(spirv_binary) &&
+            InitializeFromReflection(Allocator, Reflection, shaderDesc, CombinedSamplerSuffix, LoadShaderStageInputs, EntryPoint))
+        {
+            return;
+        }
+    }
+
     // https://github.com/KhronosGroup/SPIRV-Cross/wiki/Reflection-API-user-guide
     diligent_spirv_cross::Parser parser{std::move(spirv_binary)};
     parser.parse();
@@ -714,11 +754,196 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
     {
         VERIFY_EXPR(LoadUniformBufferReflection);
         VERIFY_EXPR(UBReflections.size() == GetNumUBs());
-        m_UBReflectionBuffer = ShaderCodeBufferDescX::PackArray(UBReflections.cbegin(), UBReflections.cend(), GetRawAllocator());
+        m_UBReflectionBuffer = ShaderCodeBufferDescX::PackArray(UBReflections.cbegin(), UBReflections.cend(), Allocator);
     }
     //LOG_INFO_MESSAGE(DumpResources());
 }
 
+bool SPIRVShaderResources::InitializeFromReflection(IMemoryAllocator& Allocator,
+                                                    SPIRVReflection&  Reflection,
+                                                    const ShaderDesc& shaderDesc,
+                                                    const char*       CombinedSamplerSuffix,
+                                                    bool              LoadShaderStageInputs,
+                                                    std::string&      EntryPoint) noexcept(false)
+{
+    // Select the entry point the same way as the SPIRV-Cross path does
+    const spv::ExecutionModel ExecutionModel = ShaderTypeToSpvExecutionModel(shaderDesc.ShaderType);
+
+    const SPIRVReflection::EntryPointInfo* pEntryPoint    = nullptr;
+    Uint32                                 NumEntryPoints = 0;
+    for (const auto& CurrEntryPoint : Reflection.GetEntryPoints())
+    {
+        if (CurrEntryPoint.ExecutionModel != static_cast<Uint32>(ExecutionModel))
+            continue;
+
+        ++NumEntryPoints;
+        if (pEntryPoint == nullptr && (EntryPoint.empty() || EntryPoint == CurrEntryPoint.Name))
+            pEntryPoint = &CurrEntryPoint;
+    }
+    if (NumEntryPoints == 0)
+    {
+        LOG_ERROR_AND_THROW("Unable to find entry point of type ", GetShaderTypeLiteralName(shaderDesc.ShaderType), " in SPIRV binary for shader '", shaderDesc.Name, "'");
+    }
+    if (pEntryPoint == nullptr)
+    {
+        // Let SPIRV-Cross report the error
+        return false;
+    }
+
+    SPIRVReflection::Resources resources;
+    if (!Reflection.LoadResources(*pEntryPoint, resources))
+        return false;
+
+    // The SPIRV-Cross path warns about every entry point of the same type other than the one selected
+    for (Uint32 i = EntryPoint.empty() ? 1 : 0; i < NumEntryPoints; ++i)
+    {
+        LOG_WARNING_MESSAGE("More than one entry point of type ", GetShaderTypeLiteralName(shaderDesc.ShaderType), " found in SPIRV binary for shader '", shaderDesc.Name, "'. The first one ('", pEntryPoint->Name, "') will be used.");
+    }
+    if (EntryPoint.empty())
+        EntryPoint = pEntryPoint->Name;
+
+    m_IsHLSLSource = Reflection.IsHLSLSource();
+
+    size_t ResourceNamesPoolSize = 0;
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please account for the new resource type below");
+    for (const auto* pResType :
+         {
+             &resources.UniformBuffers,
+             &resources.StorageBuffers,
+             &resources.StorageImages,
+             &resources.SampledImages,
+             &resources.AtomicCounters,
+             &resources.SeparateImages,
+             &resources.SeparateSamplers,
+             &resources.SubpassInputs,
+             &resources.AccelerationStructures //
+         })                                    //
+    {
+        for (const auto& res : *pResType)
+            ResourceNamesPoolSize += strlen(res.Name) + 1;
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+    }
+
+    VERIFY_EXPR(shaderDesc.Name != nullptr);
+    ResourceNamesPoolSize += strlen(shaderDesc.Name) + 1;
+
+    Uint32 NumShaderStageInputs = 0;
+
+    if (!m_IsHLSLSource || resources.StageInputs.empty())
+        LoadShaderStageInputs = false;
+    if (LoadShaderStageInputs)
+    {
+        if (Reflection.UsesHLSLFunctionality1())
+        {
+            for (const auto& Input : resources.StageInputs)
+            {
+                if (Input.Semantic != nullptr)
+                {
+                    ResourceNamesPoolSize += strlen(Input.Semantic) + 1;
+                    ++NumShaderStageInputs;
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("Shader input '", Input.Name, "' does not have DecorationHlslSemanticGOOGLE decoration, which is unexpected as the shader declares SPV_GOOGLE_hlsl_functionality1 extension");
+                }
+            }
+        }
+        else
+        {
+            LoadShaderStageInputs = false;
+            LOG_WARNING_MESSAGE("SPIRV byte code of shader '", shaderDesc.Name,
+                                "' does not use SPV_GOOGLE_hlsl_functionality1 extension. "
+                                "As a result, it is not possible to get semantics of shader inputs and map them to proper locations. "
+                                "The shader will still work correctly if all attributes are declared in ascending order without any gaps. "
+                                "Enable SPV_GOOGLE_hlsl_functionality1 in your compiler to allow proper mapping of vertex shader inputs.");
+        }
+    }
+
+    ResourceCounters ResCounters;
+    ResCounters.NumUBs          = static_cast<Uint32>(resources.UniformBuffers.size());
+    ResCounters.NumSBs          = static_cast<Uint32>(resources.StorageBuffers.size());
+    ResCounters.NumImgs         = static_cast<Uint32>(resources.StorageImages.size());
+    ResCounters.NumSmpldImgs    = static_cast<Uint32>(resources.SampledImages.size());
+    ResCounters.NumACs          = static_cast<Uint32>(resources.AtomicCounters.size());
+    ResCounters.NumSepSmplrs    = static_cast<Uint32>(resources.SeparateSamplers.size());
+    ResCounters.NumSepImgs      = static_cast<Uint32>(resources.SeparateImages.size());
+    ResCounters.NumInptAtts     = static_cast<Uint32>(resources.SubpassInputs.size());
+    ResCounters.NumAccelStructs = static_cast<Uint32>(resources.AccelerationStructures.size());
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please set the new resource type counter here");
+
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, ResCounters, NumShaderStageInputs, ResourceNamesPoolSize, ResourceNamesPool);
+
+    auto InitResources = [&](const std::vector<SPIRVReflection::ResourceInfo>& Resources, Uint32 NumResources, Uint32 Offset) {
+        VERIFY_EXPR(Resources.size() == NumResources);
+        for (Uint32 i = 0; i < NumResources; ++i)
+        {
+            const auto& Res = Resources[i];
+            VERIFY(Res.ArraySize <= std::numeric_limits<Uint16>::max(), "Array size exceeds maximum representable value ", std::numeric_limits<Uint16>::max());
+            new (&GetResAttribs(i, NumResources, Offset)) SPIRVShaderResourceAttribs //
+                {
+                    ResourceNamesPool.CopyString(Res.Name),
+                    Res.Type,
+                    static_cast<Uint16>(Res.ArraySize),
+                    Res.ResourceDim,
+                    Res.IsMS,
+                    Res.BindingDecorationOffset,
+                    Res.DescriptorSetDecorationOffset,
+                    Res.BufferStaticSize,
+                    Res.BufferStride //
+                };
+        }
+    };
+    InitResources(resources.UniformBuffers, GetNumUBs(), 0);
+    InitResources(resources.StorageBuffers, GetNumSBs(), m_StorageBufferOffset);
+    InitResources(resources.SampledImages, GetNumSmpldImgs(), m_SampledImageOffset);
+    InitResources(resources.StorageImages, GetNumImgs(), m_StorageImageOffset);
+    InitResources(resources.AtomicCounters, GetNumACs(), m_AtomicCounterOffset);
+    InitResources(resources.SeparateSamplers, GetNumSepSmplrs(), m_SeparateSamplerOffset);
+    InitResources(resources.SeparateImages, GetNumSepImgs(), m_SeparateImageOffset);
+    InitResources(resources.SubpassInputs, GetNumInptAtts(), m_InputAttachmentOffset);
+    InitResources(resources.AccelerationStructures, GetNumAccelStructs(), m_AccelStructOffset);
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please initialize SPIRVShaderResourceAttribs for the new resource type here");
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(shaderDesc.Name);
+
+    if (LoadShaderStageInputs)
+    {
+        Uint32 CurrStageInput = 0;
+        for (const auto& Input : resources.StageInputs)
+        {
+            if (Input.Semantic != nullptr)
+            {
+                VERIFY(Input.LocationDecorationOffset != 0, "Shader input '", Input.Name, "' has no location decoration");
+                new (&GetShaderStageInputAttribs(CurrStageInput++)) SPIRVShaderStageInputAttribs //
+                    {
+                        ResourceNamesPool.CopyString(Input.Semantic),
+                        Input.LocationDecorationOffset //
+                    };
+            }
+        }
+        VERIFY_EXPR(CurrStageInput == GetNumShaderStageInputs());
+    }
+
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+
+    if (shaderDesc.ShaderType == SHADER_TYPE_COMPUTE)
+    {
+        m_ComputeGroupSize = resources.ComputeGroupSize;
+    }
+
+    return true;
+}
+
 void SPIRVShaderResources::Initialize(IMemoryAllocator&       Allocator,
                                       const ResourceCounters& Counters,
                                       Uint32                  NumShaderStageInputs,
@@ -817,6 +1042,251 @@ SPIRVShaderResources::~SPIRVShaderResources()
     static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please add destructor for the new resource");
 }
 
+namespace
+{
+
+template <SerializerMode Mode>
+bool SerializeResourceData(Serializer<Mode>&           Ser,
+                           const SPIRVShaderResources& Resources,
+                           const std::string&          EntryPoint)
+{
+    static_assert(Mode != SerializerMode::Read, "Use the SPIRVShaderResources constructor to read the data");
+
+    const char*  pEntryPoint          = EntryPoint.c_str();
+    const Uint32 ShaderType           = Resources.GetShaderType();
+    const Uint32 NumShaderStageInputs = Resources.GetNumShaderStageInputs();
+    const Uint8  IsHLSLSource         = Resources.IsHLSLSource() ? 1 : 0;
+    // clang-format off
+    const Uint32 Counters[] =
+    {
+        Resources.GetNumUBs(),
+        Resources.GetNumSBs(),
+        Resources.GetNumImgs(),
+        Resources.GetNumSmpldImgs(),
+        Resources.GetNumACs(),
+        Resources.GetNumSepSmplrs(),
+        Resources.GetNumSepImgs(),
+        Resources.GetNumInptAtts(),
+        Resources.GetNumAccelStructs()
+    };
+    // clang-format on
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please serialize the new resource type counter");
+
+    if (!Ser(ShaderType, pEntryPoint, IsHLSLSource, Resources.GetComputeGroupSize(), Counters, NumShaderStageInputs))
+        return false;
+
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+    {
+        const SPIRVShaderResourceAttribs& Res = Resources.GetResource(i);
+
+        const Uint8 ResourceDim = Res.ResourceDim;
+        const Uint8 IsMS        = Res.IsMS;
+        if (!Ser(Res.Name, Res.Type, Res.ArraySize, ResourceDim, IsMS, Res.BindingDecorationOffset, Res.DescriptorSetDecorationOffset, Res.BufferStaticSize, Res.BufferStride))
+            return false;
+    }
+
+    for (Uint32 i = 0; i < NumShaderStageInputs; ++i)
+    {
+        const SPIRVShaderStageInputAttribs& Input = Resources.GetShaderStageInputAttribs(i);
+        if (!Ser(Input.Semantic, Input.LocationDecorationOffset))
+            return false;
+    }
+
+    return true;
+}
+
+constexpr size_t ResourceDataFooterSize = 3; // Data size, version, magic
+
+} // namespace
+
+SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator& Allocator,
+                                           const void*       pData,
+                                           size_t            DataSize,
+                                           size_t            SPIRVWordCount,
+                                           const ShaderDesc& shaderDesc,
+                                           const char*       CombinedSamplerSuffix,
+                                           std::string&      EntryPoint) noexcept(false) :
+    m_ShaderType{shaderDesc.ShaderType}
+{
+#define CHECK_RESOURCE_DATA(Expr)                                                                                   \
+    do                                                                                                              \
+    {                                                                                                               \
+        if (!(Expr))                                                                                                \
+            LOG_ERROR_AND_THROW("Serialized resources of shader '", shaderDesc.Name, "' are invalid or corrupted"); \
+    } while (false)
+
+    // Decoration offsets are used to patch the SPIRV when the pipeline is created, so an offset
+    // outside of the module (e.g. in a corrupted cache file) would result in out-of-bounds writes.
+    // The first words of the module are the header, which never contains decorations.
+    constexpr size_t SPIRVHeaderSize         = 5;
+    const auto       IsValidDecorationOffset = [SPIRVWordCount](Uint32 Offset) {
+        return Offset >= SPIRVHeaderSize && Offset < SPIRVWordCount;
+    };
+
+    Serializer<SerializerMode::Read> Ser{SerializedData{const_cast<void*>(pData), DataSize}};
+
+    Uint32      ShaderType           = 0;
+    const char* SerializedEntryPoint = nullptr;
+    Uint8       IsHLSLSource         = 0;
+    Uint32      Counters[9]          = {};
+    Uint32      NumShaderStageInputs = 0;
+    CHECK_RESOURCE_DATA(Ser(ShaderType, SerializedEntryPoint, IsHLSLSource, m_ComputeGroupSize, Counters, NumShaderStageInputs));
+    CHECK_RESOURCE_DATA(ShaderType == static_cast<Uint32>(shaderDesc.ShaderType));
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please read the new resource type counter");
+
+    if (!EntryPoint.empty() && EntryPoint != SerializedEntryPoint)
+    {
+        LOG_ERROR_AND_THROW("Entry point '", EntryPoint, "' does not match the entry point '", SerializedEntryPoint, "' of serialized resources of shader '", shaderDesc.Name, "'");
+    }
+    EntryPoint     = SerializedEntryPoint;
+    m_IsHLSLSource = IsHLSLSource != 0;
+
+    ResourceCounters ResCounters;
+    ResCounters.NumUBs          = Counters[0];
+    ResCounters.NumSBs          = Counters[1];
+    ResCounters.NumImgs         = Counters[2];
+    ResCounters.NumSmpldImgs    = Counters[3];
+    ResCounters.NumACs          = Counters[4];
+    ResCounters.NumSepSmplrs    = Counters[5];
+    ResCounters.NumSepImgs      = Counters[6];
+    ResCounters.NumInptAtts     = Counters[7];
+    ResCounters.NumAccelStructs = Counters[8];
+
+    Uint32 TotalResources = 0;
+    for (Uint32 Count : Counters)
+        TotalResources += Count;
+    CHECK_RESOURCE_DATA(TotalResources <= std::numeric_limits<OffsetType>::max() && NumShaderStageInputs <= std::numeric_limits<OffsetType>::max());
+
+    // Names are read in place first to compute the size of the names pool
+    struct ResourceData
+    {
+        const char* Name                          = nullptr;
+        Uint8       Type                          = 0;
+        Uint16      ArraySize                     = 0;
+        Uint8       ResourceDim                   = 0;
+        Uint8       IsMS                          = 0;
+        Uint32      BindingDecorationOffset       = 0;
+        Uint32      DescriptorSetDecorationOffset = 0;
+        Uint32      BufferStaticSize              = 0;
+        Uint32      BufferStride                  = 0;
+    };
+    std::vector<ResourceData> Resources(TotalResources);
+
+    size_t ResourceNamesPoolSize = 0;
+    for (ResourceData& Res : Resources)
+    {
+        CHECK_RESOURCE_DATA(Ser(Res.Name, Res.Type, Res.ArraySize, Res.ResourceDim, Res.IsMS, Res.BindingDecorationOffset, Res.DescriptorSetDecorationOffset, Res.BufferStaticSize, Res.BufferStride));
+        CHECK_RESOURCE_DATA(Res.Type < SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes);
+        CHECK_RESOURCE_DATA(IsValidDecorationOffset(Res.BindingDecorationOffset) && IsValidDecorationOffset(Res.DescriptorSetDecorationOffset));
+        ResourceNamesPoolSize += strlen(Res.Name) + 1;
+    }
+
+    std::vector<std::pair<const char*, Uint32>> StageInputs(NumShaderStageInputs);
+    for (auto& Input : StageInputs)
+    {
+        CHECK_RESOURCE_DATA(Ser(Input.first, Input.second));
+        CHECK_RESOURCE_DATA(IsValidDecorationOffset(Input.second));
+        ResourceNamesPoolSize += strlen(Input.first) + 1;
+    }
+    CHECK_RESOURCE_DATA(Ser.IsEnded());
+
+    if (CombinedSamplerSuffix != nullptr)
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+
+    VERIFY_EXPR(shaderDesc.Name != nullptr);
+    ResourceNamesPoolSize += strlen(shaderDesc.Name) + 1;
+
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, ResCounters, NumShaderStageInputs, ResourceNamesPoolSize, ResourceNamesPool);
+
+    for (Uint32 i = 0; i < TotalResources; ++i)
+    {
+        const ResourceData& Res = Resources[i];
+        new (&GetResource(i)) SPIRVShaderResourceAttribs //
+            {
+                ResourceNamesPool.CopyString(Res.Name),
+                static_cast<SPIRVShaderResourceAttribs::ResourceType>(Res.Type),
+                Res.ArraySize,
+                static_cast<RESOURCE_DIMENSION>(Res.ResourceDim),
+                Res.IsMS != 0,
+                Res.BindingDecorationOffset,
+                Res.DescriptorSetDecorationOffset,
+                Res.BufferStaticSize,
+                Res.BufferStride //
+            };
+    }
+
+    for (Uint32 i = 0; i < NumShaderStageInputs; ++i)
+    {
+        new (&GetShaderStageInputAttribs(i)) SPIRVShaderStageInputAttribs //
+            {
+                ResourceNamesPool.CopyString(StageInputs[i].first),
+                StageInputs[i].second //
+            };
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+
+    m_ShaderName = ResourceNamesPool.CopyString(shaderDesc.Name);
+
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+
+#undef CHECK_RESOURCE_DATA
+}
+
+void SPIRVShaderResources::AppendToBytecode(std::vector<uint32_t>& Bytecode, const std::string& EntryPoint) const
+{
+    Serializer<SerializerMode::Measure> MeasureSer;
+    SerializeResourceData(MeasureSer, *this, EntryPoint);
+
+    const size_t DataSize   = MeasureSer.GetSize();
+    const size_t DataOffset = Bytecode.size();
+    Bytecode.resize(DataOffset + AlignUp(DataSize, sizeof(uint32_t)) / sizeof(uint32_t) + ResourceDataFooterSize);
+
+    Serializer<SerializerMode::Write> Ser{SerializedData{&Bytecode[DataOffset], DataSize}};
+    if (!SerializeResourceData(Ser, *this, EntryPoint))
+        UNEXPECTED("Failed to serialize shader resources");
+    VERIFY_EXPR(Ser.IsEnded());
+
+    uint32_t* pFooter = &Bytecode[Bytecode.size() - ResourceDataFooterSize];
+    pFooter[0]        = static_cast<uint32_t>(DataSize);
+    pFooter[1]        = ResourceDataVersion;
+    pFooter[2]        = ResourceDataMagic;
+}
+
+bool SPIRVShaderResources::SplitBytecode(const void*  pBytecode,
+                                         size_t       BytecodeSize,
+                                         size_t&      SPIRVSize,
+                                         const void*& pResourceData,
+                                         size_t&      ResourceDataSize)
+{
+    SPIRVSize        = BytecodeSize;
+    pResourceData    = nullptr;
+    ResourceDataSize = 0;
+
+    const size_t NumWords = BytecodeSize / sizeof(uint32_t);
+    if (pBytecode == nullptr || NumWords < ResourceDataFooterSize + 1)
+        return false;
+
+    const uint32_t* pWords  = static_cast<const uint32_t*>(pBytecode);
+    const uint32_t* pFooter = pWords + NumWords - ResourceDataFooterSize;
+    if (pFooter[2] != ResourceDataMagic)
+        return false;
+
+    const size_t DataWords = AlignUp(size_t{pFooter[0]}, sizeof(uint32_t)) / sizeof(uint32_t);
+    if (DataWords + ResourceDataFooterSize >= NumWords)
+        return false;
+
+    SPIRVSize = (NumWords - ResourceDataFooterSize - DataWords) * sizeof(uint32_t);
+    if (pFooter[1] != ResourceDataVersion)
+        return false;
+
+    pResourceData    = pWords + NumWords - ResourceDataFooterSize - DataWords;
+    ResourceDataSize = pFooter[0];
+    return true;
+}
+
 void SPIRVShaderResources::MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV) const
 {
     VERIFY(IsHLSLSource(), "This method is only relevant for HLSL source");
@@ -25,7 +25,14 @@
  */
 
 #include "SPIRVTools.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 #include "DebugUtilities.hpp"
+#include "HashUtils.hpp"
+#include "LRUCache.hpp"
 
 #include "spirv-tools/optimizer.hpp"
 
@@ -105,17 +112,93 @@ spv_target_env SpvTargetEnvFromSPIRV(const std::vector<uint32_t>& SPIRV)
     }
 }
 
-} // namespace
-
-std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+// Pool of optimizers with pre-registered passes.
+// Registering the passes is relatively expensive, so optimizers are reused. An optimizer is
+// not thread-safe and is exclusively owned by the thread that acquired it until it is released.
+class SPIRVOptimizerPool
 {
-    VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+public:
+    static SPIRVOptimizerPool& Get()
+    {
+        static SPIRVOptimizerPool Pool;
+        return Pool;
+    }
 
-    if (TargetEnv == SPV_ENV_MAX)
-        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+    std::unique_ptr<spvtools::Optimizer> Acquire(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+
+            auto it = m_Optimizers.find(GetKey(TargetEnv, Passes));
+            if (it != m_Optimizers.end() && !it->second.empty())
+            {
+                std::unique_ptr<spvtools::Optimizer> pOptimizer = std::move(it->second.back());
+                it->second.pop_back();
+                return pOptimizer;
+            }
+        }
+
+        m_NumOptimizersCreated.fetch_add(1);
+        return CreateOptimizer(TargetEnv, Passes);
+    }
+
+    void Release(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes, std::unique_ptr<spvtools::Optimizer>&& pOptimizer)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_Optimizers[GetKey(TargetEnv, Passes)].emplace_back(std::move(pOptimizer));
+    }
+
+    Uint32 GetNumOptimizersCreated() const
+    {
+        return m_NumOptimizersCreated.load();
+    }
+
+private:
+    static Uint64 GetKey(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+    {
+        return (Uint64{static_cast<Uint32>(TargetEnv)} << 32u) | Uint64{Passes};
+    }
+
+    static std::unique_ptr<spvtools::Optimizer> CreateOptimizer(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+    {
+        std::unique_ptr<spvtools::Optimizer> pOptimizer = std::make_unique<spvtools::Optimizer>(TargetEnv);
+        pOptimizer->SetMessageConsumer(SpvOptimizerMessageConsumer);
+
+        // SPIR-V bytecode generated from HLSL must be legalized to
+        // turn it into a valid vulkan SPIR-V shader.
+        if (Passes & SPIRV_OPTIMIZATION_FLAG_LEGALIZATION)
+        {
+            pOptimizer->RegisterLegalizationPasses();
+        }
+
+        if (Passes & SPIRV_OPTIMIZATION_FLAG_PERFORMANCE)
+        {
+            pOptimizer->RegisterPerformancePasses();
+        }
+
+        if (Passes & SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION)
+        {
+            // Decorations defined in SPV_GOOGLE_hlsl_functionality1 are the only instructions
+            // removed by strip-reflect-info pass. SPIRV offsets become INVALID after this operation.
+            pOptimizer->RegisterPass(spvtools::CreateStripReflectInfoPass());
+        }
+
+        return pOptimizer;
+    }
+
+private:
+    std::mutex m_Mtx;
+
+    std::unordered_map<Uint64, std::vector<std::unique_ptr<spvtools::Optimizer>>> m_Optimizers;
 
-    spvtools::Optimizer SpirvOptimizer(TargetEnv);
-    SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
+    std::atomic<Uint32> m_NumOptimizersCreated{0};
+};
+
+std::vector<uint32_t> RunOptimizer(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+{
+    SPIRVOptimizerPool& Pool = SPIRVOptimizerPool::Get();
+
+    std::unique_ptr<spvtools::Optimizer> pOptimizer = Pool.Acquire(TargetEnv, Passes);
 
     spvtools::OptimizerOptions Options;
 #ifndef DILIGENT_DEVELOPMENT
@@ -123,34 +206,151 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_t
     Options.set_run_validator(false);
 #endif
 
-    // SPIR-V bytecode generated from HLSL must be legalized to
-    // turn it into a valid vulkan SPIR-V shader.
     if (Passes & SPIRV_OPTIMIZATION_FLAG_LEGALIZATION)
     {
-        SpirvOptimizer.RegisterLegalizationPasses();
-
         spvtools::ValidatorOptions ValidatorOptions;
         ValidatorOptions.SetBeforeHlslLegalization(true);
         Options.set_validator_options(ValidatorOptions);
     }
 
-    if (Passes & SPIRV_OPTIMIZATION_FLAG_PERFORMANCE)
+    std::vector<uint32_t> OptimizedSPIRV;
+    if (!pOptimizer->Run(SrcSPIRV.data(), SrcSPIRV.size(), &OptimizedSPIRV, Options))
+        OptimizedSPIRV.clear();
+
+    Pool.Release(TargetEnv, Passes, std::move(pOptimizer));
+
+    return OptimizedSPIRV;
+}
+
+// Cache of optimization results addressed by the content of the source byte code.
+// The same byte code is typically optimized many times, e.g. reflection is stripped
+// from the shader every time it is used in a new pipeline.
+class SPIRVOptimizationCache
+{
+public:
+    static constexpr size_t DefaultMaxSize = size_t{32} << 20u;
+
+    static SPIRVOptimizationCache& Get()
+    {
+        static SPIRVOptimizationCache Cache;
+        return Cache;
+    }
+
+    std::vector<uint32_t> Optimize(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
     {
-        SpirvOptimizer.RegisterPerformancePasses();
+        if (SrcSPIRV.empty())
+            return {};
+
+        const Key SrcKey{
+            ComputeHashRaw(SrcSPIRV.data(), SrcSPIRV.size() * sizeof(uint32_t)),
+            SrcSPIRV.size(),
+            TargetEnv,
+            Passes,
+        };
+
+        // Concurrent requests for the same byte code wait for the first one to finish
+        bool         IsNewEntry = false;
+        const Result Res        = m_Cache.Get(
+            SrcKey,
+            [&](Result& NewResult, size_t& Size) {
+                NewResult.pSrcSPIRV       = std::make_shared<const std::vector<uint32_t>>(SrcSPIRV);
+                NewResult.pOptimizedSPIRV = std::make_shared<const std::vector<uint32_t>>(RunOptimizer(SrcSPIRV, TargetEnv, Passes));
+
+                Size       = (NewResult.pSrcSPIRV->size() + NewResult.pOptimizedSPIRV->size()) * sizeof(uint32_t);
+                IsNewEntry = true;
+            });
+
+        if (IsNewEntry)
+        {
+            m_NumOptimizations.fetch_add(1);
+        }
+        else if (*Res.pSrcSPIRV == SrcSPIRV)
+        {
+            m_NumCacheHits.fetch_add(1);
+        }
+        else
+        {
+            // Hash collision
+            m_NumOptimizations.fetch_add(1);
+            return RunOptimizer(SrcSPIRV, TargetEnv, Passes);
+        }
+
+        return *Res.pOptimizedSPIRV;
     }
 
-    if (Passes & SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION)
+    void SetMaxSize(size_t MaxSize)
     {
-        // Decorations defined in SPV_GOOGLE_hlsl_functionality1 are the only instructions
-        // removed by strip-reflect-info pass. SPIRV offsets become INVALID after this operation.
-        SpirvOptimizer.RegisterPass(spvtools::CreateStripReflectInfoPass());
+        m_Cache.SetMaxSize(MaxSize);
     }
 
-    std::vector<uint32_t> OptimizedSPIRV;
-    if (!SpirvOptimizer.Run(SrcSPIRV.data(), SrcSPIRV.size(), &OptimizedSPIRV, Options))
-        OptimizedSPIRV.clear();
+    void GetStatistics(SPIRVOptimizationStatistics& Stats) const
+    {
+        Stats.NumOptimizations     = m_NumOptimizations.load();
+        Stats.NumCacheHits         = m_NumCacheHits.load();
+        Stats.NumOptimizersCreated = SPIRVOptimizerPool::Get().GetNumOptimizersCreated();
+        Stats.CacheSize            = m_Cache.GetCurrSize();
+    }
 
-    return OptimizedSPIRV;
+private:
+    SPIRVOptimizationCache()
+    {
+        m_Cache.SetMaxSize(DefaultMaxSize);
+    }
+
+    struct Key
+    {
+        size_t                   Hash     = 0;
+        size_t                   NumWords = 0;
+        spv_target_env           TargetEnv = SPV_ENV_MAX;
+        SPIRV_OPTIMIZATION_FLAGS Passes    = SPIRV_OPTIMIZATION_FLAG_NONE;
+
+        bool operator==(const Key& Other) const
+        {
+            return Hash == Other.Hash && NumWords == Other.NumWords && TargetEnv == Other.TargetEnv && Passes == Other.Passes;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const Key& K) const
+            {
+                return ComputeHash(K.Hash, K.NumWords, static_cast<Uint32>(K.TargetEnv), static_cast<Uint32>(K.Passes));
+            }
+        };
+    };
+
+    struct Result
+    {
+        // The source is kept to resolve hash collisions
+        std::shared_ptr<const std::vector<uint32_t>> pSrcSPIRV;
+        std::shared_ptr<const std::vector<uint32_t>> pOptimizedSPIRV;
+    };
+
+    LRUCache<Key, Result, Key::Hasher> m_Cache;
+
+    std::atomic<Uint32> m_NumOptimizations{0};
+    std::atomic<Uint32> m_NumCacheHits{0};
+};
+
+} // namespace
+
+std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+{
+    VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+
+    if (TargetEnv == SPV_ENV_MAX)
+        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+
+    return SPIRVOptimizationCache::Get().Optimize(SrcSPIRV, TargetEnv, Passes);
+}
+
+void SetSPIRVOptimizationCacheSize(size_t MaxSize)
+{
+    SPIRVOptimizationCache::Get().SetMaxSize(MaxSize);
+}
+
+void GetSPIRVOptimizationStatistics(SPIRVOptimizationStatistics& Stats)
+{
+    SPIRVOptimizationCache::Get().GetStatistics(Stats);
 }
 
 } // namespace Diligent
@@ -28,6 +28,7 @@
 #include "ShaderToolsCommon.hpp"
 
 #include <unordered_set>
+#include <string_view>
 
 #include "BasicFileSystem.hpp"
 #include "DebugUtilities.hpp"
@@ -316,21 +317,15 @@ bool FindIncludes(const char* pBuffer, size_t BufferSize, HandlerType&& IncludeH
     {
         while (pCurrPos < pBufferEnd)
         {
-            pCurrPos = SkipDelimitersAndComments(pCurrPos, pBufferEnd); // May throw
+            pCurrPos = FindNextHash(pCurrPos, pBufferEnd); // May throw
             if (pCurrPos == pBufferEnd)
                 return true;
 
-            if (*pCurrPos != '#')
-            {
-                ++pCurrPos;
-                continue;
-            }
-
             const auto pIncludeStart = pCurrPos;
             // # /* ... */ include <File.h>
             // ^
 
-            auto pLineEnd = SkipLine(pCurrPos, pBufferEnd);
+            auto pLineEnd = FindLineEnd(pCurrPos, pBufferEnd);
 
             pCurrPos = SkipDelimitersAndComments(pIncludeStart + 1, pBufferEnd, " \t", SKIP_COMMENT_FLAG_MULTILINE); // May throw
             if (pCurrPos == pBufferEnd)
@@ -373,9 +368,7 @@ bool FindIncludes(const char* pBuffer, size_t BufferSize, HandlerType&& IncludeH
                 throw ErrorType{pCurrPos, "\'<\' or \'\"\' is expected"};
 
             auto ClosingChar = *pCurrPos == '<' ? '>' : '"';
-            ++pCurrPos;
-            while (pCurrPos < pBufferEnd && *pCurrPos != ClosingChar)
-                ++pCurrPos;
+            pCurrPos         = FindFirstOf(pCurrPos + 1, pBufferEnd, ClosingChar);
 
             if (pCurrPos == pBufferEnd)
                 throw ErrorType{pOpenQuoteOrAngleBracket, (ClosingChar == '>' ? "Unable to find the matching angle bracket" : "Unable to find the matching closing quote")};
@@ -383,7 +376,7 @@ bool FindIncludes(const char* pBuffer, size_t BufferSize, HandlerType&& IncludeH
             if (pCurrPos >= pLineEnd)
                 throw ErrorType{pLineEnd, "New line in the file name."};
 
-            IncludeHandler(std::string{pOpenQuoteOrAngleBracket + 1, pCurrPos}, pIncludeStart - pBuffer, pCurrPos - pBuffer + 1);
+            IncludeHandler(std::string_view{pOpenQuoteOrAngleBracket + 1, static_cast<size_t>(pCurrPos - pOpenQuoteOrAngleBracket - 1)}, pIncludeStart - pBuffer, pCurrPos - pBuffer + 1);
 
             ++pCurrPos;
         }
@@ -434,13 +427,14 @@ void ProcessShaderIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_
 
     FindIncludes(
         FileInfo.Source, FileInfo.SourceLength,
-        [&](const std::string& FilePath, size_t Start, size_t End) //
+        [&](std::string_view Path, size_t Start, size_t End) //
         {
-            if (!Includes.insert(FilePath).second)
+            auto it_inserted = Includes.emplace(Path);
+            if (!it_inserted.second)
                 return;
 
             auto IncludeCI{ShaderCI};
-            IncludeCI.FilePath     = FilePath.c_str();
+            IncludeCI.FilePath     = it_inserted.first->c_str();
             IncludeCI.Source       = nullptr;
             IncludeCI.SourceLength = 0;
             ProcessShaderIncludesImpl(IncludeCI, Includes, IncludeHandler);
@@ -471,52 +465,106 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
     }
 }
 
-static std::string UnrollShaderIncludesImpl(ShaderCreateInfo ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
+std::vector<std::string> FindShaderIncludes(const ShaderCreateInfo& ShaderCI, const char* Source, size_t SourceLength) noexcept(false)
 {
-    const auto SourceData = ReadShaderSourceFile(ShaderCI);
+    std::vector<std::string> Includes;
+    FindIncludes(
+        Source, SourceLength,
+        [&](std::string_view FilePath, size_t /*Start*/, size_t /*End*/) //
+        {
+            Includes.emplace_back(FilePath);
+        },
+        std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+    return Includes;
+}
 
-    ShaderCI.Source       = SourceData.Source;
-    ShaderCI.SourceLength = SourceData.SourceLength;
-    ShaderCI.FilePath     = nullptr;
+namespace
+{
 
-    std::stringstream Stream;
-    size_t            PrevIncludeEnd = 0;
+// Unrolls includes in two passes: the first pass loads all files and collects the
+// chunks of source text in the output order, the second one copies the chunks into
+// a string allocated once. Chunks and include paths reference the loaded file data.
+class ShaderIncludeUnroller
+{
+public:
+    std::string Unroll(const ShaderCreateInfo& ShaderCI) noexcept(false)
+    {
+        if (ShaderCI.FilePath != nullptr)
+            m_Includes.emplace(ShaderCI.FilePath);
 
-    FindIncludes(
-        ShaderCI.Source, ShaderCI.SourceLength, [&](const std::string& Path, size_t IncludeStart, size_t IncludeEnd) {
-            // Insert text before the include start
-            Stream.write(ShaderCI.Source + PrevIncludeEnd, IncludeStart - PrevIncludeEnd);
+        CollectChunks(ShaderCI);
 
-            if (AllIncludes.insert(Path).second)
-            {
-                // Process the #include directive
-                ShaderCreateInfo IncludeCI{ShaderCI};
-                IncludeCI.Source       = nullptr;
-                IncludeCI.SourceLength = 0;
-                IncludeCI.FilePath     = Path.c_str();
-                auto UnrolledInclude   = UnrollShaderIncludesImpl(IncludeCI, AllIncludes);
-                Stream << UnrolledInclude;
-            }
+        std::string Unrolled;
+        Unrolled.reserve(m_TotalSize);
+        for (const std::string_view& Chunk : m_Chunks)
+            Unrolled.append(Chunk.data(), Chunk.size());
+        VERIFY_EXPR(Unrolled.size() == m_TotalSize);
 
-            PrevIncludeEnd = IncludeEnd;
-        },
-        std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+        return Unrolled;
+    }
 
-    // Insert text after the last include
-    Stream.write(ShaderCI.Source + PrevIncludeEnd, ShaderCI.SourceLength - PrevIncludeEnd);
+private:
+    void CollectChunks(ShaderCreateInfo ShaderCI) noexcept(false)
+    {
+        m_Files.emplace_back(ReadShaderSourceFile(ShaderCI));
+
+        const char* const Source         = m_Files.back().Source;
+        const size_t      SourceLength   = m_Files.back().SourceLength;
+        size_t            PrevIncludeEnd = 0;
+
+        ShaderCI.Source       = Source;
+        ShaderCI.SourceLength = SourceLength;
+        ShaderCI.FilePath     = nullptr;
+
+        FindIncludes(
+            Source, SourceLength, [&](std::string_view Path, size_t IncludeStart, size_t IncludeEnd) {
+                // Add text before the include start
+                AddChunk({Source + PrevIncludeEnd, IncludeStart - PrevIncludeEnd});
+
+                if (m_Includes.insert(Path).second)
+                {
+                    // Process the #include directive
+                    const std::string IncludePath{Path};
+
+                    ShaderCreateInfo IncludeCI{ShaderCI};
+                    IncludeCI.Source       = nullptr;
+                    IncludeCI.SourceLength = 0;
+                    IncludeCI.FilePath     = IncludePath.c_str();
+                    CollectChunks(IncludeCI);
+                }
+
+                PrevIncludeEnd = IncludeEnd;
+            },
+            std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+
+        // Add text after the last include
+        AddChunk({Source + PrevIncludeEnd, SourceLength - PrevIncludeEnd});
+    }
 
-    return Stream.str();
-}
+    void AddChunk(std::string_view Chunk)
+    {
+        if (Chunk.empty())
+            return;
+        m_Chunks.emplace_back(Chunk);
+        m_TotalSize += Chunk.size();
+    }
+
+private:
+    // Keeps the file data alive until the output is assembled
+    std::vector<ShaderSourceFileData> m_Files;
+
+    std::vector<std::string_view>        m_Chunks;
+    std::unordered_set<std::string_view> m_Includes;
+    size_t                               m_TotalSize = 0;
+};
+
+} // namespace
 
 std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false)
 {
-    std::unordered_set<std::string> Includes;
-    if (ShaderCI.FilePath != nullptr)
-        Includes.emplace(ShaderCI.FilePath);
-
     try
     {
-        return UnrollShaderIncludesImpl(ShaderCI, Includes);
+        return ShaderIncludeUnroller{}.Unroll(ShaderCI);
     }
     catch (const std::pair<std::string, std::string>& ErrInfo)
     {
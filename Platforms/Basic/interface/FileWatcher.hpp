@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::FileWatcher class
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Watches directories for modified, created, renamed and deleted files.
+
+/// The watcher does not use any threads: file system events are queued by the OS
+/// and collected when PollChanges() is called. File watching is currently implemented
+/// on Linux (inotify); on other platforms AddDirectory() always fails.
+class FileWatcher
+{
+public:
+    FileWatcher() noexcept {}
+    ~FileWatcher();
+
+    // clang-format off
+    FileWatcher           (const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+    FileWatcher           (FileWatcher&&)      = delete;
+    FileWatcher& operator=(FileWatcher&&)      = delete;
+    // clang-format on
+
+    /// Starts watching the directory and all its subdirectories.
+
+    /// \return     true if the directory is being watched, and false otherwise.
+    ///
+    /// \remarks    Subdirectories created after this call are watched automatically.
+    bool AddDirectory(const Char* Path);
+
+    /// Returns true if at least one directory is being watched.
+    bool IsWatching() const { return !m_Directories.empty(); }
+
+    /// Collects the files that have changed since the previous call.
+
+    /// \param [out] ChangedFiles - Paths of the changed files. Every path is the path of the
+    ///                             watched directory as passed to AddDirectory(), followed by
+    ///                             the path of the file relative to it. Each file is reported once.
+    ///
+    /// \return     true if all changes have been reported, and false if some events have been lost
+    ///             (e.g. because the OS event queue overflowed) and any file may have changed.
+    bool PollChanges(std::vector<std::string>& ChangedFiles);
+
+    /// Returns true if file watching is supported on the current platform.
+    static bool IsSupported();
+
+private:
+    bool AddWatch(const std::string& Path);
+
+private:
+#if PLATFORM_LINUX
+    int m_fd = -1;
+#endif
+
+    // Watch descriptor -> directory path
+    std::unordered_map<int, std::string> m_Directories;
+};
+
+} // namespace Diligent
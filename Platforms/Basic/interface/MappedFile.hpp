@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::MappedFile class
+
+#include <stddef.h>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Read-only view of a file mapped into the address space of the process.
+
+/// The view reflects the file contents at the time it was opened. Data appended
+/// to the file after that is not visible until the file is mapped again.
+class MappedFile
+{
+public:
+    MappedFile() noexcept {}
+    ~MappedFile();
+
+    // clang-format off
+    MappedFile           (const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile           (MappedFile&&)      = delete;
+    MappedFile& operator=(MappedFile&&)      = delete;
+    // clang-format on
+
+    /// Maps the file into memory.
+
+    /// \return     true if the file was mapped successfully, and false otherwise.
+    ///             An empty file is opened successfully, but has no data.
+    bool Open(const Char* Path);
+
+    /// Unmaps the file.
+    void Close();
+
+    bool IsOpen() const { return m_IsOpen; }
+
+    const void* GetData() const { return m_pData; }
+    size_t      GetSize() const { return m_Size; }
+
+    /// Returns true if memory mapping is supported on the current platform.
+    static bool IsSupported();
+
+private:
+    const void* m_pData  = nullptr;
+    size_t      m_Size   = 0;
+    bool        m_IsOpen = false;
+#if PLATFORM_WIN32
+    void* m_hFile    = nullptr;
+    void* m_hMapping = nullptr;
+#endif
+};
+
+} // namespace Diligent
@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FileWatcher.hpp"
+
+#if PLATFORM_LINUX
+#    include <dirent.h>
+#    include <sys/inotify.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define DILIGENT_INOTIFY 1
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <unordered_set>
+
+#include "DebugUtilities.hpp"
+#include "Errors.hpp"
+
+namespace Diligent
+{
+
+bool FileWatcher::IsSupported()
+{
+#if DILIGENT_INOTIFY
+    return true;
+#else
+    return false;
+#endif
+}
+
+#if DILIGENT_INOTIFY
+
+namespace
+{
+
+constexpr uint32_t WatchMask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+
+} // namespace
+
+FileWatcher::~FileWatcher()
+{
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+bool FileWatcher::AddWatch(const std::string& Path)
+{
+    const int wd = inotify_add_watch(m_fd, Path.c_str(), WatchMask);
+    if (wd < 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to watch directory '", Path, "': ", strerror(errno));
+        return false;
+    }
+    m_Directories[wd] = Path;
+
+    if (DIR* pDir = opendir(Path.c_str()))
+    {
+        while (const dirent* pEntry = readdir(pDir))
+        {
+            if (strcmp(pEntry->d_name, ".") == 0 || strcmp(pEntry->d_name, "..") == 0)
+                continue;
+
+            std::string EntryPath = Path + '/' + pEntry->d_name;
+
+            bool IsDir = pEntry->d_type == DT_DIR;
+            if (pEntry->d_type == DT_UNKNOWN)
+            {
+                // Not all file systems report the entry type
+                struct stat Stat;
+                IsDir = stat(EntryPath.c_str(), &Stat) == 0 && S_ISDIR(Stat.st_mode);
+            }
+            if (IsDir)
+                AddWatch(EntryPath);
+        }
+        closedir(pDir);
+    }
+
+    return true;
+}
+
+bool FileWatcher::AddDirectory(const Char* Path)
+{
+    VERIFY_EXPR(Path != nullptr);
+    if (m_fd < 0)
+    {
+        m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_fd < 0)
+        {
+            LOG_WARNING_MESSAGE("Failed to initialize inotify: ", strerror(errno));
+            return false;
+        }
+    }
+
+    std::string Dir{Path};
+    while (Dir.length() > 1 && Dir.back() == '/')
+        Dir.pop_back();
+
+    return AddWatch(Dir);
+}
+
+bool FileWatcher::PollChanges(std::vector<std::string>& ChangedFiles)
+{
+    ChangedFiles.clear();
+    if (m_fd < 0)
+        return true;
+
+    bool                            AllReported = true;
+    std::unordered_set<std::string> ReportedFiles;
+
+    alignas(inotify_event) char Buffer[4096];
+    while (true)
+    {
+        const ssize_t Size = read(m_fd, Buffer, sizeof(Buffer));
+        if (Size <= 0)
+        {
+            if (Size < 0 && errno == EINTR)
+                continue;
+            // EAGAIN: no more events
+            break;
+        }
+
+        for (const char* Ptr = Buffer; Ptr < Buffer + Size;)
+        {
+            const inotify_event& Event = *reinterpret_cast<const inotify_event*>(Ptr);
+            Ptr += sizeof(inotify_event) + Event.len;
+
+            if (Event.mask & IN_Q_OVERFLOW)
+            {
+                AllReported = false;
+                continue;
+            }
+
+            auto dir_it = m_Directories.find(Event.wd);
+            if (dir_it == m_Directories.end())
+                continue;
+
+            if (Event.mask & (IN_IGNORED | IN_DELETE_SELF))
+            {
+                // The directory has been removed
+                if (Event.mask & IN_IGNORED)
+                    m_Directories.erase(dir_it);
+                continue;
+            }
+
+            if (Event.len == 0)
+                continue;
+
+            std::string FilePath = dir_it->second + '/' + Event.name;
+            if (Event.mask & IN_ISDIR)
+            {
+                // Files may have been added to the new directory before the watch was created,
+                // so all changes in it can't be reported reliably.
+                if (Event.mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    AddWatch(FilePath);
+                    AllReported = false;
+                }
+                continue;
+            }
+
+            if (ReportedFiles.insert(FilePath).second)
+                ChangedFiles.emplace_back(std::move(FilePath));
+        }
+    }
+
+    return AllReported;
+}
+
+#else
+
+FileWatcher::~FileWatcher()
+{
+}
+
+bool FileWatcher::AddWatch(const std::string& /*Path*/)
+{
+    return false;
+}
+
+bool FileWatcher::AddDirectory(const Char* /*Path*/)
+{
+    return false;
+}
+
+bool FileWatcher::PollChanges(std::vector<std::string>& ChangedFiles)
+{
+    ChangedFiles.clear();
+    return true;
+}
+
+#endif
+
+} // namespace Diligent
@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MappedFile.hpp"
+
+#if PLATFORM_WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <Windows.h>
+#    include "../../../Common/interface/StringTools.hpp"
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define DILIGENT_POSIX_MMAP 1
+#endif
+
+#include <cerrno>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+#include "Errors.hpp"
+
+namespace Diligent
+{
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::IsSupported()
+{
+#if PLATFORM_WIN32 || DILIGENT_POSIX_MMAP
+    return true;
+#else
+    return false;
+#endif
+}
+
+#if PLATFORM_WIN32
+
+bool MappedFile::Open(const Char* Path)
+{
+    VERIFY_EXPR(Path != nullptr);
+    Close();
+
+    const std::wstring PathW = WidenString(Path);
+
+    HANDLE hFile = CreateFileW(PathW.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER FileSize{};
+    if (!GetFileSizeEx(hFile, &FileSize))
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    m_hFile  = hFile;
+    m_IsOpen = true;
+    if (FileSize.QuadPart == 0)
+        return true;
+
+    m_hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_hMapping != nullptr)
+        m_pData = MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (m_pData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to map file '", Path, "' into memory");
+        Close();
+        return false;
+    }
+
+    m_Size = static_cast<size_t>(FileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_pData != nullptr)
+        UnmapViewOfFile(m_pData);
+    if (m_hMapping != nullptr)
+        CloseHandle(m_hMapping);
+    if (m_hFile != nullptr)
+        CloseHandle(m_hFile);
+
+    m_pData    = nullptr;
+    m_Size     = 0;
+    m_hMapping = nullptr;
+    m_hFile    = nullptr;
+    m_IsOpen   = false;
+}
+
+#elif DILIGENT_POSIX_MMAP
+
+bool MappedFile::Open(const Char* Path)
+{
+    VERIFY_EXPR(Path != nullptr);
+    Close();
+
+    const int fd = open(Path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat Stat = {};
+    if (fstat(fd, &Stat) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    m_IsOpen = true;
+    if (Stat.st_size > 0)
+    {
+        void* pData = mmap(nullptr, static_cast<size_t>(Stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (pData != MAP_FAILED)
+        {
+            m_pData = pData;
+            m_Size  = static_cast<size_t>(Stat.st_size);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to map file '", Path, "' into memory: ", strerror(errno));
+            m_IsOpen = false;
+        }
+    }
+
+    // The mapping remains valid after the descriptor is closed
+    close(fd);
+    return m_IsOpen;
+}
+
+void MappedFile::Close()
+{
+    if (m_pData != nullptr)
+        munmap(const_cast<void*>(m_pData), m_Size);
+
+    m_pData  = nullptr;
+    m_Size   = 0;
+    m_IsOpen = false;
+}
+
+#else
+
+bool MappedFile::Open(const Char* /*Path*/)
+{
+    return false;
+}
+
+void MappedFile::Close()
+{
+}
+
+#endif
+
+} // namespace Diligent
@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <thread>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Offset;
+    float4 g_Color;
+};
+
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float4 Color  : COLOR)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos   = float4(PosXY[VertId] * 0.01 + g_Offset.xy, 0.0, 1.0);
+    Color = g_Color;
+}
+)";
+
+const char* const PSSource = R"(
+float4 main(in float4 Pos   : SV_Position,
+            in float4 Color : COLOR) : SV_Target
+{
+    return Color;
+}
+)";
+
+struct Constants
+{
+    float Offset[4];
+    float Color[4];
+};
+
+// Records the same number of draw calls on 1, 2, 4, ... deferred contexts in parallel and
+// measures how the recording time scales with the number of threads. Each draw maps a dynamic
+// constant buffer, so the recording includes validation, state resolution and data copies.
+TEST(DeferredContextsGLBenchmark, RecordingScalability)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not enabled in the testing environment";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Deferred contexts test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Deferred contexts test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Deferred contexts test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    const Uint32 MaxThreads = static_cast<Uint32>(pEnv->GetNumDeferredContexts());
+
+    // Every thread uses its own constant buffer and SRB
+    std::vector<RefCntAutoPtr<IBuffer>>                pCBs(MaxThreads);
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> pSRBs(MaxThreads);
+    for (Uint32 i = 0; i < MaxThreads; ++i)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Deferred contexts test constants";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.Size           = sizeof(Constants);
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pCBs[i]);
+        ASSERT_NE(pCBs[i], nullptr);
+
+        pPSO->CreateShaderResourceBinding(&pSRBs[i], true);
+        ASSERT_NE(pSRBs[i], nullptr);
+        pSRBs[i]->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pCBs[i]);
+    }
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+
+    constexpr Uint32 TotalDraws = 8192;
+
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        const Uint32 DrawsPerThread = TotalDraws / NumThreads;
+
+        std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+        std::vector<std::thread>                 Threads(NumThreads);
+
+        Timer T;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads[t] = std::thread{
+                [&](Uint32 ThreadId) {
+                    IDeviceContext* pCtx = pEnv->GetDeferredContext(ThreadId);
+                    IBuffer*        pCB  = pCBs[ThreadId];
+
+                    pCtx->Begin(0);
+                    pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                    pCtx->SetPipelineState(pPSO);
+                    pCtx->CommitShaderResources(pSRBs[ThreadId], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                    for (Uint32 i = 0; i < DrawsPerThread; ++i)
+                    {
+                        {
+                            MapHelper<Constants> pConstants{pCtx, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+
+                            const Uint32 DrawId = ThreadId * DrawsPerThread + i;
+                            const float  x      = static_cast<float>(DrawId % 64) / 32.f - 1.f;
+                            const float  y      = static_cast<float>((DrawId / 64) % 64) / 32.f - 1.f;
+                            *pConstants         = Constants{{x, y, 0, 0}, {x, y, static_cast<float>(ThreadId + 1) / NumThreads, 1}};
+                        }
+                        pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+                    }
+                    pCtx->FinishCommandList(&CmdLists[ThreadId]);
+                },
+                t};
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+        const double RecordTime = T.GetElapsedTime();
+
+        std::vector<ICommandList*> CmdListPtrs(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            ASSERT_NE(CmdLists[t], nullptr);
+            CmdListPtrs[t] = CmdLists[t];
+        }
+
+        T.Restart();
+        pContext->ExecuteCommandLists(NumThreads, CmdListPtrs.data());
+        pContext->Flush();
+        const double ExecuteTime = T.GetElapsedTime();
+
+        for (Uint32 t = 0; t < NumThreads; ++t)
+            pEnv->GetDeferredContext(t)->FinishFrame();
+        pContext->FinishFrame();
+        pContext->WaitForIdle();
+
+        LOG_INFO_MESSAGE(NumThreads, " recording thread(s): ", TotalDraws, " draws recorded in ", RecordTime * 1000,
+                         " ms, executed in ", ExecuteTime * 1000, " ms");
+    }
+}
+
+} // namespace
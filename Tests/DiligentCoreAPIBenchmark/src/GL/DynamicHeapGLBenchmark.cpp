@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Offset;
+    float4 g_Color;
+};
+
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float4 Color  : COLOR)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos   = float4(PosXY[VertId] * 0.01 + g_Offset.xy, 0.0, 1.0);
+    Color = g_Color;
+}
+)";
+
+const char* const PSSource = R"(
+float4 main(in float4 Pos   : SV_Position,
+            in float4 Color : COLOR) : SV_Target
+{
+    return Color;
+}
+)";
+
+struct Constants
+{
+    float Offset[4];
+    float Color[4];
+};
+
+// Measures the throughput of MapBuffer(MAP_WRITE, MAP_FLAG_DISCARD) followed by a draw call.
+// When the dynamic heap is enabled with --gl_dynamic_heap_size, uniform-only dynamic buffers are
+// suballocated from the heap, while buffers that can also be bound as vertex buffers always use
+// buffer orphaning.
+TEST(DynamicHeapGLBenchmark, MapDiscardThroughput)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Dynamic heap test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Dynamic heap test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Dynamic heap test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    auto RunTest = [&](BIND_FLAGS BindFlags, const char* Name) {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = Name;
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.Size           = sizeof(Constants);
+        BuffDesc.BindFlags      = BindFlags;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+        RefCntAutoPtr<IBuffer> pCB;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pCB);
+        ASSERT_NE(pCB, nullptr);
+
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        pPSO->CreateShaderResourceBinding(&pSRB, true);
+        ASSERT_NE(pSRB, nullptr);
+        pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pCB);
+
+        ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->SetPipelineState(pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        constexpr Uint32 NumFrames     = 16;
+        constexpr Uint32 DrawsPerFrame = 1024;
+
+        Timer T;
+        for (Uint32 frame = 0; frame < NumFrames; ++frame)
+        {
+            for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+            {
+                {
+                    MapHelper<Constants> pConstants{pContext, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+                    ASSERT_NE(pConstants, nullptr);
+
+                    const float x = static_cast<float>(i % 32) / 16.f - 1.f;
+                    const float y = static_cast<float>(i / 32) / 16.f - 1.f;
+                    *pConstants   = Constants{{x, y, 0, 0}, {x, y, static_cast<float>(frame) / NumFrames, 1}};
+                }
+                pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+            }
+            pContext->Flush();
+            pContext->FinishFrame();
+        }
+        pContext->WaitForIdle();
+
+        const double Time = T.GetElapsedTime();
+        LOG_INFO_MESSAGE(Name, ": ", NumFrames * DrawsPerFrame, " map/draw pairs in ", Time * 1000, " ms (",
+                         Time * 1e9 / (NumFrames * DrawsPerFrame), " ns per pair)");
+    };
+
+    RunTest(BIND_UNIFORM_BUFFER | BIND_VERTEX_BUFFER, "Orphaned dynamic buffer");
+    RunTest(BIND_UNIFORM_BUFFER, "Uniform-only dynamic buffer");
+}
+
+} // namespace
@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+#include "GPUTestingEnvironment.hpp"
+#include "PipelineStateCacheGL.h"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+cbuffer Constants
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Color;
+};
+
+struct PSInput
+{
+    float4 Pos   : SV_Position;
+    float4 Color : COLOR;
+};
+
+void main(in  uint    VertId : SV_VertexID,
+          out PSInput PSIn)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    PSIn.Pos   = mul(float4(PosXY[VertId], 0.0, 1.0), g_WorldViewProj);
+    PSIn.Color = g_Color * SCALE;
+}
+)";
+
+const char* const PSSource = R"(
+Texture2D    g_Tex;
+SamplerState g_Tex_sampler;
+
+struct PSInput
+{
+    float4 Pos   : SV_Position;
+    float4 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return PSIn.Color * g_Tex.Sample(g_Tex_sampler, PSIn.Pos.xy) * SCALE;
+}
+)";
+
+// Creates a pipeline with new shader objects so that the device-level program cache is not used.
+// Every Idx produces different GLSL source, so that each pipeline needs its own program binary.
+RefCntAutoPtr<IPipelineState> CreatePSO(IPipelineStateCache* pCache, Uint32 Idx)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    const std::string Scale    = std::to_string(1.0 + Idx / 1024.0);
+    const ShaderMacro Macros[] = {{"SCALE", Scale.c_str()}};
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Macros         = {Macros, _countof(Macros)};
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Program binary cache benchmark VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Program binary cache benchmark PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Program binary cache benchmark";
+
+    PsoCI.pVS       = pVS;
+    PsoCI.pPS       = pPS;
+    PsoCI.pPSOCache = pCache;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    return pPSO;
+}
+
+RefCntAutoPtr<IPipelineStateCache> CreateCache(const void* pData, size_t DataSize, PSO_CACHE_MODE Mode)
+{
+    PipelineStateCacheCreateInfo PSOCacheCI;
+    PSOCacheCI.Desc.Name     = "Program binary cache";
+    PSOCacheCI.Desc.Mode     = Mode;
+    PSOCacheCI.pCacheData    = pData;
+    PSOCacheCI.CacheDataSize = static_cast<Uint32>(DataSize);
+
+    RefCntAutoPtr<IPipelineStateCache> pCache;
+    GPUTestingEnvironment::GetInstance()->GetDevice()->CreatePipelineStateCache(PSOCacheCI, &pCache);
+    return pCache;
+}
+
+// Compares the time to create pipelines whose programs are linked from the shaders with the time
+// to create the same pipelines from the program binaries. Shader compilation is included in both.
+TEST(ProgramBinaryCacheGLBenchmark, PipelineCreation)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<IPipelineStateCache> pStoreCache = CreateCache(nullptr, 0, PSO_CACHE_MODE_STORE);
+    if (!pStoreCache)
+        GTEST_SKIP() << "Program binaries are not supported by this device";
+
+    constexpr Uint32 NumPipelines = 32;
+
+    Timer T;
+
+    const double ColdStart = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+        ASSERT_NE(CreatePSO(pStoreCache, i), nullptr);
+    const double ColdTime = T.GetElapsedTime() - ColdStart;
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pStoreCache->GetData(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    RefCntAutoPtr<IPipelineStateCache> pLoadCache = CreateCache(pData->GetConstDataPtr(), pData->GetSize(), PSO_CACHE_MODE_LOAD);
+    ASSERT_NE(pLoadCache, nullptr);
+
+    const double WarmStart = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+        ASSERT_NE(CreatePSO(pLoadCache, i), nullptr);
+    const double WarmTime = T.GetElapsedTime() - WarmStart;
+
+    RefCntAutoPtr<IPipelineStateCacheGL> pLoadCacheGL{pLoadCache, IID_PipelineStateCacheGL};
+    ASSERT_NE(pLoadCacheGL, nullptr);
+    PipelineStateCacheStatsGL Stats;
+    pLoadCacheGL->GetStats(Stats);
+
+    LOG_INFO_MESSAGE(NumPipelines, " pipelines: ", ColdTime * 1000, " ms without program binaries, ", WarmTime * 1000,
+                     " ms with program binaries (", Stats.NumProgramsLoaded, " programs loaded, ", Stats.NumProgramsRejected, " rejected)");
+}
+
+} // namespace
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "HLSL2GLSLConverter.h"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares converting the entry points of one conversion stream sequentially and from a thread pool
+TEST(HLSL2GLSLConverterBenchmark, ParallelEntryPoints)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+    pConverter->CreateStream("EffectLibrary.hlsl", pShaderSourceFactory, nullptr, 0, &pStream);
+    ASSERT_NE(pStream, nullptr);
+
+    struct EntryPointInfo
+    {
+        const char* Name;
+        SHADER_TYPE Type;
+    };
+    // clang-format off
+    static constexpr EntryPointInfo EntryPoints[] =
+    {
+        {"MeshVS",            SHADER_TYPE_VERTEX },
+        {"ShadowVS",          SHADER_TYPE_VERTEX },
+        {"FullScreenVS",      SHADER_TYPE_VERTEX },
+        {"OpaquePS",          SHADER_TYPE_PIXEL  },
+        {"TransparentPS",     SHADER_TYPE_PIXEL  },
+        {"PostProcessPS",     SHADER_TYPE_PIXEL  },
+        {"UpdateParticlesCS", SHADER_TYPE_COMPUTE},
+        {"BlurCS",            SHADER_TYPE_COMPUTE},
+    };
+    // clang-format on
+    constexpr Uint32 NumEntryPoints = _countof(EntryPoints);
+    constexpr Uint32 NumIterations  = 16;
+    constexpr Uint32 NumConversions = NumEntryPoints * NumIterations;
+
+    auto ConvertEntryPoint = [&](Uint32 Idx) {
+        const EntryPointInfo& EntryPoint = EntryPoints[Idx % NumEntryPoints];
+
+        RefCntAutoPtr<IDataBlob> pGLSLSource;
+        pStream->Convert(EntryPoint.Name, EntryPoint.Type, true, "_sampler", true, false, &pGLSLSource);
+        return pGLSLSource != nullptr;
+    };
+
+    Timer SeqTimer;
+    for (Uint32 i = 0; i < NumConversions; ++i)
+        ASSERT_TRUE(ConvertEntryPoint(i)) << EntryPoints[i % NumEntryPoints].Name;
+    const double SeqTime = SeqTimer.GetElapsedTime();
+
+    const Uint32 NumThreads = std::max(std::thread::hardware_concurrency(), 4u);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Timer ParallelTimer;
+    for (Uint32 i = 0; i < NumConversions; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&, i](Uint32 ThreadId) {
+                             ConvertEntryPoint(i);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    pThreadPool->WaitForAllTasks();
+    const double ParallelTime = ParallelTimer.GetElapsedTime();
+
+    LOG_INFO_MESSAGE("Converted ", NumConversions, " entry points sequentially in ", SeqTime * 1000, " ms; using ",
+                     NumThreads, " threads in ", ParallelTime * 1000, " ms");
+}
+
+} // namespace
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the CPU latency of submitting many small command buffers from the immediate context.
+// When timeline semaphores are available, the queue signals its timeline semaphore with every
+// submission instead of a binary fence, and with the submission thread enabled (--vk_submission_thread)
+// the context does not block on vkQueueSubmit at all. With a software Vulkan implementation
+// (e.g. lavapipe or SwiftShader), vkQueueSubmit executes a large part of the work on the calling thread,
+// so the difference is most visible.
+TEST(CommandQueueSubmitVkBenchmark, SubmitLatency)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    constexpr Uint32 NumFrames       = 16;
+    constexpr Uint32 SubmitsPerFrame = 64;
+    constexpr float  ClearColor[4]   = {0.25f, 0.5f, 0.75f, 1.0f};
+
+    Timer T;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        for (Uint32 i = 0; i < SubmitsPerFrame; ++i)
+        {
+            pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            pContext->Flush();
+        }
+        pContext->FinishFrame();
+    }
+    const double Time = T.GetElapsedTime();
+    pContext->WaitForIdle();
+
+    LOG_INFO_MESSAGE("Command queue submissions: ", NumFrames * SubmitsPerFrame, " submissions in ", Time * 1000, " ms (",
+                     Time * 1e+6 / (NumFrames * SubmitsPerFrame), " us per submission)");
+}
+
+// Measures the CPU cost of signaling a CPU-wait-only fence, which is tracked by the queue sync points.
+TEST(CommandQueueSubmitVkBenchmark, FenceSignal)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    FenceDesc Desc;
+    Desc.Name = "Command queue submit benchmark fence";
+    Desc.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(Desc, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    constexpr Uint64 NumSignals = 256;
+
+    Timer T;
+    for (Uint64 Value = 1; Value <= NumSignals; ++Value)
+    {
+        pContext->EnqueueSignal(pFence, Value);
+        pContext->Flush();
+    }
+    const double Time = T.GetElapsedTime();
+    pFence->Wait(NumSignals);
+
+    LOG_INFO_MESSAGE("Fence signals: ", NumSignals, " signals in ", Time * 1000, " ms (",
+                     Time * 1e+6 / NumSignals, " us per signal)");
+}
+
+} // namespace
@@ -0,0 +1,196 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+
+#include "GPUTestingEnvironment.hpp"
+#include "Timer.hpp"
+#include "CommonlyUsedStates.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float2 UV     : TEX_COORD)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos = float4(PosXY[VertId], 0.0, 1.0);
+    UV  = PosXY[VertId] * float2(0.5, -0.5) + float2(0.5, 0.5);
+}
+)";
+
+const char* const PSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Weights[2];
+};
+
+Texture2D    g_Textures[8];
+SamplerState g_Sampler;
+
+float4 main(in float4 Pos : SV_Position,
+            in float2 UV  : TEX_COORD) : SV_Target
+{
+    float4 Color = float4(0.0, 0.0, 0.0, 0.0);
+    Color += g_Textures[0].Sample(g_Sampler, UV) * g_Weights[0].x;
+    Color += g_Textures[1].Sample(g_Sampler, UV) * g_Weights[0].y;
+    Color += g_Textures[2].Sample(g_Sampler, UV) * g_Weights[0].z;
+    Color += g_Textures[3].Sample(g_Sampler, UV) * g_Weights[0].w;
+    Color += g_Textures[4].Sample(g_Sampler, UV) * g_Weights[1].x;
+    Color += g_Textures[5].Sample(g_Sampler, UV) * g_Weights[1].y;
+    Color += g_Textures[6].Sample(g_Sampler, UV) * g_Weights[1].z;
+    Color += g_Textures[7].Sample(g_Sampler, UV) * g_Weights[1].w;
+    return Color;
+}
+)";
+
+// Measures the CPU cost of committing dynamic descriptor sets. All resources are dynamic variables,
+// so every draw after a commit allocates a new descriptor set and writes all descriptors to it.
+// When descriptor update templates are supported, the writes are done by a single
+// vkUpdateDescriptorSetWithTemplate call from the resource cache data. With a software Vulkan
+// implementation (e.g. lavapipe or SwiftShader), the time is dominated by the descriptor writes.
+TEST(DescriptorUpdateTemplateVkBenchmark, CommitDynamicResources)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Descriptor update template test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Descriptor update template test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Descriptor update template test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    const float Weights[8] = {0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Descriptor update template test constants";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = sizeof(Weights);
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    BufferData InitData{Weights, sizeof(Weights)};
+
+    RefCntAutoPtr<IBuffer> pCB;
+    pDevice->CreateBuffer(BuffDesc, &InitData, &pCB);
+    ASSERT_NE(pCB, nullptr);
+
+    std::array<RefCntAutoPtr<ITexture>, 8> pTextures;
+    std::array<IDeviceObject*, 8>          pSRVs{};
+    for (size_t i = 0; i < pTextures.size(); ++i)
+    {
+        pTextures[i] = pEnv->CreateTexture("Descriptor update template test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 64, 64);
+        ASSERT_NE(pTextures[i], nullptr);
+        pSRVs[i] = pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    RefCntAutoPtr<ISampler> pSampler = pEnv->CreateSampler(Sam_LinearClamp);
+    ASSERT_NE(pSampler, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pCB);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->SetArray(pSRVs.data(), 0, static_cast<Uint32>(pSRVs.size()));
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Sampler")->Set(pSampler);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+
+    // Transition the resources once so that the loop below only measures descriptor set commits
+    pContext->TransitionShaderResources(pSRB);
+
+    constexpr Uint32 NumFrames     = 16;
+    constexpr Uint32 DrawsPerFrame = 1024;
+
+    Timer T;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+        {
+            pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+        }
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+    const double Time = T.GetElapsedTime();
+    pContext->WaitForIdle();
+
+    LOG_INFO_MESSAGE("Dynamic descriptor set commits: ", NumFrames * DrawsPerFrame, " commits in ", Time * 1000, " ms (",
+                     Time * 1e+6 / (NumFrames * DrawsPerFrame), " us per commit)");
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderVk.h"
+#include "GPUTestingEnvironment.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const ShaderSource = R"(
+cbuffer Constants
+{
+    float4 g_Color;
+    float4 g_Scale;
+};
+
+Texture2D              g_Textures[4];
+SamplerState           g_Sampler;
+StructuredBuffer<uint> g_Indices;
+RWTexture2D<float4>    g_RWTex;
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    uint Idx = g_Indices[uint(Pos.x)] % 4u;
+    g_RWTex[uint2(Pos.xy)] = g_Color;
+    return g_Textures[Idx].Sample(g_Sampler, Pos.xy) * g_Scale;
+}
+)";
+
+// Compares creating shaders from plain SPIRV, which is reflected, and from SPIRV
+// with serialized resources
+TEST(ShaderBytecodeReflectionVkBenchmark, CreateFromBytecode)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This benchmark is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source         = ShaderSource;
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Desc           = {"Bytecode reflection benchmark", SHADER_TYPE_PIXEL, true};
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+    RefCntAutoPtr<IShader> pShader;
+    pDevice->CreateShader(ShaderCI, &pShader);
+    ASSERT_NE(pShader, nullptr);
+
+    RefCntAutoPtr<IShaderVk> pShaderVk{pShader, IID_ShaderVk};
+    ASSERT_NE(pShaderVk, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pBytecode;
+    pShaderVk->GetBytecodeWithReflection(&pBytecode);
+    ASSERT_NE(pBytecode, nullptr);
+    const std::vector<uint32_t>& SPIRV = pShaderVk->GetSPIRV();
+
+    ShaderCreateInfo BytecodeCI;
+    BytecodeCI.Desc = ShaderCI.Desc;
+
+    constexpr Uint32 NumIterations = 100;
+
+    double Times[2] = {};
+    for (Uint32 WithReflection = 0; WithReflection < 2; ++WithReflection)
+    {
+        BytecodeCI.ByteCode     = WithReflection ? pBytecode->GetConstDataPtr() : SPIRV.data();
+        BytecodeCI.ByteCodeSize = WithReflection ? pBytecode->GetSize() : SPIRV.size() * sizeof(SPIRV[0]);
+
+        Timer T;
+        for (Uint32 i = 0; i < NumIterations; ++i)
+        {
+            RefCntAutoPtr<IShader> pShader2;
+            pDevice->CreateShader(BytecodeCI, &pShader2);
+            ASSERT_NE(pShader2, nullptr);
+        }
+        Times[WithReflection] = T.GetElapsedTime();
+    }
+    LOG_INFO_MESSAGE("Created ", NumIterations, " shaders from SPIRV in ", Times[0] * 1000, " ms; from SPIRV with serialized resources in ", Times[1] * 1000, " ms");
+}
+
+} // namespace
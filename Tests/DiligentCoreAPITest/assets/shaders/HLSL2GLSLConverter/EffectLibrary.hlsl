@@ -0,0 +1,138 @@
+// Effect library with multiple entry points sharing the same resources
+
+cbuffer cbCamera
+{
+    float4x4 g_ViewProj;
+    float4   g_CameraPos;
+    float4   g_LightDir;
+}
+
+cbuffer cbObject
+{
+    float4x4 g_World;
+    float4   g_Color;
+}
+
+struct VSInput
+{
+    float3 Pos    : ATTRIB0;
+    float3 Normal : ATTRIB1;
+    float2 UV     : ATTRIB2;
+};
+
+struct PSInput
+{
+    float4 Pos    : SV_Position;
+    float3 Normal : NORMAL;
+    float2 UV     : TEX_COORD;
+    float3 WSPos  : WORLD_POS;
+};
+
+struct ParticleData
+{
+    float4 PosAndSize;
+    float4 Velocity;
+};
+
+Texture2D g_ColorMap;
+SamplerState g_ColorMap_sampler;
+
+Texture2D g_NormalMap;
+SamplerState g_NormalMap_sampler;
+
+Texture2D g_ShadowMap;
+SamplerComparisonState g_ShadowMap_sampler;
+
+TextureCube g_EnvMap;
+SamplerState g_EnvMap_sampler;
+
+RWTexture2D</* format = rgba8 */ float4> g_RWOutput;
+RWStructuredBuffer<ParticleData> g_Particles;
+
+float3 TransformNormal(float3 Normal)
+{
+    return normalize(mul(float4(Normal, 0.0), g_World).xyz);
+}
+
+float ComputeShadow(float3 WSPos)
+{
+    float4 ShadowPos = mul(float4(WSPos, 1.0), g_ViewProj);
+    float2 ShadowUV  = ShadowPos.xy / ShadowPos.w * float2(0.5, -0.5) + float2(0.5, 0.5);
+    return g_ShadowMap.SampleCmp(g_ShadowMap_sampler, ShadowUV, ShadowPos.z / ShadowPos.w);
+}
+
+float3 ComputeLighting(float3 Normal, float3 WSPos, float3 BaseColor)
+{
+    float  NdotL   = saturate(dot(Normal, -g_LightDir.xyz));
+    float3 ViewDir = normalize(g_CameraPos.xyz - WSPos);
+    float3 Refl    = reflect(-ViewDir, Normal);
+    float3 Env     = g_EnvMap.SampleLevel(g_EnvMap_sampler, Refl, 0.0).rgb;
+    return BaseColor * NdotL * ComputeShadow(WSPos) + Env * 0.1;
+}
+
+void MeshVS(in  VSInput VSIn,
+            out PSInput PSIn)
+{
+    float4 WSPos = mul(float4(VSIn.Pos, 1.0), g_World);
+    PSIn.Pos     = mul(WSPos, g_ViewProj);
+    PSIn.Normal  = TransformNormal(VSIn.Normal);
+    PSIn.UV      = VSIn.UV;
+    PSIn.WSPos   = WSPos.xyz;
+}
+
+void ShadowVS(in  float3 Pos : ATTRIB0,
+              out float4 OutPos : SV_Position)
+{
+    OutPos = mul(mul(float4(Pos, 1.0), g_World), g_ViewProj);
+}
+
+void FullScreenVS(in  uint   VertId : SV_VertexID,
+                  out float4 Pos    : SV_Position,
+                  out float2 UV     : TEX_COORD)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos = float4(PosXY[VertId], 0.0, 1.0);
+    UV  = PosXY[VertId] * float2(0.5, -0.5) + float2(0.5, 0.5);
+}
+
+float4 OpaquePS(in PSInput PSIn) : SV_Target
+{
+    float3 BaseColor = g_ColorMap.Sample(g_ColorMap_sampler, PSIn.UV).rgb * g_Color.rgb;
+    float3 Normal    = normalize(PSIn.Normal + g_NormalMap.Sample(g_NormalMap_sampler, PSIn.UV).xyz * 2.0 - 1.0);
+    return float4(ComputeLighting(Normal, PSIn.WSPos, BaseColor), 1.0);
+}
+
+float4 TransparentPS(in PSInput PSIn) : SV_Target
+{
+    float4 BaseColor = g_ColorMap.Sample(g_ColorMap_sampler, PSIn.UV) * g_Color;
+    return float4(ComputeLighting(normalize(PSIn.Normal), PSIn.WSPos, BaseColor.rgb), BaseColor.a);
+}
+
+float4 PostProcessPS(in float4 Pos : SV_Position,
+                     in float2 UV  : TEX_COORD) : SV_Target
+{
+    float3 Color = g_ColorMap.SampleLevel(g_ColorMap_sampler, UV, 0.0).rgb;
+    Color = Color / (Color + float3(1.0, 1.0, 1.0));
+    return float4(pow(Color, float3(1.0 / 2.2, 1.0 / 2.2, 1.0 / 2.2)), 1.0);
+}
+
+[numthreads(64, 1, 1)]
+void UpdateParticlesCS(uint3 DTid : SV_DispatchThreadID)
+{
+    ParticleData Particle = g_Particles[DTid.x];
+    Particle.PosAndSize.xyz += Particle.Velocity.xyz * g_Color.w;
+    g_Particles[DTid.x] = Particle;
+}
+
+[numthreads(8, 8, 1)]
+void BlurCS(uint3 DTid : SV_DispatchThreadID)
+{
+    float4 Color = float4(0.0, 0.0, 0.0, 0.0);
+    for (int i = -2; i <= 2; ++i)
+        Color += g_ColorMap.Load(int3(int(DTid.x) + i, int(DTid.y), 0));
+    g_RWOutput[DTid.xy] = Color / 5.0;
+}
@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+
+#include "../../../GPUTestFramework/include/GL/TestingEnvironmentGL.hpp"
+#include "TestingSwapChainBase.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos = float4(PosXY[VertId], 0.0, 1.0);
+}
+)";
+
+const char* const PSSource = R"(
+cbuffer cb0 { float4 g_Color0; };
+cbuffer cb1 { float4 g_Color1; };
+cbuffer cb2 { float4 g_Color2; };
+cbuffer cb3 { float4 g_Color3; };
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return g_Color0 + g_Color1 + g_Color2 + g_Color3;
+}
+)";
+
+constexpr Uint32 NumCBs = 4;
+
+// Mirrors the check in GLContextState constructor
+bool IsMultiBindSupported()
+{
+#if GL_ARB_multi_bind
+    return (GLEW_VERSION_4_4 || GLEW_ARB_multi_bind) &&
+        glBindTextures != nullptr &&
+        glBindSamplers != nullptr &&
+        glBindBuffersRange != nullptr;
+#else
+    return false;
+#endif
+}
+
+DeviceContextBindingCounters operator-(const DeviceContextBindingCounters& lhs, const DeviceContextBindingCounters& rhs)
+{
+    return {lhs.Filtered - rhs.Filtered, lhs.Changed - rhs.Changed, lhs.ApiCalls - rhs.ApiCalls};
+}
+
+// Binds four uniform buffers that occupy consecutive slots and checks how redundant bindings are
+// filtered and how changed bindings are merged into contiguous ranges by CommitStagedBindings().
+TEST(BindingCountersGLTest, UniformBuffers)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Resources in an explicit signature are assigned consecutive binding slots in the order they are declared
+    constexpr PipelineResourceDesc Resources[] = //
+        {
+            {SHADER_TYPE_PIXEL, "cb0", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "cb1", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "cb2", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "cb3", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE}, //
+        };
+    static_assert(_countof(Resources) == NumCBs, "Unexpected number of resources");
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Binding counters test PRS";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Binding counters test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Binding counters test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Binding counters test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS};
+    PsoCI.ppResourceSignatures                 = ppSignatures;
+    PsoCI.ResourceSignaturesCount              = _countof(ppSignatures);
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    auto CreateCB = [&](const float4& Color) {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Binding counters test CB";
+        BuffDesc.Size      = sizeof(Color);
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        return pEnv->CreateBuffer(BuffDesc, &Color);
+    };
+
+    auto CreateSRB = [&](const std::array<RefCntAutoPtr<IBuffer>, NumCBs>& CBs) {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        pPRS->CreateShaderResourceBinding(&pSRB, true);
+        if (pSRB)
+        {
+            for (Uint32 i = 0; i < NumCBs; ++i)
+                pSRB->GetVariableByName(SHADER_TYPE_PIXEL, Resources[i].Name)->Set(CBs[i]);
+        }
+        return pSRB;
+    };
+
+    const float4 Colors[] = {
+        float4{0.25, 0.00, 0.00, 0.25},
+        float4{0.00, 0.25, 0.00, 0.25},
+        float4{0.00, 0.00, 0.50, 0.25},
+        float4{0.25, 0.50, 0.25, 0.25},
+    };
+
+    std::array<RefCntAutoPtr<IBuffer>, NumCBs> CBsA;
+    for (Uint32 i = 0; i < NumCBs; ++i)
+    {
+        CBsA[i] = CreateCB(float4{0, 0, 0, 0});
+        ASSERT_NE(CBsA[i], nullptr);
+    }
+
+    // SRB B changes the two middle slots, SRB C changes the two outer slots
+    std::array<RefCntAutoPtr<IBuffer>, NumCBs> CBsB = CBsA;
+    std::array<RefCntAutoPtr<IBuffer>, NumCBs> CBsC;
+    CBsB[1] = CreateCB(Colors[1]);
+    CBsB[2] = CreateCB(Colors[2]);
+    CBsC    = CBsB;
+    CBsC[0] = CreateCB(Colors[0]);
+    CBsC[3] = CreateCB(Colors[3]);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRBs[] = {CreateSRB(CBsA), CreateSRB(CBsB), CreateSRB(CBsC)};
+    for (const auto& pSRB : pSRBs)
+        ASSERT_NE(pSRB, nullptr);
+
+    const bool MultiBind = IsMultiBindSupported();
+
+    RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+    ASSERT_NE(pTestingSwapChain, nullptr);
+
+    const float4 RefColor = Colors[0] + Colors[1] + Colors[2] + Colors[3];
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], RefColor.Data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+    pContext->InvalidateState();
+    pTestingSwapChain->TakeSnapshot();
+
+    // Invalidating the state resets the tracked bindings, so all slots are rebound by the first draw
+    pContext->InvalidateState();
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+
+    auto Draw = [&](IShaderResourceBinding* pSRB) {
+        const DeviceContextBindingCounters Start = pContext->GetStats().BindingCounters;
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+        return pContext->GetStats().BindingCounters - Start;
+    };
+
+    {
+        const DeviceContextBindingCounters Counters = Draw(pSRBs[0]);
+        EXPECT_EQ(Counters.Changed, NumCBs);
+        EXPECT_EQ(Counters.Filtered, 0u);
+        EXPECT_EQ(Counters.ApiCalls, MultiBind ? 1u : NumCBs);
+    }
+
+    {
+        // The same buffers are already bound to all slots
+        const DeviceContextBindingCounters Counters = Draw(pSRBs[0]);
+        EXPECT_EQ(Counters.Changed, 0u);
+        EXPECT_EQ(Counters.Filtered, NumCBs);
+        EXPECT_EQ(Counters.ApiCalls, 0u);
+    }
+
+    {
+        // Slots 1 and 2 form one contiguous range
+        const DeviceContextBindingCounters Counters = Draw(pSRBs[1]);
+        EXPECT_EQ(Counters.Changed, 2u);
+        EXPECT_EQ(Counters.Filtered, 2u);
+        EXPECT_EQ(Counters.ApiCalls, MultiBind ? 1u : 2u);
+    }
+
+    {
+        // Slots 0 and 3 are not contiguous and require two calls even with multi-bind
+        const DeviceContextBindingCounters Counters = Draw(pSRBs[2]);
+        EXPECT_EQ(Counters.Changed, 2u);
+        EXPECT_EQ(Counters.Filtered, 2u);
+        EXPECT_EQ(Counters.ApiCalls, 2u);
+    }
+
+    // The last draw must use the buffers of all three bindings
+    pSwapChain->Present();
+}
+
+} // namespace
@@ -0,0 +1,239 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "TestingSwapChainBase.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Offset;
+    float4 g_Color;
+};
+
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float4 Color  : COLOR)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos   = float4(PosXY[VertId] * 0.01 + g_Offset.xy, 0.0, 1.0);
+    Color = g_Color;
+}
+)";
+
+const char* const PSSource = R"(
+float4 main(in float4 Pos   : SV_Position,
+            in float4 Color : COLOR) : SV_Target
+{
+    return Color;
+}
+)";
+
+struct Constants
+{
+    float Offset[4];
+    float Color[4];
+};
+
+constexpr Uint32 GridSize = 32;
+
+// Draws triangles [FirstDraw, FirstDraw + NumDraws) of the grid, mapping the constant buffer before every draw
+void DrawGrid(IDeviceContext* pCtx, IBuffer* pCB, Uint32 FirstDraw, Uint32 NumDraws)
+{
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        {
+            MapHelper<Constants> pConstants{pCtx, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            if (!pConstants)
+                return;
+
+            const Uint32 DrawId = FirstDraw + i;
+            const float  x      = static_cast<float>(DrawId % GridSize) / (GridSize / 2) - 1.f + 0.01f;
+            const float  y      = static_cast<float>(DrawId / GridSize) / (GridSize / 2) - 1.f + 0.01f;
+            *pConstants         = Constants{{x, y, 0, 0}, {x * 0.5f + 0.5f, y * 0.5f + 0.5f, static_cast<float>(DrawId % 5) / 5.f, 1}};
+        }
+        pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+}
+
+// Records a grid of draw calls on all deferred contexts in parallel and compares the result
+// with the same grid rendered by the immediate context. Each draw maps a dynamic constant buffer,
+// so the data staged in the command streams must be replayed in order.
+TEST(DeferredContextsGLTest, ParallelRecording)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not enabled in the testing environment";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Deferred contexts test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Deferred contexts test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Deferred contexts test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    const Uint32 NumThreads = static_cast<Uint32>(pEnv->GetNumDeferredContexts());
+
+    // Every thread uses its own constant buffer and SRB
+    std::vector<RefCntAutoPtr<IBuffer>>                pCBs(NumThreads);
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> pSRBs(NumThreads);
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Deferred contexts test constants";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.Size           = sizeof(Constants);
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pCBs[i]);
+        ASSERT_NE(pCBs[i], nullptr);
+
+        pPSO->CreateShaderResourceBinding(&pSRBs[i], true);
+        ASSERT_NE(pSRBs[i], nullptr);
+        pSRBs[i]->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pCBs[i]);
+    }
+
+    ITextureView*   pRTVs[]      = {pSwapChain->GetCurrentBackBufferRTV()};
+    constexpr float ClearColor[] = {0, 0, 0, 0};
+
+    constexpr Uint32 TotalDraws     = GridSize * GridSize;
+    const Uint32     DrawsPerThread = (TotalDraws + NumThreads - 1) / NumThreads;
+
+    // Reference: render the whole grid on the immediate context
+    {
+        RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+        ASSERT_NE(pTestingSwapChain, nullptr);
+
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->SetPipelineState(pPSO);
+        pContext->CommitShaderResources(pSRBs[0], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        DrawGrid(pContext, pCBs[0], 0, TotalDraws);
+
+        pContext->Flush();
+        pContext->InvalidateState();
+        pTestingSwapChain->TakeSnapshot();
+    }
+
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+    std::vector<std::thread>                 Threads(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread{
+            [&](Uint32 ThreadId) {
+                IDeviceContext* pCtx = pEnv->GetDeferredContext(ThreadId);
+
+                const Uint32 FirstDraw = ThreadId * DrawsPerThread;
+                const Uint32 NumDraws  = std::min(DrawsPerThread, TotalDraws - std::min(FirstDraw, TotalDraws));
+
+                pCtx->Begin(0);
+                pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                pCtx->SetPipelineState(pPSO);
+                pCtx->CommitShaderResources(pSRBs[ThreadId], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                DrawGrid(pCtx, pCBs[ThreadId], FirstDraw, NumDraws);
+                pCtx->FinishCommandList(&CmdLists[ThreadId]);
+            },
+            t};
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    std::vector<ICommandList*> CmdListPtrs(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        ASSERT_NE(CmdLists[t], nullptr);
+        CmdListPtrs[t] = CmdLists[t];
+    }
+    pContext->ExecuteCommandLists(NumThreads, CmdListPtrs.data());
+
+    for (Uint32 t = 0; t < NumThreads; ++t)
+        pEnv->GetDeferredContext(t)->FinishFrame();
+
+    pSwapChain->Present();
+}
+
+} // namespace
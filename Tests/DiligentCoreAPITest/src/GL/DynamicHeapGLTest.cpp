@@ -0,0 +1,344 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "../../../GPUTestFramework/include/GL/TestingEnvironmentGL.hpp"
+#include "TestingSwapChainBase.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Offset;
+    float4 g_Color;
+};
+
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float4 Color  : COLOR)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos   = float4(PosXY[VertId] * 0.01 + g_Offset.xy, 0.0, 1.0);
+    Color = g_Color;
+}
+)";
+
+const char* const PSSource = R"(
+float4 main(in float4 Pos   : SV_Position,
+            in float4 Color : COLOR) : SV_Target
+{
+    return Color;
+}
+)";
+
+struct Constants
+{
+    float Offset[4];
+    float Color[4];
+};
+
+// The dynamic heap is disabled by default and is enabled with the --gl_dynamic_heap_size command line option
+bool IsDynamicHeapEnabled()
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    return pEnv->GetDevice()->GetDeviceInfo().IsGLDevice() && TestingEnvironmentGL::GetInstance()->GetDynamicHeapSize() != 0;
+}
+
+RefCntAutoPtr<IPipelineState> CreateTestPSO()
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Dynamic heap test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Dynamic heap test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Dynamic heap test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    return pPSO;
+}
+
+RefCntAutoPtr<IBuffer> CreateConstantBuffer(BIND_FLAGS BindFlags, const char* Name)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = Name;
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.Size           = sizeof(Constants);
+    BuffDesc.BindFlags      = BindFlags;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    return GPUTestingEnvironment::GetInstance()->CreateBuffer(BuffDesc);
+}
+
+// Renders a grid of triangles, mapping the constant buffer with MAP_FLAG_DISCARD before every draw call
+void RenderGrid(IPipelineState* pPSO, IBuffer* pCB)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pCB);
+
+    constexpr Uint32 GridSize      = 32;
+    constexpr Uint32 DrawsPerFlush = 256;
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    for (Uint32 i = 0; i < GridSize * GridSize; ++i)
+    {
+        if (i % DrawsPerFlush == 0)
+        {
+            // FinishFrame() closes the current dynamic heap frame, and Flush() resets the committed state
+            if (i != 0)
+            {
+                pContext->Flush();
+                pContext->FinishFrame();
+            }
+
+            pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            if (i == 0)
+            {
+                constexpr float ClearColor[] = {0, 0, 0, 0};
+                pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            pContext->SetPipelineState(pPSO);
+        }
+
+        {
+            MapHelper<Constants> pConstants{pContext, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            ASSERT_NE(pConstants, nullptr);
+
+            const float x = static_cast<float>(i % GridSize) / (GridSize / 2) - 1.f + 0.01f;
+            const float y = static_cast<float>(i / GridSize) / (GridSize / 2) - 1.f + 0.01f;
+            *pConstants   = Constants{{x, y, 0, 0}, {x * 0.5f + 0.5f, y * 0.5f + 0.5f, static_cast<float>(i % 7) / 7.f, 1}};
+        }
+
+        if (i % DrawsPerFlush == 0)
+            pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+}
+
+// Renders the same grid with a buffer that always uses orphaning and with
+// a buffer suballocated from the dynamic heap, and compares the results.
+TEST(DynamicHeapGLTest, MatchesOrphaning)
+{
+    if (!IsDynamicHeapEnabled())
+        GTEST_SKIP() << "The dynamic heap is not enabled. Use --gl_dynamic_heap_size=<size> to enable it";
+
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateTestPSO();
+    ASSERT_NE(pPSO, nullptr);
+
+    // Buffers that can also be bound as vertex buffers always use buffer orphaning
+    RefCntAutoPtr<IBuffer> pOrphanedCB = CreateConstantBuffer(BIND_UNIFORM_BUFFER | BIND_VERTEX_BUFFER, "Orphaned dynamic buffer");
+    ASSERT_NE(pOrphanedCB, nullptr);
+
+    RefCntAutoPtr<IBuffer> pHeapCB = CreateConstantBuffer(BIND_UNIFORM_BUFFER, "Uniform-only dynamic buffer");
+    ASSERT_NE(pHeapCB, nullptr);
+
+    RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+    ASSERT_NE(pTestingSwapChain, nullptr);
+
+    RenderGrid(pPSO, pOrphanedCB);
+    pContext->Flush();
+    pContext->InvalidateState();
+    pTestingSwapChain->TakeSnapshot();
+
+    RenderGrid(pPSO, pHeapCB);
+    pSwapChain->Present();
+}
+
+// Maps the buffer many more times than the dynamic heap can hold
+// without recycling and verifies that the data of the last allocation is intact.
+TEST(DynamicHeapGLTest, WrapAround)
+{
+    if (!IsDynamicHeapEnabled())
+        GTEST_SKIP() << "The dynamic heap is not enabled. Use --gl_dynamic_heap_size=<size> to enable it";
+
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 BufferSize = 64 << 10;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Dynamic heap wrap-around test";
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.Size           = BufferSize;
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BuffDesc.Name           = "Dynamic heap wrap-around staging buffer";
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.BindFlags      = BIND_NONE;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    // Wrap around the heap several times
+    const Uint32 NumMaps = TestingEnvironmentGL::GetInstance()->GetDynamicHeapSize() / BufferSize * 4 + 3;
+
+    std::vector<Uint32> RefData(BufferSize / sizeof(Uint32));
+    for (Uint32 i = 0; i < NumMaps; ++i)
+    {
+        for (size_t j = 0; j < RefData.size(); ++j)
+            RefData[j] = static_cast<Uint32>(i * 1000 + j);
+
+        MapHelper<Uint32> pData{pContext, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+        ASSERT_NE(pData, nullptr);
+        memcpy(pData, RefData.data(), BufferSize);
+
+        // Only finish the frame occasionally so that the heap runs out of space
+        if (i % 16 == 15)
+            pContext->FinishFrame();
+    }
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    MapHelper<Uint32> pStagingData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+    ASSERT_NE(pStagingData, nullptr);
+    EXPECT_EQ(memcmp(pStagingData, RefData.data(), BufferSize), 0);
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+// FinishFrame() closes the dynamic heap frame, after which the space of the allocation may be reused.
+// Using the buffer without mapping it again must be reported.
+TEST(DynamicHeapGLTest, StaleAllocation)
+{
+    if (!IsDynamicHeapEnabled())
+        GTEST_SKIP() << "The dynamic heap is not enabled. Use --gl_dynamic_heap_size=<size> to enable it";
+
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateTestPSO();
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IBuffer> pCB = CreateConstantBuffer(BIND_UNIFORM_BUFFER, "Stale dynamic buffer");
+    ASSERT_NE(pCB, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pCB);
+
+    {
+        MapHelper<Constants> pConstants{pContext, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        ASSERT_NE(pConstants, nullptr);
+        *pConstants = Constants{{0, 0, 0, 0}, {1, 1, 1, 1}};
+    }
+    pContext->FinishFrame();
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Dynamic heap allocation of dynamic buffer 'Stale dynamic buffer'"};
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+
+    // Mapping the buffer again makes it valid
+    {
+        MapHelper<Constants> pConstants{pContext, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        ASSERT_NE(pConstants, nullptr);
+        *pConstants = Constants{{0, 0, 0, 0}, {1, 1, 1, 1}};
+    }
+    pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+}
+#endif
+
+} // namespace
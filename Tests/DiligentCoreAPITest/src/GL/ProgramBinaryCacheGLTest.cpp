@@ -0,0 +1,263 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "../../../GPUTestFramework/include/GL/TestingEnvironmentGL.hpp"
+#include "PipelineStateCacheGL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+cbuffer Constants
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Color;
+};
+
+struct PSInput
+{
+    float4 Pos   : SV_Position;
+    float4 Color : COLOR;
+};
+
+void main(in  uint    VertId : SV_VertexID,
+          out PSInput PSIn)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    PSIn.Pos   = mul(float4(PosXY[VertId], 0.0, 1.0), g_WorldViewProj);
+    PSIn.Color = g_Color;
+}
+)";
+
+const char* const PSSource = R"(
+Texture2D    g_Tex;
+SamplerState g_Tex_sampler;
+
+struct PSInput
+{
+    float4 Pos   : SV_Position;
+    float4 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return PSIn.Color * g_Tex.Sample(g_Tex_sampler, PSIn.Pos.xy);
+}
+)";
+
+RefCntAutoPtr<IPipelineState> CreatePSO(IPipelineStateCache* pCache)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    // Always create new shader objects so that the device-level program cache is not used
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Program binary cache test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Program binary cache test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Program binary cache test";
+
+    PsoCI.pVS       = pVS;
+    PsoCI.pPS       = pPS;
+    PsoCI.pPSOCache = pCache;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    return pPSO;
+}
+
+RefCntAutoPtr<IPipelineStateCache> CreateCache(const void* pData, size_t DataSize, PSO_CACHE_MODE Mode = PSO_CACHE_MODE_LOAD_STORE)
+{
+    PipelineStateCacheCreateInfo PSOCacheCI;
+    PSOCacheCI.Desc.Name     = "Program binary cache";
+    PSOCacheCI.Desc.Mode     = Mode;
+    PSOCacheCI.pCacheData    = pData;
+    PSOCacheCI.CacheDataSize = static_cast<Uint32>(DataSize);
+
+    RefCntAutoPtr<IPipelineStateCache> pCache;
+    GPUTestingEnvironment::GetInstance()->GetDevice()->CreatePipelineStateCache(PSOCacheCI, &pCache);
+    return pCache;
+}
+
+PipelineStateCacheStatsGL GetCacheStats(IPipelineStateCache* pCache)
+{
+    PipelineStateCacheStatsGL Stats;
+    RefCntAutoPtr<IPipelineStateCacheGL> pCacheGL{pCache, IID_PipelineStateCacheGL};
+    if (pCacheGL)
+        pCacheGL->GetStats(Stats);
+    else
+        ADD_FAILURE() << "Pipeline state cache does not implement IPipelineStateCacheGL";
+    return Stats;
+}
+
+TEST(ProgramBinaryCacheGLTest, StoreAndLoad)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<IPipelineStateCache> pStoreCache = CreateCache(nullptr, 0, PSO_CACHE_MODE_STORE);
+    if (!pStoreCache)
+        GTEST_SKIP() << "Program binaries are not supported by this device";
+
+    ASSERT_NE(CreatePSO(pStoreCache), nullptr);
+    {
+        const PipelineStateCacheStatsGL Stats = GetCacheStats(pStoreCache);
+        EXPECT_EQ(Stats.NumProgramsLoaded, 0u);
+        EXPECT_EQ(Stats.NumProgramsStored, 1u);
+    }
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pStoreCache->GetData(&pData);
+    ASSERT_NE(pData, nullptr);
+    ASSERT_GT(pData->GetSize(), size_t{0});
+
+    RefCntAutoPtr<IPipelineStateCache> pLoadCache = CreateCache(pData->GetConstDataPtr(), pData->GetSize(), PSO_CACHE_MODE_LOAD);
+    ASSERT_NE(pLoadCache, nullptr);
+
+    // The program must be created from the binary rather than linked from the shaders
+    // or found in the device-level program cache.
+    ASSERT_NE(CreatePSO(pLoadCache), nullptr);
+    {
+        const PipelineStateCacheStatsGL Stats = GetCacheStats(pLoadCache);
+        EXPECT_EQ(Stats.NumProgramsLoaded, 1u);
+        EXPECT_EQ(Stats.NumProgramsRejected, 0u);
+        EXPECT_EQ(Stats.NumProgramsStored, 0u);
+    }
+
+    // The cache created in load-only mode must not be extended
+    RefCntAutoPtr<IDataBlob> pLoadData;
+    pLoadCache->GetData(&pLoadData);
+    ASSERT_NE(pLoadData, nullptr);
+    EXPECT_EQ(pLoadData->GetSize(), pData->GetSize());
+}
+
+TEST(ProgramBinaryCacheGLTest, InvalidData)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<IPipelineStateCache> pStoreCache = CreateCache(nullptr, 0, PSO_CACHE_MODE_STORE);
+    if (!pStoreCache)
+        GTEST_SKIP() << "Program binaries are not supported by this device";
+
+    ASSERT_NE(CreatePSO(pStoreCache), nullptr);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pStoreCache->GetData(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    const Uint8* pBytes = pData->GetConstDataPtr<Uint8>();
+    const size_t Size   = pData->GetSize();
+    ASSERT_GT(Size, size_t{64});
+
+    // Corrupted program binary: the driver must reject it and the program must be relinked
+    {
+        std::vector<Uint8> Corrupted{pBytes, pBytes + Size};
+        for (size_t i = Size - 32; i < Size; ++i)
+            Corrupted[i] ^= 0xA5;
+
+        RefCntAutoPtr<IPipelineStateCache> pCache = CreateCache(Corrupted.data(), Corrupted.size());
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_NE(CreatePSO(pCache), nullptr);
+    }
+
+    // Truncated data
+    {
+        RefCntAutoPtr<IPipelineStateCache> pCache = CreateCache(pBytes, Size / 2);
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_NE(CreatePSO(pCache), nullptr);
+    }
+
+    // Data produced by a different driver
+    {
+        std::vector<Uint8> OtherDriver{pBytes, pBytes + Size};
+        OtherDriver[8] ^= 0xFF;
+
+        RefCntAutoPtr<IPipelineStateCache> pCache = CreateCache(OtherDriver.data(), OtherDriver.size());
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_NE(CreatePSO(pCache), nullptr);
+        EXPECT_EQ(GetCacheStats(pCache).NumProgramsLoaded, 0u);
+    }
+
+    // Not a cache at all
+    {
+        const char Garbage[] = "This is not a program binary cache";
+
+        RefCntAutoPtr<IPipelineStateCache> pCache = CreateCache(Garbage, sizeof(Garbage));
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_NE(CreatePSO(pCache), nullptr);
+        EXPECT_EQ(GetCacheStats(pCache).NumProgramsLoaded, 0u);
+    }
+}
+
+} // namespace
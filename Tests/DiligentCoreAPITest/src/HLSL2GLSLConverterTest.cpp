@@ -25,8 +25,14 @@
  *  of the possibility of such damages.
  */
 
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "GPUTestingEnvironment.hpp"
 #include "HLSL2GLSLConverter.h"
+#include "ThreadPool.hpp"
 
 #include "gtest/gtest.h"
 
@@ -175,4 +181,86 @@ TEST(HLSL2GLSLConverterTest, Preprocessor)
     }
 }
 
+TEST(HLSL2GLSLConverterTest, ParallelEntryPoints)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+    pConverter->CreateStream("EffectLibrary.hlsl", pShaderSourceFactory, nullptr, 0, &pStream);
+    ASSERT_NE(pStream, nullptr);
+
+    struct EntryPointInfo
+    {
+        const char* Name;
+        SHADER_TYPE Type;
+    };
+    // clang-format off
+    static constexpr EntryPointInfo EntryPoints[] =
+    {
+        {"MeshVS",            SHADER_TYPE_VERTEX },
+        {"ShadowVS",          SHADER_TYPE_VERTEX },
+        {"FullScreenVS",      SHADER_TYPE_VERTEX },
+        {"OpaquePS",          SHADER_TYPE_PIXEL  },
+        {"TransparentPS",     SHADER_TYPE_PIXEL  },
+        {"PostProcessPS",     SHADER_TYPE_PIXEL  },
+        {"UpdateParticlesCS", SHADER_TYPE_COMPUTE},
+        {"BlurCS",            SHADER_TYPE_COMPUTE},
+    };
+    // clang-format on
+    constexpr Uint32 NumEntryPoints = _countof(EntryPoints);
+    constexpr Uint32 NumIterations  = 16;
+    constexpr Uint32 NumConversions = NumEntryPoints * NumIterations;
+
+    auto ConvertEntryPoint = [&](Uint32 Idx) {
+        const EntryPointInfo& EntryPoint = EntryPoints[Idx % NumEntryPoints];
+
+        RefCntAutoPtr<IDataBlob> pGLSLSource;
+        pStream->Convert(EntryPoint.Name, EntryPoint.Type, true, "_sampler", true, false, &pGLSLSource);
+        return pGLSLSource != nullptr ?
+            std::string{pGLSLSource->GetConstDataPtr<char>(), pGLSLSource->GetSize()} :
+            std::string{};
+    };
+
+    std::vector<std::string> RefSources(NumConversions);
+
+    for (Uint32 i = 0; i < NumConversions; ++i)
+    {
+        RefSources[i] = ConvertEntryPoint(i);
+        ASSERT_FALSE(RefSources[i].empty()) << EntryPoints[i % NumEntryPoints].Name;
+    }
+
+    // Converting the same entry point must always produce the same source
+    for (Uint32 i = NumEntryPoints; i < NumConversions; ++i)
+        EXPECT_EQ(RefSources[i], RefSources[i % NumEntryPoints]) << EntryPoints[i % NumEntryPoints].Name;
+
+    const Uint32 NumThreads = std::max(std::thread::hardware_concurrency(), 4u);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::vector<std::string> Sources(NumConversions);
+
+    for (Uint32 i = 0; i < NumConversions; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&, i](Uint32 ThreadId) {
+                             Sources[i] = ConvertEntryPoint(i);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    pThreadPool->WaitForAllTasks();
+
+    for (Uint32 i = 0; i < NumConversions; ++i)
+        EXPECT_EQ(Sources[i], RefSources[i % NumEntryPoints]) << EntryPoints[i % NumEntryPoints].Name;
+}
+
 } // namespace
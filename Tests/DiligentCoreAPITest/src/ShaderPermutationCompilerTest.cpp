@@ -0,0 +1,164 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include "ShaderPermutationCompiler.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ShaderPermutationCompilerTest, Compile)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders", &pShaderSourceFactory);
+
+    const ShaderMacro BaseMacros[] = {{"SIMPLIFIED", "1"}};
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+    ShaderCI.FilePath                   = "AsyncShaderCompilationTest.psh";
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Desc                       = {"Shader permutation compiler test", SHADER_TYPE_PIXEL, true};
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Macros                     = {BaseMacros, _countof(BaseMacros)};
+
+    // UNUSED is not referenced by the shader, so only 3 of 6 variants are unique
+    const std::vector<ShaderMacroHelper> Permutations = ShaderPermutationCompiler::ExpandMacroMatrix({
+        {"RANDOM", {"0.25", "0.5", "0.75"}},
+        {"UNUSED", {"0", "1"}},
+    });
+    ASSERT_EQ(Permutations.size(), size_t{6});
+
+    ShaderPermutationCompiler             Compiler{pDevice};
+    ShaderPermutationCompiler::Statistics Stats;
+    const auto                            Variants = Compiler.Compile(ShaderCI, Permutations, &Stats);
+    ASSERT_EQ(Variants.size(), Permutations.size());
+
+    EXPECT_EQ(Stats.NumVariants, 6u);
+    EXPECT_EQ(Stats.NumCompiled, 3u);
+    EXPECT_EQ(Stats.NumFailed, 0u);
+    EXPECT_TRUE(Stats.SharedSource);
+
+    for (size_t i = 0; i < Variants.size(); ++i)
+    {
+        const auto& Variant = Variants[i];
+        ASSERT_NE(Variant.pShader, nullptr);
+        EXPECT_EQ(Variant.pShader->GetStatus(), SHADER_STATUS_READY);
+        EXPECT_EQ(Variant.CompiledVariant, i & ~size_t{1});
+
+        Uint64      Size      = 0;
+        const void* pBytecode = Variant.GetBytecode(Size);
+        EXPECT_NE(pBytecode, nullptr);
+        EXPECT_GT(Size, Uint64{0});
+    }
+    EXPECT_NE(Variants[0].pShader, Variants[2].pShader);
+    EXPECT_NE(Variants[2].pShader, Variants[4].pShader);
+
+    LOG_INFO_MESSAGE("Compiled ", Stats.NumCompiled, " of ", Stats.NumVariants, " variants. Preprocessing: ",
+                     Stats.PreprocessTime * 1000, " ms, compilation: ", Stats.CompileTime * 1000, " ms");
+}
+
+// The same file is included in both branches of the conditional block. The unrolled source would only
+// contain it in the first branch, so the variants must resolve the includes themselves.
+TEST(ShaderPermutationCompilerTest, ConditionalIncludes)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    constexpr char MainSource[] = R"(
+#if USE_RED
+#   include "Color.fxh"
+#   define COLOR_SCALE 1.0
+#else
+#   include "Color.fxh"
+#   define COLOR_SCALE 0.5
+#endif
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return GetColor() * COLOR_SCALE;
+}
+)";
+
+    constexpr char ColorSource[] = R"(
+float4 GetColor()
+{
+    return float4(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory = CreateMemoryShaderSourceFactory({
+        {"Main.psh", MainSource},
+        {"Color.fxh", ColorSource},
+    });
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+    ShaderCI.FilePath                   = "Main.psh";
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Desc                       = {"Shader permutation compiler conditional includes test", SHADER_TYPE_PIXEL, true};
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+    const std::vector<ShaderMacroHelper> Permutations = ShaderPermutationCompiler::ExpandMacroMatrix({
+        {"USE_RED", {"0", "1"}},
+        {"UNUSED", {"0", "1"}},
+    });
+    ASSERT_EQ(Permutations.size(), size_t{4});
+
+    ShaderPermutationCompiler             Compiler{pDevice};
+    ShaderPermutationCompiler::Statistics Stats;
+    const auto                            Variants = Compiler.Compile(ShaderCI, Permutations, &Stats);
+    ASSERT_EQ(Variants.size(), Permutations.size());
+
+    EXPECT_FALSE(Stats.SharedSource);
+    // Variants are still deduplicated
+    EXPECT_EQ(Stats.NumCompiled, 2u);
+    EXPECT_EQ(Stats.NumFailed, 0u);
+    for (const auto& Variant : Variants)
+    {
+        ASSERT_NE(Variant.pShader, nullptr);
+        EXPECT_EQ(Variant.pShader->GetStatus(), SHADER_STATUS_READY);
+    }
+}
+
+} // namespace
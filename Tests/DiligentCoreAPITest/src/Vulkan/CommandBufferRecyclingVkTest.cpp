@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "TestingSwapChainBase.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Command buffers of deferred contexts are returned to the pools of these contexts by the immediate context
+// that purges the release queue, while the worker threads record new command lists in the same contexts.
+TEST(CommandBufferRecyclingVkTest, MultithreadedRecycling)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    if (!pEnv->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+    if (pEnv->GetNumDeferredContexts() < 2)
+        GTEST_SKIP() << "At least two deferred contexts are required";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pImmediateCtx = pEnv->GetDeviceContext();
+    auto* pSwapChain    = pEnv->GetSwapChain();
+
+    constexpr Uint32 NumThreads        = 2;
+    constexpr Uint32 NumListsPerThread = 4;
+    constexpr Uint32 NumFrames         = 16;
+
+    const auto GetClearColor = [](Uint32 Frame, Uint32 Thread, Uint32 List) {
+        return float4{
+            static_cast<float>(Frame) / NumFrames,
+            static_cast<float>(Thread) / NumThreads,
+            static_cast<float>(List) / NumListsPerThread,
+            1.f,
+        };
+    };
+
+    // The list recorded last by the last thread in the last frame is executed last
+    const float4 RefColor = GetClearColor(NumFrames - 1, NumThreads - 1, NumListsPerThread - 1);
+    {
+        RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+        ASSERT_NE(pTestingSwapChain, nullptr);
+
+        ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+        pImmediateCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pImmediateCtx->ClearRenderTarget(pRTVs[0], RefColor.Data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pImmediateCtx->Flush();
+        pImmediateCtx->InvalidateState();
+        pTestingSwapChain->TakeSnapshot();
+    }
+
+    ITextureView* pRTV = pSwapChain->GetCurrentBackBufferRTV();
+    pImmediateCtx->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pImmediateCtx->Flush();
+
+    for (Uint32 t = 0; t < NumThreads; ++t)
+        pEnv->GetDeferredContext(t)->ClearStats();
+
+    for (Uint32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        std::array<std::array<RefCntAutoPtr<ICommandList>, NumListsPerThread>, NumThreads> CmdLists;
+
+        std::array<std::thread, NumThreads> WorkerThreads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            WorkerThreads[t] = std::thread(
+                [&](Uint32 Thread) //
+                {
+                    IDeviceContext* pCtx = pEnv->GetDeferredContext(Thread);
+                    for (Uint32 List = 0; List < NumListsPerThread; ++List)
+                    {
+                        pCtx->Begin(0);
+                        pCtx->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                        pCtx->ClearRenderTarget(pRTV, GetClearColor(Frame, Thread, List).Data(), RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                        pCtx->FinishCommandList(&CmdLists[Thread][List]);
+                    }
+                },
+                t);
+        }
+
+        // Purge the release queue while the worker threads are recording. This returns the command buffers
+        // of the previous frame to the deferred contexts' pools.
+        pImmediateCtx->WaitForIdle();
+        pImmediateCtx->FinishFrame();
+
+        for (std::thread& Thread : WorkerThreads)
+            Thread.join();
+
+        // Interleave the lists of different contexts
+        std::vector<ICommandList*> CmdListPtrs;
+        for (Uint32 List = 0; List < NumListsPerThread; ++List)
+        {
+            for (Uint32 t = 0; t < NumThreads; ++t)
+            {
+                ASSERT_NE(CmdLists[t][List], nullptr);
+                CmdListPtrs.push_back(CmdLists[t][List]);
+            }
+        }
+        pImmediateCtx->ExecuteCommandLists(static_cast<Uint32>(CmdListPtrs.size()), CmdListPtrs.data());
+
+        for (Uint32 t = 0; t < NumThreads; ++t)
+            pEnv->GetDeferredContext(t)->FinishFrame();
+    }
+
+    pSwapChain->Present();
+
+    // The command buffers of a frame are recycled before the frame after next starts recording
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        const DeviceContextCommandBufferCounters& Counters = pEnv->GetDeferredContext(t)->GetStats().CommandBufferCounters;
+        EXPECT_EQ(Counters.Allocated + Counters.Reused, NumFrames * NumListsPerThread);
+        EXPECT_LE(Counters.Allocated, 2 * NumListsPerThread);
+    }
+}
+
+} // namespace
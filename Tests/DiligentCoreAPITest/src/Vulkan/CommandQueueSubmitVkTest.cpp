@@ -0,0 +1,354 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+#include "TestingSwapChainBase.hpp"
+#include "CommandQueueVk.h"
+#include "FenceVk.h"
+#include "MapHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void ClearRenderTargetReferenceVk(ISwapChain* pSwapChain, const float ClearColor[]);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+// The tests below run with and without the submission thread (--vk_submission_thread),
+// and check that the thread does not change the behavior observed by the application.
+namespace
+{
+
+RefCntAutoPtr<IBuffer> CreateTestBuffer(IRenderDevice* pDevice, Uint64 Size, USAGE Usage)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name  = "Command queue submit test buffer";
+    BuffDesc.Size  = Size;
+    BuffDesc.Usage = Usage;
+    if (Usage == USAGE_STAGING)
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    else
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+// Checks that submissions are executed in the order they were made: every submission overwrites
+// the same buffer and copies it to its own slot of the staging buffer, so a reordered submission
+// leaves a wrong value in some slot.
+TEST(CommandQueueSubmitVkTest, SubmissionOrder)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumSubmits = 256;
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice, sizeof(Uint32) * 4, USAGE_DEFAULT);
+    ASSERT_NE(pBuffer, nullptr);
+    RefCntAutoPtr<IBuffer> pStagingBuffer = CreateTestBuffer(pDevice, sizeof(Uint32) * NumSubmits, USAGE_STAGING);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    for (Uint32 i = 0; i < NumSubmits; ++i)
+    {
+        const Uint32 Data[4] = {i, i, i, i};
+        pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, sizeof(Uint32) * i, sizeof(Uint32), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Flush();
+    }
+    pContext->WaitForIdle();
+
+    MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+    ASSERT_NE(ReadBackData, nullptr);
+    for (Uint32 i = 0; i < NumSubmits; ++i)
+        EXPECT_EQ(ReadBackData[i], i) << "Submission " << i;
+}
+
+// Checks that the submitted fence values strictly increase and that the completed value
+// advances to the last submitted value without waiting for the context to become idle.
+TEST(CommandQueueSubmitVkTest, CompletedValueAdvances)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    constexpr Uint32 NumSubmits    = 64;
+    constexpr float  ClearColor[4] = {0.25f, 0.5f, 0.75f, 1.0f};
+
+    Uint64 LastSubmittedValue = 0;
+    Uint64 LastCompletedValue = 0;
+    for (Uint32 i = 0; i < NumSubmits; ++i)
+    {
+        pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        pContext->Flush();
+
+        ICommandQueue* pQueue         = pContext->LockCommandQueue();
+        const Uint64   SubmittedValue = pQueue->GetNextFenceValue() - 1;
+        const Uint64   CompletedValue = pQueue->GetCompletedFenceValue();
+        pContext->UnlockCommandQueue();
+
+        EXPECT_GT(SubmittedValue, LastSubmittedValue);
+        EXPECT_GE(CompletedValue, LastCompletedValue);
+        EXPECT_LE(CompletedValue, SubmittedValue);
+        LastSubmittedValue = SubmittedValue;
+        LastCompletedValue = CompletedValue;
+    }
+
+    // Poll the completed value instead of waiting for idle, so that the test fails
+    // if the queue never observes the completion of the last submission.
+    constexpr double Timeout = 10.0;
+
+    Timer T;
+    while (LastCompletedValue < LastSubmittedValue && T.GetElapsedTime() < Timeout)
+    {
+        const Uint64 CompletedValue = pContext->LockCommandQueue()->GetCompletedFenceValue();
+        pContext->UnlockCommandQueue();
+
+        EXPECT_GE(CompletedValue, LastCompletedValue);
+        LastCompletedValue = CompletedValue;
+    }
+    EXPECT_GE(LastCompletedValue, LastSubmittedValue);
+
+    pContext->WaitForIdle();
+}
+
+// Checks that Present sees the work submitted before it: all clears except the last one use
+// a different color, and Present is called right after the last flush while the previous
+// submissions may still be queued.
+TEST(CommandQueueSubmitVkTest, PresentAfterQueuedWork)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr float RefColor[4]   = {0.25f, 0.5f, 0.75f, 1.0f};
+    constexpr float OtherColor[4] = {0.75f, 0.5f, 0.25f, 1.0f};
+
+    if (RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain})
+    {
+        pContext->Flush();
+        pContext->InvalidateState();
+        ClearRenderTargetReferenceVk(pSwapChain, RefColor);
+        pTestingSwapChain->TakeSnapshot();
+    }
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    constexpr Uint32 NumSubmits = 64;
+    for (Uint32 i = 0; i < NumSubmits; ++i)
+    {
+        pContext->ClearRenderTarget(pRTVs[0], i + 1 < NumSubmits ? OtherColor : RefColor, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        pContext->Flush();
+    }
+
+    pSwapChain->Present();
+}
+
+// Checks that a fence signaled after queued work is only completed once that work is done:
+// the data copied to the staging buffer before the signal must be visible after waiting for the fence.
+TEST(CommandQueueSubmitVkTest, SignalAfterQueuedWork)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    FenceDesc Desc;
+    Desc.Name = "Command queue submit test fence";
+    Desc.Type = FENCE_TYPE_GENERAL;
+
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(Desc, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice, sizeof(Uint32) * 4, USAGE_DEFAULT);
+    ASSERT_NE(pBuffer, nullptr);
+    RefCntAutoPtr<IBuffer> pStagingBuffer = CreateTestBuffer(pDevice, sizeof(Uint32) * 4, USAGE_STAGING);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    auto CopyValue = [&](Uint32 Value) {
+        const Uint32 Data[4] = {Value, Value, Value, Value};
+        pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, sizeof(Data), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    };
+    auto CheckValue = [&](Uint32 Value) {
+        MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+        ASSERT_NE(ReadBackData, nullptr);
+        EXPECT_EQ(ReadBackData[0], Value);
+        EXPECT_EQ(ReadBackData[3], Value);
+    };
+
+    constexpr Uint32 NumSignals = 64;
+
+    Uint64 FenceValue = 0;
+    for (Uint32 i = 0; i < NumSignals; ++i)
+    {
+        CopyValue(i);
+        pContext->EnqueueSignal(pFence, ++FenceValue);
+        pContext->Flush();
+
+        pFence->Wait(FenceValue);
+        EXPECT_GE(pFence->GetCompletedValue(), FenceValue);
+        CheckValue(i);
+    }
+
+    // Signal the fence semaphore directly through the queue after the context has flushed its work
+    RefCntAutoPtr<IFenceVk> pFenceVk{pFence, IID_FenceVk};
+    if (pDevice->GetDeviceInfo().Features.NativeFence && pFenceVk && pFenceVk->GetVkSemaphore() != VK_NULL_HANDLE)
+    {
+        for (Uint32 i = 0; i < NumSignals; ++i)
+        {
+            CopyValue(NumSignals + i);
+            pContext->Flush();
+
+            ICommandQueueVk* pQueueVk = ClassPtrCast<ICommandQueueVk>(pContext->LockCommandQueue());
+            pQueueVk->EnqueueSignal(pFenceVk->GetVkSemaphore(), ++FenceValue);
+            pContext->UnlockCommandQueue();
+
+            pFence->Wait(FenceValue);
+            CheckValue(NumSignals + i);
+        }
+    }
+
+    pContext->WaitForIdle();
+}
+
+// Checks that the completed value of a CPU-wait-only fence, which is tracked by the queue sync points,
+// follows the submissions.
+TEST(CommandQueueSubmitVkTest, SyncPointCompletion)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    FenceDesc Desc;
+    Desc.Name = "Command queue submit test fence";
+    Desc.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(Desc, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    constexpr Uint64 NumSignals = 256;
+
+    for (Uint64 Value = 1; Value <= NumSignals; ++Value)
+    {
+        pContext->EnqueueSignal(pFence, Value);
+        pContext->Flush();
+    }
+
+    pFence->Wait(NumSignals);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSignals);
+}
+
+// Checks that the application may access the Vulkan queue directly while the command queue is locked:
+// waiting for the VkQueue to become idle must also wait for the work flushed right before locking the queue,
+// and the submissions made through the locked queue must not deadlock.
+TEST(CommandQueueSubmitVkTest, DirectQueueAccess)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice, sizeof(Uint32) * 4, USAGE_DEFAULT);
+    ASSERT_NE(pBuffer, nullptr);
+    RefCntAutoPtr<IBuffer> pStagingBuffer = CreateTestBuffer(pDevice, sizeof(Uint32) * 4, USAGE_STAGING);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    constexpr Uint32 NumSubmits = 64;
+    for (Uint32 i = 0; i < NumSubmits; ++i)
+    {
+        const Uint32 Data[4] = {i, i, i, i};
+        pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, sizeof(Data), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Flush();
+
+        ICommandQueueVk* pQueueVk = ClassPtrCast<ICommandQueueVk>(pContext->LockCommandQueue());
+        EXPECT_EQ(vkQueueWaitIdle(pQueueVk->GetVkQueue()), VK_SUCCESS);
+
+        const Uint64 FenceValue = pQueueVk->SubmitCmdBuffer(VK_NULL_HANDLE);
+        EXPECT_EQ(vkQueueWaitIdle(pQueueVk->GetVkQueue()), VK_SUCCESS);
+        EXPECT_GE(pQueueVk->GetCompletedFenceValue(), FenceValue);
+        pContext->UnlockCommandQueue();
+
+        MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+        ASSERT_NE(ReadBackData, nullptr);
+        EXPECT_EQ(ReadBackData[0], i) << "Submission " << i;
+        EXPECT_EQ(ReadBackData[3], i) << "Submission " << i;
+    }
+
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -0,0 +1,465 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+#include "TestingSwapChainBase.hpp"
+#include "RenderDeviceVk.h"
+#include "MapHelper.hpp"
+#include "CommonlyUsedStates.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float2 UV     : TEX_COORD)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos = float4(PosXY[VertId], 0.0, 1.0);
+    UV  = PosXY[VertId] * float2(0.5, -0.5) + float2(0.5, 0.5);
+}
+)";
+
+const char* const PSSource = R"(
+cbuffer cbWeights
+{
+    float4 g_Weights[2];
+};
+
+cbuffer cbDynamic
+{
+    float4 g_DynamicColor;
+};
+
+StructuredBuffer<float4> g_DynamicData;
+
+Texture2D    g_MutableTextures[4];
+Texture2D    g_DynamicTextures[4];
+SamplerState g_Sampler;
+SamplerState g_AssignedSampler;
+
+float4 main(in float4 Pos : SV_Position,
+            in float2 UV  : TEX_COORD) : SV_Target
+{
+    float4 Color = g_DynamicColor + g_DynamicData[0];
+    Color += g_MutableTextures[0].Sample(g_Sampler, UV) * g_Weights[0].x;
+    Color += g_MutableTextures[1].Sample(g_Sampler, UV) * g_Weights[0].y;
+    Color += g_MutableTextures[2].Sample(g_Sampler, UV) * g_Weights[0].z;
+    Color += g_MutableTextures[3].Sample(g_Sampler, UV) * g_Weights[0].w;
+    Color += g_DynamicTextures[0].Sample(g_AssignedSampler, UV) * g_Weights[1].x;
+    Color += g_DynamicTextures[1].Sample(g_AssignedSampler, UV) * g_Weights[1].y;
+    Color += g_DynamicTextures[2].Sample(g_AssignedSampler, UV) * g_Weights[1].z;
+    Color += g_DynamicTextures[3].Sample(g_AssignedSampler, UV) * g_Weights[1].w;
+    return Color;
+}
+)";
+
+constexpr Uint32 NumTextures      = 8;
+constexpr Uint32 NumArrayElements = NumTextures / 2;
+
+// All values written to the render target are multiples of 1/512, so the expected color
+// is exactly representable as a float and matches the color set by ClearRenderTarget.
+constexpr float Weights[NumTextures] = {1.f / 512.f, 2.f / 512.f, 4.f / 512.f, 8.f / 512.f, 16.f / 512.f, 32.f / 512.f, 64.f / 512.f, 128.f / 512.f};
+
+float4 GetTextureColor(Uint32 i)
+{
+    return float4{
+        static_cast<float>(i & 0x01),
+        static_cast<float>((i >> 1) & 0x01),
+        static_cast<float>((i >> 2) & 0x01),
+        1.f,
+    };
+}
+
+// Contents of the dynamic uniform buffer and the dynamic structured buffer for the given draw
+float4 GetDynamicColor(Uint32 Draw)
+{
+    return float4{static_cast<float>(Draw % 4 + 1) / 16.f, 0.f, 0.f, 0.f};
+}
+
+float4 GetDynamicData(Uint32 Draw)
+{
+    return float4{0.f, static_cast<float>(Draw % 8 + 1) / 32.f, static_cast<float>(Draw % 2) / 4.f, 0.f};
+}
+
+// Mutable textures are never changed, dynamic textures are rotated by Shift elements
+Uint32 GetMutableTextureIndex(Uint32 Elem)
+{
+    return NumTextures - 1 - Elem;
+}
+
+Uint32 GetDynamicTextureIndex(Uint32 Elem, Uint32 Shift)
+{
+    return (Elem + Shift) % NumTextures;
+}
+
+float4 GetRefColor(Uint32 Shift, Uint32 Draw)
+{
+    float4 Color = GetDynamicColor(Draw) + GetDynamicData(Draw);
+    for (Uint32 i = 0; i < NumArrayElements; ++i)
+    {
+        Color += GetTextureColor(GetMutableTextureIndex(i)) * Weights[i];
+        Color += GetTextureColor(GetDynamicTextureIndex(i, Shift)) * Weights[NumArrayElements + i];
+    }
+    return Color;
+}
+
+bool IsDescriptorBufferEnabled(IRenderDevice* pDevice)
+{
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        return false;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    if (!pDeviceVk)
+        return false;
+
+    DeviceFeaturesVk FeaturesVk;
+    pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+    return FeaturesVk.DescriptorBuffer == DEVICE_FEATURE_STATE_ENABLED;
+}
+
+// Resources are placed in both the static/mutable and the dynamic descriptor sets:
+//  - cbWeights         - static variable, default buffer
+//  - cbDynamic         - mutable variable, dynamic uniform buffer
+//  - g_DynamicData     - dynamic variable, dynamic structured buffer
+//  - g_MutableTextures - mutable variable
+//  - g_DynamicTextures - dynamic variable
+//  - g_Sampler         - immutable sampler that is not assigned to any resource
+//  - g_AssignedSampler - immutable sampler assigned to a sampler resource
+struct DescriptorBufferTestObjects
+{
+    RefCntAutoPtr<IPipelineState>         pPSO;
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    RefCntAutoPtr<IBuffer>                pDynamicCB;
+    RefCntAutoPtr<IBuffer>                pDynamicSB;
+
+    std::array<RefCntAutoPtr<ITexture>, NumTextures> pTextures;
+    std::array<IDeviceObject*, NumTextures>          pSRVs{};
+
+    IShaderResourceVariable* pDynamicTexturesVar = nullptr;
+
+    void SetDynamicTextures(Uint32 Shift)
+    {
+        for (Uint32 i = 0; i < NumArrayElements; ++i)
+            pDynamicTexturesVar->SetArray(&pSRVs[GetDynamicTextureIndex(i, Shift)], i, 1);
+    }
+
+    void UpdateDynamicBuffers(IDeviceContext* pContext, Uint32 Draw)
+    {
+        {
+            MapHelper<float4> CBData{pContext, pDynamicCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            CBData[0] = GetDynamicColor(Draw);
+        }
+        {
+            MapHelper<float4> SBData{pContext, pDynamicSB, MAP_WRITE, MAP_FLAG_DISCARD};
+            SBData[0] = GetDynamicData(Draw);
+        }
+    }
+};
+
+void CreateTestObjects(DescriptorBufferTestObjects& Objects)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    constexpr PipelineResourceDesc Resources[] = //
+        {
+            {SHADER_TYPE_PIXEL, "cbWeights", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_PIXEL, "cbDynamic", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "g_DynamicData", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            {SHADER_TYPE_PIXEL, "g_MutableTextures", NumArrayElements, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "g_DynamicTextures", NumArrayElements, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            {SHADER_TYPE_PIXEL, "g_AssignedSampler", 1, SHADER_RESOURCE_TYPE_SAMPLER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC}, //
+        };
+
+    constexpr ImmutableSamplerDesc ImmutableSamplers[] = //
+        {
+            {SHADER_TYPE_PIXEL, "g_Sampler", Sam_PointClamp},
+            {SHADER_TYPE_PIXEL, "g_AssignedSampler", Sam_LinearClamp}, //
+        };
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name                 = "Descriptor buffer test PRS";
+    PRSDesc.Resources            = Resources;
+    PRSDesc.NumResources         = _countof(Resources);
+    PRSDesc.ImmutableSamplers    = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers = _countof(ImmutableSamplers);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Descriptor buffer test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Descriptor buffer test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Descriptor buffer test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS};
+    PsoCI.ppResourceSignatures                 = ppSignatures;
+    PsoCI.ResourceSignaturesCount              = _countof(ppSignatures);
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    pDevice->CreateGraphicsPipelineState(PsoCI, &Objects.pPSO);
+    ASSERT_NE(Objects.pPSO, nullptr);
+
+    RefCntAutoPtr<IBuffer> pWeightsCB;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Descriptor buffer test weights";
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        BuffDesc.Size      = sizeof(Weights);
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+        pWeightsCB = pEnv->CreateBuffer(BuffDesc, Weights);
+        ASSERT_NE(pWeightsCB, nullptr);
+    }
+
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Descriptor buffer test dynamic CB";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        BuffDesc.Size           = sizeof(float4);
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+
+        pDevice->CreateBuffer(BuffDesc, nullptr, &Objects.pDynamicCB);
+        ASSERT_NE(Objects.pDynamicCB, nullptr);
+
+        BuffDesc.Name              = "Descriptor buffer test dynamic SB";
+        BuffDesc.BindFlags         = BIND_SHADER_RESOURCE;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(float4);
+
+        pDevice->CreateBuffer(BuffDesc, nullptr, &Objects.pDynamicSB);
+        ASSERT_NE(Objects.pDynamicSB, nullptr);
+    }
+
+    constexpr Uint32 TexDim = 4;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        const float4 Color = GetTextureColor(i);
+        const Uint32 Texel = (static_cast<Uint32>(Color.r * 255) << 0u) |
+            (static_cast<Uint32>(Color.g * 255) << 8u) |
+            (static_cast<Uint32>(Color.b * 255) << 16u) |
+            (static_cast<Uint32>(Color.a * 255) << 24u);
+
+        const std::vector<Uint32> TexData(TexDim * TexDim, Texel);
+
+        Objects.pTextures[i] = pEnv->CreateTexture("Descriptor buffer test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, TexDim, TexDim, TexData.data());
+        ASSERT_NE(Objects.pTextures[i], nullptr);
+        Objects.pSRVs[i] = Objects.pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbWeights")->Set(pWeightsCB);
+
+    pPRS->CreateShaderResourceBinding(&Objects.pSRB, true);
+    ASSERT_NE(Objects.pSRB, nullptr);
+
+    IShaderResourceBinding* pSRB = Objects.pSRB;
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbDynamic")->Set(Objects.pDynamicCB);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicData")->Set(Objects.pDynamicSB->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+
+    IShaderResourceVariable* pMutableTexturesVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableTextures");
+    ASSERT_NE(pMutableTexturesVar, nullptr);
+    for (Uint32 i = 0; i < NumArrayElements; ++i)
+        pMutableTexturesVar->SetArray(&Objects.pSRVs[GetMutableTextureIndex(i)], i, 1);
+
+    Objects.pDynamicTexturesVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicTextures");
+    ASSERT_NE(Objects.pDynamicTexturesVar, nullptr);
+
+    // Samplers with immutable samplers assigned are not exposed as variables
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_AssignedSampler"), nullptr);
+}
+
+void TakeReferenceSnapshot(const float4& RefColor)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+    ASSERT_NE(pTestingSwapChain, nullptr);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], RefColor.Data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+    pContext->InvalidateState();
+    pTestingSwapChain->TakeSnapshot();
+}
+
+void SetRenderTargetsAndPSO(IPipelineState* pPSO)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+}
+
+// Every draw commits the SRB with a new set of dynamic textures and new contents of dynamic buffers.
+TEST(DescriptorBufferVkTest, StaticMutableDynamicVariables)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    if (!IsDescriptorBufferEnabled(pEnv->GetDevice()))
+        GTEST_SKIP() << "Descriptor buffers are not enabled on this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    DescriptorBufferTestObjects Objects;
+    ASSERT_NO_FATAL_FAILURE(CreateTestObjects(Objects));
+
+    constexpr Uint32 NumDraws = NumTextures + 3;
+    ASSERT_NO_FATAL_FAILURE(TakeReferenceSnapshot(GetRefColor(NumDraws - 1, NumDraws - 1)));
+
+    SetRenderTargetsAndPSO(Objects.pPSO);
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        Objects.SetDynamicTextures(i);
+        Objects.UpdateDynamicBuffers(pContext, i);
+        pContext->CommitShaderResources(Objects.pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+    pSwapChain->Present();
+}
+
+// The SRB is committed once. Descriptors of dynamic buffers contain buffer addresses, so they
+// must be rewritten by every draw after the buffers have been mapped again.
+TEST(DescriptorBufferVkTest, DynamicBuffers)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    if (!IsDescriptorBufferEnabled(pEnv->GetDevice()))
+        GTEST_SKIP() << "Descriptor buffers are not enabled on this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    DescriptorBufferTestObjects Objects;
+    ASSERT_NO_FATAL_FAILURE(CreateTestObjects(Objects));
+
+    constexpr Uint32 NumDraws = 11;
+    ASSERT_NO_FATAL_FAILURE(TakeReferenceSnapshot(GetRefColor(0, NumDraws - 1)));
+
+    SetRenderTargetsAndPSO(Objects.pPSO);
+    Objects.SetDynamicTextures(0);
+    Objects.UpdateDynamicBuffers(pContext, 0);
+    pContext->CommitShaderResources(Objects.pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        if (i > 0)
+            Objects.UpdateDynamicBuffers(pContext, i);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+    pSwapChain->Present();
+}
+
+// Flush() and InvalidateState() reset the command buffer state, so the descriptor buffer
+// and the set offsets must be bound again when the SRB is committed next time.
+TEST(DescriptorBufferVkTest, FlushAndInvalidateState)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    if (!IsDescriptorBufferEnabled(pEnv->GetDevice()))
+        GTEST_SKIP() << "Descriptor buffers are not enabled on this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    DescriptorBufferTestObjects Objects;
+    ASSERT_NO_FATAL_FAILURE(CreateTestObjects(Objects));
+
+    constexpr Uint32 NumDraws = 6;
+    ASSERT_NO_FATAL_FAILURE(TakeReferenceSnapshot(GetRefColor(NumDraws - 1, NumDraws - 1)));
+
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        SetRenderTargetsAndPSO(Objects.pPSO);
+        Objects.SetDynamicTextures(i);
+        Objects.UpdateDynamicBuffers(pContext, i);
+        pContext->CommitShaderResources(Objects.pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+
+        if (i + 1 < NumDraws)
+        {
+            pContext->Flush();
+            if (i % 2 == 1)
+                pContext->InvalidateState();
+        }
+    }
+    pSwapChain->Present();
+}
+
+} // namespace
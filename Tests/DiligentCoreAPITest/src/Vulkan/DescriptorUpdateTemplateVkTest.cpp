@@ -0,0 +1,274 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "TestingSwapChainBase.hpp"
+#include "CommonlyUsedStates.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+void main(in  uint   VertId : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float2 UV     : TEX_COORD)
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+
+    Pos = float4(PosXY[VertId], 0.0, 1.0);
+    UV  = PosXY[VertId] * float2(0.5, -0.5) + float2(0.5, 0.5);
+}
+)";
+
+const char* const PSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Weights[2];
+};
+
+Texture2D    g_Textures[8];
+SamplerState g_Sampler;
+
+float4 main(in float4 Pos : SV_Position,
+            in float2 UV  : TEX_COORD) : SV_Target
+{
+    float4 Color = float4(0.0, 0.0, 0.0, 0.0);
+    Color += g_Textures[0].Sample(g_Sampler, UV) * g_Weights[0].x;
+    Color += g_Textures[1].Sample(g_Sampler, UV) * g_Weights[0].y;
+    Color += g_Textures[2].Sample(g_Sampler, UV) * g_Weights[0].z;
+    Color += g_Textures[3].Sample(g_Sampler, UV) * g_Weights[0].w;
+    Color += g_Textures[4].Sample(g_Sampler, UV) * g_Weights[1].x;
+    Color += g_Textures[5].Sample(g_Sampler, UV) * g_Weights[1].y;
+    Color += g_Textures[6].Sample(g_Sampler, UV) * g_Weights[1].z;
+    Color += g_Textures[7].Sample(g_Sampler, UV) * g_Weights[1].w;
+    return Color;
+}
+)";
+
+constexpr Uint32 NumTextures = 8;
+
+// g_Weights are powers of two, so every combination of textures results in a unique color
+// that is exactly representable as a float.
+constexpr float Weights[NumTextures] = {1.f / 64.f, 2.f / 64.f, 4.f / 64.f, 8.f / 64.f, 16.f / 64.f, 32.f / 64.f, 0.f, 0.f};
+
+// Returns the color of the i-th test texture
+float4 GetTextureColor(Uint32 i)
+{
+    return float4{
+        static_cast<float>(i & 0x01),
+        static_cast<float>((i >> 1) & 0x01),
+        static_cast<float>((i >> 2) & 0x01),
+        1.f,
+    };
+}
+
+// Renders a full-screen triangle with all resources declared as dynamic variables and compares
+// the result with the expected color. Every commit writes a new dynamic descriptor set.
+// If BindUnusedTexture is false, a resource in the signature that is not used by the shader
+// remains null, so the descriptor update template can't be used and the resource cache falls
+// back to writing individual descriptors.
+void TestDynamicResources(bool BindUnusedTexture)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    constexpr SHADER_RESOURCE_VARIABLE_TYPE VarType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+    constexpr PipelineResourceDesc Resources[] = //
+        {
+            {SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, VarType},
+            {SHADER_TYPE_PIXEL, "g_Textures", NumTextures, SHADER_RESOURCE_TYPE_TEXTURE_SRV, VarType},
+            {SHADER_TYPE_PIXEL, "g_UnusedTexture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, VarType}, //
+        };
+
+    // Separate immutable samplers are not written to the descriptor set
+    constexpr ImmutableSamplerDesc ImmutableSamplers[] = {{SHADER_TYPE_PIXEL, "g_Sampler", Sam_PointClamp}};
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name                 = "Descriptor update template test PRS";
+    PRSDesc.Resources            = Resources;
+    PRSDesc.NumResources         = _countof(Resources);
+    PRSDesc.ImmutableSamplers    = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers = _countof(ImmutableSamplers);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Descriptor update template test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Descriptor update template test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Descriptor update template test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS};
+    PsoCI.ppResourceSignatures                 = ppSignatures;
+    PsoCI.ResourceSignaturesCount              = _countof(ppSignatures);
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Descriptor update template test constants";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = sizeof(Weights);
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pCB = pEnv->CreateBuffer(BuffDesc, Weights);
+    ASSERT_NE(pCB, nullptr);
+
+    constexpr Uint32 TexDim = 4;
+
+    std::array<RefCntAutoPtr<ITexture>, NumTextures> pTextures;
+    std::array<IDeviceObject*, NumTextures>          pSRVs{};
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        const float4 Color = GetTextureColor(i);
+        const Uint32 Texel = (static_cast<Uint32>(Color.r * 255) << 0u) |
+            (static_cast<Uint32>(Color.g * 255) << 8u) |
+            (static_cast<Uint32>(Color.b * 255) << 16u) |
+            (static_cast<Uint32>(Color.a * 255) << 24u);
+
+        const std::vector<Uint32> TexData(TexDim * TexDim, Texel);
+
+        pTextures[i] = pEnv->CreateTexture("Descriptor update template test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, TexDim, TexDim, TexData.data());
+        ASSERT_NE(pTextures[i], nullptr);
+        pSRVs[i] = pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pCB);
+    if (BindUnusedTexture)
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_UnusedTexture")->Set(pSRVs[0]);
+
+    IShaderResourceVariable* pTexturesVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures");
+    ASSERT_NE(pTexturesVar, nullptr);
+
+    // Sets the texture array rotated by Shift elements
+    auto SetTextures = [&](Uint32 Shift) {
+        for (Uint32 i = 0; i < NumTextures; ++i)
+            pTexturesVar->SetArray(&pSRVs[(i + Shift) % NumTextures], i, 1);
+    };
+
+    // Every draw commits a new dynamic descriptor set with a different texture order.
+    // The last draw determines the result.
+    constexpr Uint32 NumDraws = NumTextures + 3;
+
+    float4 RefColor;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        RefColor += GetTextureColor((i + NumDraws - 1) % NumTextures) * Weights[i];
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+
+    {
+        RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+        ASSERT_NE(pTestingSwapChain, nullptr);
+
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->ClearRenderTarget(pRTVs[0], RefColor.Data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Flush();
+        pContext->InvalidateState();
+        pTestingSwapChain->TakeSnapshot();
+    }
+
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        SetTextures(i);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+    pSwapChain->Present();
+}
+
+// All resources in the dynamic set are bound, so the set is written with vkUpdateDescriptorSetWithTemplate
+// when VK_KHR_descriptor_update_template is supported.
+TEST(DescriptorUpdateTemplateVkTest, CommitDynamicResources_Template)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    if (!pEnv->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+    TestDynamicResources(/*BindUnusedTexture = */ true);
+}
+
+// One resource in the dynamic set is null, so the set is written with individual descriptor writes.
+TEST(DescriptorUpdateTemplateVkTest, CommitDynamicResources_NullDescriptorFallback)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    if (!pEnv->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+    TestDynamicResources(/*BindUnusedTexture = */ false);
+}
+
+} // namespace
@@ -0,0 +1,403 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+#include "RenderDeviceVk.h"
+#include "BufferVk.h"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IRenderDeviceVk> GetDeviceVk()
+{
+    IRenderDevice* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        return {};
+
+    return RefCntAutoPtr<IRenderDeviceVk>{pDevice, IID_RenderDeviceVk};
+}
+
+DeviceMemoryStatsVk GetMemoryStats(IRenderDeviceVk* pDeviceVk)
+{
+    DeviceMemoryStatsVk Stats;
+    pDeviceVk->GetDeviceMemoryStats(Stats);
+    return Stats;
+}
+
+RefCntAutoPtr<IBuffer> CreateDeviceLocalBuffer(Uint64 Size)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Memory manager test buffer";
+    BuffDesc.Size      = Size;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    GPUTestingEnvironment::GetInstance()->GetDevice()->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+// Releases the memory of the resources that are no longer in use and the pages that are no longer needed.
+void ReleaseStaleMemory(IRenderDeviceVk* pDeviceVk)
+{
+    // The memory manager is shrunk before the release queues are purged,
+    // so the pages freed by the purge are released by the second call.
+    pDeviceVk->IdleGPU();
+    pDeviceVk->ReleaseStaleResources();
+}
+
+TEST(MemoryManagerVkTest, SizeClassRouting)
+{
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk = GetDeviceVk();
+    if (!pDeviceVk)
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const DeviceMemoryStatsVk RefStats = GetMemoryStats(pDeviceVk);
+    const Uint64              PageSize = RefStats.DeviceLocalPageSize;
+    ASSERT_GT(PageSize, 0u);
+
+    // Allocations not larger than 1/64 of the page size are small
+    RefCntAutoPtr<IBuffer> pSmallBuffer = CreateDeviceLocalBuffer(1024);
+    ASSERT_NE(pSmallBuffer, nullptr);
+    {
+        const DeviceMemoryStatsVk Stats = GetMemoryStats(pDeviceVk);
+        EXPECT_EQ(Stats.Small.NumAllocations, RefStats.Small.NumAllocations + 1);
+        EXPECT_EQ(Stats.Medium.NumAllocations, RefStats.Medium.NumAllocations);
+        EXPECT_EQ(Stats.Dedicated.NumAllocations, RefStats.Dedicated.NumAllocations);
+        EXPECT_GE(Stats.Small.UsedSize, RefStats.Small.UsedSize + 1024);
+    }
+
+    // Allocations not larger than 1/2 of the page size are medium
+    RefCntAutoPtr<IBuffer> pMediumBuffer = CreateDeviceLocalBuffer(PageSize / 4);
+    ASSERT_NE(pMediumBuffer, nullptr);
+    {
+        const DeviceMemoryStatsVk Stats = GetMemoryStats(pDeviceVk);
+        EXPECT_EQ(Stats.Small.NumAllocations, RefStats.Small.NumAllocations + 1);
+        EXPECT_EQ(Stats.Medium.NumAllocations, RefStats.Medium.NumAllocations + 1);
+        EXPECT_EQ(Stats.Dedicated.NumAllocations, RefStats.Dedicated.NumAllocations);
+        EXPECT_GE(Stats.Medium.UsedSize, RefStats.Medium.UsedSize + PageSize / 4);
+    }
+
+    // Larger allocations are given dedicated pages
+    const Uint64           DedicatedSize    = PageSize / 2 + PageSize / 4;
+    RefCntAutoPtr<IBuffer> pDedicatedBuffer = CreateDeviceLocalBuffer(DedicatedSize);
+    ASSERT_NE(pDedicatedBuffer, nullptr);
+    {
+        const DeviceMemoryStatsVk Stats = GetMemoryStats(pDeviceVk);
+        EXPECT_EQ(Stats.Small.NumAllocations, RefStats.Small.NumAllocations + 1);
+        EXPECT_EQ(Stats.Medium.NumAllocations, RefStats.Medium.NumAllocations + 1);
+        EXPECT_EQ(Stats.Dedicated.NumAllocations, RefStats.Dedicated.NumAllocations + 1);
+        EXPECT_EQ(Stats.Dedicated.PageCount, RefStats.Dedicated.PageCount + 1);
+        EXPECT_GE(Stats.Dedicated.AllocatedSize, RefStats.Dedicated.AllocatedSize + DedicatedSize);
+        // The page has the exact size of the allocation
+        EXPECT_EQ(Stats.Dedicated.FreeSize, RefStats.Dedicated.FreeSize);
+    }
+}
+
+TEST(MemoryManagerVkTest, ShrinkMemoryReleasesDedicatedPages)
+{
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk = GetDeviceVk();
+    if (!pDeviceVk)
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ReleaseStaleMemory(pDeviceVk);
+
+    const DeviceMemoryStatsVk RefStats = GetMemoryStats(pDeviceVk);
+    const Uint64              PageSize = RefStats.DeviceLocalPageSize;
+
+    constexpr Uint32                                 NumBuffers = 3;
+    std::array<RefCntAutoPtr<IBuffer>, NumBuffers> pBuffers;
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        pBuffers[i] = CreateDeviceLocalBuffer(PageSize + i * PageSize / 2);
+        ASSERT_NE(pBuffers[i], nullptr);
+    }
+    EXPECT_EQ(GetMemoryStats(pDeviceVk).Dedicated.PageCount, RefStats.Dedicated.PageCount + NumBuffers);
+
+    // Shrinking the memory while the allocations are alive must not release the pages
+    ReleaseStaleMemory(pDeviceVk);
+    EXPECT_EQ(GetMemoryStats(pDeviceVk).Dedicated.PageCount, RefStats.Dedicated.PageCount + NumBuffers);
+
+    // Empty dedicated pages are released regardless of the reserve size
+    pBuffers[1].Release();
+    ReleaseStaleMemory(pDeviceVk);
+    EXPECT_EQ(GetMemoryStats(pDeviceVk).Dedicated.PageCount, RefStats.Dedicated.PageCount + NumBuffers - 1);
+
+    pBuffers[0].Release();
+    pBuffers[2].Release();
+    ReleaseStaleMemory(pDeviceVk);
+
+    const DeviceMemoryStatsVk Stats = GetMemoryStats(pDeviceVk);
+    EXPECT_EQ(Stats.Dedicated.PageCount, RefStats.Dedicated.PageCount);
+    EXPECT_EQ(Stats.Dedicated.AllocatedSize, RefStats.Dedicated.AllocatedSize);
+    EXPECT_EQ(Stats.Dedicated.UsedSize, RefStats.Dedicated.UsedSize);
+}
+
+// Every thread caches the page it last allocated from. Destroying pages must invalidate the cached
+// pages of all threads, after which the allocations must be served from the remaining pages.
+TEST(MemoryManagerVkTest, PageHintInvalidation)
+{
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk = GetDeviceVk();
+    if (!pDeviceVk)
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const Uint64 PageSize = GetMemoryStats(pDeviceVk).DeviceLocalPageSize;
+
+    constexpr Uint32 NumThreads      = 4;
+    constexpr Uint32 NumSmallBuffers = 8;
+    constexpr Uint32 SmallBufferSize = 4096;
+
+    std::array<std::vector<RefCntAutoPtr<IBuffer>>, NumThreads> ThreadBuffers;
+
+    auto RunThreads = [&]() {
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&ThreadBuffers, t]() {
+                for (Uint32 i = 0; i < NumSmallBuffers; ++i)
+                    ThreadBuffers[t].emplace_back(CreateDeviceLocalBuffer(SmallBufferSize));
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+    };
+
+    // Let every thread cache a small page
+    RunThreads();
+
+    // Release half of the buffers of every thread to make room in the existing pages
+    for (auto& Buffers : ThreadBuffers)
+    {
+        for (const auto& pBuffer : Buffers)
+            ASSERT_NE(pBuffer, nullptr);
+        Buffers.resize(NumSmallBuffers / 2);
+    }
+
+    // Destroy dedicated pages to change the pages generation
+    {
+        RefCntAutoPtr<IBuffer> pDedicatedBuffer = CreateDeviceLocalBuffer(PageSize);
+        ASSERT_NE(pDedicatedBuffer, nullptr);
+    }
+    const Uint32 NumDedicatedPages = GetMemoryStats(pDeviceVk).Dedicated.PageCount;
+    ReleaseStaleMemory(pDeviceVk);
+
+    const DeviceMemoryStatsVk RefStats = GetMemoryStats(pDeviceVk);
+    ASSERT_LT(RefStats.Dedicated.PageCount, NumDedicatedPages);
+
+    // The cached pages are stale now, so the allocations must fall back to the pages that exist
+    RunThreads();
+
+    for (const auto& Buffers : ThreadBuffers)
+    {
+        EXPECT_EQ(Buffers.size(), NumSmallBuffers / 2 + NumSmallBuffers);
+        for (const auto& pBuffer : Buffers)
+            EXPECT_NE(pBuffer, nullptr);
+    }
+
+    const DeviceMemoryStatsVk Stats = GetMemoryStats(pDeviceVk);
+    EXPECT_EQ(Stats.Small.NumAllocations, RefStats.Small.NumAllocations + NumThreads * NumSmallBuffers);
+    EXPECT_GE(Stats.Small.UsedSize, RefStats.Small.UsedSize + NumThreads * NumSmallBuffers * SmallBufferSize);
+    EXPECT_EQ(Stats.Dedicated.PageCount, RefStats.Dedicated.PageCount);
+}
+
+TEST(MemoryManagerVkTest, GetStats)
+{
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk = GetDeviceVk();
+    if (!pDeviceVk)
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const DeviceMemoryStatsVk RefStats = GetMemoryStats(pDeviceVk);
+    EXPECT_GT(RefStats.DeviceLocalPageSize, 0u);
+    EXPECT_GT(RefStats.HostVisiblePageSize, 0u);
+
+    // Leave gaps between the allocations to fragment the free space
+    constexpr Uint32                    NumBuffers = 16;
+    const Uint64                        BufferSize = RefStats.DeviceLocalPageSize / 128;
+    std::vector<RefCntAutoPtr<IBuffer>> pBuffers(NumBuffers);
+    for (auto& pBuffer : pBuffers)
+    {
+        pBuffer = CreateDeviceLocalBuffer(BufferSize);
+        ASSERT_NE(pBuffer, nullptr);
+    }
+    for (Uint32 i = 0; i < NumBuffers; i += 2)
+        pBuffers[i].Release();
+    pDeviceVk->IdleGPU();
+
+    const DeviceMemoryStatsVk Stats = GetMemoryStats(pDeviceVk);
+    EXPECT_EQ(Stats.Small.NumAllocations, RefStats.Small.NumAllocations + NumBuffers);
+
+    for (const DeviceMemorySizeClassStatsVk* pClassStats : {&Stats.Small, &Stats.Medium, &Stats.Dedicated})
+    {
+        EXPECT_EQ(pClassStats->UsedSize + pClassStats->FreeSize, pClassStats->AllocatedSize);
+        EXPECT_LE(pClassStats->MaxFreeBlockSize, pClassStats->FreeSize);
+        EXPECT_GE(pClassStats->Fragmentation, 0.f);
+        EXPECT_LE(pClassStats->Fragmentation, 1.f);
+        EXPECT_LE(pClassStats->MaxAllocationTime, pClassStats->TotalAllocationTime);
+        if (pClassStats->PageCount == 0)
+        {
+            EXPECT_EQ(pClassStats->AllocatedSize, 0u);
+            EXPECT_EQ(pClassStats->Fragmentation, 0.f);
+        }
+    }
+
+    // The released buffers leave holes between the live ones
+    EXPECT_GE(Stats.Small.UsedSize, RefStats.Small.UsedSize + NumBuffers / 2 * BufferSize);
+    EXPECT_GT(Stats.Small.Fragmentation, 0.f);
+}
+
+// Immutable vertex buffers are moved out of sparsely used pages with GPU copies over several frames.
+TEST(MemoryManagerVkTest, Defragmentation)
+{
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk = GetDeviceVk();
+    if (!pDeviceVk)
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    TestingEnvironmentVk* pEnv = TestingEnvironmentVk::GetInstance();
+    if (!pEnv->IsMemoryDefragmentationEnabled())
+        GTEST_SKIP() << "Memory defragmentation is not enabled. Use --vk_memory_defragmentation command line option to run this test";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    IDeviceContext* pContext = pEnv->GetDeviceContext();
+
+    ReleaseStaleMemory(pDeviceVk);
+    const DeviceMemoryStatsVk RefStats = GetMemoryStats(pDeviceVk);
+
+    const Uint64 PageSize   = RefStats.DeviceLocalPageSize;
+    const Uint64 BufferSize = PageSize / 256;
+    const Uint32 NumValues  = static_cast<Uint32>(BufferSize / sizeof(Uint32));
+
+    // Small pages are 1/4 of the page size, so the buffers fill at least three small pages
+    constexpr Uint32 NumBuffers = 256;
+    constexpr Uint32 KeepStride = 4;
+
+    auto GetBufferData = [NumValues](Uint32 BufferId) {
+        std::vector<Uint32> Data(NumValues);
+        for (Uint32 i = 0; i < NumValues; ++i)
+            Data[i] = BufferId * NumValues + i;
+        return Data;
+    };
+
+    std::vector<RefCntAutoPtr<IBuffer>> pBuffers(NumBuffers);
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        const std::vector<Uint32> Data = GetBufferData(i);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Movable buffer";
+        BuffDesc.Size      = BufferSize;
+        BuffDesc.Usage     = USAGE_IMMUTABLE;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+        BufferData InitData{Data.data(), BufferSize};
+        pEnv->GetDevice()->CreateBuffer(BuffDesc, &InitData, &pBuffers[i]);
+        ASSERT_NE(pBuffers[i], nullptr);
+    }
+
+    // Leave every page sparsely used
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        if (i % KeepStride != 0)
+            pBuffers[i].Release();
+    }
+    ReleaseStaleMemory(pDeviceVk);
+
+    std::vector<VkBuffer> OrigVkBuffers(NumBuffers);
+    for (Uint32 i = 0; i < NumBuffers; i += KeepStride)
+        OrigVkBuffers[i] = pBuffers[i].Cast<IBufferVk>(IID_BufferVk)->GetVkBuffer();
+
+    // The copies are recorded in one frame and the buffers are switched to the new memory in the next one
+    constexpr Uint32 NumFrames = 16;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        pContext->Flush();
+        pContext->FinishFrame();
+        pDeviceVk->IdleGPU();
+    }
+
+    Uint32 NumMovedBuffers = 0;
+    for (Uint32 i = 0; i < NumBuffers; i += KeepStride)
+    {
+        if (pBuffers[i].Cast<IBufferVk>(IID_BufferVk)->GetVkBuffer() != OrigVkBuffers[i])
+            ++NumMovedBuffers;
+    }
+    EXPECT_GT(NumMovedBuffers, 0u);
+
+    // The contents of the buffers must have been preserved
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Defragmentation test staging buffer";
+    StagingDesc.Size           = BufferSize * (NumBuffers / KeepStride);
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pEnv->GetDevice()->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    for (Uint32 i = 0; i < NumBuffers; i += KeepStride)
+    {
+        pContext->CopyBuffer(pBuffers[i], 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, BufferSize * (i / KeepStride), BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    pContext->WaitForIdle();
+
+    MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+    ASSERT_NE(ReadBackData, nullptr);
+    for (Uint32 i = 0; i < NumBuffers; i += KeepStride)
+    {
+        const std::vector<Uint32> RefData = GetBufferData(i);
+        EXPECT_EQ(memcmp(&ReadBackData[NumValues * (i / KeepStride)], RefData.data(), BufferSize), 0) << "Buffer " << i;
+    }
+    ReadBackData.Unmap();
+
+    // All moves have completed, so no allocation must remain when the buffers are released
+    pBuffers.clear();
+    pStagingBuffer.Release();
+    ReleaseStaleMemory(pDeviceVk);
+    EXPECT_EQ(GetMemoryStats(pDeviceVk).Small.UsedSize, RefStats.Small.UsedSize);
+}
+
+} // namespace
@@ -0,0 +1,292 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+#include "TestingSwapChainBase.hpp"
+#include "RenderDeviceVk.h"
+#include "PipelineStateVk.h"
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const VSSource = R"(
+float4 main(in uint VertId : SV_VertexID) : SV_Position
+{
+    float2 PosXY[3];
+    PosXY[0] = float2(-1.0, -1.0);
+    PosXY[1] = float2(-1.0, +3.0);
+    PosXY[2] = float2(+3.0, -1.0);
+    return float4(PosXY[VertId], 0.0, 1.0);
+}
+)";
+
+const char* const PSSource = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(0.25, 0.5, 0.75, 1.0);
+}
+)";
+
+constexpr float RefColor[] = {0.25f, 0.5f, 0.75f, 1.f};
+
+bool IsGraphicsPipelineLibraryEnabled(IRenderDevice* pDevice)
+{
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        return false;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    if (!pDeviceVk)
+        return false;
+
+    DeviceFeaturesVk FeaturesVk;
+    pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+    return FeaturesVk.GraphicsPipelineLibrary == DEVICE_FEATURE_STATE_ENABLED;
+}
+
+RefCntAutoPtr<IPipelineState> CreateTestPSO()
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Pipeline library test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Pipeline library test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name = "Pipeline library test";
+
+    PsoCI.pVS = pVS;
+    PsoCI.pPS = pPS;
+
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    return pPSO;
+}
+
+VkPipeline GetVkPipeline(IPipelineState* pPSO)
+{
+    RefCntAutoPtr<IPipelineStateVk> pPSOVk{pPSO, IID_PipelineStateVk};
+    return pPSOVk ? pPSOVk->GetVkPipeline() : VK_NULL_HANDLE;
+}
+
+void RenderAndCompare(IPipelineState* pPSO)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<ITestingSwapChain> pTestingSwapChain{pSwapChain, IID_TestingSwapChain};
+    ASSERT_NE(pTestingSwapChain, nullptr);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], RefColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+    pContext->InvalidateState();
+    pTestingSwapChain->TakeSnapshot();
+
+    constexpr float ClearColor[] = {0, 0, 0, 0};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    pSwapChain->Present();
+}
+
+// Occupies all threads of the thread pool so that the optimized link task stays in the queue.
+class ThreadPoolBlocker
+{
+public:
+    explicit ThreadPoolBlocker(IThreadPool* pThreadPool) :
+        m_pThreadPool{pThreadPool}
+    {
+        // Blocking tasks have higher priority than the optimized link task.
+        const Uint32 NumThreads = m_pThreadPool->GetThreadCount();
+        for (Uint32 i = 0; i < NumThreads; ++i)
+        {
+            EnqueueAsyncWork(
+                m_pThreadPool,
+                [this](Uint32 ThreadId) {
+                    m_NumStarted.fetch_add(1);
+                    while (m_Block.load())
+                        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                    return ASYNC_TASK_STATUS_COMPLETE;
+                },
+                1.f);
+        }
+
+        // Wait until every thread runs a blocking task
+        while (m_NumStarted.load() < NumThreads)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    ~ThreadPoolBlocker()
+    {
+        Unblock();
+    }
+
+    void Unblock()
+    {
+        m_Block.store(false);
+        m_pThreadPool->WaitForAllTasks();
+    }
+
+private:
+    IThreadPool*        m_pThreadPool = nullptr;
+    std::atomic<bool>   m_Block{true};
+    std::atomic<Uint32> m_NumStarted{0};
+};
+
+// The pipeline is fast-linked from the libraries and is usable immediately.
+// The optimized pipeline is linked in the background and replaces the fast-linked pipeline when ready.
+TEST(PipelineLibraryVkTest, OptimizedLink)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!IsGraphicsPipelineLibraryEnabled(pDevice))
+        GTEST_SKIP() << "Graphics pipeline libraries are not enabled on this device";
+
+    IThreadPool* pThreadPool = pDevice->GetShaderCompilationThreadPool();
+    if (pThreadPool == nullptr)
+        GTEST_SKIP() << "Optimized pipelines are linked in the background only when the device has a shader compilation thread pool";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ThreadPoolBlocker Blocker{pThreadPool};
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateTestPSO();
+    ASSERT_NE(pPSO, nullptr);
+
+    const VkPipeline vkFastLinkedPipeline = GetVkPipeline(pPSO);
+    ASSERT_NE(vkFastLinkedPipeline, VK_NULL_HANDLE);
+
+    RenderAndCompare(pPSO);
+    // The optimized link task can't start while the thread pool is blocked
+    EXPECT_EQ(GetVkPipeline(pPSO), vkFastLinkedPipeline);
+
+    Blocker.Unblock();
+
+    const VkPipeline vkOptimizedPipeline = GetVkPipeline(pPSO);
+    EXPECT_NE(vkOptimizedPipeline, VK_NULL_HANDLE);
+    EXPECT_NE(vkOptimizedPipeline, vkFastLinkedPipeline);
+
+    RenderAndCompare(pPSO);
+}
+
+// The optimized link task that has not started must be removed from the queue when the pipeline is destroyed.
+TEST(PipelineLibraryVkTest, CancelOnDestruction)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!IsGraphicsPipelineLibraryEnabled(pDevice))
+        GTEST_SKIP() << "Graphics pipeline libraries are not enabled on this device";
+
+    IThreadPool* pThreadPool = pDevice->GetShaderCompilationThreadPool();
+    if (pThreadPool == nullptr)
+        GTEST_SKIP() << "Optimized pipelines are linked in the background only when the device has a shader compilation thread pool";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ThreadPoolBlocker Blocker{pThreadPool};
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateTestPSO();
+    ASSERT_NE(pPSO, nullptr);
+
+    const Uint32 QueueSize = pThreadPool->GetQueueSize();
+    EXPECT_GT(QueueSize, 0u);
+
+    // The destructor must not wait for the blocked thread pool
+    pPSO.Release();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), QueueSize - 1);
+
+    Blocker.Unblock();
+}
+
+// Pipelines with the same state share the libraries. The libraries must stay alive
+// while any pipeline that uses them exists, and must be recreated after they have been evicted.
+TEST(PipelineLibraryVkTest, SharedLibraries)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!IsGraphicsPipelineLibraryEnabled(pDevice))
+        GTEST_SKIP() << "Graphics pipeline libraries are not enabled on this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineState> pPSO1 = CreateTestPSO();
+    ASSERT_NE(pPSO1, nullptr);
+    RefCntAutoPtr<IPipelineState> pPSO2 = CreateTestPSO();
+    ASSERT_NE(pPSO2, nullptr);
+
+    // The second pipeline holds the libraries
+    pPSO1.Release();
+    RenderAndCompare(pPSO2);
+
+    // The libraries are evicted and created again
+    pPSO2.Release();
+    RefCntAutoPtr<IPipelineState> pPSO3 = CreateTestPSO();
+    ASSERT_NE(pPSO3, nullptr);
+    RenderAndCompare(pPSO3);
+}
+
+} // namespace
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderVk.h"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const ShaderSource = R"(
+cbuffer Constants
+{
+    float4 g_Color;
+    float4 g_Scale;
+};
+
+Texture2D              g_Textures[4];
+SamplerState           g_Sampler;
+StructuredBuffer<uint> g_Indices;
+RWTexture2D<float4>    g_RWTex;
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    uint Idx = g_Indices[uint(Pos.x)] % 4u;
+    g_RWTex[uint2(Pos.xy)] = g_Color;
+    return g_Textures[Idx].Sample(g_Sampler, Pos.xy) * g_Scale;
+}
+)";
+
+void CompareResources(IShader* pShader0, IShader* pShader1)
+{
+    ASSERT_EQ(pShader0->GetResourceCount(), pShader1->GetResourceCount());
+    for (Uint32 i = 0; i < pShader0->GetResourceCount(); ++i)
+    {
+        ShaderResourceDesc Desc0, Desc1;
+        pShader0->GetResourceDesc(i, Desc0);
+        pShader1->GetResourceDesc(i, Desc1);
+        EXPECT_STREQ(Desc0.Name, Desc1.Name);
+        EXPECT_EQ(Desc0.Type, Desc1.Type);
+        EXPECT_EQ(Desc0.ArraySize, Desc1.ArraySize);
+    }
+}
+
+TEST(ShaderBytecodeReflectionVkTest, CreateFromBytecodeWithReflection)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source         = ShaderSource;
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Desc           = {"Bytecode reflection test", SHADER_TYPE_PIXEL, true};
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+    RefCntAutoPtr<IShader> pShader;
+    pDevice->CreateShader(ShaderCI, &pShader);
+    ASSERT_NE(pShader, nullptr);
+    EXPECT_EQ(pShader->GetResourceCount(), 5u);
+
+    RefCntAutoPtr<IShaderVk> pShaderVk{pShader, IID_ShaderVk};
+    ASSERT_NE(pShaderVk, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pBytecode;
+    pShaderVk->GetBytecodeWithReflection(&pBytecode);
+    ASSERT_NE(pBytecode, nullptr);
+    const std::vector<uint32_t>& SPIRV = pShaderVk->GetSPIRV();
+    EXPECT_GT(pBytecode->GetSize(), SPIRV.size() * sizeof(SPIRV[0]));
+
+    ShaderCreateInfo BytecodeCI;
+    BytecodeCI.Desc = ShaderCI.Desc;
+
+    // Create the shader from the plain SPIRV and from the SPIRV with serialized resources
+    for (Uint32 WithReflection = 0; WithReflection < 2; ++WithReflection)
+    {
+        BytecodeCI.ByteCode     = WithReflection ? pBytecode->GetConstDataPtr() : SPIRV.data();
+        BytecodeCI.ByteCodeSize = WithReflection ? pBytecode->GetSize() : SPIRV.size() * sizeof(SPIRV[0]);
+
+        RefCntAutoPtr<IShader> pShader2;
+        pDevice->CreateShader(BytecodeCI, &pShader2);
+        ASSERT_NE(pShader2, nullptr);
+        CompareResources(pShader, pShader2);
+
+        // The serialized resources must not be passed to the driver
+        RefCntAutoPtr<IShaderVk> pShader2Vk{pShader2, IID_ShaderVk};
+        EXPECT_EQ(pShader2Vk->GetSPIRV(), SPIRV);
+    }
+
+    // Uniform buffer reflection is not serialized, so it must be loaded from SPIRV
+    BytecodeCI.LoadConstantBufferReflection = true;
+    {
+        RefCntAutoPtr<IShader> pShader2;
+        pDevice->CreateShader(BytecodeCI, &pShader2);
+        ASSERT_NE(pShader2, nullptr);
+        CompareResources(pShader, pShader2);
+
+        const ShaderCodeBufferDesc* pCBDesc = pShader2->GetConstantBufferDesc(0);
+        ASSERT_NE(pCBDesc, nullptr);
+        EXPECT_EQ(pCBDesc->NumVariables, 2u);
+    }
+}
+
+} // namespace
@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "RefCntAutoPtr.hpp"
+#include "RefCountedObjectImpl.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+template <RefCountersThreading ThreadingMode>
+class BenchmarkObject : public RefCountedObject<IObject, ThreadingMode>
+{
+public:
+    using TBase = RefCountedObject<IObject, ThreadingMode>;
+
+    BenchmarkObject(IReferenceCounters* pRefCounters) :
+        TBase{pRefCounters}
+    {}
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override
+    {
+        *ppInterface = nullptr;
+        if (IID == IID_Unknown)
+        {
+            *ppInterface = this;
+            (*ppInterface)->AddRef();
+        }
+    }
+};
+
+template <typename ObjectType>
+void RunRefCountingBenchmark(const char* Name)
+{
+    constexpr Uint32 NumIterations = 1u << 22;
+
+    RefCntAutoPtr<ObjectType> pObj{MakeNewRCObj<ObjectType>{}()};
+
+    Timer  T;
+    double StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        pObj->AddRef();
+        pObj->Release();
+    }
+    const double AddRefReleaseTime = T.GetElapsedTime() - StartTime;
+
+    StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        RefCntAutoPtr<ObjectType> pCopy{pObj};
+    }
+    const double CopyTime = T.GetElapsedTime() - StartTime;
+
+    RefCntWeakPtr<ObjectType> wpObj{pObj};
+    StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        RefCntAutoPtr<ObjectType> pLocked = wpObj.Lock();
+    }
+    const double LockTime = T.GetElapsedTime() - StartTime;
+
+    LOG_INFO_MESSAGE(Name, ":\n    AddRef/Release:      ", AddRefReleaseTime * 1e9 / NumIterations, " ns/pair",
+                     "\n    RefCntAutoPtr copy:  ", CopyTime * 1e9 / NumIterations, " ns/copy",
+                     "\n    RefCntWeakPtr lock:  ", LockTime * 1e9 / NumIterations, " ns/lock");
+}
+
+// Default multi-threaded counters, which all engine objects use
+TEST(RefCountingBenchmark, MultiThreaded)
+{
+    RunRefCountingBenchmark<BenchmarkObject<RefCountersThreading::MultiThreaded>>("Multi-threaded ref counters");
+}
+
+TEST(RefCountingBenchmark, ThreadConfined)
+{
+    RunRefCountingBenchmark<BenchmarkObject<RefCountersThreading::ThreadConfined>>("Thread-confined ref counters");
+}
+
+// Default counters updated from several threads at once
+TEST(RefCountingBenchmark, MultiThreadedContended)
+{
+    using ObjectType = BenchmarkObject<RefCountersThreading::MultiThreaded>;
+
+    constexpr Uint32 NumIterations = 1u << 20;
+
+    const Uint32 NumThreads = std::max(std::thread::hardware_concurrency(), 2u);
+
+    RefCntAutoPtr<ObjectType> pObj{MakeNewRCObj<ObjectType>{}()};
+
+    Timer T;
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&pObj]() {
+            for (Uint32 i = 0; i < NumIterations; ++i)
+            {
+                RefCntAutoPtr<ObjectType> pCopy{pObj};
+            }
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    const double Time = T.GetElapsedTime();
+
+    LOG_INFO_MESSAGE("Multi-threaded ref counters, ", NumThreads, " threads: ", Time * 1e9 / NumIterations, " ns/copy");
+}
+
+} // namespace
@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct BenchmarkAttribs
+{
+    Uint32 Data[4];
+};
+
+} // namespace
+
+namespace Diligent
+{
+DECL_TRIVIALLY_SERIALIZABLE(BenchmarkAttribs);
+} // namespace Diligent
+
+namespace
+{
+
+// Compares unpacking arrays of resource attributes, which dominate pipeline
+// resource signature data, element by element versus in place.
+TEST(SerializerBenchmark, ArrayUnpack)
+{
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr Uint32              NumAttribs    = 64;
+    constexpr Uint32              NumArrays     = 32;
+    constexpr Uint32              NumIterations = 1000;
+    std::vector<BenchmarkAttribs> RefAttribs(NumAttribs);
+
+    const auto SerializeElementwise = [](auto& Ser, auto*& pAttribs, Uint32& Count, DynamicLinearAllocator* pAllocator) {
+        return Ser.SerializeArray(pAllocator, pAttribs, Count,
+                                  [](auto& Ser, auto& Attribs) {
+                                      return Ser(Attribs);
+                                  });
+    };
+
+    const auto WriteData = [&](auto& Ser, bool Elementwise) {
+        for (Uint32 i = 0; i < NumArrays; ++i)
+        {
+            const BenchmarkAttribs* pAttribs = RefAttribs.data();
+            Uint32                  Count    = NumAttribs;
+            ASSERT_TRUE(Elementwise ?
+                            SerializeElementwise(Ser, pAttribs, Count, nullptr) :
+                            Ser.SerializeArrayRaw(nullptr, pAttribs, Count));
+        }
+    };
+
+    double Times[2] = {};
+    for (int Elementwise = 0; Elementwise < 2; ++Elementwise)
+    {
+        Serializer<SerializerMode::Measure> MSer;
+        WriteData(MSer, Elementwise != 0);
+        auto Data = MSer.AllocateData(RawAllocator);
+        {
+            Serializer<SerializerMode::Write> WSer{Data};
+            WriteData(WSer, Elementwise != 0);
+        }
+
+        DynamicLinearAllocator Allocator{RawAllocator};
+
+        Timer T;
+        for (Uint32 iter = 0; iter < NumIterations; ++iter)
+        {
+            Serializer<SerializerMode::Read> RSer{Data};
+            for (Uint32 i = 0; i < NumArrays; ++i)
+            {
+                const BenchmarkAttribs* pAttribs = nullptr;
+                Uint32                  Count    = 0;
+                if (Elementwise)
+                    SerializeElementwise(RSer, pAttribs, Count, &Allocator);
+                else
+                    RSer.SerializeArrayRaw(&Allocator, pAttribs, Count);
+            }
+            Allocator.Discard();
+        }
+        Times[Elementwise] = T.GetElapsedTime();
+    }
+
+    LOG_INFO_MESSAGE("Unpacking ", NumArrays, " arrays of ", NumAttribs, " elements: ",
+                     Times[1] * 1e6 / NumIterations, " us element-wise, ",
+                     Times[0] * 1e6 / NumIterations, " us in place");
+}
+
+} // namespace
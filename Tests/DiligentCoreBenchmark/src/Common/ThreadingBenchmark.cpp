@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ThreadSignal.hpp"
+#include "SpinLock.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Measures the round-trip latency of handing work over between two threads,
+// which is the pattern used by TextureUploader and AsyncInitializer.
+TEST(ThreadingBenchmark, SignalPingPong)
+{
+    constexpr int NumRoundTrips = 20000;
+
+    Threading::Signal Ping;
+    Threading::Signal Pong;
+
+    std::thread Worker{[&]() {
+        for (int i = 0; i < NumRoundTrips; ++i)
+        {
+            const int Value = Ping.Wait(true, 1);
+            Pong.Trigger(false, Value);
+        }
+    }};
+
+    Timer T;
+    for (int i = 0; i < NumRoundTrips; ++i)
+    {
+        Ping.Trigger(false, i + 1);
+        Pong.Wait(true, 1);
+    }
+    const double Time = T.GetElapsedTime();
+    Worker.join();
+
+    LOG_INFO_MESSAGE("Threading::Signal ping-pong round-trip latency: ", Time * 1e6 / NumRoundTrips, " us");
+}
+
+template <typename LockType>
+void RunLockContentionBenchmark(const char* LockName)
+{
+    const Uint32 NumCores   = std::max(std::thread::hardware_concurrency(), 1u);
+    const Uint32 NumThreads = NumCores * 8;
+
+    static constexpr size_t NumThreadIterations = 32768;
+
+    LockType Lock;
+    size_t   Counter = 0;
+
+    std::vector<std::thread> Workers;
+    Workers.reserve(NumThreads);
+
+    Timer T;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Workers.emplace_back([&Lock, &Counter]() {
+            for (size_t i = 0; i < NumThreadIterations; ++i)
+            {
+                std::lock_guard<LockType> Guard{Lock};
+                ++Counter;
+            }
+        });
+    }
+    for (auto& Thread : Workers)
+        Thread.join();
+    const double Time = T.GetElapsedTime();
+
+    LOG_INFO_MESSAGE(LockName, ", ", NumThreads, " threads / ", NumCores, " cores: ",
+                     Time * 1e9 / (NumThreadIterations * NumThreads), " ns per lock/unlock under contention");
+}
+
+TEST(ThreadingBenchmark, SpinLockContention)
+{
+    RunLockContentionBenchmark<Threading::SpinLock>("SpinLock");
+}
+
+TEST(ThreadingBenchmark, AdaptiveLockContention)
+{
+    RunLockContentionBenchmark<Threading::AdaptiveLock>("AdaptiveLock");
+}
+
+} // namespace
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GLSLangUtils.hpp"
+#include "DebugUtilities.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Every generated shader has a different number of functions with different constants
+// and loop counts, so that each compilation does distinct work.
+std::string GenerateShaderSource(Uint32 Idx)
+{
+    const Uint32 NumFunctions = 32 + Idx * 4;
+
+    std::string Source = "cbuffer cbConstants\n{\n    float4 g_Data[16];\n};\n\n"
+                         "Texture2D    g_Texture;\n"
+                         "SamplerState g_Texture_sampler;\n\n";
+    for (Uint32 f = 0; f < NumFunctions; ++f)
+    {
+        Source += "float4 Func" + std::to_string(f) + "(float4 Color, float2 UV)\n{\n";
+        Source += "    for (int i = 0; i < " + std::to_string((f + Idx) % 8 + 1) + "; ++i)\n";
+        Source += "        Color = Color * " + std::to_string(Idx + f + 1) + ".0 + g_Texture.Sample(g_Texture_sampler, UV + g_Data[" + std::to_string((f * 7 + Idx) % 16) + "].xy * float(i));\n";
+        Source += "    return Color;\n}\n\n";
+    }
+    Source += "float4 main(in float4 Pos : SV_Position) : SV_Target\n{\n"
+              "    float4 Color = float4(0.0, 0.0, 0.0, 0.0);\n";
+    for (Uint32 f = 0; f < NumFunctions; ++f)
+        Source += "    Color = Func" + std::to_string(f) + "(Color, Pos.xy);\n";
+    Source += "    return Color;\n}\n";
+
+    return Source;
+}
+
+// Compiles a set of distinct HLSL shaders using 1..N threads and reports the scaling.
+TEST(GLSLangCompilationBenchmark, ParallelCompilation)
+{
+    constexpr Uint32 NumShaders = 64;
+
+    std::vector<std::string> Sources(NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+        Sources[i] = GenerateShaderSource(i);
+
+    auto CompileShader = [&Sources](size_t Idx) {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Desc           = {"GLSLang compilation benchmark", SHADER_TYPE_PIXEL};
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = Sources[Idx].c_str();
+        ShaderCI.SourceLength   = Sources[Idx].length();
+        return GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    };
+
+    GLSLangUtils::InitializeGlslang();
+
+    const size_t MaxThreads = std::max(std::min(size_t{std::thread::hardware_concurrency()}, size_t{8}), size_t{2});
+
+    double SingleThreadTime = 0;
+    for (size_t NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        std::vector<std::vector<uint32_t>> SPIRV(NumShaders);
+        std::atomic<size_t>                NextShader{0};
+
+        Timer T;
+
+        std::vector<std::thread> Threads;
+        for (size_t t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&]() {
+                for (size_t Idx = NextShader.fetch_add(1); Idx < SPIRV.size(); Idx = NextShader.fetch_add(1))
+                    SPIRV[Idx] = CompileShader(Idx);
+            });
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+
+        const double Time = T.GetElapsedTime();
+        if (NumThreads == 1)
+            SingleThreadTime = Time;
+
+        for (size_t i = 0; i < SPIRV.size(); ++i)
+            EXPECT_FALSE(SPIRV[i].empty()) << "Shader " << i;
+
+        LOG_INFO_MESSAGE("Compiled ", NumShaders, " shaders using ", NumThreads, (NumThreads == 1 ? " thread" : " threads"), " in ",
+                         Time * 1000, " ms. Speedup: ", SingleThreadTime / std::max(Time, 1e-6), "x");
+    }
+
+    GLSLangUtils::FinalizeGlslang();
+}
+
+} // namespace
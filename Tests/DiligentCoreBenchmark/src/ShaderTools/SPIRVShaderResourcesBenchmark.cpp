@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "EngineMemory.h"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<uint32_t> CompileToSPIRV(const char* FilePath, SHADER_TYPE ShaderType)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    if (!pShaderSourceStreamFactory)
+        return {};
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.FilePath                   = FilePath;
+    ShaderCI.Desc                       = {"SPIRV resources benchmark", ShaderType};
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+
+    GLSLangUtils::InitializeGlslang();
+    std::vector<uint32_t> SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    GLSLangUtils::FinalizeGlslang();
+
+    return SPIRV;
+}
+
+// Compares loading resources by reflecting SPIRV with SPIRV-Cross and SPIRVReflection,
+// and from the data serialized with the byte code
+void RunSPIRVResourcesBenchmark(const char* FilePath, SHADER_TYPE ShaderType)
+{
+    const std::vector<uint32_t> SPIRV = CompileToSPIRV(FilePath, ShaderType);
+    ASSERT_FALSE(SPIRV.empty());
+
+    const ShaderDesc Desc{"SPIRV resources benchmark", ShaderType};
+
+    const auto CreateResources = [&](bool ForceSPIRVCross, std::string& EntryPoint) {
+        return std::make_unique<SPIRVShaderResources>(
+            GetRawAllocator(),
+            SPIRV,
+            Desc,
+            "_sampler", // CombinedSamplerSuffix
+            ShaderType == SHADER_TYPE_VERTEX,
+            false, // LoadUniformBufferReflection
+            EntryPoint,
+            ForceSPIRVCross);
+    };
+
+    std::string           EntryPoint;
+    std::vector<uint32_t> Bytecode = SPIRV;
+    CreateResources(false, EntryPoint)->AppendToBytecode(Bytecode, EntryPoint);
+
+    size_t      SPIRVSize        = 0;
+    const void* pResourceData    = nullptr;
+    size_t      ResourceDataSize = 0;
+    ASSERT_TRUE(SPIRVShaderResources::SplitBytecode(Bytecode.data(), Bytecode.size() * sizeof(Bytecode[0]), SPIRVSize, pResourceData, ResourceDataSize));
+
+    constexpr int NumIterations = 100;
+
+    double ReflectionTimes[2] = {};
+    for (bool ForceSPIRVCross : {true, false})
+    {
+        Timer T;
+        for (int i = 0; i < NumIterations; ++i)
+        {
+            std::string EntryPointName;
+            CreateResources(ForceSPIRVCross, EntryPointName);
+        }
+        ReflectionTimes[ForceSPIRVCross ? 0 : 1] = T.GetElapsedTime();
+    }
+
+    Timer T;
+    for (int i = 0; i < NumIterations; ++i)
+    {
+        std::string          EntryPointName;
+        SPIRVShaderResources Resources{GetRawAllocator(), pResourceData, ResourceDataSize, SPIRV.size(), Desc, "_sampler", EntryPointName};
+    }
+    const double SerializedTime = T.GetElapsedTime();
+
+    LOG_INFO_MESSAGE(FilePath, " SPIRV-Cross: ", ReflectionTimes[0] * 1e6 / NumIterations, " us, SPIRVReflection: ", ReflectionTimes[1] * 1e6 / NumIterations,
+                     " us, serialized (", ResourceDataSize, " bytes): ", SerializedTime * 1e6 / NumIterations, " us");
+}
+
+TEST(SPIRVShaderResourcesBenchmark, HLSLResources)
+{
+    RunSPIRVResourcesBenchmark("Resources.psh", SHADER_TYPE_PIXEL);
+}
+
+TEST(SPIRVShaderResourcesBenchmark, HLSLVertexInputs)
+{
+    RunSPIRVResourcesBenchmark("VertexInputs.vsh", SHADER_TYPE_VERTEX);
+}
+
+} // namespace
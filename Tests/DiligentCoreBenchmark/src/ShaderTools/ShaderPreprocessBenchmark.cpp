@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <string>
+
+#include "ShaderToolsCommon.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ParsingTools.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(ShaderPreprocessBenchmark, UnrollIncludes)
+{
+    // Each file includes up to four children and its sibling, so that
+    // most files are referenced more than once and must only be pasted once.
+    constexpr size_t NumFiles    = 256;
+    constexpr size_t NumBodyRows = 512;
+
+    std::vector<std::string> Names(NumFiles);
+    for (size_t i = 0; i < NumFiles; ++i)
+        Names[i] = "File" + std::to_string(i) + ".fxh";
+
+    std::vector<std::string> Sources(NumFiles);
+    for (size_t i = 0; i < NumFiles; ++i)
+    {
+        std::string& Source = Sources[i];
+        Source += "/* " + Names[i] + "\n * #include \"NotAFile.fxh\"\n */\n";
+        for (size_t Child : {i * 4 + 1, i * 4 + 2, i * 4 + 3, i * 4 + 4, i + 1})
+        {
+            if (Child < NumFiles)
+                Source += "#include \"" + Names[Child] + "\"\n";
+        }
+        Source += "#define FILE" + std::to_string(i) + "_INCLUDED 1\n";
+        for (size_t Row = 0; Row < NumBodyRows; ++Row)
+        {
+            Source += "float4 Func" + std::to_string(Row) + "(float4 a, float4 b) // Divide a by b\n";
+            Source += "{\n";
+            Source += "    return a / b; /* Single-line block comment */\n";
+            Source += "}\n";
+        }
+    }
+
+    std::vector<MemoryShaderSourceFileInfo> Files(NumFiles);
+    size_t                                  TotalSize = 0;
+    for (size_t i = 0; i < NumFiles; ++i)
+    {
+        Files[i] = {Names[i].c_str(), Sources[i]};
+        TotalSize += Sources[i].length();
+    }
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory =
+        CreateMemoryShaderSourceFactory(MemoryShaderSourceFactoryCreateInfo{Files.data(), static_cast<Uint32>(Files.size())});
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.Name                  = "UnrollIncludesBenchmark";
+    ShaderCI.FilePath                   = Names[0].c_str();
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    constexpr Uint32 NumIterations = 10;
+
+    std::string Unrolled;
+    Timer       T;
+    for (Uint32 i = 0; i < NumIterations; ++i)
+        Unrolled = UnrollShaderIncludes(ShaderCI);
+    const double UnrollTime = T.GetElapsedTime() / NumIterations;
+
+    // Compare the vectorized scanner with the character-by-character loop
+    // that FindIncludes used before
+    const char* const pStart = Unrolled.c_str();
+    const char* const pEnd   = pStart + Unrolled.length();
+
+    size_t NumHashes = 0;
+    T.Restart();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        NumHashes = 0;
+        for (const char* Pos = pStart; (Pos = Parsing::FindNextHash(Pos, pEnd)) != pEnd; ++Pos)
+            ++NumHashes;
+    }
+    const double ScanTime = T.GetElapsedTime() / NumIterations;
+
+    size_t RefNumHashes = 0;
+    T.Restart();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        RefNumHashes = 0;
+        for (const char* Pos = pStart; (Pos = Parsing::SkipDelimitersAndComments(Pos, pEnd)) != pEnd; ++Pos)
+        {
+            if (*Pos == '#')
+                ++RefNumHashes;
+        }
+    }
+    const double RefScanTime = T.GetElapsedTime() / NumIterations;
+    EXPECT_EQ(NumHashes, RefNumHashes);
+
+    const double MB = 1.0 / (1024.0 * 1024.0);
+    LOG_INFO_MESSAGE("Unrolled ", NumFiles, " files (", TotalSize * MB, " MB) in ", UnrollTime * 1000, " ms (", TotalSize * MB / UnrollTime, " MB/s).\n",
+                     "Scanned ", Unrolled.length() * MB, " MB in ", ScanTime * 1000, " ms (", Unrolled.length() * MB / ScanTime, " MB/s), "
+                     "per-character scan: ", RefScanTime * 1000, " ms (", Unrolled.length() * MB / RefScanTime, " MB/s)");
+}
+
+} // namespace
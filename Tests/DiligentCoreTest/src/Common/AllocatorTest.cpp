@@ -26,11 +26,14 @@
  */
 
 #include <array>
+#include <thread>
+#include <vector>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "TrackingMemoryAllocator.hpp"
 
 #include "gtest/gtest.h"
 
@@ -289,4 +292,83 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_TrackingMemoryAllocator, Counters)
+{
+    MemoryAllocationCounters Counters;
+    TrackingMemoryAllocator  Allocator{DefaultRawMemoryAllocator::GetAllocator(), Counters};
+
+    void* pMem0 = Allocator.Allocate(100, "Tracking allocator test", __FILE__, __LINE__);
+    ASSERT_NE(pMem0, nullptr);
+    EXPECT_EQ(Counters.LiveBytes, 100);
+    EXPECT_EQ(Counters.PeakBytes, 100);
+    EXPECT_EQ(Counters.LiveAllocations, 1);
+
+    void* pMem1 = Allocator.AllocateAligned(256, 64, "Tracking allocator test", __FILE__, __LINE__);
+    ASSERT_NE(pMem1, nullptr);
+    EXPECT_EQ(reinterpret_cast<size_t>(pMem1) % 64, size_t{0});
+    EXPECT_EQ(Counters.LiveBytes, 356);
+    EXPECT_EQ(Counters.PeakBytes, 356);
+    EXPECT_EQ(Counters.LiveAllocations, 2);
+
+    Allocator.Free(pMem0);
+    EXPECT_EQ(Counters.LiveBytes, 256);
+    EXPECT_EQ(Counters.PeakBytes, 356);
+    EXPECT_EQ(Counters.LiveAllocations, 1);
+
+    Allocator.FreeAligned(pMem1);
+    EXPECT_EQ(Counters.LiveBytes, 0);
+    EXPECT_EQ(Counters.PeakBytes, 356);
+    EXPECT_EQ(Counters.LiveAllocations, 0);
+    EXPECT_EQ(Counters.TotalAllocations, Uint64{2});
+    EXPECT_EQ(Counters.TotalBytes, Uint64{356});
+
+    Counters.ResetCumulative();
+    EXPECT_EQ(Counters.PeakBytes, 0);
+    EXPECT_EQ(Counters.TotalAllocations, Uint64{0});
+
+    // Tracking allocator should work as the parent of other allocators
+    {
+        FixedBlockMemoryAllocator FixedAllocator{Allocator, 32, 16};
+        void*                     pBlock = FixedAllocator.Allocate(32, "Tracking allocator test", __FILE__, __LINE__);
+        EXPECT_GT(Counters.LiveBytes, 32 * 16);
+        FixedAllocator.Free(pBlock);
+    }
+    EXPECT_EQ(Counters.LiveBytes, 0);
+    EXPECT_EQ(Counters.LiveAllocations, 0);
+}
+
+TEST(Common_TrackingMemoryAllocator, Multithreading)
+{
+    MemoryAllocationCounters Counters;
+    TrackingMemoryAllocator  Allocator{DefaultRawMemoryAllocator::GetAllocator(), Counters};
+
+    constexpr size_t NumThreads       = 4;
+    constexpr size_t NumIterations    = 1000;
+    constexpr size_t NumAllocsPerIter = 8;
+    constexpr size_t AllocationSize   = 48;
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&]() {
+            for (size_t i = 0; i < NumIterations; ++i)
+            {
+                void* Ptrs[NumAllocsPerIter] = {};
+                for (auto& Ptr : Ptrs)
+                    Ptr = Allocator.Allocate(AllocationSize, "Tracking allocator test", __FILE__, __LINE__);
+                for (auto& Ptr : Ptrs)
+                    Allocator.Free(Ptr);
+            }
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(Counters.LiveBytes, 0);
+    EXPECT_EQ(Counters.LiveAllocations, 0);
+    EXPECT_LE(Counters.PeakBytes, static_cast<Int64>(NumThreads * NumAllocsPerIter * AllocationSize));
+    EXPECT_GE(Counters.PeakBytes, static_cast<Int64>(NumAllocsPerIter * AllocationSize));
+    EXPECT_EQ(Counters.TotalAllocations, Uint64{NumThreads * NumIterations * NumAllocsPerIter});
+}
+
 } // namespace
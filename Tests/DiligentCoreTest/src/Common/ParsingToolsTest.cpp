@@ -294,6 +294,118 @@ TEST(Common_ParsingTools, SkipDelimitersAndComments)
                " \t\n", SKIP_COMMENT_FLAG_ALL, "\r /* Correct */");
 }
 
+TEST(Common_ParsingTools, FindFirstOf)
+{
+    auto Test = [](const std::string& Str, size_t RefPos, auto... Chars) {
+        // Test all offsets to cover both the vectorized and the scalar paths
+        for (size_t Offset = 0; Offset <= std::min(RefPos, Str.length()); ++Offset)
+        {
+            const char* Start = Str.c_str() + Offset;
+            const char* End   = Str.c_str() + Str.length();
+            const char* Pos   = FindFirstOf(Start, End, Chars...);
+            EXPECT_EQ(static_cast<size_t>(Pos - Str.c_str()), RefPos) << "Offset: " << Offset;
+        }
+    };
+
+    Test("", 0, '#');
+    Test("abc", 3, '#');
+    Test("#abc", 0, '#');
+    Test("abc#", 3, '#');
+    Test("abc#/", 3, '#', '/');
+    Test("abc/#", 3, '#', '/');
+
+    const std::string Long(100, 'x');
+    Test(Long, 100, '#', '/');
+    for (size_t i = 0; i < Long.length(); ++i)
+    {
+        std::string Str{Long};
+        Str[i] = '/';
+        if (i + 1 < Str.length())
+            Str[i + 1] = '#';
+        Test(Str, i, '#', '/');
+    }
+
+    {
+        std::string Str{Long};
+        Str[40] = '\0';
+        Test(Str, 100, '#');
+        Test(Str, 40, '#', '\0');
+    }
+}
+
+TEST(Common_ParsingTools, FindLineEnd)
+{
+    auto Test = [](const std::string& Str) {
+        const char* Start = Str.c_str();
+        const char* End   = Start + Str.length();
+        EXPECT_EQ(FindLineEnd(Start, End), SkipLine(Start, End));
+    };
+
+    Test("");
+    Test("abc def ");
+    Test("abc def \n");
+    Test("abc def \r\n");
+    Test(std::string(50, ' ') + "\r" + std::string(50, ' '));
+    Test(std::string(50, ' ') + '\0' + "\n");
+    Test(std::string(100, ' '));
+}
+
+TEST(Common_ParsingTools, FindCommentStart)
+{
+    auto Test = [](const char* Str, const char* Expected) {
+        const char* End = Str + strlen(Str);
+        EXPECT_STREQ(FindCommentStart(Str, End), Expected);
+    };
+
+    Test("", "");
+    Test("a / b", "");
+    Test("a / b /", "");
+    Test("a / b // Comment", "// Comment");
+    Test("a / b /* Comment */", "/* Comment */");
+    Test("a / b / c / d / e / f / g / h / i // Comment", "// Comment");
+}
+
+TEST(Common_ParsingTools, FindNextHash)
+{
+    auto Test = [](const char* Str, const char* Expected) {
+        const char* End = Str + strlen(Str);
+        EXPECT_STREQ(FindNextHash(Str, End), Expected);
+    };
+
+    Test("", "");
+    Test("abc", "");
+    Test("#define A", "#define A");
+    Test("float a = b / c; #define A", "#define A");
+    Test("// #define A\n#define B", "#define B");
+    Test("/* #define A */#define B", "#define B");
+    Test("/* #define A\n #define B **/ #define C", "#define C");
+    Test("/*/ #define A */#define B", "#define B");
+    Test("//\n/**/ # /* Comment */ include", "# /* Comment */ include");
+    Test("// Long single-line comment with #define A and /* */\r\n"
+         "/* Long multi-line comment with #define B and // ***\n"
+         "   more text **** / */ Some code\n"
+         "#include \"File.h\"",
+         "#include \"File.h\"");
+
+    auto TestError = [](const char* Str, size_t ErrorPos) {
+        const char* End = Str + strlen(Str);
+        try
+        {
+            FindNextHash(Str, End);
+            ADD_FAILURE() << "Exception is expected";
+        }
+        catch (const std::pair<const char*, const char*>& Err)
+        {
+            EXPECT_EQ(static_cast<size_t>(Err.first - Str), ErrorPos);
+        }
+    };
+
+    TestError("/*", 0);
+    TestError("abc /* #define A", 4);
+    TestError("abc /* #define A *", 4);
+    TestError("abc // \n /* #define A * /", 9);
+}
+
 TEST(Common_ParsingTools, SkipIdentifier)
 {
     auto Test = [](const char* Str, const char* Expected, bool EndReached = false) {
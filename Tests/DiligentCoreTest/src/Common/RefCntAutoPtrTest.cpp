@@ -49,12 +49,15 @@ Type* MakeNewObj()
 namespace
 {
 
-class Object : public Diligent::RefCountedObject<Diligent::IObject>
+template <RefCountersThreading ThreadingMode>
+class ObjectT : public Diligent::RefCountedObject<Diligent::IObject, ThreadingMode>
 {
 public:
-    static void DILIGENT_CALL_TYPE Create(Object** ppObj)
+    using TBase = Diligent::RefCountedObject<Diligent::IObject, ThreadingMode>;
+
+    static void DILIGENT_CALL_TYPE Create(ObjectT** ppObj)
     {
-        *ppObj = MakeNewObj<Object>();
+        *ppObj = MakeNewObj<ObjectT>();
         (*ppObj)->AddRef();
     }
 
@@ -68,16 +71,19 @@ public:
         }
     }
 
-    Object(Diligent::IReferenceCounters* pRefCounters) :
-        RefCountedObject<Diligent::IObject>{pRefCounters},
+    ObjectT(Diligent::IReferenceCounters* pRefCounters) :
+        TBase{pRefCounters},
         m_Value(0)
     {
     }
 
-    ~Object() {}
+    ~ObjectT() {}
     std::atomic_int m_Value;
 };
 
+using Object               = ObjectT<RefCountersThreading::MultiThreaded>;
+using ThreadConfinedObject = ObjectT<RefCountersThreading::ThreadConfined>;
+
 
 class DerivedObject : public Object
 {
@@ -631,6 +637,43 @@ TEST(Common_RefCntAutoPtr, Misc)
     }
 }
 
+TEST(Common_RefCntAutoPtr, ThreadConfined)
+{
+    static_assert(std::is_same<Object::RefCountersType, RefCountersImpl<RefCountersThreading::MultiThreaded>>::value, "Objects must use multi-threaded ref counters by default");
+    static_assert(ThreadConfinedObject::RefCountersType::GetThreading() == RefCountersThreading::ThreadConfined, "ThreadConfinedObject must use thread-confined ref counters");
+
+    RefCntAutoPtr<ThreadConfinedObject> pObj{MakeNewObj<ThreadConfinedObject>()};
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    {
+        RefCntAutoPtr<ThreadConfinedObject> pObj2{pObj};
+        EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 2);
+    }
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    RefCntWeakPtr<ThreadConfinedObject> wpObj{pObj};
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumWeakRefs(), 1);
+    {
+        auto pLocked = wpObj.Lock();
+        EXPECT_EQ(pLocked, pObj);
+        EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 2);
+    }
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    // Weak pointer to the interface does not know the counters type of the object
+    RefCntWeakPtr<IObject> wpIObj{pObj.RawPtr<IObject>()};
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumWeakRefs(), 2);
+    EXPECT_TRUE(wpIObj.IsValid());
+
+    // The object is destroyed when the last strong reference is released,
+    // and the counters are destroyed when the last weak reference is released.
+    pObj.Release();
+    EXPECT_FALSE(wpObj.IsValid());
+    EXPECT_FALSE(wpObj.Lock());
+    EXPECT_FALSE(wpIObj.IsValid());
+    EXPECT_FALSE(wpIObj.Lock());
+}
+
 class RefCntAutoPtrThreadingTest
 {
 public:
@@ -25,6 +25,7 @@
  */
 
 #include <cstring>
+#include <vector>
 
 #include "Serializer.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
@@ -172,4 +173,160 @@ TEST(SerializerTest, SerializerTest)
     }
 }
 
+struct SerializerTestAttribs
+{
+    Uint32 Data[4];
+};
+
+} // namespace
+
+namespace Diligent
+{
+DECL_TRIVIALLY_SERIALIZABLE(SerializerTestAttribs);
+} // namespace Diligent
+
+namespace
+{
+
+TEST(SerializerTest, ZeroCopyArrays)
+{
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr Uint32      RefCount = 5;
+    SerializerTestAttribs RefAttribs[RefCount];
+    for (Uint32 i = 0; i < RefCount; ++i)
+        RefAttribs[i] = {{i, i * 2, i * 3, i * 4}};
+
+    const auto WriteData = [&](auto& Ser) {
+        const Uint8 U8 = 19;
+        EXPECT_TRUE(Ser(U8));
+        EXPECT_TRUE(Ser.SerializeArrayRaw(nullptr, RefAttribs, RefCount));
+    };
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+
+    auto Data = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        WriteData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    const auto ReadData = [&](const SerializedData& Src, auto*& pAttribs, DynamicLinearAllocator* pAllocator) {
+        Serializer<SerializerMode::Read> RSer{Src};
+
+        Uint8 U8 = 0;
+        EXPECT_TRUE(RSer(U8));
+        EXPECT_EQ(U8, 19);
+
+        Uint32 Count = 0;
+        EXPECT_TRUE(RSer.SerializeArrayRaw(pAllocator, pAttribs, Count));
+        EXPECT_TRUE(RSer.IsEnded());
+        ASSERT_EQ(Count, RefCount);
+        EXPECT_EQ(std::memcmp(pAttribs, RefAttribs, sizeof(RefAttribs)), 0);
+    };
+
+    // Const elements reference the source data
+    {
+        const SerializerTestAttribs* pAttribs = nullptr;
+        ReadData(Data, pAttribs, nullptr);
+        EXPECT_GE(reinterpret_cast<const Uint8*>(pAttribs), Data.Ptr<const Uint8>());
+        EXPECT_LT(reinterpret_cast<const Uint8*>(pAttribs), Data.Ptr<const Uint8>() + Data.Size());
+    }
+
+    // Non-const elements are copied
+    {
+        DynamicLinearAllocator TmpAllocator{RawAllocator};
+        SerializerTestAttribs* pAttribs = nullptr;
+        ReadData(Data, pAttribs, &TmpAllocator);
+        EXPECT_TRUE(reinterpret_cast<const Uint8*>(pAttribs) < Data.Ptr<const Uint8>() ||
+                    reinterpret_cast<const Uint8*>(pAttribs) >= Data.Ptr<const Uint8>() + Data.Size());
+    }
+
+    // Misaligned source data is copied
+    {
+        std::vector<Uint8> Buffer(Data.Size() + 1);
+        std::memcpy(&Buffer[1], Data.Ptr(), Data.Size());
+        SerializedData MisalignedData{&Buffer[1], Data.Size()};
+
+        DynamicLinearAllocator       TmpAllocator{RawAllocator};
+        const SerializerTestAttribs* pAttribs = nullptr;
+        ReadData(MisalignedData, pAttribs, &TmpAllocator);
+        EXPECT_TRUE(reinterpret_cast<const Uint8*>(pAttribs) < &Buffer.front() ||
+                    reinterpret_cast<const Uint8*>(pAttribs) > &Buffer.back());
+    }
+}
+
+// Arrays of resource attributes, which dominate pipeline resource signature data,
+// must unpack identically whether they are serialized element by element or in place.
+TEST(SerializerTest, ArrayUnpackElementwiseVsRaw)
+{
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr Uint32                   NumAttribs = 64;
+    constexpr Uint32                   NumArrays  = 4;
+    std::vector<SerializerTestAttribs> RefAttribs(NumAttribs);
+    for (Uint32 i = 0; i < NumAttribs; ++i)
+        RefAttribs[i] = {{i, i + 1, i * 7, ~i}};
+
+    const auto SerializeElementwise = [](auto& Ser, auto*& pAttribs, Uint32& Count, DynamicLinearAllocator* pAllocator) {
+        return Ser.SerializeArray(pAllocator, pAttribs, Count,
+                                  [](auto& Ser, auto& Attribs) {
+                                      return Ser(Attribs);
+                                  });
+    };
+
+    const auto WriteData = [&](auto& Ser, bool Elementwise) {
+        for (Uint32 i = 0; i < NumArrays; ++i)
+        {
+            const SerializerTestAttribs* pAttribs = RefAttribs.data();
+            Uint32                       Count    = NumAttribs - i;
+            EXPECT_TRUE(Elementwise ?
+                            SerializeElementwise(Ser, pAttribs, Count, nullptr) :
+                            Ser.SerializeArrayRaw(nullptr, pAttribs, Count));
+        }
+    };
+
+    const auto PackData = [&](bool Elementwise) {
+        Serializer<SerializerMode::Measure> MSer;
+        WriteData(MSer, Elementwise);
+        auto Data = MSer.AllocateData(RawAllocator);
+
+        Serializer<SerializerMode::Write> WSer{Data};
+        WriteData(WSer, Elementwise);
+        EXPECT_TRUE(WSer.IsEnded());
+        return Data;
+    };
+
+    const auto ElementwiseData = PackData(true);
+    const auto RawData         = PackData(false);
+
+    DynamicLinearAllocator Allocator{RawAllocator};
+    for (int Elementwise = 0; Elementwise < 2; ++Elementwise)
+    {
+        const SerializedData& Data = Elementwise ? ElementwiseData : RawData;
+
+        Serializer<SerializerMode::Read> RSer{Data};
+        for (Uint32 i = 0; i < NumArrays; ++i)
+        {
+            const SerializerTestAttribs* pAttribs = nullptr;
+            Uint32                       Count    = 0;
+            EXPECT_TRUE(Elementwise ?
+                            SerializeElementwise(RSer, pAttribs, Count, &Allocator) :
+                            RSer.SerializeArrayRaw(nullptr, pAttribs, Count));
+            ASSERT_EQ(Count, NumAttribs - i);
+            ASSERT_NE(pAttribs, nullptr);
+            EXPECT_EQ(std::memcmp(pAttribs, RefAttribs.data(), sizeof(SerializerTestAttribs) * Count), 0);
+            if (!Elementwise)
+            {
+                // In-place arrays reference the source data and require no allocations
+                EXPECT_GE(reinterpret_cast<const Uint8*>(pAttribs), Data.Ptr<const Uint8>());
+                EXPECT_LT(reinterpret_cast<const Uint8*>(pAttribs), Data.Ptr<const Uint8>() + Data.Size());
+            }
+        }
+        EXPECT_TRUE(RSer.IsEnded());
+    }
+}
+
 } // namespace
@@ -36,15 +36,16 @@ using namespace Diligent;
 namespace
 {
 
-TEST(Common_SpinLock, ThreadContention)
+template <typename LockType>
+void TestThreadContention(const char* LockName)
 {
     const auto NumCores   = std::thread::hardware_concurrency();
     const auto NumThreads = NumCores * 8;
-    LOG_INFO_MESSAGE("Running SpinLock test on ", NumThreads, " threads / ", NumCores, " cores");
+    LOG_INFO_MESSAGE("Running ", LockName, " test on ", NumThreads, " threads / ", NumCores, " cores");
     size_t Counter = 0;
 
     static constexpr size_t  NumThreadIterations = 32768;
-    Threading::SpinLock      Lock;
+    LockType                 Lock;
     std::vector<std::thread> Workers;
     Workers.reserve(NumThreads);
     for (size_t i = 0; i < NumThreads; ++i)
@@ -55,7 +56,7 @@ TEST(Common_SpinLock, ThreadContention)
                 {
                     for (size_t i = 0; i < NumThreadIterations; ++i)
                     {
-                        Threading::SpinLockGuard Guard{Lock};
+                        std::lock_guard<LockType> Guard{Lock};
                         ++Counter;
                     }
                 } //
@@ -66,9 +67,30 @@ TEST(Common_SpinLock, ThreadContention)
         Thread.join();
 
     {
-        Threading::SpinLockGuard Guard{Lock};
+        std::lock_guard<LockType> Guard{Lock};
         EXPECT_EQ(Counter, NumThreadIterations * NumThreads);
     }
 }
 
+TEST(Common_SpinLock, ThreadContention)
+{
+    TestThreadContention<Threading::SpinLock>("SpinLock");
+}
+
+TEST(Common_AdaptiveLock, ThreadContention)
+{
+    TestThreadContention<Threading::AdaptiveLock>("AdaptiveLock");
+}
+
+TEST(Common_AdaptiveLock, TryLock)
+{
+    Threading::AdaptiveLock Lock;
+    EXPECT_FALSE(Lock.is_locked());
+    EXPECT_TRUE(Lock.try_lock());
+    EXPECT_TRUE(Lock.is_locked());
+    EXPECT_FALSE(Lock.try_lock());
+    Lock.unlock();
+    EXPECT_FALSE(Lock.is_locked());
+}
+
 } // namespace
@@ -57,6 +57,7 @@ TEST(Common_ThreadPool, EnqueueTask)
 
     auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
+    EXPECT_EQ(pThreadPool->GetThreadCount(), NumThreads);
 
     std::array<std::atomic<float>, NumTasks>        Results{};
     std::array<std::atomic<bool>, NumTasks>         WorkComplete{};
@@ -96,6 +97,9 @@ TEST(Common_ThreadPool, EnqueueTask)
     // Check that multiple calls to WaitForAllTasks work fine
     pThreadPool->WaitForAllTasks();
 
+    pThreadPool->StopThreads();
+    EXPECT_EQ(pThreadPool->GetThreadCount(), 0u);
+
     pThreadPool.Release();
     EXPECT_EQ(NumThreadsFinished.load(), PoolCI.NumThreads);
 }
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadSignal.hpp"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_ThreadSignal, TriggerWait)
+{
+    Threading::Signal Signal;
+    EXPECT_FALSE(Signal.IsTriggered());
+
+    Signal.Trigger(false, 5);
+    EXPECT_TRUE(Signal.IsTriggered());
+    EXPECT_EQ(Signal.Wait(), 5);
+    EXPECT_TRUE(Signal.IsTriggered());
+
+    Signal.Reset();
+    EXPECT_FALSE(Signal.IsTriggered());
+
+    Signal.Trigger(false, 7);
+    EXPECT_EQ(Signal.Wait(true, 1), 7);
+    EXPECT_FALSE(Signal.IsTriggered());
+}
+
+TEST(Common_ThreadSignal, NotifyAll)
+{
+    const size_t NumThreads = std::max(std::thread::hardware_concurrency(), 4u);
+
+    Threading::Signal        Signal;
+    std::atomic<int>         SumOfValues{0};
+    std::vector<std::thread> Threads;
+    for (size_t i = 0; i < NumThreads; ++i)
+    {
+        Threads.emplace_back([&]() {
+            SumOfValues.fetch_add(Signal.Wait(true, static_cast<int>(NumThreads)));
+        });
+    }
+
+    Signal.Trigger(true, 3);
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(SumOfValues.load(), static_cast<int>(NumThreads) * 3);
+    EXPECT_FALSE(Signal.IsTriggered());
+}
+
+// Hands values over between two threads, which is the pattern used by TextureUploader and AsyncInitializer.
+TEST(Common_ThreadSignal, PingPong)
+{
+    constexpr int NumRoundTrips = 1000;
+
+    Threading::Signal Ping;
+    Threading::Signal Pong;
+
+    std::thread Worker{[&]() {
+        for (int i = 0; i < NumRoundTrips; ++i)
+        {
+            const int Value = Ping.Wait(true, 1);
+            Pong.Trigger(false, Value);
+        }
+    }};
+
+    for (int i = 0; i < NumRoundTrips; ++i)
+    {
+        Ping.Trigger(false, i + 1);
+        EXPECT_EQ(Pong.Wait(true, 1), i + 1);
+    }
+    Worker.join();
+
+    EXPECT_FALSE(Ping.IsTriggered());
+    EXPECT_FALSE(Pong.IsTriggered());
+}
+
+} // namespace
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "EngineMemory.h"
+#include "DynamicLinearAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(GraphicsEngine_EngineMemory, CategoryStatistics)
+{
+    for (Uint32 i = 0; i < MEMORY_CATEGORY_COUNT; ++i)
+    {
+        const MEMORY_CATEGORY Category = static_cast<MEMORY_CATEGORY>(i);
+
+        MemoryCategoryStatistics StartStats;
+        GetMemoryCategoryStatistics(Category, StartStats);
+
+        IMemoryAllocator& Allocator = GetRawAllocator(Category);
+
+        void* pMem = Allocator.Allocate(1024, "Engine memory test", __FILE__, __LINE__);
+        ASSERT_NE(pMem, nullptr);
+
+        MemoryCategoryStatistics Stats;
+        GetMemoryCategoryStatistics(Category, Stats);
+        EXPECT_EQ(Stats.LiveBytes, StartStats.LiveBytes + 1024);
+        EXPECT_EQ(Stats.LiveAllocations, StartStats.LiveAllocations + 1);
+        EXPECT_EQ(Stats.TotalAllocations, StartStats.TotalAllocations + 1);
+        EXPECT_GE(Stats.PeakBytes, Stats.LiveBytes);
+
+        Allocator.Free(pMem);
+        GetMemoryCategoryStatistics(Category, Stats);
+        EXPECT_EQ(Stats.LiveBytes, StartStats.LiveBytes);
+        EXPECT_EQ(Stats.LiveAllocations, StartStats.LiveAllocations);
+    }
+}
+
+TEST(GraphicsEngine_EngineMemory, LinearAllocator)
+{
+    MemoryCategoryStatistics StartStats;
+    GetMemoryCategoryStatistics(MEMORY_CATEGORY_SERIALIZATION, StartStats);
+
+    {
+        DynamicLinearAllocator Allocator{GetRawAllocator(MEMORY_CATEGORY_SERIALIZATION), 256};
+        void* pData0 = Allocator.Allocate(100, 16);
+        void* pData1 = Allocator.Allocate(1000, 16);
+        EXPECT_NE(pData0, nullptr);
+        EXPECT_NE(pData1, nullptr);
+
+        MemoryCategoryStatistics Stats;
+        GetMemoryCategoryStatistics(MEMORY_CATEGORY_SERIALIZATION, Stats);
+        EXPECT_GE(Stats.LiveBytes, StartStats.LiveBytes + 1100);
+        EXPECT_EQ(Stats.LiveAllocations, StartStats.LiveAllocations + 2);
+    }
+
+    MemoryCategoryStatistics Stats;
+    GetMemoryCategoryStatistics(MEMORY_CATEGORY_SERIALIZATION, Stats);
+    EXPECT_EQ(Stats.LiveBytes, StartStats.LiveBytes);
+    EXPECT_EQ(Stats.LiveAllocations, StartStats.LiveAllocations);
+}
+
+} // namespace
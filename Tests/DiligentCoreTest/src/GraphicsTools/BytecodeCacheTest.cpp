@@ -24,16 +24,48 @@
  *  of the possibility of such damages.
  */
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "BytecodeCache.h"
 #include "DataBlobImpl.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
+#include "FileSystem.hpp"
+#include "MappedFile.hpp"
+#include "TempDirectory.hpp"
 #include "gtest/gtest.h"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
 
+ShaderCreateInfo GetTestShaderCI(const char* Source)
+{
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "TestName";
+    ShaderCI.Source          = Source;
+    return ShaderCI;
+}
+
+void AddTestBytecode(IBytecodeCache* pCache, const char* Source, const std::string& Data)
+{
+    RefCntAutoPtr<IDataBlob> pBytecode = DataBlobImpl::Create(Data.length(), Data.c_str());
+    pCache->AddBytecode(GetTestShaderCI(Source), pBytecode);
+}
+
+std::string GetTestBytecode(IBytecodeCache* pCache, const char* Source)
+{
+    RefCntAutoPtr<IDataBlob> pBytecode;
+    pCache->GetBytecode(GetTestShaderCI(Source), &pBytecode);
+    if (!pBytecode)
+        return {};
+    return std::string{static_cast<const char*>(pBytecode->GetConstDataPtr()), pBytecode->GetSize()};
+}
+
 TEST(BytecodeCacheTest, Basic)
 {
     RefCntAutoPtr<IBytecodeCache> pCache;
@@ -186,4 +218,237 @@ TEST(BytecodeCacheTest, Include)
     }
 }
 
+TEST(BytecodeCacheTest, Eviction)
+{
+    BytecodeCacheCreateInfo CI;
+    CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+    CI.MaxSize    = 16;
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    AddTestBytecode(pCache, "Code0", "Bytecode");
+    AddTestBytecode(pCache, "Code1", "Bytecode");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "Bytecode");
+
+    // Code1 is the least recently used entry
+    AddTestBytecode(pCache, "Code2", "Bytecode");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "Bytecode");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code1"), "");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code2"), "Bytecode");
+
+    // The entry that exceeds the budget is not kept
+    AddTestBytecode(pCache, "Code3", "Bytecode that is too large");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code3"), "");
+}
+
+TEST(BytecodeCacheTest, FileStorage)
+{
+    TempDirectory TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "BytecodeCache.bin";
+
+    BytecodeCacheCreateInfo CI;
+    CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+    CI.FilePath   = FilePath.c_str();
+
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        AddTestBytecode(pCache, "Code0", "Bytecode0");
+        AddTestBytecode(pCache, "Code1", "Bytecode1");
+        AddTestBytecode(pCache, "Code2", "Bytecode2");
+        AddTestBytecode(pCache, "Code1", "Bytecode1 updated");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code1"), "Bytecode1 updated");
+    }
+    EXPECT_TRUE(FileSystem::FileExists(FilePath.c_str()));
+
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "Bytecode0");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code1"), "Bytecode1 updated");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code2"), "Bytecode2");
+
+        pCache->RemoveBytecode(GetTestShaderCI("Code0"));
+        AddTestBytecode(pCache, "Code3", "Bytecode3");
+
+        RefCntAutoPtr<IDataBlob> pData;
+        pCache->Store(&pData);
+        ASSERT_NE(pData, nullptr);
+
+        RefCntAutoPtr<IBytecodeCache> pMemCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pMemCache);
+        ASSERT_NE(pMemCache, nullptr);
+        EXPECT_TRUE(pMemCache->Load(pData));
+        EXPECT_EQ(GetTestBytecode(pMemCache, "Code0"), "");
+        EXPECT_EQ(GetTestBytecode(pMemCache, "Code3"), "Bytecode3");
+    }
+
+    {
+        // Reopen the cache with a budget that does not fit all entries.
+        // Code2 was written to the file before the other entries and is evicted.
+        CI.MaxSize = 30;
+
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code1"), "Bytecode1 updated");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code2"), "");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code3"), "Bytecode3");
+    }
+
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_EQ(GetTestBytecode(pCache, "Code1"), "Bytecode1 updated");
+        EXPECT_EQ(GetTestBytecode(pCache, "Code3"), "Bytecode3");
+
+        pCache->Clear();
+        EXPECT_EQ(GetTestBytecode(pCache, "Code3"), "");
+    }
+
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_EQ(GetTestBytecode(pCache, "Code3"), "");
+    }
+
+    {
+        // The cache created for another device type must not reuse the file
+        CI.DeviceType = RENDER_DEVICE_TYPE_GL;
+
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        AddTestBytecode(pCache, "Code0", "Bytecode0");
+    }
+
+    {
+        CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "");
+    }
+}
+
+TEST(BytecodeCacheTest, FileStorageReleasesBytecode)
+{
+    if (!MappedFile::IsSupported())
+        GTEST_SKIP() << "Memory-mapped files are not supported on this platform";
+
+    TempDirectory TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "BytecodeCache.bin";
+
+    BytecodeCacheCreateInfo CI;
+    CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+
+    const std::string        Data      = "Bytecode0";
+    RefCntAutoPtr<IDataBlob> pBytecode = DataBlobImpl::Create(Data.length(), Data.c_str());
+
+    {
+        // The in-memory cache keeps a reference to the byte code
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        pCache->AddBytecode(GetTestShaderCI("Code0"), pBytecode);
+        EXPECT_EQ(pBytecode->GetReferenceCounters()->GetNumStrongRefs(), 2);
+    }
+    EXPECT_EQ(pBytecode->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    CI.FilePath = FilePath.c_str();
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    // The disk-backed cache only keeps the location of the byte code in the file
+    pCache->AddBytecode(GetTestShaderCI("Code0"), pBytecode);
+    EXPECT_EQ(pBytecode->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    // Modifying the source blob must not affect the cached byte code
+    static_cast<char*>(pBytecode->GetDataPtr())[0] = 'X';
+    EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "Bytecode0");
+
+    // Entries written after the file was mapped again are also read from the file
+    AddTestBytecode(pCache, "Code1", "Bytecode1");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code1"), "Bytecode1");
+    EXPECT_EQ(GetTestBytecode(pCache, "Code0"), "Bytecode0");
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pCache->Store(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    RefCntAutoPtr<IBytecodeCache> pMemCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pMemCache);
+    ASSERT_NE(pMemCache, nullptr);
+    EXPECT_TRUE(pMemCache->Load(pData));
+    EXPECT_EQ(GetTestBytecode(pMemCache, "Code0"), "Bytecode0");
+    EXPECT_EQ(GetTestBytecode(pMemCache, "Code1"), "Bytecode1");
+}
+
+TEST(BytecodeCacheTest, Multithreading)
+{
+    TempDirectory TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "BytecodeCache.bin";
+
+    BytecodeCacheCreateInfo CI;
+    CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+    CI.FilePath   = FilePath.c_str();
+
+    constexpr size_t NumThreads       = 4;
+    constexpr size_t NumShadersPerThr = 64;
+
+    auto GetSource = [](size_t Thread, size_t Shader) {
+        return "Code" + std::to_string(Thread) + "_" + std::to_string(Shader);
+    };
+
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        std::vector<std::thread> Threads;
+        for (size_t t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                for (size_t i = 0; i < NumShadersPerThr; ++i)
+                {
+                    const std::string Source = GetSource(t, i);
+                    AddTestBytecode(pCache, Source.c_str(), "Bytecode" + Source);
+                    // Read shaders added by other threads
+                    const std::string OtherSource = GetSource((t + 1) % NumThreads, i);
+                    const std::string Bytecode    = GetTestBytecode(pCache, OtherSource.c_str());
+                    EXPECT_TRUE(Bytecode.empty() || Bytecode == "Bytecode" + OtherSource);
+                }
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        for (size_t i = 0; i < NumShadersPerThr; ++i)
+        {
+            const std::string Source = GetSource(t, i);
+            EXPECT_EQ(GetTestBytecode(pCache, Source.c_str()), "Bytecode" + Source);
+        }
+    }
+}
+
 } // namespace
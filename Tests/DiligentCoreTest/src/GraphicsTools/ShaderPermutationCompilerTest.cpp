@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderPermutationCompiler.hpp"
+
+#include <cstring>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ShaderPermutationCompilerTest, ExpandMacroMatrix)
+{
+    const std::vector<ShaderPermutationCompiler::MacroDimension> Matrix = {
+        {"A", {"0", "1"}},
+        {"B", {}},
+        {"C", {"x", "y", "z"}},
+    };
+
+    const std::vector<ShaderMacroHelper> Permutations = ShaderPermutationCompiler::ExpandMacroMatrix(Matrix);
+    ASSERT_EQ(Permutations.size(), size_t{6});
+
+    const char* Expected[][2] = {
+        {"0", "x"},
+        {"0", "y"},
+        {"0", "z"},
+        {"1", "x"},
+        {"1", "y"},
+        {"1", "z"},
+    };
+    for (size_t i = 0; i < Permutations.size(); ++i)
+    {
+        const ShaderMacroArray Macros = Permutations[i];
+        ASSERT_EQ(Macros.Count, 2u);
+        EXPECT_STREQ(Macros[0].Name, "A");
+        EXPECT_STREQ(Macros[0].Definition, Expected[i][0]);
+        EXPECT_STREQ(Macros[1].Name, "C");
+        EXPECT_STREQ(Macros[1].Definition, Expected[i][1]);
+    }
+
+    EXPECT_EQ(ShaderPermutationCompiler::ExpandMacroMatrix({}).size(), size_t{1});
+}
+
+TEST(ShaderPermutationCompilerTest, FindReferencedMacros)
+{
+    static constexpr char Source[] = R"(
+// USE_COMMENT is only mentioned in a comment
+/* USE_BLOCK_COMMENT
+*/
+#if USE_FEATURE
+float4 Color = float4(1.0f, 2.0f, 3.0f, SCALE);
+#endif
+float USE_FEATURE2x = 1.0e5f;
+uint Mask = 0x10u;
+const char* Str = "USE_STRING";
+)";
+
+    ShaderMacroHelper Macros;
+    Macros
+        .Add("USE_COMMENT", 1)
+        .Add("USE_BLOCK_COMMENT", 1)
+        .Add("USE_FEATURE", 1)
+        .Add("SCALE", 1)
+        .Add("USE_FEATURE2", 1)
+        .Add("f", 1)
+        .Add("e5f", 1)
+        .Add("x10u", 1)
+        .Add("USE_STRING", 1);
+
+    const std::vector<std::string> Referenced = ShaderPermutationCompiler::FindReferencedMacros(Source, strlen(Source), Macros);
+    EXPECT_EQ(Referenced, (std::vector<std::string>{"USE_FEATURE", "SCALE"}));
+}
+
+TEST(ShaderPermutationCompilerTest, UnterminatedComment)
+{
+    static constexpr char Source[] = "float A; /* USE_FEATURE";
+
+    ShaderMacroHelper Macros;
+    Macros.Add("USE_FEATURE", 1).Add("OTHER", 1);
+
+    // All macros are conservatively reported as referenced
+    TestingEnvironment::ErrorScope ExpectedErrors{"Unable to tokenize string", "Unable to find the end of the multiline comment"};
+
+    const std::vector<std::string> Referenced = ShaderPermutationCompiler::FindReferencedMacros(Source, strlen(Source), Macros);
+    EXPECT_EQ(Referenced, (std::vector<std::string>{"USE_FEATURE", "OTHER"}));
+}
+
+TEST(ShaderPermutationCompilerTest, FindReferencedMacrosTransitive)
+{
+    static constexpr char Source[] = R"(
+#if USE_A
+float Value = SCALE;
+#endif
+)";
+
+    ShaderMacroHelper Macros;
+    Macros
+        .Add("USE_A", "USE_B && !USE_C")
+        .Add("USE_B", "(USE_D)")
+        .Add("SCALE", "2")
+        // Every definition of the macro is followed
+        .Add(ShaderMacro{"SCALE", "SCALE_FACTOR * 2.0"})
+        .Add("USE_C", 0)
+        .Add("USE_D", 1)
+        .Add("SCALE_FACTOR", "1e5")
+        // Macros that are only referenced by unreferenced macros do not affect the source
+        .Add("UNUSED", "USE_E")
+        .Add("USE_E", 1)
+        // Macros in comments and string constants of the definitions are ignored
+        .Add("USE_COMMENT", 1)
+        .Add("USE_STRING", 1)
+        .Add(ShaderMacro{"USE_D", "1 /* USE_COMMENT */"})
+        .Add(ShaderMacro{"USE_C", "\"USE_STRING\""});
+
+    const std::vector<std::string> Referenced = ShaderPermutationCompiler::FindReferencedMacros(Source, strlen(Source), Macros);
+    EXPECT_EQ(Referenced, (std::vector<std::string>{"USE_A", "USE_B", "SCALE", "USE_C", "USE_D", "SCALE_FACTOR"}));
+}
+
+TEST(ShaderPermutationCompilerTest, HasConditionalIncludes)
+{
+    auto HasConditionalIncludes = [](const char* Source) {
+        return ShaderPermutationCompiler::HasConditionalIncludes(Source, strlen(Source));
+    };
+
+    EXPECT_FALSE(HasConditionalIncludes(R"(
+#include "A.fxh"
+#define B 1
+#include "B.fxh"
+)"));
+
+    // Includes inside the include guard
+    EXPECT_FALSE(HasConditionalIncludes(R"(
+// Comment
+#ifndef _HEADER_FXH_
+#   define _HEADER_FXH_
+#   include "A.fxh"
+#   if USE_B
+        float B;
+#   endif
+#   include "C.fxh"
+#endif
+)"));
+
+    EXPECT_TRUE(HasConditionalIncludes(R"(
+#if USE_A
+#   include "A.fxh"
+#endif
+)"));
+
+    // The same file is included in both branches
+    EXPECT_TRUE(HasConditionalIncludes(R"(
+#ifdef USE_A
+#   define SCALE 1.0
+#else
+#   include "A.fxh"
+#endif
+#include "A.fxh"
+)"));
+
+    // Conditional include inside the include guard
+    EXPECT_TRUE(HasConditionalIncludes(R"(
+#ifndef _HEADER_FXH_
+#define _HEADER_FXH_
+#ifndef USE_A
+#    include "A.fxh"
+#endif
+#endif
+)"));
+
+    // Not an include guard: the block does not enclose the whole file
+    EXPECT_TRUE(HasConditionalIncludes(R"(
+#ifndef USE_A
+#define USE_A 0
+#include "A.fxh"
+#endif
+#include "B.fxh"
+)"));
+
+    // Directives in comments are ignored
+    EXPECT_FALSE(HasConditionalIncludes(R"(
+/*
+#if USE_A
+#   include "A.fxh"
+#endif
+*/
+// #if USE_B
+#include "B.fxh"
+)"));
+}
+
+} // namespace
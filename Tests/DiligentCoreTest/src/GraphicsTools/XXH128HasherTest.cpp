@@ -25,6 +25,7 @@
  */
 
 #include "XXH128Hasher.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
 #include "gtest/gtest.h"
 #include <memory>
 #include <unordered_set>
@@ -76,4 +77,96 @@ TEST(XXH128HasherTest, Struct)
     EXPECT_EQ(Hasher1.Digest(), Hasher2.Digest());
 }
 
+XXH128Hash HashShader(const ShaderCreateInfo& ShaderCI)
+{
+    XXH128State Hasher;
+    Hasher.Update(ShaderCI);
+    return Hasher.Digest();
+}
+
+TEST(XXH128HasherTest, ShaderSourceHashCache)
+{
+    constexpr char MainSource[] = R"(
+#include "Common.fxh"
+#include "Lighting.fxh"
+float4 main() : SV_Target { return GetColor(); }
+)";
+    constexpr char CommonSource[] = R"(
+#include "Structures.fxh"
+)";
+    constexpr char LightingSource[] = R"(
+#include "Structures.fxh"
+#include "Common.fxh"
+)";
+    constexpr char StructuresSource[]         = "float4 GetColor() { return float4(1.0, 0.0, 0.0, 1.0); }";
+    constexpr char ModifiedStructuresSource[] = "float4 GetColor() { return float4(0.0, 1.0, 0.0, 1.0); }";
+
+    auto pFactory = CreateMemoryShaderSourceFactory({
+        {"Main.psh", MainSource},
+        {"Common.fxh", CommonSource},
+        {"Lighting.fxh", LightingSource},
+        {"Structures.fxh", StructuresSource},
+    });
+    ASSERT_TRUE(pFactory);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_PIXEL;
+    ShaderCI.FilePath                   = "Main.psh";
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    InvalidateShaderSourceHashCache();
+    const ShaderSourceHashCacheStatistics Stats0 = GetShaderSourceHashCacheStatistics();
+
+    const XXH128Hash Hash1 = HashShader(ShaderCI);
+
+    const ShaderSourceHashCacheStatistics Stats1 = GetShaderSourceHashCacheStatistics();
+    EXPECT_EQ(Stats1.NumFilesRead - Stats0.NumFilesRead, 4u);
+    EXPECT_EQ(Stats1.NumCacheHits - Stats0.NumCacheHits, 0u);
+
+    // All files must be served from the cache
+    EXPECT_EQ(HashShader(ShaderCI), Hash1);
+
+    const ShaderSourceHashCacheStatistics Stats2 = GetShaderSourceHashCacheStatistics();
+    EXPECT_EQ(Stats2.NumFilesRead, Stats1.NumFilesRead);
+    EXPECT_EQ(Stats2.NumCacheHits - Stats1.NumCacheHits, 4u);
+    EXPECT_EQ(Stats2.BytesSaved - Stats1.BytesSaved, Stats1.BytesRead - Stats0.BytesRead);
+
+    // Inline source that includes the same files
+    {
+        ShaderCreateInfo InlineCI{ShaderCI};
+        InlineCI.FilePath = nullptr;
+        InlineCI.Source   = MainSource;
+        EXPECT_NE(HashShader(InlineCI), Hash1);
+
+        const ShaderSourceHashCacheStatistics Stats3 = GetShaderSourceHashCacheStatistics();
+        EXPECT_EQ(Stats3.NumFilesRead, Stats2.NumFilesRead);
+        EXPECT_EQ(Stats3.NumCacheHits - Stats2.NumCacheHits, 3u);
+    }
+
+    // A different factory must not reuse cached hashes
+    {
+        auto pModifiedFactory = CreateMemoryShaderSourceFactory({
+            {"Main.psh", MainSource},
+            {"Common.fxh", CommonSource},
+            {"Lighting.fxh", LightingSource},
+            {"Structures.fxh", ModifiedStructuresSource},
+        });
+        ASSERT_TRUE(pModifiedFactory);
+
+        ShaderCreateInfo ModifiedCI{ShaderCI};
+        ModifiedCI.pShaderSourceStreamFactory = pModifiedFactory;
+        EXPECT_NE(HashShader(ModifiedCI), Hash1);
+    }
+
+    // Invalidation must force the files to be read again
+    {
+        const ShaderSourceHashCacheStatistics Stats4 = GetShaderSourceHashCacheStatistics();
+        InvalidateShaderSourceHashCache();
+        EXPECT_EQ(HashShader(ShaderCI), Hash1);
+
+        const ShaderSourceHashCacheStatistics Stats5 = GetShaderSourceHashCacheStatistics();
+        EXPECT_EQ(Stats5.NumFilesRead - Stats4.NumFilesRead, 4u);
+    }
+}
+
 } // namespace
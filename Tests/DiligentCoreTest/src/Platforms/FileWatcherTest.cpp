@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FileWatcher.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void WriteFile(const std::string& Path, const char* Data)
+{
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File);
+    EXPECT_TRUE(File->Write(Data, strlen(Data)));
+}
+
+bool Contains(const std::vector<std::string>& Files, const std::string& Path)
+{
+    return std::find(Files.begin(), Files.end(), Path) != Files.end();
+}
+
+TEST(Platforms_FileWatcher, PollChanges)
+{
+    if (!FileWatcher::IsSupported())
+        GTEST_SKIP() << "File watching is not supported on this platform";
+
+    TempDirectory TmpDir;
+    const std::string& Dir    = TmpDir.Get();
+    const std::string  SubDir = Dir + "/SubDir";
+    ASSERT_TRUE(FileSystem::CreateDirectory(SubDir.c_str()));
+
+    const std::string File1 = Dir + "/File1.txt";
+    const std::string File2 = SubDir + "/File2.txt";
+    WriteFile(File1, "1");
+
+    FileWatcher Watcher;
+    ASSERT_TRUE(Watcher.AddDirectory(Dir.c_str()));
+    EXPECT_TRUE(Watcher.IsWatching());
+
+    std::vector<std::string> ChangedFiles;
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(ChangedFiles.empty());
+
+    WriteFile(File1, "11");
+    WriteFile(File2, "2");
+    WriteFile(File2, "22");
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_EQ(ChangedFiles.size(), size_t{2});
+    EXPECT_TRUE(Contains(ChangedFiles, File1));
+    EXPECT_TRUE(Contains(ChangedFiles, File2));
+
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(ChangedFiles.empty());
+
+    FileSystem::DeleteFile(File1.c_str());
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    ASSERT_EQ(ChangedFiles.size(), size_t{1});
+    EXPECT_EQ(ChangedFiles[0], File1);
+
+    // Changes in a new directory can't be tracked reliably
+    const std::string NewDir = Dir + "/NewDir";
+    ASSERT_TRUE(FileSystem::CreateDirectory(NewDir.c_str()));
+    EXPECT_FALSE(Watcher.PollChanges(ChangedFiles));
+
+    // The new directory is watched from now on
+    const std::string File3 = NewDir + "/File3.txt";
+    WriteFile(File3, "3");
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    ASSERT_EQ(ChangedFiles.size(), size_t{1});
+    EXPECT_EQ(ChangedFiles[0], File3);
+}
+
+} // namespace
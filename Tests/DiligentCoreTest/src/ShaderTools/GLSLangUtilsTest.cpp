@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GLSLangUtils.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+struct CompileJob
+{
+    const char*            FilePath;
+    SHADER_TYPE            ShaderType;
+    SHADER_SOURCE_LANGUAGE SourceLang;
+    std::string            Source;
+};
+
+// Every generated shader has a different number of functions with different constants,
+// so that all shaders compile to different byte code.
+std::string GenerateShaderSource(Uint32 Idx)
+{
+    const Uint32 NumFunctions = 4 + Idx;
+
+    std::string Source = "cbuffer cbConstants\n{\n    float4 g_Data[16];\n};\n\n"
+                         "Texture2D    g_Texture;\n"
+                         "SamplerState g_Texture_sampler;\n\n";
+    for (Uint32 f = 0; f < NumFunctions; ++f)
+    {
+        Source += "float4 Func" + std::to_string(f) + "(float4 Color)\n{\n";
+        Source += "    return Color * " + std::to_string(Idx + f + 1) + ".0 + g_Data[" + std::to_string((f * 7 + Idx) % 16) + "];\n}\n\n";
+    }
+    Source += "float4 main(in float4 Pos : SV_Position) : SV_Target\n{\n"
+              "    float4 Color = g_Texture.Sample(g_Texture_sampler, Pos.xy);\n";
+    for (Uint32 f = 0; f < NumFunctions; ++f)
+        Source += "    Color = Func" + std::to_string(f) + "(Color);\n";
+    Source += "    return Color;\n}\n";
+
+    return Source;
+}
+
+std::vector<uint32_t> CompileJobToSPIRV(const CompileJob& Job, IShaderSourceInputStreamFactory* pShaderSourceStreamFactory)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = Job.SourceLang;
+    ShaderCI.Desc                       = {"GLSLang parallel compilation test", Job.ShaderType};
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+    if (!Job.Source.empty())
+    {
+        ShaderCI.Source       = Job.Source.c_str();
+        ShaderCI.SourceLength = Job.Source.length();
+    }
+    else
+    {
+        ShaderCI.FilePath = Job.FilePath;
+    }
+
+    if (Job.SourceLang == SHADER_SOURCE_LANGUAGE_HLSL)
+        return GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+
+    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType                 = Job.ShaderType;
+    Attribs.ShaderSource               = SourceData.Source;
+    Attribs.SourceCodeLen              = static_cast<int>(SourceData.SourceLength);
+    Attribs.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+    return GLSLangUtils::GLSLtoSPIRV(Attribs);
+}
+
+// Compiles the same shaders from several threads at once and checks that
+// the results match the single-threaded compilation.
+TEST(GLSLangUtils, ParallelCompilation)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    ASSERT_NE(pShaderSourceStreamFactory, nullptr);
+
+    constexpr Uint32 NumGeneratedShaders = 16;
+
+    std::vector<CompileJob> Jobs;
+    Jobs.push_back({"Resources.psh", SHADER_TYPE_PIXEL, SHADER_SOURCE_LANGUAGE_HLSL, {}});
+    Jobs.push_back({"VertexInputs.vsh", SHADER_TYPE_VERTEX, SHADER_SOURCE_LANGUAGE_HLSL, {}});
+    Jobs.push_back({"Compute.csh", SHADER_TYPE_COMPUTE, SHADER_SOURCE_LANGUAGE_GLSL, {}});
+    for (Uint32 i = 0; i < NumGeneratedShaders; ++i)
+        Jobs.push_back({"Generated.psh", SHADER_TYPE_PIXEL, SHADER_SOURCE_LANGUAGE_HLSL, GenerateShaderSource(i)});
+
+    GLSLangUtils::InitializeGlslang();
+
+    std::vector<std::vector<uint32_t>> RefSPIRV;
+    for (const CompileJob& Job : Jobs)
+    {
+        RefSPIRV.emplace_back(CompileJobToSPIRV(Job, pShaderSourceStreamFactory));
+        ASSERT_FALSE(RefSPIRV.back().empty()) << Job.FilePath;
+    }
+    for (size_t i = 1; i < Jobs.size(); ++i)
+        EXPECT_NE(RefSPIRV[i], RefSPIRV[i - 1]) << "Shaders " << i - 1 << " and " << i << " must compile to different byte code";
+
+    // Every shader is compiled by several threads, so that a thread picks up
+    // a different shader than the one the previous thread compiled.
+    constexpr size_t NumRepetitions = 4;
+
+    const size_t NumThreads = std::max(std::min(size_t{std::thread::hardware_concurrency()}, size_t{8}), size_t{4});
+
+    std::vector<std::vector<uint32_t>> SPIRV(Jobs.size() * NumRepetitions);
+    std::atomic<size_t>                NextJob{0};
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&]() {
+            for (size_t Idx = NextJob.fetch_add(1); Idx < SPIRV.size(); Idx = NextJob.fetch_add(1))
+                SPIRV[Idx] = CompileJobToSPIRV(Jobs[Idx % Jobs.size()], pShaderSourceStreamFactory);
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    for (size_t i = 0; i < SPIRV.size(); ++i)
+        EXPECT_EQ(SPIRV[i], RefSPIRV[i % Jobs.size()]) << "Shader " << i % Jobs.size() << " (" << Jobs[i % Jobs.size()].FilePath << ")";
+
+    GLSLangUtils::FinalizeGlslang();
+}
+
+} // namespace
@@ -0,0 +1,252 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "EngineMemory.h"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::vector<uint32_t> CompileToSPIRV(const char*                FilePath,
+                                     SHADER_TYPE                ShaderType,
+                                     SHADER_SOURCE_LANGUAGE     SourceLang,
+                                     GLSLangUtils::SpirvVersion Version)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    if (!pShaderSourceStreamFactory)
+        return {};
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SourceLang;
+    ShaderCI.FilePath                   = FilePath;
+    ShaderCI.Desc                       = {"SPIRV resources test", ShaderType};
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+
+    std::vector<uint32_t> SPIRV;
+
+    GLSLangUtils::InitializeGlslang();
+    if (SourceLang == SHADER_SOURCE_LANGUAGE_HLSL)
+    {
+        SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, Version, nullptr, nullptr);
+    }
+    else
+    {
+        const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+
+        GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+        Attribs.ShaderType                 = ShaderType;
+        Attribs.ShaderSource               = SourceData.Source;
+        Attribs.SourceCodeLen              = static_cast<int>(SourceData.SourceLength);
+        Attribs.Version                    = Version;
+        Attribs.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+
+        SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+    }
+    GLSLangUtils::FinalizeGlslang();
+
+    return SPIRV;
+}
+
+std::unique_ptr<SPIRVShaderResources> CreateResources(const std::vector<uint32_t>& SPIRV,
+                                                      SHADER_TYPE                  ShaderType,
+                                                      bool                         ForceSPIRVCross,
+                                                      std::string&                 EntryPoint)
+{
+    const ShaderDesc Desc{"SPIRV resources test", ShaderType};
+    return std::make_unique<SPIRVShaderResources>(
+        GetRawAllocator(),
+        SPIRV,
+        Desc,
+        "_sampler", // CombinedSamplerSuffix
+        ShaderType == SHADER_TYPE_VERTEX,
+        false, // LoadUniformBufferReflection
+        EntryPoint,
+        ForceSPIRVCross);
+}
+
+std::unique_ptr<SPIRVShaderResources> LoadSerializedResources(const void*  pData,
+                                                              size_t       DataSize,
+                                                              size_t       SPIRVWordCount,
+                                                              SHADER_TYPE  ShaderType,
+                                                              std::string& EntryPoint)
+{
+    const ShaderDesc Desc{"SPIRV resources test", ShaderType};
+    return std::make_unique<SPIRVShaderResources>(
+        GetRawAllocator(),
+        pData,
+        DataSize,
+        SPIRVWordCount,
+        Desc,
+        "_sampler", // CombinedSamplerSuffix
+        EntryPoint);
+}
+
+void CompareSPIRVResources(const SPIRVShaderResources& Res, const SPIRVShaderResources& Ref)
+{
+    EXPECT_EQ(Res.IsHLSLSource(), Ref.IsHLSLSource());
+    EXPECT_STREQ(Res.GetCombinedSamplerSuffix(), Ref.GetCombinedSamplerSuffix());
+    EXPECT_STREQ(Res.GetShaderName(), Ref.GetShaderName());
+    EXPECT_EQ(Res.GetComputeGroupSize(), Ref.GetComputeGroupSize());
+
+    // clang-format off
+    EXPECT_EQ(Res.GetNumUBs(),          Ref.GetNumUBs());
+    EXPECT_EQ(Res.GetNumSBs(),          Ref.GetNumSBs());
+    EXPECT_EQ(Res.GetNumImgs(),         Ref.GetNumImgs());
+    EXPECT_EQ(Res.GetNumSmpldImgs(),    Ref.GetNumSmpldImgs());
+    EXPECT_EQ(Res.GetNumACs(),          Ref.GetNumACs());
+    EXPECT_EQ(Res.GetNumSepSmplrs(),    Ref.GetNumSepSmplrs());
+    EXPECT_EQ(Res.GetNumSepImgs(),      Ref.GetNumSepImgs());
+    EXPECT_EQ(Res.GetNumInptAtts(),     Ref.GetNumInptAtts());
+    EXPECT_EQ(Res.GetNumAccelStructs(), Ref.GetNumAccelStructs());
+    // clang-format on
+    ASSERT_EQ(Res.GetTotalResources(), Ref.GetTotalResources());
+
+    for (Uint32 i = 0; i < Res.GetTotalResources(); ++i)
+    {
+        const SPIRVShaderResourceAttribs& Attribs    = Res.GetResource(i);
+        const SPIRVShaderResourceAttribs& RefAttribs = Ref.GetResource(i);
+        EXPECT_STREQ(Attribs.Name, RefAttribs.Name);
+        EXPECT_EQ(Attribs.Type, RefAttribs.Type) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.ArraySize, RefAttribs.ArraySize) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.GetResourceDimension(), RefAttribs.GetResourceDimension()) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.IsMultisample(), RefAttribs.IsMultisample()) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.BindingDecorationOffset, RefAttribs.BindingDecorationOffset) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.DescriptorSetDecorationOffset, RefAttribs.DescriptorSetDecorationOffset) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.BufferStaticSize, RefAttribs.BufferStaticSize) << RefAttribs.Name;
+        EXPECT_EQ(Attribs.BufferStride, RefAttribs.BufferStride) << RefAttribs.Name;
+    }
+
+    ASSERT_EQ(Res.GetNumShaderStageInputs(), Ref.GetNumShaderStageInputs());
+    for (Uint32 i = 0; i < Res.GetNumShaderStageInputs(); ++i)
+    {
+        const SPIRVShaderStageInputAttribs& Input    = Res.GetShaderStageInputAttribs(i);
+        const SPIRVShaderStageInputAttribs& RefInput = Ref.GetShaderStageInputAttribs(i);
+        EXPECT_STREQ(Input.Semantic, RefInput.Semantic);
+        EXPECT_EQ(Input.LocationDecorationOffset, RefInput.LocationDecorationOffset) << RefInput.Semantic;
+    }
+}
+
+// Verifies that resources reflected by SPIRVReflection are identical to the ones reflected by SPIRV-Cross
+void TestSPIRVResources(const char*                FilePath,
+                        SHADER_TYPE                ShaderType,
+                        SHADER_SOURCE_LANGUAGE     SourceLang,
+                        GLSLangUtils::SpirvVersion Version,
+                        Uint32                     RefTotalResources)
+{
+    const std::vector<uint32_t> SPIRV = CompileToSPIRV(FilePath, ShaderType, SourceLang, Version);
+    ASSERT_FALSE(SPIRV.empty());
+
+    std::string                           RefEntryPoint;
+    std::unique_ptr<SPIRVShaderResources> pRefResources = CreateResources(SPIRV, ShaderType, true, RefEntryPoint);
+    ASSERT_NE(pRefResources, nullptr);
+
+    std::string                           EntryPoint;
+    std::unique_ptr<SPIRVShaderResources> pResources = CreateResources(SPIRV, ShaderType, false, EntryPoint);
+    ASSERT_NE(pResources, nullptr);
+    LOG_INFO_MESSAGE("SPIRV Resources:\n", pResources->DumpResources());
+
+    const SPIRVShaderResources& Ref = *pRefResources;
+    const SPIRVShaderResources& Res = *pResources;
+
+    EXPECT_EQ(EntryPoint, RefEntryPoint);
+    EXPECT_EQ(Res.GetTotalResources(), RefTotalResources);
+    CompareSPIRVResources(Res, Ref);
+
+    // Resources loaded from the serialized data must be identical to the reflected ones
+    std::vector<uint32_t> Bytecode = SPIRV;
+    Res.AppendToBytecode(Bytecode, EntryPoint);
+
+    size_t      SPIRVSize        = 0;
+    const void* pResourceData    = nullptr;
+    size_t      ResourceDataSize = 0;
+    ASSERT_TRUE(SPIRVShaderResources::SplitBytecode(Bytecode.data(), Bytecode.size() * sizeof(Bytecode[0]), SPIRVSize, pResourceData, ResourceDataSize));
+    EXPECT_EQ(SPIRVSize, SPIRV.size() * sizeof(SPIRV[0]));
+    EXPECT_FALSE(SPIRVShaderResources::SplitBytecode(SPIRV.data(), SPIRV.size() * sizeof(SPIRV[0]), SPIRVSize, pResourceData, ResourceDataSize));
+    EXPECT_EQ(SPIRVSize, SPIRV.size() * sizeof(SPIRV[0]));
+    EXPECT_EQ(pResourceData, nullptr);
+    ASSERT_TRUE(SPIRVShaderResources::SplitBytecode(Bytecode.data(), Bytecode.size() * sizeof(Bytecode[0]), SPIRVSize, pResourceData, ResourceDataSize));
+
+    {
+        std::string                           SerializedEntryPoint;
+        std::unique_ptr<SPIRVShaderResources> pSerializedResources = LoadSerializedResources(pResourceData, ResourceDataSize, SPIRV.size(), ShaderType, SerializedEntryPoint);
+        ASSERT_NE(pSerializedResources, nullptr);
+        EXPECT_EQ(SerializedEntryPoint, EntryPoint);
+        CompareSPIRVResources(*pSerializedResources, Ref);
+    }
+
+    // Resources whose decoration offsets are outside of the SPIRV must be rejected,
+    // since the offsets are used to patch the byte code.
+    if (Ref.GetTotalResources() > 0 || Ref.GetNumShaderStageInputs() > 0)
+    {
+        uint32_t MaxOffset = 0;
+        for (Uint32 i = 0; i < Ref.GetTotalResources(); ++i)
+            MaxOffset = std::max({MaxOffset, Ref.GetResource(i).BindingDecorationOffset, Ref.GetResource(i).DescriptorSetDecorationOffset});
+        for (Uint32 i = 0; i < Ref.GetNumShaderStageInputs(); ++i)
+            MaxOffset = std::max(MaxOffset, Ref.GetShaderStageInputAttribs(i).LocationDecorationOffset);
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"are invalid or corrupted"};
+
+        std::string SerializedEntryPoint;
+        EXPECT_THROW(LoadSerializedResources(pResourceData, ResourceDataSize, MaxOffset, ShaderType, SerializedEntryPoint), std::runtime_error);
+    }
+}
+
+TEST(SPIRVShaderResources, HLSLResources)
+{
+    TestSPIRVResources("Resources.psh", SHADER_TYPE_PIXEL, SHADER_SOURCE_LANGUAGE_HLSL, GLSLangUtils::SpirvVersion::Vk100, 14);
+}
+
+TEST(SPIRVShaderResources, HLSLVertexInputs)
+{
+    TestSPIRVResources("VertexInputs.vsh", SHADER_TYPE_VERTEX, SHADER_SOURCE_LANGUAGE_HLSL, GLSLangUtils::SpirvVersion::Vk100, 1);
+}
+
+TEST(SPIRVShaderResources, GLSLCompute)
+{
+    TestSPIRVResources("Compute.csh", SHADER_TYPE_COMPUTE, SHADER_SOURCE_LANGUAGE_GLSL, GLSLangUtils::SpirvVersion::Vk100, 6);
+}
+
+TEST(SPIRVShaderResources, GLSLComputeSpirv15)
+{
+    // In SPIR-V 1.4+, all global variables are listed in the entry point interface
+    TestSPIRVResources("Compute.csh", SHADER_TYPE_COMPUTE, SHADER_SOURCE_LANGUAGE_GLSL, GLSLangUtils::SpirvVersion::Vk120, 6);
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+
+#include "SPIRVTools.hpp"
+#include "GLSLangUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(SPIRVTools, OptimizationCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    ASSERT_TRUE(pShaderSourceStreamFactory);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.FilePath                   = "VertexInputs.vsh";
+    ShaderCI.Desc                       = {"SPIRV tools test", SHADER_TYPE_VERTEX};
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+
+    GLSLangUtils::InitializeGlslang();
+    const std::vector<uint32_t> SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    GLSLangUtils::FinalizeGlslang();
+    ASSERT_FALSE(SPIRV.empty());
+
+    SPIRVOptimizationStatistics StartStats;
+    GetSPIRVOptimizationStatistics(StartStats);
+
+    const std::vector<uint32_t> RefSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION);
+    ASSERT_FALSE(RefSPIRV.empty());
+    EXPECT_LT(RefSPIRV.size(), SPIRV.size());
+
+    constexpr size_t NumThreads    = 4;
+    constexpr size_t NumIterations = 16;
+
+    std::vector<std::thread> Threads;
+    std::vector<bool>        Mismatch(NumThreads);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < NumIterations; ++i)
+            {
+                if (OptimizeSPIRV(SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION) != RefSPIRV)
+                    Mismatch[t] = true;
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    for (size_t t = 0; t < NumThreads; ++t)
+        EXPECT_FALSE(Mismatch[t]) << "Thread " << t;
+
+    SPIRVOptimizationStatistics Stats;
+    GetSPIRVOptimizationStatistics(Stats);
+    // The first request may have been served from the cache if the test is repeated
+    EXPECT_LE(Stats.NumOptimizations - StartStats.NumOptimizations, 1u);
+    EXPECT_GE(Stats.NumCacheHits - StartStats.NumCacheHits, NumThreads * NumIterations);
+    EXPECT_GT(Stats.CacheSize, size_t{0});
+
+    // A different pass list must not use the cached result
+    const std::vector<uint32_t> OptimizedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+    EXPECT_FALSE(OptimizedSPIRV.empty());
+    EXPECT_NE(OptimizedSPIRV, RefSPIRV);
+}
+
+} // namespace
@@ -25,9 +25,13 @@
  */
 
 #include <deque>
+#include <vector>
+#include <string>
 
 #include "ShaderToolsCommon.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ParsingTools.hpp"
 #include "RenderDevice.h"
 #include "TestingEnvironment.hpp"
 
@@ -194,6 +198,109 @@ TEST(ShaderPreprocessTest, UnrollIncludes)
     }
 }
 
+TEST(ShaderPreprocessTest, UnrollIncludesGraph)
+{
+    // Each file includes up to four children and its sibling, so that
+    // most files are referenced more than once and must only be pasted once.
+    constexpr size_t NumFiles    = 64;
+    constexpr size_t NumBodyRows = 4;
+
+    std::vector<std::string> Names(NumFiles);
+    for (size_t i = 0; i < NumFiles; ++i)
+        Names[i] = "File" + std::to_string(i) + ".fxh";
+
+    const auto GetChildren = [NumFiles](size_t i) {
+        std::vector<size_t> Children;
+        for (size_t Child : {i * 4 + 1, i * 4 + 2, i * 4 + 3, i * 4 + 4, i + 1})
+        {
+            if (Child < NumFiles)
+                Children.push_back(Child);
+        }
+        return Children;
+    };
+
+    const auto GetDefine = [](size_t i) {
+        return "#define FILE" + std::to_string(i) + "_INCLUDED 1\n";
+    };
+
+    std::vector<std::string> Sources(NumFiles);
+    size_t                   RefUnrolledSize = 0;
+    for (size_t i = 0; i < NumFiles; ++i)
+    {
+        std::string& Source = Sources[i];
+        Source += "/* " + Names[i] + "\n * #include \"NotAFile.fxh\"\n */\n";
+        size_t IncludesSize = 0;
+        for (size_t Child : GetChildren(i))
+        {
+            const std::string Include = "#include \"" + Names[Child] + "\"";
+            Source += Include + "\n";
+            IncludesSize += Include.length();
+        }
+        Source += GetDefine(i);
+        for (size_t Row = 0; Row < NumBodyRows; ++Row)
+        {
+            Source += "float4 Func" + std::to_string(Row) + "(float4 a, float4 b) // Divide a by b\n";
+            Source += "{\n";
+            Source += "    return a / b; /* Single-line block comment */\n";
+            Source += "}\n";
+        }
+        RefUnrolledSize += Source.length() - IncludesSize;
+    }
+
+    std::vector<MemoryShaderSourceFileInfo> Files(NumFiles);
+    for (size_t i = 0; i < NumFiles; ++i)
+        Files[i] = {Names[i].c_str(), Sources[i]};
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory =
+        CreateMemoryShaderSourceFactory(MemoryShaderSourceFactoryCreateInfo{Files.data(), static_cast<Uint32>(Files.size())});
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.Name                  = "UnrollIncludesGraph";
+    ShaderCI.FilePath                   = Names[0].c_str();
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    const std::string Unrolled = UnrollShaderIncludes(ShaderCI);
+    // Every file is pasted exactly once, and only the includes are removed
+    EXPECT_EQ(Unrolled.length(), RefUnrolledSize);
+    EXPECT_EQ(Unrolled.find("#include \"File"), std::string::npos);
+    EXPECT_NE(Unrolled.find("#include \"NotAFile.fxh\""), std::string::npos) << "Includes in comments must be kept";
+
+    std::vector<size_t> DefinePos(NumFiles);
+    for (size_t i = 0; i < NumFiles; ++i)
+    {
+        const std::string Define = GetDefine(i);
+        DefinePos[i]             = Unrolled.find(Define);
+        ASSERT_NE(DefinePos[i], std::string::npos) << Names[i] << " is missing";
+        EXPECT_EQ(Unrolled.find(Define, DefinePos[i] + 1), std::string::npos) << Names[i] << " is pasted more than once";
+    }
+
+    // Included files are pasted before the files that include them
+    for (size_t i = 0; i < NumFiles; ++i)
+    {
+        for (size_t Child : GetChildren(i))
+            EXPECT_LT(DefinePos[Child], DefinePos[i]) << Names[Child] << " must precede " << Names[i];
+    }
+
+    // The vectorized scanner finds the same '#' characters as the
+    // character-by-character loop that FindIncludes used before
+    const char* const pStart = Unrolled.c_str();
+    const char* const pEnd   = pStart + Unrolled.length();
+
+    std::vector<const char*> Hashes;
+    for (const char* Pos = pStart; (Pos = Parsing::FindNextHash(Pos, pEnd)) != pEnd; ++Pos)
+        Hashes.push_back(Pos);
+
+    std::vector<const char*> RefHashes;
+    for (const char* Pos = pStart; (Pos = Parsing::SkipDelimitersAndComments(Pos, pEnd)) != pEnd; ++Pos)
+    {
+        if (*Pos == '#')
+            RefHashes.push_back(Pos);
+    }
+    EXPECT_EQ(Hashes.size(), NumFiles);
+    EXPECT_EQ(Hashes, RefHashes);
+}
+
 TEST(ShaderPreprocessTest, ShaderSourceLanguageDefiniton)
 {
     EXPECT_EQ(ParseShaderSourceLanguageDefinition(""), SHADER_SOURCE_LANGUAGE_DEFAULT);
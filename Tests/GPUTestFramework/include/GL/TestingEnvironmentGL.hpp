@@ -66,10 +66,15 @@ public:
 
     GLuint GetDummyVAO() { return m_DummyVAO; }
 
+    // Returns the dynamic heap size requested with the --gl_dynamic_heap_size command line option
+    Uint32 GetDynamicHeapSize() const { return m_DynamicHeapSize; }
+
     virtual void Reset() override final;
 
 private:
     GLuint m_DummyVAO = 0;
+
+    const Uint32 m_DynamicHeapSize;
 };
 
 } // namespace Testing
@@ -60,6 +60,15 @@ public:
         Uint32             NumDeferredContexts    = 4;
         bool               EnableDeviceSimulation = false;
 
+        // Size of the OpenGL dynamic heap, see EngineGLCreateInfo::DynamicHeapSize.
+        Uint32 GLDynamicHeapSize = 0;
+
+        // Whether to use the Vulkan submission thread, see EngineVkCreateInfo::EnableSubmissionThread.
+        bool VkSubmissionThread = false;
+
+        // Whether to defragment Vulkan device memory, see EngineVkCreateInfo::EnableMemoryDefragmentation.
+        bool VkMemoryDefragmentation = false;
+
         DeviceFeatures   Features{DEVICE_FEATURE_STATE_OPTIONAL};
         DeviceFeaturesVk FeaturesVk{DEVICE_FEATURE_STATE_OPTIONAL};
 
@@ -90,6 +90,12 @@ public:
 
     virtual bool SupportsRayTracing() const override final;
 
+    // Returns true if the submission thread was requested with the --vk_submission_thread command line option
+    bool IsSubmissionThreadEnabled() const { return m_SubmissionThreadEnabled; }
+
+    // Returns true if memory defragmentation was requested with the --vk_memory_defragmentation command line option
+    bool IsMemoryDefragmentationEnabled() const { return m_MemoryDefragmentationEnabled; }
+
     VkShaderModule CreateShaderModule(const SHADER_TYPE ShaderType, const std::string& ShaderSource);
 
     static VkRenderPassCreateInfo GetRenderPassCreateInfo(
@@ -126,6 +132,9 @@ private:
 
     VkPhysicalDeviceMemoryProperties m_MemoryProperties = {};
 
+    const bool m_SubmissionThreadEnabled;
+    const bool m_MemoryDefragmentationEnabled;
+
 public:
     VkPhysicalDeviceDescriptorIndexingFeaturesEXT DescriptorIndexing = {};
     VkPhysicalDeviceProperties                    DeviceProps        = {};
@@ -40,7 +40,8 @@ void CreateTestingSwapChainGL(IRenderDevice*       pDevice,
 
 TestingEnvironmentGL::TestingEnvironmentGL(const CreateInfo&    CI,
                                            const SwapChainDesc& SCDesc) :
-    GPUTestingEnvironment{CI, SCDesc}
+    GPUTestingEnvironment{CI, SCDesc},
+    m_DynamicHeapSize{CI.GLDynamicHeapSize}
 {
 
 #ifndef PLATFORM_WEB
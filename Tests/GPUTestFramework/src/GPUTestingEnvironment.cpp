@@ -366,9 +366,11 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             // Always enable validation
             EngineCI.SetValidationLevel(VALIDATION_LEVEL_1);
 
-            EngineCI.Window   = Window;
-            EngineCI.Features = EnvCI.Features;
-            NumDeferredCtx    = 0;
+            EngineCI.Window              = Window;
+            EngineCI.Features            = EnvCI.Features;
+            EngineCI.DynamicHeapSize     = EnvCI.GLDynamicHeapSize;
+            NumDeferredCtx               = EnvCI.NumDeferredContexts;
+            EngineCI.NumDeferredContexts = NumDeferredCtx / 2;
             ppContexts.resize(std::max(size_t{1}, ContextCI.size()) + NumDeferredCtx);
             RefCntAutoPtr<ISwapChain> pSwapChain; // We will use testing swap chain instead
             pFactoryOpenGL->CreateDeviceAndSwapChainGL(
@@ -414,6 +416,11 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             AddContext(COMMAND_QUEUE_TYPE_COMPUTE, "Compute", EngineCI.AdapterId);
             AddContext(COMMAND_QUEUE_TYPE_TRANSFER, "Transfer", EngineCI.AdapterId);
             AddContext(COMMAND_QUEUE_TYPE_GRAPHICS, "Graphics 2", EngineCI.AdapterId);
+            if (EnvCI.VkMemoryDefragmentation && ContextCI.size() > 1)
+            {
+                // Memory defragmentation requires a single immediate context
+                ContextCI.resize(1);
+            }
 
             // Always enable validation
             EngineCI.SetValidationLevel(VALIDATION_LEVEL_1);
@@ -425,10 +432,12 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             EngineCI.UploadHeapPageSize        = 32 * 1024;
             //EngineCI.DeviceLocalMemoryReserveSize = 32 << 20;
             //EngineCI.HostVisibleMemoryReserveSize = 48 << 20;
-            EngineCI.Features                  = EnvCI.Features;
-            EngineCI.FeaturesVk                = EnvCI.FeaturesVk;
-            EngineCI.IgnoreDebugMessageCount   = static_cast<Uint32>(IgnoreDebugMessages.size());
-            EngineCI.ppIgnoreDebugMessageNames = IgnoreDebugMessages.data();
+            EngineCI.Features                    = EnvCI.Features;
+            EngineCI.FeaturesVk                  = EnvCI.FeaturesVk;
+            EngineCI.IgnoreDebugMessageCount     = static_cast<Uint32>(IgnoreDebugMessages.size());
+            EngineCI.ppIgnoreDebugMessageNames   = IgnoreDebugMessages.data();
+            EngineCI.EnableSubmissionThread      = EnvCI.VkSubmissionThread;
+            EngineCI.EnableMemoryDefragmentation = EnvCI.VkMemoryDefragmentation;
 
             NumDeferredCtx               = EnvCI.NumDeferredContexts;
             EngineCI.NumDeferredContexts = NumDeferredCtx / 2;
@@ -675,6 +684,13 @@ GPUTestingEnvironment::~GPUTestingEnvironment()
                 "\n    GenerateMips              ", CmdCounters.GenerateMips,
                 "\n    ResolveTextureSubresource ", CmdCounters.ResolveTextureSubresource,
                 "\n    BindSparseResourceMemory  ", CmdCounters.BindSparseResourceMemory,
+                "\n  Binding counters",
+                "\n    Filtered                  ", Stats.BindingCounters.Filtered,
+                "\n    Changed                   ", Stats.BindingCounters.Changed,
+                "\n    API calls                 ", Stats.BindingCounters.ApiCalls,
+                "\n  Command buffer counters",
+                "\n    Allocated                 ", Stats.CommandBufferCounters.Allocated,
+                "\n    Reused                    ", Stats.CommandBufferCounters.Reused,
                 "\n  Primitives",
                 "\n    TRIANGLE_LIST             ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_LIST],
                 "\n    TRIANGLE_STRIP            ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP],
@@ -931,7 +947,8 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
     SHADER_COMPILER                   ShCompiler = SHADER_COMPILER_DEFAULT;
     for (int i = 1; i < argc; ++i)
     {
-        const std::string AdapterArgName = "--adapter=";
+        const std::string AdapterArgName       = "--adapter=";
+        const std::string GLDynamicHeapArgName = "--gl_dynamic_heap_size=";
 
         const char* arg = argv[i];
         if (strcmp(arg, "--mode=d3d11") == 0)
@@ -997,6 +1014,18 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.EnableDeviceSimulation = true;
         }
+        else if (strcmp(arg, "--vk_submission_thread") == 0)
+        {
+            TestEnvCI.VkSubmissionThread = true;
+        }
+        else if (strcmp(arg, "--vk_memory_defragmentation") == 0)
+        {
+            TestEnvCI.VkMemoryDefragmentation = true;
+        }
+        else if (GLDynamicHeapArgName.compare(0, GLDynamicHeapArgName.length(), arg, GLDynamicHeapArgName.length()) == 0)
+        {
+            TestEnvCI.GLDynamicHeapSize = static_cast<Uint32>(atoi(arg + GLDynamicHeapArgName.length()));
+        }
         else if (ParseFeatureState(arg, TestEnvCI.Features, TestEnvCI.FeaturesVk))
         {
             // Feature state has been updated by ParseFeatureState
@@ -47,7 +47,9 @@ void CreateTestingSwapChainVk(TestingEnvironmentVk* pEnv,
 
 TestingEnvironmentVk::TestingEnvironmentVk(const CreateInfo&    CI,
                                            const SwapChainDesc& SCDesc) :
-    GPUTestingEnvironment{CI, SCDesc}
+    GPUTestingEnvironment{CI, SCDesc},
+    m_SubmissionThreadEnabled{CI.VkSubmissionThread},
+    m_MemoryDefragmentationEnabled{CI.VkMemoryDefragmentation}
 {
 #if !DILIGENT_NO_GLSLANG
     GLSLangUtils::InitializeGlslang();
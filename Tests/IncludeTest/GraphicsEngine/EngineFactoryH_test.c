@@ -47,4 +47,8 @@ void TestEngineFactortCInterface(struct IEngineFactory* pFactory)
     (void)pDearchiver;
 
     IEngineFactory_SetMessageCallback(pFactory, (DebugMessageCallbackType)NULL);
+
+    MemoryCategoryStatistics MemStats;
+    IEngineFactory_GetMemoryStatistics(pFactory, MEMORY_CATEGORY_OBJECT_POOLS, &MemStats);
+    IEngineFactory_ResetMemoryStatistics(pFactory);
 }
@@ -30,6 +30,8 @@ void TestBytecodeCacheCInterface()
 {
     BytecodeCacheCreateInfo CI;
     CI.DeviceType = RENDER_DEVICE_TYPE_D3D11;
+    CI.FilePath   = NULL;
+    CI.MaxSize    = 0;
 
     IBytecodeCache* pCache = NULL;
     Diligent_CreateBytecodeCache(&CI, &pCache);